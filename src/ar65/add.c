@@ -51,8 +51,6 @@
 void AddObjFiles (int argc, char* argv [])
 /* Add object files to a library */
 {
-    int I;
-
     /* Check the argument count */
     if (argc <= 0) {
         Error ("No library name given");
@@ -65,11 +63,7 @@ void AddObjFiles (int argc, char* argv [])
     LibOpen (argv [0], 0, 1);
 
     /* Add the object files */
-    I = 1;
-    while (I < argc) {
-        ObjAdd (argv [I]);
-        ++I;
-    }
+    ObjAddFiles (argc - 1, &argv [1]);
 
     /* Create a new library file and close the old one */
     LibClose ();
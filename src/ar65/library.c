@@ -34,12 +34,14 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
 /* common */
 #include "cmdline.h"
 #include "exprdefs.h"
+#include "hashfunc.h"
 #include "libdefs.h"
 #include "print.h"
 #include "symdefs.h"
@@ -70,6 +72,20 @@ static char*            NewLibName = 0;
 static FILE*            Lib = 0;
 static FILE*            NewLib = 0;
 
+/* True if an existing library is updated in place. New module data and the
+** new index are appended to the library, replaced and deleted modules remain
+** in the file as dead space.
+*/
+static int              InPlace = 0;
+
+/* True if modules were added or deleted, so the library must be written */
+static int              Changed = 0;
+
+/* If the dead space in a library that is updated in place exceeds this
+** percentage of the live data, the library is compacted.
+*/
+#define MAX_DEAD_PERCENT        25
+
 /* The library header */
 static LibHeader        Header = {
     LIB_MAGIC,
@@ -123,10 +139,102 @@ static void ReadIndexEntry (void)
 
 
 
+static int ReadExportTable (void)
+/* Read the export table that may follow the index and use it to set the
+** export lists of all modules. Return false if the library has no valid
+** export table.
+*/
+{
+    unsigned char   Buf[8];
+    unsigned char*  T;
+    unsigned long   Pos, Size, Fixed, Count, I;
+    long            End;
+
+    /* Libraries written by older versions of ar65 end after the index */
+    Pos = ftell (Lib);
+    if (fread (Buf, 1, sizeof (Buf), Lib) != sizeof (Buf) ||
+        GetExpTab32 (Buf) != LIB_EXP_MAGIC) {
+        return 0;
+    }
+    Size = GetExpTab32 (Buf + 4);
+    if (fseek (Lib, 0, SEEK_END) != 0 || (End = ftell (Lib)) < 0 ||
+        (unsigned long) End - Pos - sizeof (Buf) < Size || Size < 8) {
+        return 0;
+    }
+
+    /* Read the table */
+    T = xmalloc (Size);
+    fseek (Lib, Pos + sizeof (Buf), SEEK_SET);
+    ReadData (Lib, T, Size);
+
+    /* Check it */
+    if (!CheckExpTab (T, Size, CollCount (&ObjPool))) {
+        xfree (T);
+        return 0;
+    }
+    Fixed = (GetExpTab32 (T) + 2) * 4;
+    Count = GetExpTab32 (T + Fixed - 4);
+
+    /* Add the names to the modules */
+    for (I = 0; I < Count; ++I) {
+        ObjData* O = CollAtUnchecked (&ObjPool, GetExpTab32 (T + Fixed + I * 8));
+        char* Name = xstrdup ((const char*) T + Fixed + Count * 8 +
+                              GetExpTab32 (T + Fixed + I * 8 + 4));
+        CollAppend (&O->Strings, Name);
+        CollAppend (&O->Exports, Name);
+    }
+
+    /* Done */
+    xfree (T);
+    return 1;
+}
+
+
+
+static void ReadSumTable (void)
+/* Read the checksum table that may follow the export table. Libraries
+** without one have no checksums for their modules.
+*/
+{
+    unsigned char   Buf[8];
+    unsigned char*  T;
+    unsigned long   Size, I;
+
+    /* Check magic and size */
+    Size = CollCount (&ObjPool) * (unsigned long) LIB_SUM_SIZE;
+    if (fread (Buf, 1, sizeof (Buf), Lib) != sizeof (Buf) ||
+        GetExpTab32 (Buf) != LIB_SUM_MAGIC ||
+        GetExpTab32 (Buf + 4) != Size) {
+        return;
+    }
+
+    /* Read the table */
+    T = xmalloc (Size + 1);
+    if (fread (T, 1, Size, Lib) != Size) {
+        xfree (T);
+        return;
+    }
+
+    /* Set the checksums of the modules */
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjPool, I);
+        O->Sum[0]  = GetExpTab32 (T + I * LIB_SUM_SIZE);
+        O->Sum[1]  = GetExpTab32 (T + I * LIB_SUM_SIZE + 4);
+        O->Sum[2]  = GetExpTab32 (T + I * LIB_SUM_SIZE + 8);
+        O->Sum[3]  = GetExpTab32 (T + I * LIB_SUM_SIZE + 12);
+        O->HaveSum = 1;
+    }
+
+    /* Done */
+    xfree (T);
+}
+
+
+
 static void ReadIndex (void)
 /* Read the index of a library file */
 {
-    unsigned Count, I;
+    unsigned Count;
 
     /* Seek to the start of the index */
     fseek (Lib, Header.IndexOffs, SEEK_SET);
@@ -139,15 +247,16 @@ static void ReadIndex (void)
         ReadIndexEntry ();
     }
 
-    /* Read basic object file data from the actual entries */
-    for (I = 0; I < CollCount (&ObjPool); ++I) {
-
-        /* Get the object file entry */
-        ObjData* O = CollAtUnchecked (&ObjPool, I);
-
-        /* Read data */
-        ObjReadData (Lib, O);
+    /* If the library has an export table, we don't need to read the object
+    ** files. The checksums are in a table that follows it.
+    */
+    if (ReadExportTable ()) {
+        ReadSumTable ();
+        return;
     }
+
+    /* Read basic object file data from the actual entries */
+    ObjReadData (Lib);
 }
 
 
@@ -186,13 +295,134 @@ static void WriteIndexEntry (const ObjData* O)
 
 
 
+/* Entry in the export table */
+typedef struct ExpEntry ExpEntry;
+struct ExpEntry {
+    unsigned long       Bucket;         /* Hash bucket */
+    unsigned            Module;         /* Index of module */
+    const char*         Name;           /* Name of the export */
+};
+
+
+
+static int CmpExpEntry (const void* K1, const void* K2)
+/* Compare function for qsort. Entries are sorted by bucket, module and name,
+** so the table doesn't depend on the order of the exports in the modules.
+*/
+{
+    const ExpEntry* E1 = K1;
+    const ExpEntry* E2 = K2;
+    if (E1->Bucket != E2->Bucket) {
+        return (E1->Bucket < E2->Bucket)? -1 : 1;
+    }
+    if (E1->Module != E2->Module) {
+        return (E1->Module < E2->Module)? -1 : 1;
+    }
+    return strcmp (E1->Name, E2->Name);
+}
+
+
+
+static void WriteExportTable (void)
+/* Write the export table that follows the index. See libdefs.h for the
+** layout.
+*/
+{
+    unsigned            ExpCount;
+    unsigned long       Buckets;
+    unsigned long       NameSize;
+    ExpEntry*           Entries;
+    unsigned            I, J, K;
+    unsigned long       B;
+
+    /* Count the exports */
+    ExpCount = 0;
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        ExpCount += CollCount (&((const ObjData*) CollConstAt (&ObjPool, I))->Exports);
+    }
+
+    /* Use about one bucket per export */
+    Buckets = 1;
+    while (Buckets < ExpCount && Buckets < LIB_EXP_MAXBUCKETS) {
+        Buckets <<= 1;
+    }
+
+    /* Collect and sort the entries */
+    Entries  = xmalloc ((ExpCount + 1) * sizeof (Entries[0]));
+    NameSize = 0;
+    K        = 0;
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        for (J = 0; J < CollCount (&O->Exports); ++J) {
+            const char* Name  = CollConstAt (&O->Exports, J);
+            Entries[K].Bucket = HashStr (Name) & (Buckets - 1);
+            Entries[K].Module = I;
+            Entries[K].Name   = Name;
+            NameSize += strlen (Name) + 1;
+            ++K;
+        }
+    }
+    qsort (Entries, ExpCount, sizeof (Entries[0]), CmpExpEntry);
+
+    /* Write the header of the table */
+    Write32 (NewLib, LIB_EXP_MAGIC);
+    Write32 (NewLib, 4 + (Buckets + 1) * 4 + ExpCount * 8UL + NameSize);
+    Write32 (NewLib, Buckets);
+
+    /* Write the start index for each bucket */
+    K = 0;
+    for (B = 0; B <= Buckets; ++B) {
+        while (K < ExpCount && Entries[K].Bucket < B) {
+            ++K;
+        }
+        Write32 (NewLib, K);
+    }
+
+    /* Write the entries and the names */
+    NameSize = 0;
+    for (I = 0; I < ExpCount; ++I) {
+        Write32 (NewLib, Entries[I].Module);
+        Write32 (NewLib, NameSize);
+        NameSize += strlen (Entries[I].Name) + 1;
+    }
+    for (I = 0; I < ExpCount; ++I) {
+        WriteData (NewLib, Entries[I].Name, strlen (Entries[I].Name) + 1);
+    }
+
+    /* Free the entries */
+    xfree (Entries);
+}
+
+
+
+static void WriteSumTable (void)
+/* Write the checksum table that follows the export table. See libdefs.h for
+** the layout.
+*/
+{
+    unsigned I, J;
+
+    Write32 (NewLib, LIB_SUM_MAGIC);
+    Write32 (NewLib, CollCount (&ObjPool) * (unsigned long) LIB_SUM_SIZE);
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        for (J = 0; J < 4; ++J) {
+            Write32 (NewLib, O->Sum[J]);
+        }
+    }
+}
+
+
+
 static void WriteIndex (void)
 /* Write the index of a library file */
 {
     unsigned I;
 
-    /* Sync I/O in case the last operation was a read */
-    fseek (NewLib, 0, SEEK_CUR);
+    /* Sync I/O in case the last operation was a read. The index is always
+    ** written at the end of the file.
+    */
+    fseek (NewLib, 0, SEEK_END);
 
     /* Remember the current offset in the header */
     Header.IndexOffs = ftell (NewLib);
@@ -204,6 +434,12 @@ static void WriteIndex (void)
     for (I = 0; I < CollCount (&ObjPool); ++I) {
         WriteIndexEntry (CollConstAt (&ObjPool, I));
     }
+
+    /* Write the export table, so the linker may resolve imports without
+    ** reading the modules, and the checksums.
+    */
+    WriteExportTable ();
+    WriteSumTable ();
 }
 
 
@@ -214,6 +450,52 @@ static void WriteIndex (void)
 
 
 
+static void LibCreateTemp (void)
+/* Create the temporary library file */
+{
+    /* Create the temporary library name */
+    NewLibName = xmalloc (strlen (LibName) + strlen (".temp") + 1);
+    strcpy (NewLibName, LibName);
+    strcat (NewLibName, ".temp");
+
+    /* Create the temporary library */
+    NewLib = fopen (NewLibName, "w+b");
+    if (NewLib == 0) {
+        Error ("Cannot create temporary library file: %s", strerror (errno));
+    }
+
+    /* Write a dummy header to the temp file */
+    WriteHeader ();
+}
+
+
+
+static int LibNeedsCompaction (void)
+/* Return true if the dead space in a library updated in place is so large
+** that the library should be rewritten.
+*/
+{
+    unsigned      I;
+    unsigned long Live = LIB_HDR_SIZE;
+    unsigned long Dead;
+
+    /* Sum up the module data that is still in use */
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        Live += ((const ObjData*) CollConstAt (&ObjPool, I))->Size;
+    }
+
+    /* Everything else except for the new index is dead space */
+    fseek (Lib, 0, SEEK_END);
+    Dead = ftell (Lib) - Live;
+
+    Print (stdout, 2, "Library `%s': %lu bytes used, %lu bytes dead\n",
+           LibName, Live, Dead);
+
+    return Dead > Live / 100 * MAX_DEAD_PERCENT;
+}
+
+
+
 void LibOpen (const char* Name, int MustExist, int NeedTemp)
 /* Open an existing library and a temporary copy. If MustExist is true, the
 ** old library is expected to exist. If NeedTemp is true, a temporary library
@@ -223,8 +505,14 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp)
     /* Remember the name */
     LibName = xstrdup (Name);
 
-    /* Open the existing library for reading */
-    Lib = fopen (Name, "rb");
+    /* Open the existing library. If it is going to be changed, try to open
+    ** it for update, so it can be changed in place.
+    */
+    if (NeedTemp && (Lib = fopen (Name, "r+b")) != 0) {
+        InPlace = 1;
+    } else {
+        Lib = fopen (Name, "rb");
+    }
     if (Lib == 0) {
 
         /* File does not exist */
@@ -246,21 +534,12 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp)
 
     }
 
-    if (NeedTemp) {
-
-        /* Create the temporary library name */
-        NewLibName = xmalloc (strlen (Name) + strlen (".temp") + 1);
-        strcpy (NewLibName, Name);
-        strcat (NewLibName, ".temp");
-
-        /* Create the temporary library */
-        NewLib = fopen (NewLibName, "w+b");
-        if (NewLib == 0) {
-            Error ("Cannot create temporary library file: %s", strerror (errno));
-        }
-
-        /* Write a dummy header to the temp file */
-        WriteHeader ();
+    if (InPlace) {
+        /* New data is appended to the library itself */
+        NewLib = Lib;
+    } else if (NeedTemp) {
+        /* Create a new library in a temporary file */
+        LibCreateTemp ();
     }
 }
 
@@ -272,9 +551,11 @@ unsigned long LibCopyTo (FILE* F, unsigned long Bytes)
 */
 {
     unsigned char Buf [4096];
+    unsigned long Pos;
 
-    /* Remember the position */
-    unsigned long Pos = ftell (NewLib);
+    /* Data is always appended. Remember the position. */
+    fseek (NewLib, 0, SEEK_END);
+    Pos = ftell (NewLib);
 
     /* Copy loop */
     while (Bytes) {
@@ -290,6 +571,66 @@ unsigned long LibCopyTo (FILE* F, unsigned long Bytes)
 
 
 
+unsigned long LibWrite (const void* Data, unsigned long Bytes)
+/* Append data to the temp library file, return the start position in the
+** temporary library file.
+*/
+{
+    unsigned long Pos;
+
+    /* Data is always appended. Remember the position. */
+    fseek (NewLib, 0, SEEK_END);
+    Pos = ftell (NewLib);
+
+    /* Write the data */
+    while (Bytes) {
+        unsigned Count = (Bytes > 0x4000)? 0x4000 : Bytes;
+        WriteData (NewLib, Data, Count);
+        Data = (const unsigned char*) Data + Count;
+        Bytes -= Count;
+    }
+
+    /* Return the start position */
+    return Pos;
+}
+
+
+
+int LibCompare (unsigned long Pos, const void* Data, unsigned long Bytes)
+/* Compare data in the library file with the given data. Return true if the
+** data is identical.
+*/
+{
+    unsigned char Buf [4096];
+
+    /* Seek to the correct position */
+    fseek (Lib, Pos, SEEK_SET);
+
+    /* Compare loop */
+    while (Bytes) {
+        unsigned Count = (Bytes > sizeof (Buf))? sizeof (Buf) : Bytes;
+        if (fread (Buf, 1, Count, Lib) != Count ||
+            memcmp (Buf, Data, Count) != 0) {
+            return 0;
+        }
+        Data = (const unsigned char*) Data + Count;
+        Bytes -= Count;
+    }
+
+    /* Data is identical */
+    return 1;
+}
+
+
+
+void LibMarkChanged (void)
+/* Mark the library as changed, so it is written when it is closed */
+{
+    Changed = 1;
+}
+
+
+
 void LibCopyFrom (unsigned long Pos, unsigned long Bytes, FILE* F)
 /* Copy data from the library file into another file */
 {
@@ -309,6 +650,27 @@ void LibCopyFrom (unsigned long Pos, unsigned long Bytes, FILE* F)
 
 
 
+static void LibSumModules (void)
+/* Compute the checksums of all modules that don't have one. These are the
+** modules taken from a library without a checksum table.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjPool, I);
+        if (!O->HaveSum) {
+            unsigned char* Data = xmalloc (O->Size + 1);
+            fseek (Lib, O->Start, SEEK_SET);
+            ReadData (Lib, Data, O->Size);
+            HashData128 (O->Sum, Data, O->Size);
+            O->HaveSum = 1;
+            xfree (Data);
+        }
+    }
+}
+
+
+
 static void LibCheckExports (ObjData* O)
 /* Insert all exports from the given object file into the global list
 ** checking for duplicates.
@@ -338,60 +700,100 @@ void LibClose (void)
 ** filename
 */
 {
-    /* Do we have a temporary library? */
-    if (NewLib) {
+    /* Was the library changed? */
+    if (NewLib && Changed) {
 
         unsigned I;
         unsigned char Buf [4096];
         size_t Count;
 
         /* Walk through the object file list, inserting exports into the
-        ** export list checking for duplicates. Copy any data that is still
-        ** in the old library into the new one.
+        ** export list checking for duplicates.
         */
         for (I = 0; I < CollCount (&ObjPool); ++I) {
+            LibCheckExports (CollAtUnchecked (&ObjPool, I));
+        }
 
-            /* Get a pointer to the object */
-            ObjData* O = CollAtUnchecked (&ObjPool, I);
-
-            /* Check exports, make global export table */
-            LibCheckExports (O);
+        /* All modules need a checksum for the index */
+        LibSumModules ();
 
-            /* Copy data if needed */
-            if ((O->Flags & OBJ_HAVEDATA) == 0) {
-                /* Data is still in the old library */
-                fseek (Lib, O->Start, SEEK_SET);
-                O->Start = ftell (NewLib);
-                LibCopyTo (Lib, O->Size);
-                O->Flags |= OBJ_HAVEDATA;
+        /* If the library was updated in place, check if it has so much dead
+        ** space that it's worth to compact it. This is done by switching to
+        ** a temporary library and copying all module data from the old one.
+        */
+        if (InPlace && LibNeedsCompaction ()) {
+            Print (stdout, 1, "%s: Compacting library `%s'\n", ProgName, LibName);
+            LibCreateTemp ();
+            for (I = 0; I < CollCount (&ObjPool); ++I) {
+                ((ObjData*) CollAtUnchecked (&ObjPool, I))->Flags &= ~OBJ_HAVEDATA;
             }
+            InPlace = 0;
         }
 
-        /* Write the index */
-        WriteIndex ();
+        if (InPlace) {
 
-        /* Write the updated header */
-        WriteHeader ();
+            /* Append the new index and update the header. Until the header
+            ** is written, the library still refers to the old index, so an
+            ** interrupted update will leave a valid library.
+            */
+            WriteIndex ();
+            WriteHeader ();
 
-        /* Close the file */
-        if (Lib && fclose (Lib) != 0) {
-            Error ("Error closing library: %s", strerror (errno));
-        }
+            /* Lib and NewLib are the same, close it only once */
+            NewLib = 0;
 
-        /* Reopen the library and truncate it */
-        Lib = fopen (LibName, "wb");
-        if (Lib == 0) {
-            Error ("Cannot open library `%s' for writing: %s",
-                   LibName, strerror (errno));
-        }
+        } else {
 
-        /* Copy the temporary library to the new one */
-        fseek (NewLib, 0, SEEK_SET);
-        while ((Count = fread (Buf, 1, sizeof (Buf), NewLib)) != 0) {
-            if (fwrite (Buf, 1, Count, Lib) != Count) {
-                Error ("Cannot write to `%s': %s", LibName, strerror (errno));
+            /* Copy any data that is still in the old library into the new
+            ** one.
+            */
+            for (I = 0; I < CollCount (&ObjPool); ++I) {
+
+                /* Get a pointer to the object */
+                ObjData* O = CollAtUnchecked (&ObjPool, I);
+
+                /* Copy data if needed */
+                if ((O->Flags & OBJ_HAVEDATA) == 0) {
+                    /* Data is still in the old library */
+                    fseek (Lib, O->Start, SEEK_SET);
+                    O->Start = ftell (NewLib);
+                    LibCopyTo (Lib, O->Size);
+                    O->Flags |= OBJ_HAVEDATA;
+                }
+            }
+
+            /* Write the index */
+            WriteIndex ();
+
+            /* Write the updated header */
+            WriteHeader ();
+
+            /* Close the file */
+            if (Lib && fclose (Lib) != 0) {
+                Error ("Error closing library: %s", strerror (errno));
+            }
+
+            /* Reopen the library and truncate it */
+            Lib = fopen (LibName, "wb");
+            if (Lib == 0) {
+                Error ("Cannot open library `%s' for writing: %s",
+                       LibName, strerror (errno));
+            }
+
+            /* Copy the temporary library to the new one */
+            fseek (NewLib, 0, SEEK_SET);
+            while ((Count = fread (Buf, 1, sizeof (Buf), NewLib)) != 0) {
+                if (fwrite (Buf, 1, Count, Lib) != Count) {
+                    Error ("Cannot write to `%s': %s", LibName, strerror (errno));
+                }
             }
         }
+
+    } else if (InPlace) {
+
+        /* Nothing to write. Lib and NewLib are the same, close it only once */
+        NewLib = 0;
+
     }
 
     /* Close both files */
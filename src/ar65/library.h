@@ -70,6 +70,19 @@ unsigned long LibCopyTo (FILE* F, unsigned long Bytes);
 ** the temporary library file.
 */
 
+unsigned long LibWrite (const void* Data, unsigned long Bytes);
+/* Append data to the temp library file, return the start position in the
+** temporary library file.
+*/
+
+int LibCompare (unsigned long Pos, const void* Data, unsigned long Bytes);
+/* Compare data in the library file with the given data. Return true if the
+** data is identical.
+*/
+
+void LibMarkChanged (void);
+/* Mark the library as changed, so it is written when it is closed */
+
 void LibCopyFrom (unsigned long Pos, unsigned long Bytes, FILE* F);
 /* Copy data from the library file into another file */
 
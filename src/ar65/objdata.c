@@ -77,6 +77,8 @@ ObjData* NewObjData (void)
     O->Start       = 0;
     O->Size        = 0;
 
+    O->HaveSum     = 0;
+
     O->Strings     = EmptyCollection;
     O->Exports     = EmptyCollection;
 
@@ -111,6 +113,7 @@ void ClearObjData (ObjData* O)
     unsigned I;
     xfree (O->Name);
     O->Name = 0;
+    O->HaveSum = 0;
     for (I = 0; I < CollCount (&O->Strings); ++I) {
         xfree (CollAt (&O->Strings, I));
     }
@@ -158,6 +161,7 @@ void DelObjData (const char* Module)
             /* Free the entry */
             CollDelete (&ObjPool, I);
             FreeObjData (O);
+            LibMarkChanged ();
 
             /* Done */
             return;
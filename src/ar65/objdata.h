@@ -65,6 +65,10 @@ struct ObjData {
     unsigned long       Start;          /* Start offset of data in library */
     unsigned long       Size;           /* Size of data in library */
 
+    /* Hash of the module data */
+    int                 HaveSum;        /* True if Sum is valid */
+    unsigned long       Sum[4];         /* 128 bit hash, see HashData128 */
+
     /* Object file header */
     ObjHeader           Header;
 
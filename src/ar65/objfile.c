@@ -37,12 +37,14 @@
 #include <errno.h>
 
 /* common */
-#include "cddefs.h"
 #include "exprdefs.h"
 #include "filestat.h"
 #include "filetime.h"
 #include "fname.h"
+#include "hashfunc.h"
+#include "print.h"
 #include "symdefs.h"
+#include "tasks.h"
 #include "xmalloc.h"
 
 /* ar65 */
@@ -55,71 +57,183 @@
 
 
 /*****************************************************************************/
-/*                                   Code                                    */
+/*                                   Data                                    */
 /*****************************************************************************/
 
 
 
-static const char* GetModule (const char* Name)
-/* Get a module name from the file name */
+/* Contents of an object file or library module that is decoded by a task.
+** Tasks don't call Error, they store the message and the main thread
+** reports it.
+*/
+typedef struct ObjInput ObjInput;
+struct ObjInput {
+    const char*         Name;           /* Name of the file or module */
+    int                 IsFile;         /* True if the data must be read */
+    unsigned char*      Data;           /* Contents */
+    unsigned long       Size;           /* Size of the contents */
+    unsigned long       Pos;            /* Read position while decoding */
+    unsigned long       MTime;          /* Modification time of the file */
+    unsigned long       Sum[4];         /* Hash of the contents */
+    ObjHeader           Header;         /* Object file header */
+    Collection          Strings;        /* Strings from the object file */
+    Collection          Exports;        /* Exports list from object file */
+    const char*         Error;          /* Format for Error or NULL */
+    int                 ErrNo;          /* errno for I/O errors */
+};
+
+
+
+/*****************************************************************************/
+/*                              Decoding tasks                               */
+/*****************************************************************************/
+
+
+
+static void InputError (ObjInput* In, const char* Format)
+/* Remember the first error of an input */
 {
-    /* Make a module name from the file name */
-    const char* Module = FindName (Name);
+    if (In->Error == 0) {
+        In->Error = Format;
+    }
+}
 
-    /* Must not end with a path separator */
-    if (*Module == 0) {
-        Error ("Cannot make module name from `%s'", Name);
+
+
+static unsigned InputRead8 (ObjInput* In)
+/* Read an 8 bit value from the input */
+{
+    if (In->Pos >= In->Size) {
+        InputError (In, "Read error in `%s' (file corrupt?)");
+        return 0;
     }
+    return In->Data[In->Pos++];
+}
 
-    /* Done */
-    return Module;
+
+
+static unsigned long InputRead16 (ObjInput* In)
+/* Read a 16 bit value from the input */
+{
+    unsigned long Lo = InputRead8 (In);
+    unsigned long Hi = InputRead8 (In);
+    return (Hi << 8) | Lo;
 }
 
 
 
-static void ObjReadHeader (FILE* Obj, ObjHeader* H, const char* Name)
+static unsigned long InputRead32 (ObjInput* In)
+/* Read a 32 bit value from the input */
+{
+    unsigned long Lo = InputRead16 (In);
+    unsigned long Hi = InputRead16 (In);
+    return (Hi << 16) | Lo;
+}
+
+
+
+static unsigned long InputReadVar (ObjInput* In)
+/* Read a variable size value from the input */
+{
+    /* The value was written to the file in 7 bit chunks LSB first. If there
+    ** are more bytes, bit 8 is set, otherwise it is clear.
+    */
+    unsigned char C;
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    do {
+        C = InputRead8 (In);
+        if (Shift < 32) {
+            V |= ((unsigned long)(C & 0x7F)) << Shift;
+        }
+        Shift += 7;
+    } while (C & 0x80);
+    return V;
+}
+
+
+
+static char* InputReadStr (ObjInput* In)
+/* Read a string from the input (the memory will be malloc'ed) */
+{
+    char* S;
+
+    /* Read the length and check it */
+    unsigned long Len = InputReadVar (In);
+    if (Len > In->Size - In->Pos) {
+        InputError (In, "Read error in `%s' (file corrupt?)");
+        Len = 0;
+    }
+
+    /* Copy the string */
+    S = xmalloc (Len + 1);
+    memcpy (S, In->Data + In->Pos, Len);
+    S[Len] = '\0';
+    In->Pos += Len;
+    return S;
+}
+
+
+
+static void InputSeek (ObjInput* In, unsigned long Pos)
+/* Set the read position */
+{
+    if (Pos > In->Size) {
+        InputError (In, "Read error in `%s' (file corrupt?)");
+        Pos = In->Size;
+    }
+    In->Pos = Pos;
+}
+
+
+
+static void ReadHeader (ObjInput* In)
 /* Read the header of the object file checking the signature */
 {
-    H->Magic      = Read32 (Obj);
+    ObjHeader* H = &In->Header;
+
+    H->Magic      = InputRead32 (In);
     if (H->Magic != OBJ_MAGIC) {
-        Error ("`%s' is not an object file", Name);
+        InputError (In, "`%s' is not an object file");
+        return;
     }
-    H->Version    = Read16 (Obj);
+    H->Version    = InputRead16 (In);
     if (H->Version != OBJ_VERSION) {
-        Error ("Object file `%s' has wrong version", Name);
+        InputError (In, "Object file `%s' has wrong version");
+        return;
     }
-    H->Flags        = Read16 (Obj);
-    H->OptionOffs   = Read32 (Obj);
-    H->OptionSize   = Read32 (Obj);
-    H->FileOffs     = Read32 (Obj);
-    H->FileSize     = Read32 (Obj);
-    H->SegOffs      = Read32 (Obj);
-    H->SegSize      = Read32 (Obj);
-    H->ImportOffs   = Read32 (Obj);
-    H->ImportSize   = Read32 (Obj);
-    H->ExportOffs   = Read32 (Obj);
-    H->ExportSize   = Read32 (Obj);
-    H->DbgSymOffs   = Read32 (Obj);
-    H->DbgSymSize   = Read32 (Obj);
-    H->LineInfoOffs = Read32 (Obj);
-    H->LineInfoSize = Read32 (Obj);
-    H->StrPoolOffs  = Read32 (Obj);
-    H->StrPoolSize  = Read32 (Obj);
-    H->AssertOffs   = Read32 (Obj);
-    H->AssertSize   = Read32 (Obj);
-    H->ScopeOffs    = Read32 (Obj);
-    H->ScopeSize    = Read32 (Obj);
-    H->SpanOffs     = Read32 (Obj);
-    H->SpanSize     = Read32 (Obj);
+    H->Flags        = InputRead16 (In);
+    H->OptionOffs   = InputRead32 (In);
+    H->OptionSize   = InputRead32 (In);
+    H->FileOffs     = InputRead32 (In);
+    H->FileSize     = InputRead32 (In);
+    H->SegOffs      = InputRead32 (In);
+    H->SegSize      = InputRead32 (In);
+    H->ImportOffs   = InputRead32 (In);
+    H->ImportSize   = InputRead32 (In);
+    H->ExportOffs   = InputRead32 (In);
+    H->ExportSize   = InputRead32 (In);
+    H->DbgSymOffs   = InputRead32 (In);
+    H->DbgSymSize   = InputRead32 (In);
+    H->LineInfoOffs = InputRead32 (In);
+    H->LineInfoSize = InputRead32 (In);
+    H->StrPoolOffs  = InputRead32 (In);
+    H->StrPoolSize  = InputRead32 (In);
+    H->AssertOffs   = InputRead32 (In);
+    H->AssertSize   = InputRead32 (In);
+    H->ScopeOffs    = InputRead32 (In);
+    H->ScopeSize    = InputRead32 (In);
+    H->SpanOffs     = InputRead32 (In);
+    H->SpanSize     = InputRead32 (In);
 }
 
 
 
-static void SkipExpr (FILE* F)
-/* Skip an expression in F */
+static void SkipExpr (ObjInput* In)
+/* Skip an expression in the input */
 {
     /* Get the operation and skip it */
-    unsigned char Op = Read8 (F);
+    unsigned char Op = InputRead8 (In);
 
     /* Handle then different expression nodes */
     switch (Op) {
@@ -129,173 +243,354 @@ static void SkipExpr (FILE* F)
 
         case EXPR_LITERAL:
             /* 32 bit literal value */
-            (void) Read32 (F);
+            (void) InputRead32 (In);
             break;
 
         case EXPR_SYMBOL:
             /* Variable seized symbol index */
-            (void) ReadVar (F);
+            (void) InputReadVar (In);
             break;
 
         case EXPR_SECTION:
             /* 8 bit segment number */
-            (void) Read8 (F);
+            (void) InputRead8 (In);
             break;
 
         default:
             /* What's left are unary and binary nodes */
-            SkipExpr (F);   /* Left */
-            SkipExpr (F);   /* right */
+            SkipExpr (In);      /* Left */
+            SkipExpr (In);      /* right */
             break;
     }
 }
 
 
 
-static void SkipLineInfoList (FILE* F)
-/* Skip a list of line infos in F */
+static void SkipLineInfoList (ObjInput* In)
+/* Skip a list of line infos in the input */
 {
     /* Number of indices preceeds the list */
-    unsigned long Count = ReadVar (F);
+    unsigned long Count = InputReadVar (In);
 
     /* Skip indices */
-    while (Count--) {
-        (void) ReadVar (F);
+    while (Count-- && In->Error == 0) {
+        (void) InputReadVar (In);
+    }
+}
+
+
+
+static void ReadInputFile (ObjInput* In)
+/* Read the contents of an object file into memory */
+{
+    struct stat StatBuf;
+    FILE*       F;
+
+    /* Open the object file */
+    F = fopen (In->Name, "rb");
+    if (F == 0) {
+        In->ErrNo = errno;
+        InputError (In, "Could not open `%s': %s");
+        return;
     }
+
+    /* Get the modification time of the object file. There's a race condition
+    ** here, since we cannot use fileno() (non-standard identifier in standard
+    ** header file), and therefore not fstat. When using stat with the
+    ** file name, there's a risk that the file was deleted and recreated
+    ** while it was open. Since mtime and size are only used to check
+    ** if a file has changed in the debugger, we will ignore this problem
+    ** here.
+    */
+    if (FileStat (In->Name, &StatBuf) != 0) {
+        In->ErrNo = errno;
+        InputError (In, "Cannot stat object file `%s': %s");
+        fclose (F);
+        return;
+    }
+    In->MTime = (unsigned long) StatBuf.st_mtime;
+
+    /* Determine the file size and read the file. Note: Race condition here */
+    fseek (F, 0, SEEK_END);
+    In->Size = ftell (F);
+    fseek (F, 0, SEEK_SET);
+    In->Data = xmalloc (In->Size + 1);
+    if (fread (In->Data, 1, In->Size, F) != In->Size) {
+        In->ErrNo = errno;
+        InputError (In, "Cannot read `%s': %s");
+    }
+
+    /* Done, close the file (we read it only, so no error check) */
+    fclose (F);
 }
 
 
 
-void ObjReadData (FILE* F, ObjData* O)
-/* Read object file data from the given file. The function expects the Name
-** and Start fields to be valid. Header and basic data are read.
+static void DecodeInput (void* Data, unsigned Index)
+/* Task that reads an input if necessary, computes the hash of the contents
+** and reads the header, the string pool and the names of the exports.
 */
 {
+    ObjInput*     In = (ObjInput*) Data + Index;
     unsigned long Count;
 
-    /* Seek to the start of the object file data */
-    fseek (F, O->Start, SEEK_SET);
+    /* Read the file */
+    if (In->IsFile) {
+        ReadInputFile (In);
+        if (In->Error) {
+            return;
+        }
+    }
+
+    /* Compute the hash of the contents */
+    HashData128 (In->Sum, In->Data, In->Size);
 
     /* Read the object file header */
-    ObjReadHeader (F, &O->Header, O->Name);
+    ReadHeader (In);
+    if (In->Error) {
+        return;
+    }
 
     /* Read the string pool */
-    fseek (F, O->Start + O->Header.StrPoolOffs, SEEK_SET);
-    Count = ReadVar (F);
-    CollGrow (&O->Strings, Count);
-    while (Count--) {
-        CollAppend (&O->Strings, ReadStr (F));
+    InputSeek (In, In->Header.StrPoolOffs);
+    Count = InputReadVar (In);
+    while (Count-- && In->Error == 0) {
+        CollAppend (&In->Strings, InputReadStr (In));
     }
 
     /* Read the exports */
-    fseek (F, O->Start + O->Header.ExportOffs, SEEK_SET);
-    Count = ReadVar (F);
-    CollGrow (&O->Exports, Count);
-    while (Count--) {
+    InputSeek (In, In->Header.ExportOffs);
+    Count = InputReadVar (In);
+    while (Count-- && In->Error == 0) {
 
-        unsigned char ConDes[CD_TYPE_COUNT];
+        unsigned long Name;
 
         /* Skip data until we get to the name */
-        unsigned Type = ReadVar (F);
-        (void) Read8 (F);       /* AddrSize */
-        ReadData (F, ConDes, SYM_GET_CONDES_COUNT (Type));
+        unsigned Type = InputReadVar (In);
+        (void) InputRead8 (In);         /* AddrSize */
+        InputSeek (In, In->Pos + SYM_GET_CONDES_COUNT (Type));
 
         /* Now this is what we actually need: The name of the export */
-        CollAppend (&O->Exports, CollAt (&O->Strings, ReadVar (F)));
+        Name = InputReadVar (In);
+        if (Name >= CollCount (&In->Strings)) {
+            InputError (In, "Read error in `%s' (file corrupt?)");
+            break;
+        }
+        CollAppend (&In->Exports, CollAtUnchecked (&In->Strings, Name));
 
         /* Skip the export value */
         if (SYM_IS_EXPR (Type)) {
             /* Expression tree */
-            SkipExpr (F);
+            SkipExpr (In);
         } else {
             /* Literal value */
-            (void) Read32 (F);
+            (void) InputRead32 (In);
         }
 
         /* Skip the size if necessary */
         if (SYM_HAS_SIZE (Type)) {
-            (void) ReadVar (F);
+            (void) InputReadVar (In);
         }
 
         /* Line info indices */
-        SkipLineInfoList (F);
-        SkipLineInfoList (F);
+        SkipLineInfoList (In);
+        SkipLineInfoList (In);
     }
 }
 
 
 
-void ObjAdd (const char* Name)
-/* Add an object file to the library */
+static void InitInput (ObjInput* In, const char* Name, int IsFile)
+/* Initialize an input */
 {
-    struct stat StatBuf;
-    const char* Module;
-    ObjHeader H;
-    ObjData* O;
+    In->Name    = Name;
+    In->IsFile  = IsFile;
+    In->Data    = 0;
+    In->Size    = 0;
+    In->Pos     = 0;
+    In->MTime   = 0;
+    In->Strings = EmptyCollection;
+    In->Exports = EmptyCollection;
+    In->Error   = 0;
+    In->ErrNo   = 0;
+}
 
-    /* Open the object file */
-    FILE* Obj = fopen (Name, "rb");
-    if (Obj == 0) {
-        Error ("Could not open `%s': %s", Name, strerror (errno));
+
+
+static void FreeInput (ObjInput* In)
+/* Free the contents of an input and any data that was not used */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&In->Strings); ++I) {
+        xfree (CollAt (&In->Strings, I));
     }
+    DoneCollection (&In->Strings);
+    DoneCollection (&In->Exports);
+    xfree (In->Data);
+    In->Data = 0;
+}
 
-    /* Get the modification time of the object file. There's a race condition
-    ** here, since we cannot use fileno() (non-standard identifier in standard
-    ** header file), and therefore not fstat. When using stat with the
-    ** file name, there's a risk that the file was deleted and recreated
-    ** while it was open. Since mtime and size are only used to check
-    ** if a file has changed in the debugger, we will ignore this problem
-    ** here.
-    */
-    if (FileStat (Name, &StatBuf) != 0) {
-        Error ("Cannot stat object file `%s': %s", Name, strerror (errno));
+
+
+static void CheckInput (const ObjInput* In)
+/* Report the error of an input if it has one */
+{
+    if (In->Error) {
+        Error (In->Error, In->Name, strerror (In->ErrNo));
     }
+}
+
+
+
+static void UseInput (ObjData* O, ObjInput* In)
+/* Move the decoded data of an input into an object data structure */
+{
+    O->Header  = In->Header;
+    O->Strings = In->Strings;
+    O->Exports = In->Exports;
+    memcpy (O->Sum, In->Sum, sizeof (O->Sum));
+    O->HaveSum = 1;
+    In->Strings = EmptyCollection;
+    In->Exports = EmptyCollection;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
 
-    /* Read and check the header */
-    ObjReadHeader (Obj, &H, Name);
 
+static const char* GetModule (const char* Name)
+/* Get a module name from the file name */
+{
     /* Make a module name from the file name */
-    Module = GetModule (Name);
+    const char* Module = FindName (Name);
 
-    /* Check if we already have a module with this name */
-    O = FindObjData (Module);
-    if (O == 0) {
-        /* Not found, create a new entry */
-        O = NewObjData ();
-    } else {
-        /* Found - check the file modification times of the internal copy
-        ** and the external one.
-        */
-        if (difftime ((time_t)O->MTime, StatBuf.st_mtime) > 0.0) {
-            Warning ("Replacing module `%s' by older version in library `%s'",
-                     O->Name, LibName);
-        }
+    /* Must not end with a path separator */
+    if (*Module == 0) {
+        Error ("Cannot make module name from `%s'", Name);
+    }
+
+    /* Done */
+    return Module;
+}
+
+
+
+void ObjReadData (FILE* F)
+/* Read the basic data of all modules in the object pool from the library
+** file F. The Name, Start and Size fields of the modules must be valid. The
+** modules are decoded by worker threads.
+*/
+{
+    unsigned  Count = CollCount (&ObjPool);
+    ObjInput* Inputs;
+    unsigned  I;
+
+    /* Read the module data */
+    Inputs = xmalloc ((Count + 1) * sizeof (Inputs[0]));
+    for (I = 0; I < Count; ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        InitInput (&Inputs[I], O->Name, 0);
+        Inputs[I].Size = O->Size;
+        Inputs[I].Data = xmalloc (O->Size + 1);
+        fseek (F, O->Start, SEEK_SET);
+        ReadData (F, Inputs[I].Data, O->Size);
+    }
+
+    /* Decode the modules */
+    RunTasks (DecodeInput, Inputs, Count);
 
-        /* Free data */
-        ClearObjData (O);
+    /* Use the data */
+    for (I = 0; I < Count; ++I) {
+        CheckInput (&Inputs[I]);
+        UseInput (CollAtUnchecked (&ObjPool, I), &Inputs[I]);
+        FreeInput (&Inputs[I]);
     }
+    xfree (Inputs);
+}
+
 
-    /* Initialize the object module data structure */
-    O->Name     = xstrdup (Module);
-    O->Flags    = OBJ_HAVEDATA;
-    O->MTime    = (unsigned long) StatBuf.st_mtime;
-    O->Start    = 0;
 
-    /* Determine the file size. Note: Race condition here */
-    fseek (Obj, 0, SEEK_END);
-    O->Size     = ftell (Obj);
+void ObjAddFiles (unsigned Count, char* Names[])
+/* Add object files to the library. The files are read and decoded by worker
+** threads and then added in the given order.
+*/
+{
+    ObjInput* Inputs;
+    unsigned  I;
+
+    /* Make sure all files have a module name before reading them */
+    Inputs = xmalloc ((Count + 1) * sizeof (Inputs[0]));
+    for (I = 0; I < Count; ++I) {
+        (void) GetModule (Names[I]);
+        InitInput (&Inputs[I], Names[I], 1);
+    }
 
-    /* Read the basic data from the object file */
-    ObjReadData (Obj, O);
+    /* Read and decode the files */
+    RunTasks (DecodeInput, Inputs, Count);
 
-    /* Copy the complete object data to the library file and update the
-    ** starting offset
-    */
-    fseek (Obj, 0, SEEK_SET);
-    O->Start    = LibCopyTo (Obj, O->Size);
+    /* Add them to the library */
+    for (I = 0; I < Count; ++I) {
 
-    /* Done, close the file (we read it only, so no error check) */
-    fclose (Obj);
+        ObjInput*   In     = &Inputs[I];
+        const char* Module = GetModule (In->Name);
+        ObjData*    O;
+
+        /* Check for errors */
+        CheckInput (In);
+
+        /* Check if we already have a module with this name */
+        O = FindObjData (Module);
+        if (O == 0) {
+            /* Not found, create a new entry */
+            O = NewObjData ();
+        } else {
+            /* Found - if the module in the library has the same contents, it
+            ** is left alone. This avoids rewriting a library when only some
+            ** of the modules have changed. The contents are compared by
+            ** hash if the library has them, otherwise directly.
+            */
+            if (O->Size == In->Size &&
+                (O->HaveSum? memcmp (O->Sum, In->Sum, sizeof (O->Sum)) == 0 :
+                 (O->Flags & OBJ_HAVEDATA) == 0 &&
+                 LibCompare (O->Start, In->Data, In->Size))) {
+                Print (stdout, 1, "Module `%s' is unchanged\n", O->Name);
+                FreeInput (In);
+                continue;
+            }
+
+            /* Check the file modification times of the internal copy
+            ** and the external one.
+            */
+            if (difftime ((time_t)O->MTime, (time_t)In->MTime) > 0.0) {
+                Warning ("Replacing module `%s' by older version in library `%s'",
+                         O->Name, LibName);
+            }
+
+            /* Free data */
+            ClearObjData (O);
+        }
+
+        /* Initialize the object module data structure */
+        O->Name     = xstrdup (Module);
+        O->Flags    = OBJ_HAVEDATA;
+        O->MTime    = In->MTime;
+        O->Size     = In->Size;
+        UseInput (O, In);
+
+        /* Copy the complete object data to the library file and update the
+        ** starting offset
+        */
+        O->Start    = LibWrite (In->Data, In->Size);
+        LibMarkChanged ();
+
+        /* Free the contents */
+        FreeInput (In);
+    }
+    xfree (Inputs);
 }
 
 
@@ -42,29 +42,22 @@
 
 
 
-/*****************************************************************************/
-/*                                 Forwards                                  */
-/*****************************************************************************/
-
-
-
-struct ObjData;
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
-void ObjReadData (FILE* F, struct ObjData* O);
-/* Read object file data from the given file. The function expects the Name
-** and Start fields to be valid. Header and basic data are read.
+void ObjReadData (FILE* F);
+/* Read the basic data of all modules in the object pool from the library
+** file F. The Name, Start and Size fields of the modules must be valid. The
+** modules are decoded by worker threads.
 */
 
-void ObjAdd (const char* Name);
-/* Add an object file to the library */
+void ObjAddFiles (unsigned Count, char* Names[]);
+/* Add object files to the library. The files are read and decoded by worker
+** threads and then added in the given order.
+*/
 
 void ObjExtract (const char* Name);
 /* Extract a module from the library */
@@ -62,6 +62,7 @@ Fragment* NewFragment (unsigned char Type, unsigned short Len)
     GetFullLineInfo (&F->LI);
     F->Len      = Len;
     F->Type     = Type;
+    F->Flags    = 0;
 
     /* And return it */
     return F;
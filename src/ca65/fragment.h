@@ -60,6 +60,7 @@ struct Fragment {
     Collection          LI;         /* Line info for this fragment */
     unsigned short      Len;        /* Length for this fragment */
     unsigned char       Type;       /* Fragment type */
+    unsigned char       Flags;      /* Fragment flags */
     union {
         unsigned char   Data[sizeof (ExprNode*)];       /* Literal values */
         ExprNode*       Expr;                           /* Expression */
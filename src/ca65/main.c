@@ -960,8 +960,8 @@ int main (int argc, char* argv [])
         /* Get the argument */
         const char* Arg = ArgVec [I];
 
-        /* Check for an option */
-        if (Arg[0] == '-') {
+        /* Check for an option. A single "-" is stdin as input file */
+        if (Arg[0] == '-' && Arg[1] != '\0') {
             switch (Arg[1]) {
 
                 case '-':
@@ -86,6 +86,7 @@ void Emit1 (unsigned char OPC, ExprNode* Value)
         /* Emit the argument as an expression */
         F = GenFragment (FRAG_EXPR, 1);
         F->V.Expr = Value;
+        F->Flags  = FRAG_OPERAND;
     }
 }
 
@@ -119,6 +120,7 @@ void Emit2 (unsigned char OPC, ExprNode* Value)
         /* Emit the argument as an expression */
         F = GenFragment (FRAG_EXPR, 2);
         F->V.Expr = Value;
+        F->Flags  = FRAG_OPERAND;
     }
 }
 
@@ -127,8 +129,15 @@ void Emit2 (unsigned char OPC, ExprNode* Value)
 void Emit3 (unsigned char OPC, ExprNode* Expr)
 /* Emit an instruction with a three byte argument */
 {
+    Fragment* F;
+
+    /* Emit the opcode */
     Emit0 (OPC);
-    EmitFarAddr (Expr);
+
+    /* Emit the argument as an expression */
+    F = GenFragment (FRAG_EXPR, 3);
+    F->V.Expr = Expr;
+    F->Flags  = FRAG_OPERAND;
 }
 
 
@@ -498,10 +498,16 @@ int NewInputFile (const char* Name)
     ** search for it using the include path list.
     */
     if (FCount == 0) {
-        /* Main file */
-        F = fopen (Name, "r");
-        if (F == 0) {
-            Fatal ("Cannot open input file `%s': %s", Name, strerror (errno));
+        /* Main file. A name of "-" means stdin, so the compiler output may
+        ** be piped into the assembler.
+        */
+        if (strcmp (Name, "-") == 0) {
+            F = stdin;
+        } else {
+            F = fopen (Name, "r");
+            if (F == 0) {
+                Fatal ("Cannot open input file `%s': %s", Name, strerror (errno));
+            }
         }
     } else {
         /* We are on include level. Search for the file in the include
@@ -526,7 +532,11 @@ int NewInputFile (const char* Name)
     ** if a file has changed in the debugger, we will ignore this problem
     ** here.
     */
-    if (FileStat (Name, &Buf) != 0) {
+    if (F == stdin) {
+        /* There is nothing to check for stdin */
+        Buf.st_size  = 0;
+        Buf.st_mtime = 0;
+    } else if (FileStat (Name, &Buf) != 0) {
         Fatal ("Cannot stat input file `%s': %s", Name, strerror (errno));
     }
 
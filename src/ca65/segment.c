@@ -560,10 +560,10 @@ static void WriteOneSeg (Segment* Seg)
 
             case FRAG_EXPR:
                 switch (Frag->Len) {
-                    case 1:   ObjWrite8 (FRAG_EXPR8);   break;
-                    case 2:   ObjWrite8 (FRAG_EXPR16);  break;
-                    case 3:   ObjWrite8 (FRAG_EXPR24);  break;
-                    case 4:   ObjWrite8 (FRAG_EXPR32);  break;
+                    case 1:   ObjWrite8 (FRAG_EXPR8 | Frag->Flags);   break;
+                    case 2:   ObjWrite8 (FRAG_EXPR16 | Frag->Flags);  break;
+                    case 3:   ObjWrite8 (FRAG_EXPR24 | Frag->Flags);  break;
+                    case 4:   ObjWrite8 (FRAG_EXPR32 | Frag->Flags);  break;
                     default:  Internal ("Invalid fragment size: %u", Frag->Len);
                 }
                 WriteExpr (Frag->V.Expr);
@@ -1036,6 +1036,11 @@ int main (int argc, char* argv[])
     /* Create the output file name if it was not explicitly given */
     MakeDefaultOutputName (InputFile);
 
+    /* Messages would end up in the output if it goes to stdout */
+    if (strcmp (OutputFilename, "-") == 0) {
+        Verbosity = 0;
+    }
+
     /* If no CPU given, use the default CPU for the target */
     if (CPU == CPU_UNKNOWN) {
         if (Target != TGT_UNKNOWN) {
@@ -99,7 +99,13 @@ void OpenOutputFile ()
     /* Output file must not be open and we must have a name*/
     PRECONDITION (OutputFile == 0 && OutputFilename != 0);
 
-    /* Open the file */
+    /* Open the file. A name of "-" means stdout, so the output may be piped
+    ** into the assembler.
+    */
+    if (strcmp (OutputFilename, "-") == 0) {
+        OutputFile = stdout;
+        return;
+    }
     OutputFile = fopen (OutputFilename, "w");
     if (OutputFile == 0) {
         Fatal ("Cannot open output file `%s': %s", OutputFilename, strerror (errno));
@@ -133,6 +139,15 @@ void CloseOutputFile ()
     /* Output file must be open */
     PRECONDITION (OutputFile != 0);
 
+    /* Don't close stdout, but check it for errors */
+    if (OutputFile == stdout) {
+        if (fflush (stdout) != 0 || ferror (stdout)) {
+            Fatal ("Cannot write to output file: %s", strerror (errno));
+        }
+        OutputFile = 0;
+        return;
+    }
+
     /* Close the file, check for errors */
     if (fclose (OutputFile) != 0) {
         remove (OutputFilename);
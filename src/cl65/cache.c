@@ -0,0 +1,741 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  cache.c                                  */
+/*                                                                           */
+/*                     Cache for the object files of cl65                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#  include <direct.h>
+#  include <io.h>
+#  include <process.h>
+#else
+#  include <dirent.h>
+#  include <unistd.h>
+#endif
+
+/* common */
+#include "attrib.h"
+#include "chartype.h"
+#include "coll.h"
+#include "hashfunc.h"
+#include "filestat.h"
+#include "filetime.h"
+#include "xmalloc.h"
+#include "xsprintf.h"
+
+/* cl65 */
+#include "cache.h"
+#include "error.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* System specific functions */
+#if defined(_WIN32)
+#  define MakeDir(Name)         _mkdir (Name)
+#  define GetPid()              ((unsigned long) _getpid ())
+#  define PATH_SEP              ';'
+#  define EXE_EXT               ".exe"
+#else
+#  define MakeDir(Name)         mkdir (Name, 0777)
+#  define GetPid()              ((unsigned long) getpid ())
+#  define PATH_SEP              ':'
+#  define EXE_EXT               ""
+#endif
+
+/* Each cache entry is one file. Its name is the hash of the key with the
+** extension below. It starts with the magic string, followed by the object
+** file, the dependency file and the full dependency file, each preceeded by
+** its size as a 32 bit little endian number.
+*/
+#define ENTRY_EXT       ".cce"
+#define ENTRY_MAGIC     "cl65 cache 1\n"
+#define ENTRY_PARTS     3
+
+/* Length of a hash as hex string */
+#define HASH_LEN        32
+
+/* The statistics file. Every event appends one character, which keeps the
+** file consistent if several builds share the cache. The eviction replaces
+** the characters by a first line with the totals of the hits, misses and
+** evicted entries as decimal numbers.
+*/
+#define STATS_NAME      "stats"
+#define STAT_HIT        'h'
+#define STAT_MISS       'm'
+#define STAT_EVICT      'e'
+
+/* Statistics read from the file */
+typedef struct CacheStats CacheStats;
+struct CacheStats {
+    unsigned long       Hits;
+    unsigned long       Misses;
+    unsigned long       Evictions;
+    unsigned long       Events;         /* Events since the last eviction */
+};
+
+/* Reading the cache directory takes time, so the size of the cache is
+** checked only after this many events.
+*/
+#define EVICT_INTERVAL  32
+
+/* The cache entry */
+struct CacheEntry {
+    char        Hash[HASH_LEN+1];       /* Hash of the key as hex string */
+    char*       Files[ENTRY_PARTS];     /* Files stored in the entry */
+};
+
+/* The file of an entry found in the cache directory */
+typedef struct EntryFile EntryFile;
+struct EntryFile {
+    char*               Name;           /* Name including the directory */
+    unsigned long       Size;           /* Size of the file */
+    time_t              MTime;          /* Time of last use */
+};
+
+/* The cache directory and the maximum size of the files in it */
+static char*            CacheDir     = 0;
+static unsigned long    CacheMaxSize = 0;
+
+
+
+/*****************************************************************************/
+/*                                  Helpers                                  */
+/*****************************************************************************/
+
+
+
+static char* CachePath (const char* Name)
+/* Return the name of a file in the cache directory. The result must be freed
+** by the caller.
+*/
+{
+    char* Path = xmalloc (strlen (CacheDir) + 1 + strlen (Name) + 1);
+    sprintf (Path, "%s/%s", CacheDir, Name);
+    return Path;
+}
+
+
+
+static void CountEvent (char Event)
+/* Add an event to the statistics */
+{
+    char* Name = CachePath (STATS_NAME);
+    FILE* F = fopen (Name, "ab");
+    if (F != 0) {
+        putc (Event, F);
+        fclose (F);
+    }
+    xfree (Name);
+}
+
+
+
+static int ReadFile (StrBuf* B, const char* Name)
+/* Append the contents of a file to a string buffer. Returns true if the file
+** was read successfully.
+*/
+{
+    char   Buf[4096];
+    size_t Count;
+    int    Ok;
+
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        return 0;
+    }
+    while ((Count = fread (Buf, 1, sizeof (Buf), F)) > 0) {
+        SB_AppendBuf (B, Buf, Count);
+    }
+    Ok = !ferror (F);
+    fclose (F);
+    return Ok;
+}
+
+
+
+static int WriteFile (const char* Name, const char* Data, unsigned long Size)
+/* Write a file from a buffer. Returns true if the file was written
+** successfully, otherwise it's removed.
+*/
+{
+    int   Ok;
+    FILE* F = fopen (Name, "wb");
+    if (F == 0) {
+        return 0;
+    }
+    Ok = (fwrite (Data, 1, Size, F) == Size);
+    if (fclose (F) != 0 || !Ok) {
+        remove (Name);
+        return 0;
+    }
+    return 1;
+}
+
+
+
+static void Put32 (StrBuf* B, unsigned long V)
+/* Append a 32 bit little endian number to a string buffer */
+{
+    SB_AppendChar (B, (char) (V & 0xFF));
+    SB_AppendChar (B, (char) ((V >> 8) & 0xFF));
+    SB_AppendChar (B, (char) ((V >> 16) & 0xFF));
+    SB_AppendChar (B, (char) ((V >> 24) & 0xFF));
+}
+
+
+
+static unsigned long Get32 (const unsigned char* P)
+/* Read a 32 bit little endian number */
+{
+    return (unsigned long) P[0]         |
+           ((unsigned long) P[1] << 8)  |
+           ((unsigned long) P[2] << 16) |
+           ((unsigned long) P[3] << 24);
+}
+
+
+
+static void ReadStats (CacheStats* S)
+/* Read the statistics file */
+{
+    StrBuf   Stats = AUTO_STRBUF_INITIALIZER;
+    char*    Name = CachePath (STATS_NAME);
+    unsigned I = 0;
+
+    S->Hits = S->Misses = S->Evictions = S->Events = 0;
+    ReadFile (&Stats, Name);
+    SB_Terminate (&Stats);
+
+    /* The totals written by the last eviction */
+    if (SB_GetLen (&Stats) > 0 && IsDigit (SB_AtUnchecked (&Stats, 0))) {
+        sscanf (SB_GetConstBuf (&Stats), "%lu %lu %lu",
+                &S->Hits, &S->Misses, &S->Evictions);
+        while (I < SB_GetLen (&Stats) && SB_AtUnchecked (&Stats, I) != '\n') {
+            ++I;
+        }
+    }
+
+    /* The events since then */
+    for (; I < SB_GetLen (&Stats); ++I) {
+        switch (SB_AtUnchecked (&Stats, I)) {
+            case STAT_HIT:      ++S->Hits;      ++S->Events;    break;
+            case STAT_MISS:     ++S->Misses;    ++S->Events;    break;
+            case STAT_EVICT:    ++S->Evictions;                 break;
+        }
+    }
+
+    SB_Done (&Stats);
+    xfree (Name);
+}
+
+
+
+static void CompactStats (void)
+/* Replace the events in the statistics file by their totals. Events that
+** other processes add meanwhile may get lost, which is acceptable for
+** statistics.
+*/
+{
+    CacheStats S;
+    char       Line[128];
+    char       Tmp[64];
+    char*      TmpPath;
+    char*      Path;
+
+    ReadStats (&S);
+    xsprintf (Line, sizeof (Line), "%lu %lu %lu\n", S.Hits, S.Misses, S.Evictions);
+    xsprintf (Tmp, sizeof (Tmp), "%s.%lu", STATS_NAME, GetPid ());
+    TmpPath = CachePath (Tmp);
+    Path = CachePath (STATS_NAME);
+    if (WriteFile (TmpPath, Line, strlen (Line))) {
+        remove (Path);
+        if (rename (TmpPath, Path) != 0) {
+            remove (TmpPath);
+        }
+    }
+    xfree (TmpPath);
+    xfree (Path);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Hash                                    */
+/*****************************************************************************/
+
+
+
+static void HashKey (char* Hash, const StrBuf* Key)
+/* Compute the hash of a key as a hex string of HASH_LEN characters. The
+** hash has 128 bits, so collisions are practically impossible.
+*/
+{
+    unsigned long H[4];
+    unsigned      I;
+
+    HashData128 (H, SB_GetConstBuf (Key), SB_GetLen (Key));
+
+    /* Convert to hex */
+    for (I = 0; I < 4; ++I) {
+        sprintf (Hash + I * 8, "%08lx", H[I]);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                 Eviction                                  */
+/*****************************************************************************/
+
+
+
+static void AddEntryFile (Collection* Files, const char* Name)
+/* Add a file from the cache directory to the list if it's an entry */
+{
+    unsigned    Len = strlen (Name);
+    unsigned    ExtLen = sizeof (ENTRY_EXT) - 1;
+    struct stat Buf;
+    EntryFile*  E;
+    char*       Path;
+
+    /* Entries have the hash as name */
+    if (Len != HASH_LEN + ExtLen || strcmp (Name + HASH_LEN, ENTRY_EXT) != 0) {
+        return;
+    }
+
+    /* Get size and time of last use */
+    Path = CachePath (Name);
+    if (FileStat (Path, &Buf) != 0) {
+        /* Removed by someone else */
+        xfree (Path);
+        return;
+    }
+
+    E = xmalloc (sizeof (EntryFile));
+    E->Name  = Path;
+    E->Size  = (unsigned long) Buf.st_size;
+    E->MTime = Buf.st_mtime;
+    CollAppend (Files, E);
+}
+
+
+
+static void ReadEntryFiles (Collection* Files)
+/* Collect the entry files in the cache directory */
+{
+#if defined(_WIN32)
+    struct _finddata_t D;
+    char*              Pattern = CachePath ("*" ENTRY_EXT);
+    intptr_t           H = _findfirst (Pattern, &D);
+    if (H != -1) {
+        do {
+            AddEntryFile (Files, D.name);
+        } while (_findnext (H, &D) == 0);
+        _findclose (H);
+    }
+    xfree (Pattern);
+#else
+    struct dirent* D;
+    DIR*           Dir = opendir (CacheDir);
+    if (Dir != 0) {
+        while ((D = readdir (Dir)) != 0) {
+            AddEntryFile (Files, D->d_name);
+        }
+        closedir (Dir);
+    }
+#endif
+}
+
+
+
+static void FreeEntryFiles (Collection* Files)
+/* Free the list of entry files */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Files); ++I) {
+        EntryFile* E = CollAtUnchecked (Files, I);
+        xfree (E->Name);
+        xfree (E);
+    }
+    DoneCollection (Files);
+}
+
+
+
+static int CompareMTime (void* Data attribute ((unused)),
+                         const void* Left, const void* Right)
+/* Compare two entry files by the time of last use */
+{
+    const EntryFile* L = Left;
+    const EntryFile* R = Right;
+    return (L->MTime < R->MTime)? -1 : (L->MTime > R->MTime);
+}
+
+
+
+static void Evict (void)
+/* Remove the least recently used entries if the cache is too large */
+{
+    Collection     Files = AUTO_COLLECTION_INITIALIZER;
+    unsigned long  Size = 0;
+    unsigned       I;
+
+    /* Get the size of all entries */
+    ReadEntryFiles (&Files);
+    for (I = 0; I < CollCount (&Files); ++I) {
+        Size += ((EntryFile*) CollAtUnchecked (&Files, I))->Size;
+    }
+
+    /* If the cache is too large, remove the oldest entries until it's 10%
+    ** below the limit, so this doesn't happen again with the next file.
+    */
+    if (Size > CacheMaxSize) {
+        CollSort (&Files, CompareMTime, 0);
+        for (I = 0; I < CollCount (&Files) && Size > CacheMaxSize / 10 * 9; ++I) {
+            EntryFile* E = CollAtUnchecked (&Files, I);
+            if (remove (E->Name) == 0) {
+                CountEvent (STAT_EVICT);
+            }
+            Size -= E->Size;
+        }
+    }
+
+    FreeEntryFiles (&Files);
+
+    /* Keep the statistics file small */
+    CompactStats ();
+}
+
+
+
+static void CheckSize (void)
+/* Remove old entries if the cache is too large. This is done only every
+** EVICT_INTERVAL events, independent of the keys used.
+*/
+{
+    CacheStats S;
+    ReadStats (&S);
+    if (S.Events >= EVICT_INTERVAL) {
+        Evict ();
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitCache (const char* Dir, unsigned long MaxSize)
+/* Use the given directory for the cache, and create it if it doesn't exist.
+** If the files in the cache take more than MaxSize bytes, the entries used
+** least recently are removed.
+*/
+{
+    struct stat Buf;
+    unsigned    Len = strlen (Dir);
+
+    /* Remember the directory without a trailing separator */
+    while (Len > 1 && (Dir[Len-1] == '/' || Dir[Len-1] == '\\')) {
+        --Len;
+    }
+    CacheDir = xmalloc (Len + 1);
+    memcpy (CacheDir, Dir, Len);
+    CacheDir[Len] = '\0';
+    CacheMaxSize = MaxSize;
+
+    /* Create the directory if needed */
+    if (FileStat (CacheDir, &Buf) != 0 && MakeDir (CacheDir) != 0) {
+        Error ("Cannot create cache directory `%s': %s",
+               CacheDir, strerror (errno));
+    }
+}
+
+
+
+void CacheAddProgram (StrBuf* Key, const char* Name)
+/* Add the identity of a program (its size and time of last modification) to
+** a cache key. The program is searched in PATH if the name has no directory.
+*/
+{
+    struct stat Buf;
+    char        Num[64];
+    int         Found;
+
+    if (strchr (Name, '/') != 0 || strchr (Name, '\\') != 0) {
+
+        /* The name has a directory */
+        StrBuf Path = AUTO_STRBUF_INITIALIZER;
+        SB_AppendStr (&Path, Name);
+        if (FileStat (SB_GetConstBuf (&Path), &Buf) != 0) {
+            SB_AppendStr (&Path, EXE_EXT);
+        }
+        SB_Terminate (&Path);
+        Found = (FileStat (SB_GetConstBuf (&Path), &Buf) == 0);
+        SB_Done (&Path);
+
+    } else {
+
+        /* Search in PATH */
+        const char* P = getenv ("PATH");
+        Found = 0;
+        while (P && *P && !Found) {
+            StrBuf Path = AUTO_STRBUF_INITIALIZER;
+            const char* End = strchr (P, PATH_SEP);
+            if (End == 0) {
+                End = P + strlen (P);
+            }
+            SB_AppendBuf (&Path, P, End - P);
+            SB_AppendChar (&Path, '/');
+            SB_AppendStr (&Path, Name);
+            SB_AppendStr (&Path, EXE_EXT);
+            SB_Terminate (&Path);
+            Found = (FileStat (SB_GetConstBuf (&Path), &Buf) == 0 &&
+                     (Buf.st_mode & S_IFMT) == S_IFREG);
+            SB_Done (&Path);
+            P = *End? End + 1 : End;
+        }
+    }
+    if (!Found) {
+        Error ("Cannot find `%s'", Name);
+    }
+
+    /* Add the name, size and time */
+    SB_AppendStr (Key, Name);
+    xsprintf (Num, sizeof (Num), " %lu %lu", (unsigned long) Buf.st_size,
+              (unsigned long) Buf.st_mtime);
+    SB_AppendStr (Key, Num);
+    SB_AppendChar (Key, '\0');
+}
+
+
+
+void CacheAddFile (StrBuf* Key, const char* Name)
+/* Add the contents of a file to a cache key */
+{
+    if (!ReadFile (Key, Name)) {
+        Error ("Cannot read `%s': %s", Name, strerror (errno));
+    }
+}
+
+
+
+CacheEntry* NewCacheEntry (const StrBuf* Key, const char* ObjName,
+                           const char* DepName, const char* FullDepName)
+/* Create a new cache entry for the given key. ObjName is the object file,
+** DepName and FullDepName are the dependency files or NULL.
+*/
+{
+    CacheEntry* E = xmalloc (sizeof (CacheEntry));
+    HashKey (E->Hash, Key);
+    E->Files[0] = xstrdup (ObjName);
+    E->Files[1] = DepName? xstrdup (DepName) : 0;
+    E->Files[2] = FullDepName? xstrdup (FullDepName) : 0;
+    return E;
+}
+
+
+
+void FreeCacheEntry (CacheEntry* E)
+/* Free a cache entry */
+{
+    unsigned I;
+    for (I = 0; I < ENTRY_PARTS; ++I) {
+        xfree (E->Files[I]);
+    }
+    xfree (E);
+}
+
+
+
+int CacheRestore (const CacheEntry* E)
+/* Restore the files of a cache entry if it is in the cache. Returns true on
+** a hit, and false on a miss.
+*/
+{
+    StrBuf                  Data = AUTO_STRBUF_INITIALIZER;
+    const unsigned char*    P;
+    const unsigned char*    End;
+    unsigned long           Size[ENTRY_PARTS];
+    unsigned                I;
+    int                     Hit = 0;
+    char*                   Name = xmalloc (HASH_LEN + sizeof (ENTRY_EXT));
+    char*                   Path;
+
+    sprintf (Name, "%s%s", E->Hash, ENTRY_EXT);
+    Path = CachePath (Name);
+    xfree (Name);
+
+    /* Read the entry and check that it is complete */
+    if (ReadFile (&Data, Path)) {
+        P   = (const unsigned char*) SB_GetConstBuf (&Data);
+        End = P + SB_GetLen (&Data);
+        if ((unsigned long) (End - P) >= sizeof (ENTRY_MAGIC) - 1 &&
+            memcmp (P, ENTRY_MAGIC, sizeof (ENTRY_MAGIC) - 1) == 0) {
+            P += sizeof (ENTRY_MAGIC) - 1;
+            Hit = 1;
+            for (I = 0; I < ENTRY_PARTS && Hit; ++I) {
+                if (End - P < 4) {
+                    Hit = 0;
+                } else {
+                    Size[I] = Get32 (P);
+                    P += 4;
+                    if ((unsigned long) (End - P) < Size[I]) {
+                        Hit = 0;
+                    } else {
+                        P += Size[I];
+                    }
+                }
+            }
+        }
+    }
+
+    if (Hit) {
+
+        /* Write the files */
+        P = (const unsigned char*) SB_GetConstBuf (&Data) + sizeof (ENTRY_MAGIC) - 1;
+        for (I = 0; I < ENTRY_PARTS; ++I) {
+            P += 4;
+            if (E->Files[I] && !WriteFile (E->Files[I], (const char*) P, Size[I])) {
+                Error ("Cannot write to `%s': %s", E->Files[I], strerror (errno));
+            }
+            P += Size[I];
+        }
+
+        /* Mark the entry as used */
+        SetFileTimes (Path, time (0));
+    }
+
+    CountEvent (Hit? STAT_HIT : STAT_MISS);
+    SB_Done (&Data);
+    xfree (Path);
+
+    /* A hit doesn't make the cache larger, but the statistics file */
+    if (Hit) {
+        CheckSize ();
+    }
+    return Hit;
+}
+
+
+
+void CacheStore (const CacheEntry* E)
+/* Store the files of a cache entry in the cache, then remove old entries if
+** the cache is too large.
+*/
+{
+    StrBuf   Data = AUTO_STRBUF_INITIALIZER;
+    StrBuf   File = AUTO_STRBUF_INITIALIZER;
+    char     Name[HASH_LEN + 32];
+    char*    Path;
+    char*    TmpPath;
+    unsigned I;
+
+    /* Build the entry. Files that cannot be read are not stored. */
+    SB_AppendStr (&Data, ENTRY_MAGIC);
+    for (I = 0; I < ENTRY_PARTS; ++I) {
+        SB_Clear (&File);
+        if (E->Files[I] && !ReadFile (&File, E->Files[I])) {
+            SB_Done (&File);
+            SB_Done (&Data);
+            return;
+        }
+        Put32 (&Data, SB_GetLen (&File));
+        SB_Append (&Data, &File);
+    }
+    SB_Done (&File);
+
+    /* Write it to a temporary file which is unique for this process, then
+    ** rename it, so others sharing the cache never see an incomplete entry.
+    */
+    xsprintf (Name, sizeof (Name), "%s.%lu", E->Hash, GetPid ());
+    TmpPath = CachePath (Name);
+    xsprintf (Name, sizeof (Name), "%s%s", E->Hash, ENTRY_EXT);
+    Path = CachePath (Name);
+    if (!WriteFile (TmpPath, SB_GetConstBuf (&Data), SB_GetLen (&Data))) {
+        Warning ("Cannot write to cache file `%s': %s", TmpPath, strerror (errno));
+    } else if (rename (TmpPath, Path) != 0) {
+        /* Another process stored the same entry */
+        remove (TmpPath);
+    }
+    xfree (TmpPath);
+    xfree (Path);
+    SB_Done (&Data);
+
+    /* Keep the size of the cache within the limit */
+    CheckSize ();
+}
+
+
+
+void CachePrintStats (FILE* F)
+/* Print statistics about the cache */
+{
+    Collection     Files = AUTO_COLLECTION_INITIALIZER;
+    CacheStats     S;
+    unsigned long  Size = 0;
+    unsigned       I;
+
+    /* Count the events */
+    ReadStats (&S);
+
+    /* Get the size of the entries */
+    ReadEntryFiles (&Files);
+    for (I = 0; I < CollCount (&Files); ++I) {
+        Size += ((EntryFile*) CollAtUnchecked (&Files, I))->Size;
+    }
+
+    fprintf (F, "Cache directory:  %s\n", CacheDir);
+    fprintf (F, "Hits:             %lu\n", S.Hits);
+    fprintf (F, "Misses:           %lu\n", S.Misses);
+    if (S.Hits + S.Misses > 0) {
+        fprintf (F, "Hit rate:         %.1f%%\n",
+                 100.0 * S.Hits / (S.Hits + S.Misses));
+    }
+    fprintf (F, "Evicted entries:  %lu\n", S.Evictions);
+    fprintf (F, "Entries:          %u\n", CollCount (&Files));
+    fprintf (F, "Size:             %lu bytes (limit %lu)\n", Size, CacheMaxSize);
+
+    FreeEntryFiles (&Files);
+}
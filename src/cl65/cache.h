@@ -0,0 +1,104 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  cache.h                                  */
+/*                                                                           */
+/*                     Cache for the object files of cl65                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef CACHE_H
+#define CACHE_H
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An entry in the cache: The key, and the files that are stored in the
+** cache, or restored from it.
+*/
+typedef struct CacheEntry CacheEntry;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitCache (const char* Dir, unsigned long MaxSize);
+/* Use the given directory for the cache, and create it if it doesn't exist.
+** If the files in the cache take more than MaxSize bytes, the entries used
+** least recently are removed.
+*/
+
+void CacheAddProgram (StrBuf* Key, const char* Name);
+/* Add the identity of a program (its size and time of last modification) to
+** a cache key. The program is searched in PATH if the name has no directory.
+*/
+
+void CacheAddFile (StrBuf* Key, const char* Name);
+/* Add the contents of a file to a cache key */
+
+CacheEntry* NewCacheEntry (const StrBuf* Key, const char* ObjName,
+                           const char* DepName, const char* FullDepName);
+/* Create a new cache entry for the given key. ObjName is the object file,
+** DepName and FullDepName are the dependency files or NULL.
+*/
+
+void FreeCacheEntry (CacheEntry* E);
+/* Free a cache entry */
+
+int CacheRestore (const CacheEntry* E);
+/* Restore the files of a cache entry if it is in the cache. Returns true on
+** a hit, and false on a miss.
+*/
+
+void CacheStore (const CacheEntry* E);
+/* Store the files of a cache entry in the cache, then remove old entries if
+** the cache is too large.
+*/
+
+void CachePrintStats (FILE* F);
+/* Print statistics about the cache */
+
+
+
+/* End of cache.h */
+
+#endif
@@ -70,6 +70,7 @@
 /* common */
 #include "attrib.h"
 #include "cmdline.h"
+#include "coll.h"
 #include "filetype.h"
 #include "fname.h"
 #include "mmodel.h"
@@ -80,6 +81,7 @@
 #include "xmalloc.h"
 
 /* cl65 */
+#include "cache.h"
 #include "global.h"
 #include "error.h"
 
@@ -134,6 +136,25 @@ static const char* FullDepName = 0;
 /* Remember if we should link a module */
 static int Module = 0;
 
+/* Maximum count of jobs that translate input files in parallel */
+static unsigned MaxJobs = 1;
+
+/* Set if all translations write the same file (a listing for example), so
+** they must not run in parallel.
+*/
+static int CommonOutput = 0;
+
+/* Pipe the compiler output into the assembler instead of using a file */
+static int UsePipe = 0;
+
+/* The directory of the object file cache if it is used, its maximum size,
+** and a flag to print the statistics.
+*/
+static const char*   CacheDir    = 0;
+static unsigned long CacheSize   = 100UL * 1024UL * 1024UL;
+static int           CacheStats  = 0;
+static int           CacheReady  = 0;
+
 /* Extension used for a module */
 #define MODULE_EXT      ".o65"
 
@@ -391,13 +412,27 @@ static void CmdSetTarget (CmdDesc* Cmd, target_t Target)
 
 
 
-static void CmdPrint (CmdDesc* Cmd, FILE* F)
-/* Output the command line encoded in the command desc */
+static char** CmdCopyArgs (const CmdDesc* Cmd)
+/* Return a copy of the NULL terminated argument list of the command */
+{
+    unsigned I;
+    char** Args = xmalloc (Cmd->ArgCount * sizeof (char*));
+    for (I = 0; I < Cmd->ArgCount; ++I) {
+        Args[I] = Cmd->Args[I]? xstrdup (Cmd->Args[I]) : 0;
+    }
+    return Args;
+}
+
+
+
+static void FreeArgs (char** Args)
+/* Free an argument list returned by CmdCopyArgs */
 {
     unsigned I;
-    for (I = 0; I < Cmd->ArgCount && Cmd->Args[I] != 0; ++I) {
-        fprintf (F, "%s ", Cmd->Args[I]);
+    for (I = 0; Args[I] != 0; ++I) {
+        xfree (Args[I]);
     }
+    xfree (Args);
 }
 
 
@@ -429,25 +464,38 @@ static void SetTargetFiles (void)
 
 
 
-static void ExecProgram (CmdDesc* Cmd)
-/* Execute a subprocess with the given name/parameters. Exit on errors. */
+static void PrintArgs (char** Args)
+/* Output a NULL terminated argument list */
+{
+    unsigned I;
+    for (I = 0; Args[I] != 0; ++I) {
+        printf ("%s ", Args[I]);
+    }
+}
+
+
+
+static void RunProgram (char** Args)
+/* Execute a subprocess with the given NULL terminated argument list. The
+** first argument is the name of the program. Exit on errors.
+*/
 {
     int Status;
 
     /* If in debug mode, output the command line we will execute */
     if (Debug) {
         printf ("Executing: ");
-        CmdPrint (Cmd, stdout);
+        PrintArgs (Args);
         printf ("\n");
     }
 
     /* Call the program */
-    Status = spawnvp (P_WAIT, Cmd->Name, SPAWN_ARGV_CONST_CAST Cmd->Args);
+    Status = spawnvp (P_WAIT, Args[0], SPAWN_ARGV_CONST_CAST Args);
 
     /* Check the result code */
     if (Status < 0) {
         /* Error executing the program */
-        Error ("Cannot execute `%s': %s", Cmd->Name, strerror (errno));
+        Error ("Cannot execute `%s': %s", Args[0], strerror (errno));
     } else if (Status != 0) {
         /* Called program had an error */
         exit (Status);
@@ -456,6 +504,505 @@ static void ExecProgram (CmdDesc* Cmd)
 
 
 
+static void RemoveFile (const char* Name)
+/* Remove a temporary file, warn if this isn't possible */
+{
+    if (remove (Name) < 0) {
+        Warning ("Cannot remove temporary file `%s': %s",
+                 Name, strerror (errno));
+    }
+}
+
+
+
+#if defined(HAVE_JOBS)
+
+static void RunPipe (char** Args, char** PipeArgs, const char* PipeOutput)
+/* Execute two subprocesses with the output of the first one piped into the
+** second one. If the first one fails, the output file of the second one is
+** removed, since it was created from incomplete input. Exit on errors.
+*/
+{
+    int Status[2];
+
+    /* If in debug mode, output the command lines we will execute */
+    if (Debug) {
+        printf ("Executing: ");
+        PrintArgs (Args);
+        printf ("| ");
+        PrintArgs (PipeArgs);
+        printf ("\n");
+    }
+
+    /* Call the programs */
+    spawnpipe (Args, PipeArgs, Status);
+
+    /* Check the result codes */
+    if (Status[0] != 0) {
+        remove (PipeOutput);
+        exit (Status[0]);
+    } else if (Status[1] != 0) {
+        exit (Status[1]);
+    }
+}
+
+#endif
+
+
+
+/*****************************************************************************/
+/*                             Object file cache                             */
+/*****************************************************************************/
+
+
+
+/* Struct that describes the lookup of the results for a C file in the cache.
+** The preprocessor runs as part of the lookup, since its output is part of
+** the key. With jobs, the lookup runs in the job of the file.
+*/
+typedef struct CacheLookup CacheLookup;
+struct CacheLookup {
+    StrBuf      Key;            /* Key without the preprocessed source */
+    char**      PPArgs;         /* Preprocessor command */
+    char*       PPName;         /* Output file of the preprocessor */
+    char*       ObjName;        /* Object file */
+    char*       DepName;        /* Dependency file or NULL */
+    char*       FullDepName;    /* Full dependency file or NULL */
+    CacheEntry* Entry;          /* Entry to store the results after a miss */
+};
+
+
+
+static void FreeCacheLookup (CacheLookup* L)
+/* Free a cache lookup */
+{
+    SB_Done (&L->Key);
+    FreeArgs (L->PPArgs);
+    xfree (L->PPName);
+    xfree (L->ObjName);
+    xfree (L->DepName);
+    xfree (L->FullDepName);
+    if (L->Entry) {
+        FreeCacheEntry (L->Entry);
+    }
+    xfree (L);
+}
+
+
+
+static int RestoreFromCache (CacheLookup* L)
+/* Run the preprocessor, and restore the object file (and dependency files)
+** from the cache if they are there. Returns true on a hit. On a miss, the
+** entry that stores the results later is set. Exit on errors.
+*/
+{
+    /* Add the preprocessed source, which includes all headers */
+    RunProgram (L->PPArgs);
+    CacheAddFile (&L->Key, L->PPName);
+    RemoveFile (L->PPName);
+
+    /* Look up the entry */
+    L->Entry = NewCacheEntry (&L->Key, L->ObjName, L->DepName, L->FullDepName);
+    if (CacheRestore (L->Entry)) {
+        if (Debug) {
+            printf ("Restored `%s' from the cache\n", L->ObjName);
+        }
+        FreeCacheEntry (L->Entry);
+        L->Entry = 0;
+        return 1;
+    }
+    return 0;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Jobs                                    */
+/*****************************************************************************/
+
+
+
+/* If the system supports it, the commands that translate one input file are
+** collected in a job instead of running them at once. Up to MaxJobs jobs run
+** in parallel, each one in a child process that executes its commands one
+** after the other. The output of a job goes into temporary files and is
+** printed when the job is done, in the order of the input files. Linking
+** (and anything else that needs the results) waits for all jobs.
+*/
+#if defined(HAVE_JOBS)
+
+/* Struct that describes a command of a job */
+typedef struct JobCmd JobCmd;
+struct JobCmd {
+    char**      Args;           /* Argument list of the command */
+    char**      PipeArgs;       /* Command that reads the output or NULL */
+    char*       PipeOutput;     /* Output file of the second command */
+};
+
+/* Struct that describes a job */
+typedef struct Job Job;
+struct Job {
+    Collection  Cmds;           /* Commands of the job */
+    Collection  TempFiles;      /* Files to remove after the commands */
+    CacheLookup* Cache;         /* Cache lookup before the commands */
+    int         Pid;            /* Process id while the job is running */
+    FILE*       Out;            /* Standard output of the job */
+    FILE*       Err;            /* Standard error of the job */
+};
+
+/* The job that is currently set up, if any */
+static Job* CurJob = 0;
+
+/* The jobs not printed so far in the order of the input files. The first
+** JobsStarted of them have been started, JobsRunning are still running.
+*/
+static Collection Jobs = STATIC_COLLECTION_INITIALIZER;
+static unsigned JobsStarted = 0;
+static unsigned JobsRunning = 0;
+
+/* Exit code of the first job that failed, zero if none did */
+static int JobStatus = 0;
+
+
+
+static Job* NewJob (void)
+/* Create a new, empty job */
+{
+    Job* J = xmalloc (sizeof (Job));
+    InitCollection (&J->Cmds);
+    InitCollection (&J->TempFiles);
+    J->Cache = 0;
+    J->Pid = 0;
+    J->Out = 0;
+    J->Err = 0;
+    return J;
+}
+
+
+
+static void JobAddCmd (Job* J, const CmdDesc* Cmd, const CmdDesc* PipeTo,
+                       const char* PipeOutput)
+/* Add a command to a job. If PipeTo is not NULL, the output of the command
+** is piped into this second command which writes PipeOutput.
+*/
+{
+    JobCmd* C = xmalloc (sizeof (JobCmd));
+    C->Args = CmdCopyArgs (Cmd);
+    if (PipeTo) {
+        C->PipeArgs   = CmdCopyArgs (PipeTo);
+        C->PipeOutput = xstrdup (PipeOutput);
+    } else {
+        C->PipeArgs   = 0;
+        C->PipeOutput = 0;
+    }
+    CollAppend (&J->Cmds, C);
+}
+
+
+
+static void FreeJob (Job* J)
+/* Free a job including the output files */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&J->Cmds); ++I) {
+        JobCmd* C = CollAtUnchecked (&J->Cmds, I);
+        FreeArgs (C->Args);
+        if (C->PipeArgs) {
+            FreeArgs (C->PipeArgs);
+        }
+        xfree (C->PipeOutput);
+        xfree (C);
+    }
+    DoneCollection (&J->Cmds);
+    for (I = 0; I < CollCount (&J->TempFiles); ++I) {
+        xfree (CollAtUnchecked (&J->TempFiles, I));
+    }
+    DoneCollection (&J->TempFiles);
+    if (J->Cache) {
+        FreeCacheLookup (J->Cache);
+    }
+    if (J->Out) {
+        fclose (J->Out);
+    }
+    if (J->Err) {
+        fclose (J->Err);
+    }
+    xfree (J);
+}
+
+
+
+static void StartJob (Job* J)
+/* Start a job in a child process */
+{
+    /* Create the files that take the output of the job */
+    J->Out = tmpfile ();
+    J->Err = tmpfile ();
+    if (J->Out == 0 || J->Err == 0) {
+        Error ("Cannot create temporary file: %s", strerror (errno));
+    }
+
+    /* Make sure the child doesn't inherit buffered output */
+    fflush (stdout);
+    fflush (stderr);
+
+    J->Pid = forkjob (J->Out, J->Err);
+    if (J->Pid == 0) {
+
+        unsigned I;
+
+        /* The child: Use the results from the cache if they are there */
+        if (J->Cache && RestoreFromCache (J->Cache)) {
+            exit (EXIT_SUCCESS);
+        }
+
+        /* Run the commands. The first one that fails terminates the child
+        ** with its exit code.
+        */
+        for (I = 0; I < CollCount (&J->Cmds); ++I) {
+            JobCmd* C = CollAtUnchecked (&J->Cmds, I);
+            if (C->PipeArgs) {
+                RunPipe (C->Args, C->PipeArgs, C->PipeOutput);
+            } else {
+                RunProgram (C->Args);
+            }
+        }
+
+        /* Remove the intermediate files */
+        for (I = 0; I < CollCount (&J->TempFiles); ++I) {
+            RemoveFile (CollAtUnchecked (&J->TempFiles, I));
+        }
+
+        /* Store the results in the cache */
+        if (J->Cache && J->Cache->Entry) {
+            CacheStore (J->Cache->Entry);
+        }
+        exit (EXIT_SUCCESS);
+    }
+
+    ++JobsRunning;
+}
+
+
+
+static void CopyOutput (FILE* From, FILE* To)
+/* Copy the output of a job to the given stream */
+{
+    char Buf[4096];
+    size_t Count;
+
+    rewind (From);
+    while ((Count = fread (Buf, 1, sizeof (Buf), From)) > 0) {
+        fwrite (Buf, 1, Count, To);
+    }
+    fflush (To);
+}
+
+
+
+static void WaitJob (void)
+/* Wait until one of the running jobs is done, then print the output of all
+** jobs that are done and don't follow a job still running.
+*/
+{
+    unsigned I;
+    int Status;
+
+    /* Wait for a job and mark it as done */
+    int Pid = waitjob (&Status);
+    for (I = 0; I < JobsStarted; ++I) {
+        Job* J = CollAtUnchecked (&Jobs, I);
+        if (J->Pid == Pid) {
+            J->Pid = 0;
+            --JobsRunning;
+            if (Status != 0 && JobStatus == 0) {
+                JobStatus = Status;
+            }
+            break;
+        }
+    }
+
+    /* Print the output of the jobs in order */
+    while (JobsStarted > 0) {
+        Job* J = CollAtUnchecked (&Jobs, 0);
+        if (J->Pid != 0) {
+            break;
+        }
+        CopyOutput (J->Out, stdout);
+        CopyOutput (J->Err, stderr);
+        FreeJob (J);
+        CollDelete (&Jobs, 0);
+        --JobsStarted;
+    }
+}
+
+
+
+static void RunJobs (void)
+/* Start queued jobs while there are free slots. No new jobs are started
+** after one of them failed.
+*/
+{
+    while (JobStatus == 0              &&
+           JobsStarted < CollCount (&Jobs) &&
+           JobsRunning < MaxJobs) {
+        StartJob (CollAtUnchecked (&Jobs, JobsStarted++));
+    }
+}
+
+#endif
+
+
+
+static void BeginJob (void)
+/* Collect the commands for the next input file in a job if parallel jobs
+** were requested.
+*/
+{
+#if defined(HAVE_JOBS)
+    /* Don't use jobs if the translations write the same output file */
+    if (MaxJobs > 1 && !CommonOutput && (DoLink || OutputName == 0)) {
+        CurJob = NewJob ();
+    }
+#endif
+}
+
+
+
+static void EndJob (void)
+/* Queue the job for the current input file, and start it if possible */
+{
+#if defined(HAVE_JOBS)
+    Job* J = CurJob;
+    CurJob = 0;
+    if (J != 0) {
+        if (CollCount (&J->Cmds) == 0) {
+            /* Nothing to do for this file */
+            FreeJob (J);
+        } else {
+            CollAppend (&Jobs, J);
+            RunJobs ();
+        }
+    }
+#endif
+}
+
+
+
+static void FinishJobs (void)
+/* Wait until all jobs are done. Exit if one of them failed. */
+{
+#if defined(HAVE_JOBS)
+    RunJobs ();
+    while (JobsRunning > 0) {
+        WaitJob ();
+        RunJobs ();
+    }
+    if (JobStatus != 0) {
+        exit (JobStatus);
+    }
+#endif
+}
+
+
+
+static void ExecProgram (CmdDesc* Cmd)
+/* Execute a subprocess with the given name/parameters, or add it to the
+** current job. Exit on errors.
+*/
+{
+#if defined(HAVE_JOBS)
+    if (CurJob) {
+        JobAddCmd (CurJob, Cmd, 0, 0);
+        return;
+    }
+#endif
+    RunProgram (Cmd->Args);
+}
+
+
+
+#if defined(HAVE_JOBS)
+
+static void ExecPipe (CmdDesc* Cmd, CmdDesc* PipeTo, const char* PipeOutput)
+/* Execute two subprocesses with the output of the first one piped into the
+** second one which writes PipeOutput, or add them to the current job. Exit
+** on errors.
+*/
+{
+    if (CurJob) {
+        JobAddCmd (CurJob, Cmd, PipeTo, PipeOutput);
+    } else {
+        RunPipe (Cmd->Args, PipeTo->Args, PipeOutput);
+    }
+}
+
+#endif
+
+
+
+static int CheckCache (CacheLookup* L)
+/* Look up the results for a C file in the cache now, or at the start of the
+** current job. Returns true if they were restored now, L is freed in this
+** case. Exit on errors.
+*/
+{
+#if defined(HAVE_JOBS)
+    if (CurJob) {
+        CurJob->Cache = L;
+        return 0;
+    }
+#endif
+    if (RestoreFromCache (L)) {
+        if (DoLink) {
+            CmdAddFile (&LD65, L->ObjName);
+        }
+        FreeCacheLookup (L);
+        return 1;
+    }
+    return 0;
+}
+
+
+
+static void StoreInCache (CacheLookup* L)
+/* Store the results of a translation in the cache now, or when the current
+** job is done. L is freed, or owned by the job.
+*/
+{
+#if defined(HAVE_JOBS)
+    if (CurJob) {
+        return;
+    }
+#endif
+    if (L->Entry) {
+        CacheStore (L->Entry);
+    }
+    FreeCacheLookup (L);
+}
+
+
+
+static void RemoveTempFile (const char* Name)
+/* Remove a temporary file now, or when the current job is done */
+{
+#if defined(HAVE_JOBS)
+    if (CurJob) {
+        CollAppend (&CurJob->TempFiles, xstrdup (Name));
+        return;
+    }
+#endif
+    RemoveFile (Name);
+}
+
+
+
+/*****************************************************************************/
+/*                                Translation                                */
+/*****************************************************************************/
+
+
+
 static void Link (void)
 /* Link the resulting executable */
 {
@@ -572,10 +1119,7 @@ static void AssembleIntermediate (const char* SourceFile)
     AssembleFile (AsmName, CA65.ArgCount);
 
     /* Remove the input file */
-    if (remove (AsmName) < 0) {
-        Warning ("Cannot remove temporary file `%s': %s",
-                 AsmName, strerror (errno));
-    }
+    RemoveTempFile (AsmName);
 
     /* Free the assembler file name which was allocated from the heap */
     xfree (AsmName);
@@ -583,6 +1127,67 @@ static void AssembleIntermediate (const char* SourceFile)
 
 
 
+static int PipeOutput (void)
+/* Return true if the compiler output is piped into the assembler */
+{
+    /* In debug mode, the compiler prints its debug output to stdout, where
+    ** it would end up in the assembler input. Use an intermediate file then.
+    */
+    return UsePipe && !Debug;
+}
+
+
+
+#if defined(HAVE_JOBS)
+
+static void AssemblePipe (const char* SourceFile)
+/* Run the compiler with its output piped into the assembler. The command
+** line of the compiler must be complete, with "-" as the output file.
+*/
+{
+    char* ObjName;
+
+    /* Remember the current assembler argument count */
+    unsigned ArgCount = CA65.ArgCount;
+
+    /* Set the target system */
+    CmdSetTarget (&CA65, Target);
+
+    /* The assembler cannot derive the name of the object file from its
+    ** input, so set it explicitly. It's the name of the source file with
+    ** the extension replaced by ".o", or the output name if this is the
+    ** last processing step.
+    */
+    if (DoLink) {
+        ObjName = MakeFilename (SourceFile, ".o");
+        CmdAddFile (&LD65, ObjName);
+    } else if (OutputName) {
+        ObjName = xstrdup (OutputName);
+    } else {
+        ObjName = MakeFilename (SourceFile, ".o");
+    }
+    CmdSetOutput (&CA65, ObjName);
+
+    /* Read the input from stdin */
+    CmdAddArg (&CA65, "-");
+
+    /* Add a NULL pointer to terminate the argument list */
+    CmdAddArg (&CA65, 0);
+
+    /* Run the compiler and the assembler */
+    ExecPipe (&CC65, &CA65, ObjName);
+
+    /* Remove the excess arguments */
+    CmdDelArgs (&CA65, ArgCount);
+
+    /* Free the object file name */
+    xfree (ObjName);
+}
+
+#endif
+
+
+
 static void Assemble (const char* File)
 /* Assemble the given file */
 {
@@ -606,9 +1211,102 @@ static void Assemble (const char* File)
 
 
 
+static int UseCache (void)
+/* Return true if the cache is used. Initialize it on first use. */
+{
+    if (CacheDir && !CacheReady) {
+        InitCache (CacheDir, CacheSize);
+        CacheReady = 1;
+    }
+    return CacheReady;
+}
+
+
+
+static CacheLookup* NewCacheLookup (const char* File)
+/* Prepare the lookup of the object file (and dependency files) for a C file
+** in the cache. The command line of the compiler must be complete except for
+** the output and input files. Returns NULL if the results cannot be cached.
+*/
+{
+    CacheLookup* L;
+    StrBuf*      Key;
+    unsigned     ArgCount = CC65.ArgCount;
+    unsigned     I;
+
+    /* cl65 doesn't know the name of a dependency file without a name */
+    if ((DepName && *DepName == '\0') || (FullDepName && *FullDepName == '\0')) {
+        return 0;
+    }
+
+    /* The preprocessed source has neither the line structure nor the size
+    ** and time of the source files, which end up in the object file with
+    ** debug info or the source as comments.
+    */
+    for (I = 0; I < CC65.ArgCount; ++I) {
+        const char* Arg = CC65.Args[I];
+        if (strcmp (Arg, "-g") == 0 || strcmp (Arg, "--debug-info") == 0 ||
+            strcmp (Arg, "-T") == 0 || strcmp (Arg, "--add-source") == 0) {
+            return 0;
+        }
+    }
+
+    L = xmalloc (sizeof (CacheLookup));
+    SB_Init (&L->Key);
+    L->DepName     = DepName? xstrdup (DepName) : 0;
+    L->FullDepName = FullDepName? xstrdup (FullDepName) : 0;
+    L->Entry       = 0;
+    Key = &L->Key;
+
+    /* The key contains the programs, their options, and the name of the
+    ** input file, since it ends up in the debug info.
+    */
+    SB_AppendStr (Key, "cl65 ");
+    SB_AppendStr (Key, GetVersionAsString ());
+    SB_AppendChar (Key, '\0');
+    CacheAddProgram (Key, CC65.Name);
+    CacheAddProgram (Key, CA65.Name);
+    for (I = 0; I < CC65.ArgCount; ++I) {
+        SB_AppendStr (Key, CC65.Args[I]);
+        SB_AppendChar (Key, '\0');
+    }
+    for (I = 0; I < CA65.ArgCount; ++I) {
+        SB_AppendStr (Key, CA65.Args[I]);
+        SB_AppendChar (Key, '\0');
+    }
+    SB_AppendStr (Key, PipeOutput ()? "pipe" : "file");
+    SB_AppendChar (Key, '\0');
+    SB_AppendStr (Key, File);
+    SB_AppendChar (Key, '\0');
+
+    /* The preprocessor command. The preprocessed source includes all headers
+    ** and is added to the key by the lookup.
+    */
+    L->PPName = MakeFilename (File, ".i");
+    CmdAddArg (&CC65, "-E");
+    CmdSetOutput (&CC65, L->PPName);
+    CmdAddArg (&CC65, File);
+    CmdAddArg (&CC65, 0);
+    L->PPArgs = CmdCopyArgs (&CC65);
+    CmdDelArgs (&CC65, ArgCount);
+
+    /* The object file */
+    if (!DoLink && OutputName) {
+        L->ObjName = xstrdup (OutputName);
+    } else {
+        L->ObjName = MakeFilename (File, ".o");
+    }
+    return L;
+}
+
+
+
 static void Compile (const char* File)
 /* Compile the given file */
 {
+    /* Cache lookup for the results if the cache is used */
+    CacheLookup* Lookup = 0;
+
     /* Remember the current compiler argument count */
     unsigned ArgCount = CC65.ArgCount;
 
@@ -634,6 +1332,20 @@ static void Compile (const char* File)
                 xfree (ObjName);
             }
         }
+
+        /* Use the results from the cache if they are there */
+        if (UseCache ()) {
+            Lookup = NewCacheLookup (File);
+            if (Lookup && CheckCache (Lookup)) {
+                CmdDelArgs (&CC65, ArgCount);
+                return;
+            }
+        }
+
+        /* If the output is piped into the assembler, it goes to stdout */
+        if (PipeOutput ()) {
+            CmdSetOutput (&CC65, "-");
+        }
     } else {
         /* If we won't assemble, this is the final step. In this case, set
         ** the output name if it was given.
@@ -649,6 +1361,18 @@ static void Compile (const char* File)
     /* Add a NULL pointer to terminate the argument list */
     CmdAddArg (&CC65, 0);
 
+#if defined(HAVE_JOBS)
+    /* Run the compiler with the output piped into the assembler */
+    if (DoAssemble && PipeOutput ()) {
+        AssemblePipe (File);
+        CmdDelArgs (&CC65, ArgCount);
+        if (Lookup) {
+            StoreInCache (Lookup);
+        }
+        return;
+    }
+#endif
+
     /* Run the compiler */
     ExecProgram (&CC65);
 
@@ -662,14 +1386,21 @@ static void Compile (const char* File)
         /* Assemble the intermediate file and remove it */
         AssembleIntermediate (File);
     }
+
+    /* Store the results in the cache */
+    if (Lookup) {
+        StoreInCache (Lookup);
+    }
 }
 
 
 
 static void CompileRes (const char* File)
-/* Compile the given geos resource file */
+/* Compile the given geos resource file into an object file, or into an
+** assembler file if we won't assemble.
+*/
 {
-    /* Remember the current assembler argument count */
+    /* Remember the current resource compiler argument count */
     unsigned ArgCount = GRC.ArgCount;
 
     /* Resource files need an geos-apple or geos-cbm target but this
@@ -677,6 +1408,22 @@ static void CompileRes (const char* File)
     */
     CmdSetTarget (&GRC, Target);
 
+    if (DoAssemble) {
+        /* Let the resource compiler write the object file itself */
+        CmdAddArg (&GRC, "--object");
+        if (DoLink) {
+            /* The object file has the name of the input file with the
+            ** extension replaced by ".o".
+            */
+            char* ObjName = MakeFilename (File, ".o");
+            CmdAddFile (&LD65, ObjName);
+            xfree (ObjName);
+        } else if (OutputName) {
+            /* The -o option of grc65 names the C header */
+            CmdAddArg2 (&GRC, "-s", OutputName);
+        }
+    }
+
     /* Add the file as argument for the resource compiler */
     CmdAddArg (&GRC, File);
 
@@ -688,28 +1435,35 @@ static void CompileRes (const char* File)
 
     /* Remove the excess arguments */
     CmdDelArgs (&GRC, ArgCount);
-
-    /* If this is not the final step, assemble the generated file, then
-    ** remove it
-    */
-    if (DoAssemble) {
-        /* Assemble the intermediate file and remove it */
-        AssembleIntermediate (File);
-    }
 }
 
 
 
 static void ConvertO65 (const char* File)
-/* Convert an o65 object file into an assembler file */
+/* Convert an o65 object file into an object file, or into an assembler file
+** if we won't assemble.
+*/
 {
     /* Remember the current converter argument count */
     unsigned ArgCount = CO65.ArgCount;
 
-    /* If we won't assemble, this is the final step. In this case, set the
-    ** output name.
-    */
-    if (!DoAssemble && OutputName) {
+    if (DoAssemble) {
+        /* Let the converter write the object file itself, so there's no
+        ** need to run the assembler on a (possibly huge) intermediate file.
+        */
+        CmdAddArg (&CO65, "--object");
+        if (DoLink) {
+            /* The object file has the name of the input file with the
+            ** extension replaced by ".o".
+            */
+            char* ObjName = MakeFilename (File, ".o");
+            CmdAddFile (&LD65, ObjName);
+            xfree (ObjName);
+        } else if (OutputName) {
+            CmdSetOutput (&CO65, OutputName);
+        }
+    } else if (OutputName) {
+        /* This is the final step. In this case, set the output name */
         CmdSetOutput (&CO65, OutputName);
     }
 
@@ -724,14 +1478,6 @@ static void ConvertO65 (const char* File)
 
     /* Remove the excess arguments */
     CmdDelArgs (&CO65, ArgCount);
-
-    /* If this is not the final step, assemble the generated file, then
-    ** remove it
-    */
-    if (DoAssemble) {
-        /* Assemble the intermediate file and remove it */
-        AssembleIntermediate (File);
-    }
 }
 
 
@@ -788,6 +1534,9 @@ static void Usage (void)
             "  --bin-include-dir dir\t\tSet an assembler binary include directory\n"
             "  --bss-label name\t\tDefine and export a BSS segment label\n"
             "  --bss-name seg\t\tSet the name of the BSS segment\n"
+            "  --cache dir\t\t\tCache object files in this directory\n"
+            "  --cache-size size\t\tSet the maximum size of the cache\n"
+            "  --cache-stats\t\t\tPrint statistics of the cache\n"
             "  --cc-args options\t\tPass options to the compiler\n"
             "  --cfg-path path\t\tSpecify a config file search path\n"
             "  --check-stack\t\t\tGenerate stack overflow checks\n"
@@ -806,6 +1555,7 @@ static void Usage (void)
             "  --force-import sym\t\tForce an import of symbol `sym'\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet a compiler include directory path\n"
+            "  --jobs n\t\t\tTranslate up to n input files in parallel\n"
             "  --ld-args options\t\tPass options to the linker\n"
             "  --lib file\t\t\tLink this library\n"
             "  --lib-path path\t\tSpecify a library search path\n"
@@ -820,6 +1570,7 @@ static void Usage (void)
             "  --o65-model model\t\tOverride the o65 model\n"
             "  --obj file\t\t\tLink this object file\n"
             "  --obj-path path\t\tSpecify an object file search path\n"
+            "  --pipe\t\t\tPipe the compiler output into the assembler\n"
             "  --print-target-path\t\tPrint the target file path\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
@@ -904,6 +1655,42 @@ static void OptBssName (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptCache (const char* Opt attribute ((unused)), const char* Arg)
+/* Cache object files in the given directory */
+{
+    CacheDir = Arg;
+}
+
+
+
+static void OptCacheSize (const char* Opt, const char* Arg)
+/* Set the maximum size of the cache */
+{
+    char Unit = 0;
+    char Check;
+    int  Count = sscanf (Arg, "%lu%c%c", &CacheSize, &Unit, &Check);
+    if (Count == 2 && (Unit == 'k' || Unit == 'K')) {
+        CacheSize *= 1024UL;
+    } else if (Count == 2 && (Unit == 'm' || Unit == 'M')) {
+        CacheSize *= 1024UL * 1024UL;
+    } else if (Count == 2 && (Unit == 'g' || Unit == 'G')) {
+        CacheSize *= 1024UL * 1024UL * 1024UL;
+    } else if (Count != 1) {
+        InvArg (Opt, Arg);
+    }
+}
+
+
+
+static void OptCacheStats (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Print statistics of the cache */
+{
+    CacheStats = 1;
+}
+
+
+
 static void OptCCArgs (const char* Opt attribute ((unused)), const char* Arg)
 /* Pass arguments to the compiler */
 {
@@ -983,6 +1770,9 @@ static void OptCreateDep (const char* Opt attribute ((unused)), const char* Arg)
 
     /* Remember the file name for the assembler */
     DepName = Arg;
+
+    /* All translations write the same dependency file */
+    CommonOutput = 1;
 }
 
 
@@ -995,6 +1785,9 @@ static void OptCreateFullDep (const char* Opt attribute ((unused)), const char*
 
     /* Remember the file name for the assembler */
     FullDepName = Arg;
+
+    /* All translations write the same dependency file */
+    CommonOutput = 1;
 }
 
 
@@ -1072,6 +1865,17 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptJobs (const char* Opt, const char* Arg)
+/* Set the maximum count of parallel jobs */
+{
+    char Check;
+    if (sscanf (Arg, "%u%c", &MaxJobs, &Check) != 1 || MaxJobs == 0) {
+        InvArg (Opt, Arg);
+    }
+}
+
+
+
 static void OptLdArgs (const char* Opt attribute ((unused)), const char* Arg)
 /* Pass arguments to the linker */
 {
@@ -1108,6 +1912,9 @@ static void OptListing (const char* Opt attribute ((unused)), const char* Arg)
 /* Create an assembler listing */
 {
     CmdAddArg2 (&CA65, "-l", Arg);
+
+    /* All assemblies write the same listing */
+    CommonOutput = 1;
 }
 
 
@@ -1205,6 +2012,18 @@ static void OptObjPath (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptPipe (const char* Opt attribute ((unused)),
+                     const char* Arg attribute ((unused)))
+/* Pipe the compiler output into the assembler */
+{
+    /* Without support from the system, intermediate files are used */
+#if defined(HAVE_JOBS)
+    UsePipe = 1;
+#endif
+}
+
+
+
 static void OptPrintTargetPath (const char* Opt attribute ((unused)),
                                 const char* Arg attribute ((unused)))
 /* Print the target file path */
@@ -1355,6 +2174,9 @@ int main (int argc, char* argv [])
         { "--bin-include-dir",   1, OptBinIncludeDir  },
         { "--bss-label",         1, OptBssLabel       },
         { "--bss-name",          1, OptBssName        },
+        { "--cache",             1, OptCache          },
+        { "--cache-size",        1, OptCacheSize      },
+        { "--cache-stats",       0, OptCacheStats     },
         { "--cc-args",           1, OptCCArgs         },
         { "--cfg-path",          1, OptCfgPath        },
         { "--check-stack",       0, OptCheckStack     },
@@ -1373,6 +2195,7 @@ int main (int argc, char* argv [])
         { "--force-import",      1, OptForceImport    },
         { "--help",              0, OptHelp           },
         { "--include-dir",       1, OptIncludeDir     },
+        { "--jobs",              1, OptJobs           },
         { "--ld-args",           1, OptLdArgs         },
         { "--lib",               1, OptLib            },
         { "--lib-path",          1, OptLibPath        },
@@ -1387,6 +2210,7 @@ int main (int argc, char* argv [])
         { "--o65-model",         1, OptO65Model       },
         { "--obj",               1, OptObj            },
         { "--obj-path",          1, OptObjPath        },
+        { "--pipe",              0, OptPipe           },
         { "--print-target-path", 0, OptPrintTargetPath},
         { "--register-space",    1, OptRegisterSpace  },
         { "--register-vars",     0, OptRegisterVars   },
@@ -1599,6 +2423,9 @@ int main (int argc, char* argv [])
                 FirstInput = Arg;
             }
 
+            /* Collect the commands for the file in a job if possible */
+            BeginJob ();
+
             /* Determine the file type by the extension */
             switch (GetFileType (Arg)) {
 
@@ -1621,8 +2448,14 @@ int main (int argc, char* argv [])
                     break;
 
                 case FILETYPE_GR:
-                    /* Add to the resource compiler files */
+                    /* Add to the resource compiler files. The following
+                    ** files may include the generated header, so wait
+                    ** until the resource is compiled.
+                    */
+                    FinishJobs ();
                     CompileRes (Arg);
+                    EndJob ();
+                    FinishJobs ();
                     break;
 
                 case FILETYPE_O65:
@@ -1635,6 +2468,9 @@ int main (int argc, char* argv [])
 
             }
 
+            /* Queue the job */
+            EndJob ();
+
         }
 
         /* Next argument */
@@ -1642,15 +2478,26 @@ int main (int argc, char* argv [])
     }
 
     /* Check if we had any input files */
-    if (FirstInput == 0) {
+    if (FirstInput == 0 && !CacheStats) {
         Warning ("No input files");
     }
 
+    /* Wait until all input files are translated */
+    FinishJobs ();
+
     /* Link the given files if requested and if we have any */
     if (DoLink && LD65.FileCount > 0) {
         Link ();
     }
 
+    /* Print the statistics of the cache if requested */
+    if (CacheStats) {
+        if (!UseCache ()) {
+            Error ("No cache directory given");
+        }
+        CachePrintStats (stdout);
+    }
+
     /* Return an apropriate exit code */
     return EXIT_SUCCESS;
 }
@@ -49,6 +49,7 @@
 #include "global.h"
 #include "model.h"
 #include "o65.h"
+#include "objfile.h"
 #include "convert.h"
 
 
@@ -447,6 +448,13 @@ void Convert (const O65Data* D)
         return;
     }
 
+    /* Write an object file instead of assembler source if requested */
+    if (ObjOutput) {
+        WriteObjFile (D, Author);
+        xfree (Author);
+        return;
+    }
+
     /* Open the output file */
     F = fopen (OutputName, "w");
     if (F == 0) {
@@ -53,6 +53,7 @@ const char* OutputName      = 0;                /* Name of output file */
 
 /* Default extensions */
 const char AsmExt[]         = ".s";             /* Default assembler extension */
+const char ObjExt[]         = ".o";             /* Default object file extension */
 
 /* Segment names */
 const char* CodeSeg         = SEGNAME_CODE;     /* Name of the code segment */
@@ -69,3 +70,4 @@ const char* ZeropageLabel   = 0;                /* Label for the zeropage segmen
 /* Flags */
 unsigned char DebugInfo     = 0;                /* Enable debug info */
 unsigned char NoOutput      = 0;                /* Suppress the actual conversion */
+unsigned char ObjOutput     = 0;                /* Write an object file */
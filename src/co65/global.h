@@ -50,6 +50,7 @@ extern const char*      OutputName;         /* Name of output file */
 
 /* Default extensions */
 extern const char       AsmExt[];           /* Default assembler extension */
+extern const char       ObjExt[];           /* Default object file extension */
 
 /* Segment names */
 extern const char*      CodeSeg;            /* Name of the code segment */
@@ -66,6 +67,7 @@ extern const char*      ZeropageLabel;      /* Label for the zeropage segment */
 /* Flags */
 extern unsigned char    DebugInfo;          /* Enable debug info */
 extern unsigned char    NoOutput;           /* Suppress the actual conversion */
+extern unsigned char    ObjOutput;          /* Write an object file */
 
 
 
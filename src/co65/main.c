@@ -89,6 +89,7 @@ static void Usage (void)
             "  --help\t\tHelp (this text)\n"
             "  --no-output\t\tDon't generate an output file\n"
             "  --o65-model model\tOverride the o65 model\n"
+            "  --object\t\tWrite an object file instead of assembler source\n"
             "  --verbose\t\tIncrease verbosity\n"
             "  --version\t\tPrint the version number\n"
             "  --zeropage-label name\tDefine and export a ZEROPAGE segment label\n"
@@ -250,6 +251,15 @@ static void OptO65Model (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptObject (const char* Opt attribute ((unused)),
+                       const char* Arg attribute ((unused)))
+/* Handle the --object option */
+{
+    ObjOutput = 1;
+}
+
+
+
 static void OptVerbose (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Increase verbosity */
@@ -325,6 +335,7 @@ int main (int argc, char* argv [])
         { "--help",             0,      OptHelp                 },
         { "--no-output",        0,      OptNoOutput             },
         { "--o65-model",        1,      OptO65Model             },
+        { "--object",           0,      OptObject               },
         { "--verbose",          0,      OptVerbose              },
         { "--version",          0,      OptVersion              },
         { "--zeropage-label",   1,      OptZeropageLabel        },
@@ -404,7 +415,7 @@ int main (int argc, char* argv [])
 
     /* Generate the name of the output file if none was specified */
     if (OutputName == 0) {
-        OutputName = MakeFilename (InputName, AsmExt);
+        OutputName = MakeFilename (InputName, ObjOutput? ObjExt : AsmExt);
     }
 
     /* Do the conversion */
@@ -0,0 +1,873 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objfile.c                                 */
+/*                                                                           */
+/*           Object file output for the co65 object file converter           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+/* common */
+#include "addrsize.h"
+#include "coll.h"
+#include "exprdefs.h"
+#include "filestat.h"
+#include "fragdefs.h"
+#include "lidefs.h"
+#include "objdefs.h"
+#include "objwrite.h"
+#include "optdefs.h"
+#include "scopedefs.h"
+#include "segnames.h"
+#include "strbuf.h"
+#include "strpool.h"
+#include "symdefs.h"
+#include "version.h"
+#include "xmalloc.h"
+#include "xsprintf.h"
+
+/* co65 */
+#include "error.h"
+#include "global.h"
+#include "model.h"
+#include "o65.h"
+#include "objfile.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The segments of an o65 file. They are written as sections of the object
+** file in this order, except for the zero page of a cc65 module, which is
+** mapped to the zero page of the main program and has no section.
+*/
+enum {
+    SEG_CODE,
+    SEG_DATA,
+    SEG_BSS,
+    SEG_ZEROPAGE,
+    SEG_COUNT
+};
+
+/* Description of one segment. The start of the segment is used as base for
+** all relocated values, and is either a section of the object file, or an
+** imported symbol.
+*/
+typedef struct SegDesc SegDesc;
+struct SegDesc {
+    const char*     Name;           /* Name of the segment */
+    const char*     Label;          /* Label for the segment start */
+    unsigned        SymType;        /* Label type: SYM_LABEL or SYM_EQUATE */
+    unsigned char   AddrSize;       /* Address size of the label */
+    unsigned char   Op;             /* Base: EXPR_SECTION or EXPR_SYMBOL */
+    unsigned        Num;            /* Section or import number of the base */
+    unsigned        ExportId;       /* Export id of the label or ~0U */
+};
+static SegDesc Segs[SEG_COUNT];
+
+/* Number of sections written */
+static unsigned SectionCount;
+
+/* Object file header. The offsets include the header itself */
+static ObjHeader Header;
+
+/* Object file data following the header */
+static StrBuf Obj = STATIC_STRBUF_INITIALIZER;
+
+/* String pool */
+static StringPool* StrPool = 0;
+
+/* Object file import id of each o65 import, ~0U if the import is unused */
+static unsigned* ImportIds = 0;
+
+/* Names of the imports written to the object file */
+static Collection Imports = STATIC_COLLECTION_INITIALIZER;
+
+/* Export id of the first o65 export. Exported segment labels come first */
+static unsigned FirstExportId;
+
+/* o65 files don't have source positions. There is one line info referencing
+** the input file, and all items of the object file use it.
+*/
+#define LINE_INFO_ID    0U
+
+/* Symbols are written into the global scope */
+#define SCOPE_ID        0U
+
+
+
+/*****************************************************************************/
+/*                                  Helpers                                  */
+/*****************************************************************************/
+
+
+
+static void PutLineInfo (StrBuf* B)
+/* Append a line info list containing the one line info of the file */
+{
+    ObjPutVar (B, 1);
+    ObjPutVar (B, LINE_INFO_ID);
+}
+
+
+
+static void PutNoLineInfo (StrBuf* B)
+/* Append an empty line info list */
+{
+    ObjPutVar (B, 0);
+}
+
+
+
+static unsigned long ObjPos (void)
+/* Return the current position in the object file */
+{
+    return OBJ_HDR_SIZE + SB_GetLen (&Obj);
+}
+
+
+
+static unsigned StringId (const char* S)
+/* Return the id of S in the string pool */
+{
+    return SP_AddStr (StrPool, S);
+}
+
+
+
+/*****************************************************************************/
+/*                                Expressions                                */
+/*****************************************************************************/
+
+
+
+static void PutOffsExpr (StrBuf* B, unsigned char Op, unsigned Num, long Offs)
+/* Append the expression for a section or import plus an offset */
+{
+    if (Offs != 0) {
+        ObjPut8 (B, EXPR_PLUS);
+    }
+    ObjPut8 (B, Op);
+    ObjPutVar (B, Num);
+    if (Offs != 0) {
+        ObjPut8 (B, EXPR_LITERAL);
+        ObjPut32 (B, (unsigned long) Offs);
+    }
+}
+
+
+
+static void PutSegExpr (StrBuf* B, unsigned Seg, long Offs)
+/* Append the expression for an offset into one of the segments */
+{
+    PutOffsExpr (B, Segs[Seg].Op, Segs[Seg].Num, Offs);
+}
+
+
+
+static void PutRelocExpr (StrBuf* B, const O65Data* D, unsigned char SegID,
+                          unsigned long Val, const O65Reloc* R)
+/* Append the segment relative relocation expression. R is only used if the
+** expression contains an import, and may be NULL if this is an error (which
+** is then flagged).
+*/
+{
+    switch (SegID) {
+
+        case O65_SEGID_UNDEF:
+            if (R == 0) {
+                Error ("Relocation references an import which is not allowed here");
+            }
+            PutOffsExpr (B, EXPR_SYMBOL, ImportIds[R->SymIdx], (long) Val);
+            break;
+
+        case O65_SEGID_TEXT:
+            PutSegExpr (B, SEG_CODE, (long) (Val - D->Header.tbase));
+            break;
+
+        case O65_SEGID_DATA:
+            PutSegExpr (B, SEG_DATA, (long) (Val - D->Header.dbase));
+            break;
+
+        case O65_SEGID_BSS:
+            PutSegExpr (B, SEG_BSS, (long) (Val - D->Header.bbase));
+            break;
+
+        case O65_SEGID_ZP:
+            PutSegExpr (B, SEG_ZEROPAGE, (long) (Val - D->Header.zbase));
+            break;
+
+        case O65_SEGID_ABS:
+            ObjPut8 (B, EXPR_LITERAL);
+            ObjPut32 (B, Val);
+            break;
+
+        default:
+            Internal ("Cannot handle this segment reference in reloc entry");
+    }
+}
+
+
+
+static unsigned char ConstAddrSize (unsigned long Val)
+/* Return the address size of a constant the same way the assembler does */
+{
+    if ((Val & ~0xFFUL) == 0) {
+        return ADDR_SIZE_ZP;
+    } else if ((Val & ~0xFFFFUL) == 0) {
+        return ADDR_SIZE_ABS;
+    } else if ((Val & ~0xFFFFFFUL) == 0) {
+        return ADDR_SIZE_FAR;
+    } else {
+        return ADDR_SIZE_LONG;
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                 Segments                                  */
+/*****************************************************************************/
+
+
+
+static void SetupSegs (void)
+/* Setup the segment descriptions */
+{
+    static const char* const DefLabels[SEG_COUNT] = {
+        SEGNAME_CODE, SEGNAME_DATA, SEGNAME_BSS, SEGNAME_ZEROPAGE
+    };
+    const char* Names[SEG_COUNT];
+    const char* Labels[SEG_COUNT];
+    unsigned I;
+
+    Names[SEG_CODE]      = CodeSeg;
+    Names[SEG_DATA]      = DataSeg;
+    Names[SEG_BSS]       = BssSeg;
+    Names[SEG_ZEROPAGE]  = ZeropageSeg;
+    Labels[SEG_CODE]     = CodeLabel;
+    Labels[SEG_DATA]     = DataLabel;
+    Labels[SEG_BSS]      = BssLabel;
+    Labels[SEG_ZEROPAGE] = ZeropageLabel;
+
+    SectionCount  = 0;
+    FirstExportId = 0;
+    for (I = 0; I < SEG_COUNT; ++I) {
+        SegDesc* S  = Segs + I;
+        S->Name     = Names[I];
+        if (Labels[I]) {
+            /* Labels given on the command line are exported */
+            S->Label    = Labels[I];
+            S->ExportId = FirstExportId++;
+        } else {
+            S->Label    = DefLabels[I];
+            S->ExportId = ~0U;
+        }
+        if (I == SEG_ZEROPAGE && Model == O65_MODEL_CC65_MODULE) {
+            /* The zero page of a cc65 module is located by the linker
+            ** generated symbol __ZP_START__, which is always imported.
+            */
+            S->SymType  = SYM_EQUATE;
+            S->AddrSize = ADDR_SIZE_ABS;
+            S->Op       = EXPR_SYMBOL;
+            S->Num      = CollCount (&Imports);
+            CollAppend (&Imports, "__ZP_START__");
+        } else {
+            S->SymType  = SYM_LABEL;
+            S->AddrSize = (I == SEG_ZEROPAGE)? ADDR_SIZE_ZP : ADDR_SIZE_ABS;
+            S->Op       = EXPR_SECTION;
+            S->Num      = SectionCount++;
+        }
+    }
+}
+
+
+
+static void MarkImports (const O65Data* D, const Collection* Relocs)
+/* Assign object file ids to the imports used by the given relocations */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Relocs); ++I) {
+        const O65Reloc* R = CollConstAt (Relocs, I);
+        if (R->SegID == O65_SEGID_UNDEF) {
+            if (R->SymIdx >= CollCount (&D->Imports)) {
+                Error ("Import index out of range (input file corrupt)");
+            }
+            if (ImportIds[R->SymIdx] == ~0U) {
+                const O65Import* Import = CollConstAt (&D->Imports, R->SymIdx);
+                ImportIds[R->SymIdx] = CollCount (&Imports);
+                CollAppend (&Imports, (void*) Import->Name);
+            }
+        }
+    }
+}
+
+
+
+static void PutLiteral (StrBuf* B, const unsigned char* Data, unsigned long Size)
+/* Append a literal fragment */
+{
+    ObjPut8 (B, FRAG_LITERAL);
+    ObjPutVar (B, Size);
+    SB_AppendBuf (B, (const char*) Data, Size);
+    PutLineInfo (B);
+}
+
+
+
+static unsigned ConvertSeg (StrBuf* B, const O65Data* D, const Collection* Relocs,
+                            const unsigned char* Data, unsigned long Size)
+/* Convert the data of one segment into fragments and return their count.
+** Relocations against absolute values need no expression, so the data
+** stays literal in this case.
+*/
+{
+    const O65Reloc* R;
+    unsigned        RIdx;
+    unsigned long   Byte;
+    unsigned long   Start;
+    unsigned        Count;
+
+    /* Get the pointer to the first relocation entry if there are any */
+    R = (CollCount (Relocs) > 0)? CollConstAt (Relocs, 0) : 0;
+
+    /* Initialize for the loop */
+    RIdx  = 0;
+    Byte  = 0;
+    Start = 0;
+    Count = 0;
+
+    /* Walk over the segment data */
+    while (Byte < Size) {
+
+        if (R && R->Offs == Byte) {
+            /* We've reached an entry that must be relocated */
+            unsigned long Val;
+            unsigned      Len;
+            unsigned char Op;
+            switch (R->Type) {
+
+                case O65_RTYPE_WORD:
+                    if (Byte >= Size - 1) {
+                        Error ("Found WORD relocation, but not enough bytes left");
+                    }
+                    Val = (Data[Byte+1] << 8) + Data[Byte];
+                    Len = 2;
+                    Op  = EXPR_NULL;
+                    break;
+
+                case O65_RTYPE_HIGH:
+                    Val = (Data[Byte] << 8) + R->Val;
+                    Len = 1;
+                    Op  = EXPR_BYTE1;
+                    break;
+
+                case O65_RTYPE_LOW:
+                    Val = Data[Byte];
+                    Len = 1;
+                    Op  = EXPR_BYTE0;
+                    break;
+
+                case O65_RTYPE_SEGADDR:
+                    if (Byte >= Size - 2) {
+                        Error ("Found SEGADDR relocation, but not enough bytes left");
+                    }
+                    Val = (((unsigned long) Data[Byte+2]) << 16) +
+                          (((unsigned long) Data[Byte+1]) <<  8) +
+                          (((unsigned long) Data[Byte+0]) <<  0) +
+                          R->Val;
+                    Len = 3;
+                    Op  = EXPR_NULL;
+                    break;
+
+                case O65_RTYPE_SEG:
+                    /* FALLTHROUGH for now */
+                default:
+                    Internal ("Cannot handle relocation type %d at %lu",
+                              R->Type, Byte);
+            }
+
+            if (R->SegID != O65_SEGID_ABS) {
+
+                /* Flush the literal data before the relocated bytes */
+                if (Byte > Start) {
+                    PutLiteral (B, Data + Start, Byte - Start);
+                    ++Count;
+                }
+
+                /* Append the expression fragment */
+                ObjPut8 (B, FRAG_EXPR | Len);
+                if (Op != EXPR_NULL) {
+                    ObjPut8 (B, Op);
+                    PutRelocExpr (B, D, R->SegID, Val, R);
+                    ObjPut8 (B, EXPR_NULL);
+                } else {
+                    PutRelocExpr (B, D, R->SegID, Val, R);
+                }
+                PutLineInfo (B);
+                ++Count;
+
+                Start = Byte + Len;
+            }
+            Byte += Len;
+
+            /* Get the next relocation entry */
+            if (++RIdx < CollCount (Relocs)) {
+                R = CollConstAt (Relocs, RIdx);
+            } else {
+                R = 0;
+            }
+
+        } else {
+            /* Just a constant value */
+            ++Byte;
+        }
+    }
+
+    /* Flush the remaining literal data */
+    if (Size > Start) {
+        PutLiteral (B, Data + Start, Size - Start);
+        ++Count;
+    }
+
+    /* Return the number of fragments */
+    return Count;
+}
+
+
+
+static void WriteSection (unsigned Seg, unsigned long Size,
+                          const StrBuf* Frags, unsigned FragCount)
+/* Write one section with the given fragments */
+{
+    StrBuf S = STATIC_STRBUF_INITIALIZER;
+
+    ObjPutVar (&S, StringId (Segs[Seg].Name));     /* Name of the segment */
+    ObjPutVar (&S, 0);                             /* Segment flags */
+    ObjPutVar (&S, Size);                          /* Size */
+    ObjPutVar (&S, 1);                             /* Alignment */
+    ObjPut8 (&S, (Seg == SEG_ZEROPAGE)? ADDR_SIZE_ZP : ADDR_SIZE_ABS);
+    ObjPutVar (&S, FragCount);                     /* Number of fragments */
+    SB_Append (&S, Frags);
+
+    /* The section is preceeded by the size of its data */
+    ObjPut32 (&Obj, SB_GetLen (&S));
+    SB_Append (&Obj, &S);
+
+    SB_Done (&S);
+}
+
+
+
+static void WriteFillSection (unsigned Seg, unsigned long Size)
+/* Write a section that contains just uninitialized data */
+{
+    StrBuf Frags = STATIC_STRBUF_INITIALIZER;
+    unsigned Count = 0;
+
+    if (Size > 0) {
+        ObjPut8 (&Frags, FRAG_FILL);
+        ObjPutVar (&Frags, Size);
+        PutLineInfo (&Frags);
+        ++Count;
+    }
+    WriteSection (Seg, Size, &Frags, Count);
+
+    SB_Done (&Frags);
+}
+
+
+
+static void WriteSegments (const O65Data* D)
+/* Write the sections to the object file */
+{
+    StrBuf   Frags = STATIC_STRBUF_INITIALIZER;
+    unsigned Count;
+
+    Header.SegOffs = ObjPos ();
+    ObjPutVar (&Obj, SectionCount);
+
+    /* Code segment */
+    Count = ConvertSeg (&Frags, D, &D->TextReloc, D->Text, D->Header.tlen);
+    WriteSection (SEG_CODE, D->Header.tlen, &Frags, Count);
+
+    /* Data segment */
+    SB_Clear (&Frags);
+    Count = ConvertSeg (&Frags, D, &D->DataReloc, D->Data, D->Header.dlen);
+    WriteSection (SEG_DATA, D->Header.dlen, &Frags, Count);
+
+    /* BSS and zero page segment */
+    WriteFillSection (SEG_BSS, D->Header.blen);
+    if (Segs[SEG_ZEROPAGE].Op == EXPR_SECTION) {
+        WriteFillSection (SEG_ZEROPAGE, D->Header.zlen);
+    }
+
+    Header.SegSize = ObjPos () - Header.SegOffs;
+
+    SB_Done (&Frags);
+}
+
+
+
+/*****************************************************************************/
+/*                                  Symbols                                  */
+/*****************************************************************************/
+
+
+
+static unsigned PutExportValue (StrBuf* B, const O65Data* D, const O65Export* E,
+                                unsigned char* AddrSize)
+/* Append the value of an o65 export and return its flags. The address size
+** of the export is returned in AddrSize.
+*/
+{
+    if (E->SegID == O65_SEGID_ABS) {
+        ObjPut32 (B, E->Val);
+        *AddrSize = ConstAddrSize (E->Val);
+        return SYM_CONST | SYM_EQUATE;
+    } else {
+        PutRelocExpr (B, D, E->SegID, E->Val, 0);
+        if (E->SegID == O65_SEGID_ZP) {
+            *AddrSize = Segs[SEG_ZEROPAGE].AddrSize;
+        } else {
+            *AddrSize = ADDR_SIZE_ABS;
+        }
+        return SYM_EXPR | SYM_EQUATE;
+    }
+}
+
+
+
+static void WriteImports (void)
+/* Write the imports to the object file. Since only imports referenced by
+** relocations are written, they get the line info as reference, too.
+*/
+{
+    unsigned I;
+
+    Header.ImportOffs = ObjPos ();
+    ObjPutVar (&Obj, CollCount (&Imports));
+    for (I = 0; I < CollCount (&Imports); ++I) {
+        ObjPut8 (&Obj, ADDR_SIZE_ABS);
+        ObjPutVar (&Obj, StringId (CollConstAt (&Imports, I)));
+        PutLineInfo (&Obj);
+        PutLineInfo (&Obj);
+    }
+    Header.ImportSize = ObjPos () - Header.ImportOffs;
+}
+
+
+
+static void WriteExports (const O65Data* D)
+/* Write the exports to the object file. The segment labels given on the
+** command line come first.
+*/
+{
+    unsigned I;
+
+    Header.ExportOffs = ObjPos ();
+    ObjPutVar (&Obj, FirstExportId + CollCount (&D->Exports));
+
+    for (I = 0; I < SEG_COUNT; ++I) {
+        const SegDesc* S = Segs + I;
+        if (S->ExportId != ~0U) {
+            ObjPutVar (&Obj, SYM_EXPR | S->SymType | SYM_EXPORT);
+            ObjPut8 (&Obj, S->AddrSize);
+            ObjPutVar (&Obj, StringId (S->Label));
+            PutSegExpr (&Obj, I, 0);
+            PutLineInfo (&Obj);
+            PutNoLineInfo (&Obj);
+        }
+    }
+
+    for (I = 0; I < CollCount (&D->Exports); ++I) {
+        const O65Export* E = CollConstAt (&D->Exports, I);
+        StrBuf          Val = STATIC_STRBUF_INITIALIZER;
+        unsigned char   AddrSize;
+        unsigned        Flags = PutExportValue (&Val, D, E, &AddrSize);
+
+        ObjPutVar (&Obj, Flags | SYM_EXPORT);
+        ObjPut8 (&Obj, AddrSize);
+        ObjPutVar (&Obj, StringId (E->Name));
+        SB_Append (&Obj, &Val);
+        PutLineInfo (&Obj);
+        PutNoLineInfo (&Obj);
+
+        SB_Done (&Val);
+    }
+
+    Header.ExportSize = ObjPos () - Header.ExportOffs;
+}
+
+
+
+static void WriteDbgSyms (const O65Data* D)
+/* Write the debug symbols to the object file. These are the segment labels,
+** the imports and the o65 exports, all in the global scope.
+*/
+{
+    unsigned I;
+
+    Header.DbgSymOffs = ObjPos ();
+
+    if (DebugInfo) {
+
+        ObjPutVar (&Obj, SEG_COUNT + CollCount (&Imports) + CollCount (&D->Exports));
+
+        /* Segment labels */
+        for (I = 0; I < SEG_COUNT; ++I) {
+            const SegDesc* S = Segs + I;
+            unsigned Flags = SYM_EXPR | S->SymType;
+            if (S->ExportId != ~0U) {
+                Flags |= SYM_EXPORT;
+            }
+            ObjPutVar (&Obj, Flags);
+            ObjPut8 (&Obj, S->AddrSize);
+            ObjPutVar (&Obj, SCOPE_ID);
+            ObjPutVar (&Obj, StringId (S->Label));
+            PutSegExpr (&Obj, I, 0);
+            if (S->ExportId != ~0U) {
+                ObjPutVar (&Obj, S->ExportId);
+            }
+            PutLineInfo (&Obj);
+            PutNoLineInfo (&Obj);
+        }
+
+        /* Imports */
+        for (I = 0; I < CollCount (&Imports); ++I) {
+            ObjPutVar (&Obj, SYM_EXPR | SYM_EQUATE | SYM_IMPORT);
+            ObjPut8 (&Obj, ADDR_SIZE_ABS);
+            ObjPutVar (&Obj, SCOPE_ID);
+            ObjPutVar (&Obj, StringId (CollConstAt (&Imports, I)));
+            ObjPut8 (&Obj, EXPR_NULL);
+            ObjPutVar (&Obj, I);
+            PutLineInfo (&Obj);
+            PutLineInfo (&Obj);
+        }
+
+        /* Exports */
+        for (I = 0; I < CollCount (&D->Exports); ++I) {
+            const O65Export* E = CollConstAt (&D->Exports, I);
+            StrBuf          Val = STATIC_STRBUF_INITIALIZER;
+            unsigned char   AddrSize;
+            unsigned        Flags = PutExportValue (&Val, D, E, &AddrSize);
+
+            ObjPutVar (&Obj, Flags | SYM_EXPORT);
+            ObjPut8 (&Obj, AddrSize);
+            ObjPutVar (&Obj, SCOPE_ID);
+            ObjPutVar (&Obj, StringId (E->Name));
+            SB_Append (&Obj, &Val);
+            ObjPutVar (&Obj, FirstExportId + I);
+            PutLineInfo (&Obj);
+            PutNoLineInfo (&Obj);
+
+            SB_Done (&Val);
+        }
+
+    } else {
+        ObjPutVar (&Obj, 0);
+    }
+
+    /* No high level language symbols */
+    ObjPutVar (&Obj, 0);
+
+    Header.DbgSymSize = ObjPos () - Header.DbgSymOffs;
+}
+
+
+
+/*****************************************************************************/
+/*                             Other object data                             */
+/*****************************************************************************/
+
+
+
+static void WriteOptions (const char* Author)
+/* Write the object file options */
+{
+    char Buf[256];
+
+    Header.OptionOffs = ObjPos ();
+
+    ObjPutVar (&Obj, Author? 3 : 2);
+    xsprintf (Buf, sizeof (Buf), "co65 V%s", GetVersionAsString ());
+    ObjPut8 (&Obj, OPT_TRANSLATOR);
+    ObjPutVar (&Obj, StringId (Buf));
+    ObjPut8 (&Obj, OPT_DATETIME);
+    ObjPutVar (&Obj, (unsigned long) time (0));
+    if (Author) {
+        ObjPut8 (&Obj, OPT_AUTHOR);
+        ObjPutVar (&Obj, StringId (Author));
+    }
+
+    Header.OptionSize = ObjPos () - Header.OptionOffs;
+}
+
+
+
+static void WriteFiles (void)
+/* Write the file table, which contains just the input file */
+{
+    struct stat StatBuf;
+    if (FileStat (InputName, &StatBuf) != 0) {
+        Error ("Cannot stat input file `%s': %s", InputName, strerror (errno));
+    }
+
+    Header.FileOffs = ObjPos ();
+    ObjPutVar (&Obj, 1);
+    ObjPutVar (&Obj, StringId (InputName));
+    ObjPut32 (&Obj, (unsigned long) StatBuf.st_mtime);
+    ObjPutVar (&Obj, (unsigned long) StatBuf.st_size);
+    Header.FileSize = ObjPos () - Header.FileOffs;
+}
+
+
+
+static void WriteScopes (void)
+/* Write the scope table. With debug info, there's just the file scope */
+{
+    Header.ScopeOffs = ObjPos ();
+    if (DebugInfo) {
+        ObjPutVar (&Obj, 1);
+        ObjPutVar (&Obj, 0);                       /* Parent id */
+        ObjPutVar (&Obj, 0);                       /* Lexical level */
+        ObjPutVar (&Obj, SCOPE_SIZELESS | SCOPE_UNLABELED);
+        ObjPutVar (&Obj, SCOPE_FILE);
+        ObjPutVar (&Obj, StringId (""));
+        ObjPutVar (&Obj, 0);                       /* No spans */
+    } else {
+        ObjPutVar (&Obj, 0);
+    }
+    Header.ScopeSize = ObjPos () - Header.ScopeOffs;
+}
+
+
+
+static void WriteLineInfos (void)
+/* Write the line info table */
+{
+    Header.LineInfoOffs = ObjPos ();
+    ObjPutVar (&Obj, 1);
+    ObjPutVar (&Obj, 0);                           /* Line */
+    ObjPutVar (&Obj, 0);                           /* Column */
+    ObjPutVar (&Obj, 0);                           /* File */
+    ObjPutVar (&Obj, LI_MAKE_TYPE (LI_TYPE_ASM, 0));
+    ObjPutVar (&Obj, 0);                           /* No spans */
+    Header.LineInfoSize = ObjPos () - Header.LineInfoOffs;
+}
+
+
+
+static void WriteStrPool (void)
+/* Write the string pool */
+{
+    Header.StrPoolOffs = ObjPos ();
+    ObjPutStrPool (&Obj, StrPool);
+    Header.StrPoolSize = ObjPos () - Header.StrPoolOffs;
+}
+
+
+
+static void WriteEmpty (unsigned long* Offs, unsigned long* Size)
+/* Write an empty table */
+{
+    *Offs = ObjPos ();
+    ObjPutVar (&Obj, 0);
+    *Size = ObjPos () - *Offs;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void WriteObjFile (const O65Data* D, const char* Author)
+/* Write the o65 file in D as a cc65 object file to OutputName. Author is the
+** text of the author option of the o65 file, or NULL if there was none.
+*/
+{
+    unsigned I;
+    int      Err;
+
+    /* Initialize the data, the empty string has always id zero */
+    memset (&Header, 0, sizeof (Header));
+    Header.Magic   = OBJ_MAGIC;
+    Header.Version = OBJ_VERSION;
+    if (DebugInfo) {
+        Header.Flags |= OBJ_FLAGS_DBGINFO;
+    }
+    StrPool = NewStringPool (211);
+    StringId ("");
+
+    /* Setup the segments, and determine the imports needed. Unused o65
+    ** imports are dropped.
+    */
+    SetupSegs ();
+    ImportIds = xmalloc (CollCount (&D->Imports) * sizeof (ImportIds[0]) + 1);
+    for (I = 0; I < CollCount (&D->Imports); ++I) {
+        ImportIds[I] = ~0U;
+    }
+    MarkImports (D, &D->TextReloc);
+    MarkImports (D, &D->DataReloc);
+
+    /* Create the object file in memory, in the order used by the assembler */
+    WriteOptions (Author);
+    WriteFiles ();
+    WriteSegments (D);
+    WriteImports ();
+    WriteExports (D);
+    WriteDbgSyms (D);
+    WriteScopes ();
+    WriteLineInfos ();
+    WriteStrPool ();
+    WriteEmpty (&Header.AssertOffs, &Header.AssertSize);
+    WriteEmpty (&Header.SpanOffs, &Header.SpanSize);
+
+    /* Write the file */
+    Err = ObjWriteFile (OutputName, &Header, &Obj);
+    if (Err != 0) {
+        Error ("Cannot write to `%s': %s", OutputName, strerror (Err));
+    }
+
+    /* Free the data */
+    SB_Done (&Obj);
+    FreeStringPool (StrPool);
+    StrPool = 0;
+    xfree (ImportIds);
+    ImportIds = 0;
+    CollDeleteAll (&Imports);
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objfile.h                                 */
+/*                                                                           */
+/*           Object file output for the co65 object file converter           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJFILE_H
+#define OBJFILE_H
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Forward definition */
+struct O65Data;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void WriteObjFile (const struct O65Data* D, const char* Author);
+/* Write the o65 file in D as a cc65 object file to OutputName. Author is the
+** text of the author option of the o65 file, or NULL if there was none.
+*/
+
+
+
+/* End of objfile.h */
+
+#endif
@@ -47,6 +47,7 @@
 /* Masks for the fragment type byte */
 #define FRAG_TYPEMASK   0x38            /* Mask the type of the fragment */
 #define FRAG_BYTEMASK   0x07            /* Mask for byte count */
+#define FRAG_FLAGMASK   0xC0            /* Mask for the flags */
 
 /* Fragment types */
 #define FRAG_LITERAL    0x00            /* Literal data */
@@ -65,6 +66,9 @@
 
 #define FRAG_FILL       0x20            /* Fill bytes */
 
+/* Fragment flags */
+#define FRAG_OPERAND    0x40            /* Expression is an instruction operand */
+
 
 
 /* End of fragdefs.h */
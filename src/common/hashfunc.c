@@ -89,3 +89,97 @@ unsigned HashBuf (const StrBuf* S)
     }
     return H;
 }
+
+
+
+/* HashData128 is MurmurHash3 (x86, 128 bit). The hash isn't meant to be
+** secure, but 128 bits make collisions practically impossible.
+*/
+#define ROTL32(X, R)    ((((X) << (R)) | ((X) >> (32 - (R)))) & 0xFFFFFFFFUL)
+
+
+
+static unsigned long FMix (unsigned long H)
+/* Final mix of a hash lane */
+{
+    H ^= H >> 16;
+    H = (H * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+    H ^= H >> 13;
+    H = (H * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+    H ^= H >> 16;
+    return H;
+}
+
+
+
+void HashData128 (unsigned long Hash[4], const void* Buf, unsigned long Len)
+/* Compute a 128 bit hash of Len bytes of data and store it in Hash as four
+** 32 bit values.
+*/
+{
+    static const unsigned long C[5] = {
+        0x239B961BUL, 0xAB0E9789UL, 0x38B34AE5UL, 0xA1E38B93UL, 0x239B961BUL
+    };
+    static const unsigned long A[4] = {
+        0x561CCD1BUL, 0x0BCAA747UL, 0x96CD1C35UL, 0x32AC3B17UL
+    };
+    static const unsigned KRot[4] = { 15, 16, 17, 18 };
+    static const unsigned HRot[4] = { 19, 17, 15, 13 };
+
+    const unsigned char* Data = Buf;
+    unsigned long*       H    = Hash;
+    unsigned long        K[4];
+    unsigned long        Pos;
+    unsigned             I;
+
+    /* Start with a zero seed */
+    H[0] = H[1] = H[2] = H[3] = 0;
+
+    /* Body: 16 byte blocks */
+    for (Pos = 0; Pos + 16 <= Len; Pos += 16) {
+        for (I = 0; I < 4; ++I) {
+            const unsigned char* P = Data + Pos + I * 4;
+            K[I] = (unsigned long) P[0]         |
+                   ((unsigned long) P[1] << 8)  |
+                   ((unsigned long) P[2] << 16) |
+                   ((unsigned long) P[3] << 24);
+        }
+        for (I = 0; I < 4; ++I) {
+            K[I] = (K[I] * C[I]) & 0xFFFFFFFFUL;
+            K[I] = ROTL32 (K[I], KRot[I]);
+            K[I] = (K[I] * C[I+1]) & 0xFFFFFFFFUL;
+            H[I] ^= K[I];
+            H[I] = ROTL32 (H[I], HRot[I]);
+            H[I] = (H[I] + H[(I+1) & 3]) & 0xFFFFFFFFUL;
+            H[I] = (H[I] * 5 + A[I]) & 0xFFFFFFFFUL;
+        }
+    }
+
+    /* Tail: The remaining bytes */
+    K[0] = K[1] = K[2] = K[3] = 0;
+    for (I = 0; Pos + I < Len; ++I) {
+        K[I / 4] |= (unsigned long) Data[Pos + I] << ((I % 4) * 8);
+    }
+    for (I = 0; I < 4; ++I) {
+        K[I] = (K[I] * C[I]) & 0xFFFFFFFFUL;
+        K[I] = ROTL32 (K[I], KRot[I]);
+        K[I] = (K[I] * C[I+1]) & 0xFFFFFFFFUL;
+        H[I] ^= K[I];
+    }
+
+    /* Finalization */
+    for (I = 0; I < 4; ++I) {
+        H[I] ^= Len & 0xFFFFFFFFUL;
+    }
+    H[0] = (H[0] + H[1] + H[2] + H[3]) & 0xFFFFFFFFUL;
+    for (I = 1; I < 4; ++I) {
+        H[I] = (H[I] + H[0]) & 0xFFFFFFFFUL;
+    }
+    for (I = 0; I < 4; ++I) {
+        H[I] = FMix (H[I]);
+    }
+    H[0] = (H[0] + H[1] + H[2] + H[3]) & 0xFFFFFFFFUL;
+    for (I = 1; I < 4; ++I) {
+        H[I] = (H[I] + H[0]) & 0xFFFFFFFFUL;
+    }
+}
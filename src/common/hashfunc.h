@@ -59,6 +59,11 @@ unsigned HashStr (const char* S) attribute ((const));
 unsigned HashBuf (const StrBuf* S) attribute ((const));
 /* Return a hash value for the given string buffer */
 
+void HashData128 (unsigned long Hash[4], const void* Buf, unsigned long Len);
+/* Compute a 128 bit hash of Len bytes of data and store it in Hash as four
+** 32 bit values.
+*/
+
 
 
 /* End of hashfunc.h */
@@ -0,0 +1,103 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 libdefs.c                                 */
+/*                                                                           */
+/*                         Library file definitions                          */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include "libdefs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned long GetExpTab32 (const unsigned char* P)
+/* Return a 32 bit value from an export table in memory */
+{
+    return ((unsigned long) P[0])         |
+           (((unsigned long) P[1]) << 8)  |
+           (((unsigned long) P[2]) << 16) |
+           (((unsigned long) P[3]) << 24);
+}
+
+
+
+int CheckExpTab (const unsigned char* T, unsigned long Size,
+                 unsigned ModuleCount)
+/* Check the export table T of the given size without the magic and size
+** fields, for a library with ModuleCount modules. Return true if it is valid
+** and may be used.
+*/
+{
+    unsigned long Buckets, Count, Fixed, NameSize, I;
+    const unsigned char* Entries;
+
+    /* Check the number of buckets */
+    if (Size < 4) {
+        return 0;
+    }
+    Buckets = GetExpTab32 (T);
+    if (Buckets == 0 || Buckets > LIB_EXP_MAXBUCKETS ||
+        (Buckets & (Buckets - 1)) != 0 || (Buckets + 2) * 4 > Size) {
+        return 0;
+    }
+
+    /* The last start index is the number of entries */
+    Count = GetExpTab32 (T + 4 + Buckets * 4);
+    Fixed = (Buckets + 2) * 4;
+    if (Count > (Size - Fixed) / 8) {
+        return 0;
+    }
+    NameSize = Size - Fixed - Count * 8;
+    if (NameSize > 0 && T[Size-1] != '\0') {
+        return 0;
+    }
+
+    /* Check the start indices */
+    for (I = 0; I < Buckets; ++I) {
+        if (GetExpTab32 (T + 4 + I * 4) > GetExpTab32 (T + 8 + I * 4)) {
+            return 0;
+        }
+    }
+
+    /* Check the entries */
+    Entries = T + Fixed;
+    for (I = 0; I < Count; ++I) {
+        if (GetExpTab32 (Entries + I * 8)     >= ModuleCount ||
+            GetExpTab32 (Entries + I * 8 + 4) >= NameSize) {
+            return 0;
+        }
+    }
+
+    /* The table is valid */
+    return 1;
+}
@@ -51,6 +51,36 @@
 /* Size of an library file header */
 #define LIB_HDR_SIZE    12
 
+/* The index may be followed by an export table, that maps the names of all
+** exports to the index of the module that contains them. Since linkers that
+** don't know about the table stop reading after the index, no new library
+** version is needed. The table has the following layout, all values are
+** 32 bit:
+**
+**      Magic                   LIB_EXP_MAGIC
+**      Size                    Size of the remaining table in bytes
+**      BucketCount             Power of two, at most LIB_EXP_MAXBUCKETS
+**      Start[BucketCount+1]    Index of the first entry for each bucket
+**      Entries                 Module index, offset of name in name table
+**      Names                   Zero terminated export names
+**
+** The bucket for a name is HashStr (Name) & (BucketCount - 1).
+*/
+#define LIB_EXP_MAGIC           0x7A55784E
+#define LIB_EXP_MAXBUCKETS      0x10000UL
+
+/* The export table may be followed by a checksum table, that is used by the
+** archiver to find out if a module has changed without reading it. It has
+** a 128 bit hash (see HashData128) of the data of each module, in index
+** order:
+**
+**      Magic                   LIB_SUM_MAGIC
+**      Size                    Size of the remaining table in bytes
+**      Sums[ModuleCount]       Four 32 bit values for each module
+*/
+#define LIB_SUM_MAGIC           0x7A557353
+#define LIB_SUM_SIZE            16
+
 
 
 /* Header structure for the library */
@@ -64,6 +94,24 @@ struct LibHeader {
 
 
 
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned long GetExpTab32 (const unsigned char* P);
+/* Return a 32 bit value from an export table in memory */
+
+int CheckExpTab (const unsigned char* T, unsigned long Size,
+                 unsigned ModuleCount);
+/* Check the export table T of the given size without the magic and size
+** fields, for a library with ModuleCount modules. Return true if it is valid
+** and may be used.
+*/
+
+
+
 /* End of libdefs.h */
 
 #endif
@@ -0,0 +1,167 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objwrite.c                                */
+/*                                                                           */
+/*                   Output of object files built in memory                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <errno.h>
+
+/* common */
+#include "objwrite.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ObjPut8 (StrBuf* B, unsigned V)
+/* Append an 8 bit value */
+{
+    SB_AppendChar (B, (char) (V & 0xFF));
+}
+
+
+
+void ObjPut16 (StrBuf* B, unsigned V)
+/* Append a 16 bit value */
+{
+    ObjPut8 (B, V);
+    ObjPut8 (B, V >> 8);
+}
+
+
+
+void ObjPut32 (StrBuf* B, unsigned long V)
+/* Append a 32 bit value */
+{
+    ObjPut8 (B, (unsigned) V);
+    ObjPut8 (B, (unsigned) (V >> 8));
+    ObjPut8 (B, (unsigned) (V >> 16));
+    ObjPut8 (B, (unsigned) (V >> 24));
+}
+
+
+
+void ObjPutVar (StrBuf* B, unsigned long V)
+/* Append a value in the variable sized encoding used by the object files */
+{
+    do {
+        unsigned char C = (V & 0x7F);
+        V >>= 7;
+        if (V) {
+            C |= 0x80;
+        }
+        ObjPut8 (B, C);
+    } while (V != 0);
+}
+
+
+
+void ObjPutHeader (StrBuf* B, const ObjHeader* H)
+/* Append an object file header */
+{
+    ObjPut32 (B, H->Magic);
+    ObjPut16 (B, H->Version);
+    ObjPut16 (B, H->Flags);
+    ObjPut32 (B, H->OptionOffs);
+    ObjPut32 (B, H->OptionSize);
+    ObjPut32 (B, H->FileOffs);
+    ObjPut32 (B, H->FileSize);
+    ObjPut32 (B, H->SegOffs);
+    ObjPut32 (B, H->SegSize);
+    ObjPut32 (B, H->ImportOffs);
+    ObjPut32 (B, H->ImportSize);
+    ObjPut32 (B, H->ExportOffs);
+    ObjPut32 (B, H->ExportSize);
+    ObjPut32 (B, H->DbgSymOffs);
+    ObjPut32 (B, H->DbgSymSize);
+    ObjPut32 (B, H->LineInfoOffs);
+    ObjPut32 (B, H->LineInfoSize);
+    ObjPut32 (B, H->StrPoolOffs);
+    ObjPut32 (B, H->StrPoolSize);
+    ObjPut32 (B, H->AssertOffs);
+    ObjPut32 (B, H->AssertSize);
+    ObjPut32 (B, H->ScopeOffs);
+    ObjPut32 (B, H->ScopeSize);
+    ObjPut32 (B, H->SpanOffs);
+    ObjPut32 (B, H->SpanSize);
+}
+
+
+
+void ObjPutStrPool (StrBuf* B, const StringPool* P)
+/* Append the contents of a string pool as object file string table */
+{
+    unsigned I;
+    unsigned Count = SP_GetCount (P);
+
+    ObjPutVar (B, Count);
+    for (I = 0; I < Count; ++I) {
+        const StrBuf* S = SP_Get (P, I);
+        ObjPutVar (B, SB_GetLen (S));
+        SB_Append (B, S);
+    }
+}
+
+
+
+int ObjWriteFile (const char* Name, const ObjHeader* H, const StrBuf* Data)
+/* Write an object file consisting of the header H and the data following
+** it. Return zero on success, or an errno code if there was an error. A
+** partially written file is removed in this case.
+*/
+{
+    StrBuf Hdr = STATIC_STRBUF_INITIALIZER;
+    int    Err = 0;
+    FILE*  F;
+
+    F = fopen (Name, "wb");
+    if (F == 0) {
+        return errno;
+    }
+
+    ObjPutHeader (&Hdr, H);
+    if (fwrite (SB_GetConstBuf (&Hdr), 1, SB_GetLen (&Hdr), F) != SB_GetLen (&Hdr) ||
+        fwrite (SB_GetConstBuf (Data), 1, SB_GetLen (Data), F) != SB_GetLen (Data)) {
+        Err = errno? errno : EIO;
+        fclose (F);
+    } else if (fclose (F) != 0) {
+        Err = errno? errno : EIO;
+    }
+    SB_Done (&Hdr);
+
+    if (Err != 0) {
+        remove (Name);
+    }
+    return Err;
+}
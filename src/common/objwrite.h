@@ -0,0 +1,79 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objwrite.h                                */
+/*                                                                           */
+/*                   Output of object files built in memory                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJWRITE_H
+#define OBJWRITE_H
+
+
+
+/* common */
+#include "objdefs.h"
+#include "strbuf.h"
+#include "strpool.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ObjPut8 (StrBuf* B, unsigned V);
+/* Append an 8 bit value */
+
+void ObjPut16 (StrBuf* B, unsigned V);
+/* Append a 16 bit value */
+
+void ObjPut32 (StrBuf* B, unsigned long V);
+/* Append a 32 bit value */
+
+void ObjPutVar (StrBuf* B, unsigned long V);
+/* Append a value in the variable sized encoding used by the object files */
+
+void ObjPutHeader (StrBuf* B, const ObjHeader* H);
+/* Append an object file header */
+
+void ObjPutStrPool (StrBuf* B, const StringPool* P);
+/* Append the contents of a string pool as object file string table */
+
+int ObjWriteFile (const char* Name, const ObjHeader* H, const StrBuf* Data);
+/* Write an object file consisting of the header H and the data following
+** it. Return zero on success, or an errno code if there was an error. A
+** partially written file is removed in this case.
+*/
+
+
+
+/* End of objwrite.h */
+
+#endif
@@ -0,0 +1,193 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  tasks.c                                  */
+/*                                                                           */
+/*                      Run functions on worker threads                      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+/* common */
+#include "tasks.h"
+
+#if TASKS_THREADS
+#  if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#    include <process.h>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Maximum number of threads used for one task set */
+#define MAX_THREADS     32
+
+/* A thread that runs every Step'th call of a task set */
+typedef struct Worker Worker;
+struct Worker {
+    TaskFunc            Func;           /* Function to call */
+    void*               Data;           /* First argument for the function */
+    unsigned            First;          /* First index */
+    unsigned            Step;           /* Distance between indices */
+    unsigned            Count;          /* Number of indices in the set */
+#if TASKS_THREADS && defined(_WIN32)
+    HANDLE              Thread;         /* Thread running the worker */
+#elif TASKS_THREADS
+    pthread_t           Thread;         /* Thread running the worker */
+#endif
+    int                 Started;        /* True if the thread was started */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned ProcessorCount (void)
+/* Return the number of processors that may run worker threads */
+{
+#if TASKS_THREADS && defined(_WIN32)
+    SYSTEM_INFO SI;
+    GetSystemInfo (&SI);
+    return SI.dwNumberOfProcessors > 0? (unsigned) SI.dwNumberOfProcessors : 1;
+#elif TASKS_THREADS && defined(_SC_NPROCESSORS_ONLN)
+    long Count = sysconf (_SC_NPROCESSORS_ONLN);
+    return Count > 0? (unsigned) Count : 1;
+#else
+    return 1;
+#endif
+}
+
+
+
+static void RunWorker (Worker* W)
+/* Make the calls of one worker */
+{
+    unsigned I;
+    for (I = W->First; I < W->Count; I += W->Step) {
+        W->Func (W->Data, I);
+    }
+}
+
+
+
+#if TASKS_THREADS && defined(_WIN32)
+static unsigned __stdcall WorkerThread (void* Arg)
+/* Thread function that runs a worker */
+{
+    RunWorker (Arg);
+    return 0;
+}
+#elif TASKS_THREADS
+static void* WorkerThread (void* Arg)
+/* Thread function that runs a worker */
+{
+    RunWorker (Arg);
+    return 0;
+}
+#endif
+
+
+
+void RunTasks (TaskFunc Func, void* Data, unsigned Count)
+/* Call Func (Data, I) for all I from 0 to Count-1 and return when all calls
+** are done. If there is more than one processor, the calls are spread over
+** worker threads, so they may run in any order and at the same time. Func
+** must not change data that other calls use. It must not end the program or
+** print anything, unless the program makes that safe, for example by
+** catching errors per thread. Without thread support, the calls are made in
+** order.
+*/
+{
+    Worker   Workers[MAX_THREADS];
+    unsigned Threads, I;
+
+    /* Use one thread per processor, but not more than there are calls */
+    Threads = ProcessorCount ();
+    if (Threads > MAX_THREADS) {
+        Threads = MAX_THREADS;
+    }
+    if (Threads > Count) {
+        Threads = Count;
+    }
+    if (Threads == 0) {
+        return;
+    }
+
+    /* Start the threads. The first worker is run by the caller. */
+    for (I = 0; I < Threads; ++I) {
+        Workers[I].Func    = Func;
+        Workers[I].Data    = Data;
+        Workers[I].First   = I;
+        Workers[I].Step    = Threads;
+        Workers[I].Count   = Count;
+        Workers[I].Started = 0;
+#if TASKS_THREADS && defined(_WIN32)
+        if (I > 0) {
+            Workers[I].Thread = (HANDLE) _beginthreadex (0, 0, WorkerThread,
+                                                         &Workers[I], 0, 0);
+            Workers[I].Started = (Workers[I].Thread != 0);
+        }
+#elif TASKS_THREADS
+        if (I > 0) {
+            Workers[I].Started = (pthread_create (&Workers[I].Thread, 0,
+                                                  WorkerThread, &Workers[I]) == 0);
+        }
+#endif
+    }
+
+    /* Run the workers that didn't get a thread */
+    for (I = 0; I < Threads; ++I) {
+        if (!Workers[I].Started) {
+            RunWorker (&Workers[I]);
+        }
+    }
+
+    /* Wait for the threads */
+    for (I = 0; I < Threads; ++I) {
+        if (Workers[I].Started) {
+#if TASKS_THREADS && defined(_WIN32)
+            WaitForSingleObject (Workers[I].Thread, INFINITE);
+            CloseHandle (Workers[I].Thread);
+#elif TASKS_THREADS
+            pthread_join (Workers[I].Thread, 0);
+#endif
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  tasks.h                                  */
+/*                                                                           */
+/*                      Run functions on worker threads                      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#ifndef TASKS_H
+#define TASKS_H
+
+
+
+#if !defined(_WIN32)
+#  include <unistd.h>
+#endif
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Define TASKS_THREADS as 0 to build without worker threads */
+#if !defined(TASKS_THREADS)
+#  if defined(_WIN32) || (defined(_POSIX_THREADS) && _POSIX_THREADS > 0)
+#    define TASKS_THREADS       1
+#  else
+#    define TASKS_THREADS       0
+#  endif
+#endif
+
+/* Storage class for variables that have their own instance in each thread */
+#if !TASKS_THREADS
+#  define THREAD_LOCAL
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#  define THREAD_LOCAL  _Thread_local
+#elif defined(_MSC_VER)
+#  define THREAD_LOCAL  __declspec(thread)
+#else
+#  define THREAD_LOCAL  __thread
+#endif
+
+/* A function that is run for each index of a task set */
+typedef void (*TaskFunc) (void* Data, unsigned Index);
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned ProcessorCount (void);
+/* Return the number of processors that may run worker threads */
+
+void RunTasks (TaskFunc Func, void* Data, unsigned Count);
+/* Call Func (Data, I) for all I from 0 to Count-1 and return when all calls
+** are done. If there is more than one processor, the calls are spread over
+** worker threads, so they may run in any order and at the same time. Func
+** must not change data that other calls use. It must not end the program or
+** print anything, unless the program makes that safe, for example by
+** catching errors per thread. Without thread support, the calls are made in
+** order.
+*/
+
+
+
+/* End of tasks.h */
+
+#endif
@@ -0,0 +1,165 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 addrmap.c                                 */
+/*                                                                           */
+/*                      Sparse tables indexed by address                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "xmalloc.h"
+
+/* da65 */
+#include "addrmap.h"
+#include "error.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitAddrMap (AddrMap* M, unsigned EntrySize)
+/* Initialize an empty address map with entries of the given size */
+{
+    unsigned B;
+    M->EntrySize = EntrySize;
+    for (B = 0; B < 0x100; ++B) {
+        M->Banks[B] = 0;
+    }
+}
+
+
+
+void* AddrMapGet (const AddrMap* M, unsigned long Addr)
+/* Return a pointer to the entry for the given address. If no entry was ever
+** written in the page that contains the address, NULL is returned.
+*/
+{
+    unsigned char** Pages;
+    unsigned char*  Page;
+
+    /* Get the page */
+    if (Addr >= ADDRMAP_END || (Pages = M->Banks[Addr >> 16]) == 0) {
+        return 0;
+    }
+    Page = Pages[(Addr >> 8) & 0xFF];
+    if (Page == 0) {
+        return 0;
+    }
+
+    /* Return the entry */
+    return Page + (Addr & 0xFF) * M->EntrySize;
+}
+
+
+
+void* AddrMapNeed (AddrMap* M, unsigned long Addr)
+/* Return a pointer to the entry for the given address, allocating memory
+** if necessary. New entries are all zero.
+*/
+{
+    unsigned char** Pages;
+    unsigned char*  Page;
+
+    /* Check the address */
+    if (Addr >= ADDRMAP_END) {
+        Error ("Address out of range: $%06lX", Addr);
+    }
+
+    /* Get the page table of the bank, allocate it if necessary */
+    Pages = M->Banks[Addr >> 16];
+    if (Pages == 0) {
+        Pages = M->Banks[Addr >> 16] = xmalloc (0x100 * sizeof (Pages[0]));
+        memset (Pages, 0, 0x100 * sizeof (Pages[0]));
+    }
+
+    /* Get the page, allocate it if necessary */
+    Page = Pages[(Addr >> 8) & 0xFF];
+    if (Page == 0) {
+        Page = Pages[(Addr >> 8) & 0xFF] = xmalloc (0x100 * M->EntrySize);
+        memset (Page, 0, 0x100 * M->EntrySize);
+    }
+
+    /* Return the entry */
+    return Page + (Addr & 0xFF) * M->EntrySize;
+}
+
+
+
+void AddrMapClear (AddrMap* M, void (*FreeEntry) (void* Entry))
+/* Free all memory used by the map, so all entries are zero again. If
+** FreeEntry isn't NULL, it is called for each entry of the allocated pages
+** before.
+*/
+{
+    unsigned B, P, I;
+
+    for (B = 0; B < 0x100; ++B) {
+        unsigned char** Pages = M->Banks[B];
+        if (Pages == 0) {
+            continue;
+        }
+        for (P = 0; P < 0x100; ++P) {
+            if (Pages[P] != 0 && FreeEntry != 0) {
+                for (I = 0; I < 0x100; ++I) {
+                    FreeEntry (Pages[P] + I * M->EntrySize);
+                }
+            }
+            xfree (Pages[P]);
+        }
+        xfree (Pages);
+        M->Banks[B] = 0;
+    }
+}
+
+
+
+unsigned long AddrMapNext (const AddrMap* M, unsigned long Addr)
+/* Return Addr if the page that contains it has entries, otherwise the first
+** address of the next page that has. If there is no such page, ADDRMAP_END
+** is returned.
+*/
+{
+    while (Addr < ADDRMAP_END) {
+        unsigned char** Pages = M->Banks[Addr >> 16];
+        if (Pages == 0) {
+            /* Skip the bank */
+            Addr = (Addr | 0xFFFFUL) + 1;
+        } else if (Pages[(Addr >> 8) & 0xFF] == 0) {
+            /* Skip the page */
+            Addr = (Addr | 0xFFUL) + 1;
+        } else {
+            break;
+        }
+    }
+    return Addr;
+}
@@ -0,0 +1,97 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 addrmap.h                                 */
+/*                                                                           */
+/*                      Sparse tables indexed by address                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef ADDRMAP_H
+#define ADDRMAP_H
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Size of the address space */
+#define ADDRMAP_END     0x1000000UL
+
+/* A table with one entry of a fixed size per address in the 24 bit address
+** space. Memory for the entries is allocated in pages of 256 entries when
+** they're first written, so the memory needed is proportional to the
+** addresses actually used.
+*/
+typedef struct AddrMap AddrMap;
+struct AddrMap {
+    unsigned            EntrySize;      /* Size of one entry */
+    unsigned char**     Banks[0x100];   /* Page table for each bank */
+};
+
+/* Initializer for static address maps */
+#define STATIC_ADDRMAP_INITIALIZER(Size)        { Size, { 0 } }
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitAddrMap (AddrMap* M, unsigned EntrySize);
+/* Initialize an empty address map with entries of the given size */
+
+void* AddrMapGet (const AddrMap* M, unsigned long Addr);
+/* Return a pointer to the entry for the given address. If no entry was ever
+** written in the page that contains the address, NULL is returned.
+*/
+
+void* AddrMapNeed (AddrMap* M, unsigned long Addr);
+/* Return a pointer to the entry for the given address, allocating memory
+** if necessary. New entries are all zero.
+*/
+
+void AddrMapClear (AddrMap* M, void (*FreeEntry) (void* Entry));
+/* Free all memory used by the map, so all entries are zero again. If
+** FreeEntry isn't NULL, it is called for each entry of the allocated pages
+** before.
+*/
+
+unsigned long AddrMapNext (const AddrMap* M, unsigned long Addr);
+/* Return Addr if the page that contains it has entries, otherwise the first
+** address of the next page that has. If there is no such page, ADDRMAP_END
+** is returned.
+*/
+
+
+
+/* End of addrmap.h */
+#endif
@@ -35,18 +35,9 @@
 
 /* da65 */
 #include "error.h"
+#include "addrmap.h"
 #include "attrtab.h"
-
-
-
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-/* Attribute table */
-static unsigned short AttrTab[0x10000];
+#include "context.h"
 
 
 
@@ -59,7 +50,7 @@ static unsigned short AttrTab[0x10000];
 void AddrCheck (unsigned Addr)
 /* Check if the given address has a valid range */
 {
-    if (Addr >= 0x10000) {
+    if (Addr >= ADDRMAP_END) {
         Error ("Address out of range: %08X", Addr);
     }
 }
@@ -69,11 +60,24 @@ void AddrCheck (unsigned Addr)
 attr_t GetAttr (unsigned Addr)
 /* Return the attribute for the given address */
 {
+    const unsigned short* A;
+
     /* Check the given address */
     AddrCheck (Addr);
 
     /* Return the attribute */
-    return AttrTab[Addr];
+    A = AddrMapGet (&Ctx->AttrTab, Addr);
+    return A? *A : atDefault;
+}
+
+
+
+unsigned long NextAttrAddr (unsigned long Addr)
+/* Return the first address >= Addr that may have attributes. Addresses in
+** between have none. Returns ADDRMAP_END if there are no more attributes.
+*/
+{
+    return AddrMapNext (&Ctx->AttrTab, Addr);
 }
 
 
@@ -82,7 +86,7 @@ int SegmentDefined (unsigned Start, unsigned End)
 /* Return true if the atSegment bit is set somewhere in the given range */
 {
     while (Start <= End) {
-        if (AttrTab[Start++] & atSegment) {
+        if (GetAttr (Start++) & atSegment) {
             return 1;
         }
     }
@@ -145,18 +149,21 @@ void MarkRange (unsigned Start, unsigned End, attr_t Attr)
 void MarkAddr (unsigned Addr, attr_t Attr)
 /* Mark an address with an attribute */
 {
+    unsigned short* A;
+
     /* Check the given address */
     AddrCheck (Addr);
 
     /* We must not have more than one style bit */
+    A = AddrMapNeed (&Ctx->AttrTab, Addr);
     if (Attr & atStyleMask) {
-        if (AttrTab[Addr] & atStyleMask) {
+        if (*A & atStyleMask) {
             Error ("Duplicate style for address %04X", Addr);
         }
     }
 
     /* Set the style */
-    AttrTab[Addr] |= Attr;
+    *A |= Attr;
 }
 
 
@@ -164,11 +171,8 @@ void MarkAddr (unsigned Addr, attr_t Attr)
 attr_t GetStyleAttr (unsigned Addr)
 /* Return the style attribute for the given address */
 {
-    /* Check the given address */
-    AddrCheck (Addr);
-
     /* Return the attribute */
-    return (AttrTab[Addr] & atStyleMask);
+    return (GetAttr (Addr) & atStyleMask);
 }
 
 
@@ -176,9 +180,14 @@ attr_t GetStyleAttr (unsigned Addr)
 attr_t GetLabelAttr (unsigned Addr)
 /* Return the label attribute for the given address */
 {
-    /* Check the given address */
-    AddrCheck (Addr);
-
     /* Return the attribute */
-    return (AttrTab[Addr] & atLabelMask);
+    return (GetAttr (Addr) & atLabelMask);
+}
+
+
+
+void FreeAttrTab (void)
+/* Remove all attributes */
+{
+    AddrMapClear (&Ctx->AttrTab, 0);
 }
@@ -91,6 +91,11 @@ void AddrCheck (unsigned Addr);
 attr_t GetAttr (unsigned Addr);
 /* Return the attribute for the given address */
 
+unsigned long NextAttrAddr (unsigned long Addr);
+/* Return the first address >= Addr that may have attributes. Addresses in
+** between have none. Returns ADDRMAP_END if there are no more attributes.
+*/
+
 int SegmentDefined (unsigned Start, unsigned End);
 /* Return true if the atSegment bit is set somewhere in the given range */
 
@@ -115,6 +120,9 @@ attr_t GetStyleAttr (unsigned Addr);
 attr_t GetLabelAttr (unsigned Addr);
 /* Return the label attribute for the given address */
 
+void FreeAttrTab (void);
+/* Remove all attributes */
+
 
 
 /* End of attrtab.h */
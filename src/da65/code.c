@@ -39,27 +39,17 @@
 
 /* common */
 #include "check.h"
+#include "cpu.h"
+#include "xmalloc.h"
 
 /* da65 */
 #include "code.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-unsigned char CodeBuf [0x10000];        /* Code buffer */
-unsigned long CodeStart;                /* Start address */
-unsigned long CodeEnd;                  /* End address */
-unsigned long PC;                       /* Current PC */
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -70,87 +60,130 @@ void LoadCode (void)
 /* Load the code from the given file */
 {
     long Count, MaxCount, Size;
+    unsigned long Last;
     FILE* F;
 
 
-    PRECONDITION (StartAddr < 0x10000);
+    PRECONDITION (Ctx->StartAddr < 0x1000000);
 
     /* Open the file */
-    F = fopen (InFile, "rb");
+    F = fopen (Ctx->InFile, "rb");
     if (F == 0) {
-        Error ("Cannot open `%s': %s", InFile, strerror (errno));
+        Error ("Cannot open `%s': %s", Ctx->InFile, strerror (errno));
     }
 
     /* Seek to the end to get the size of the file */
     if (fseek (F, 0, SEEK_END) != 0) {
-        Error ("Cannot seek on file `%s': %s", InFile, strerror (errno));
+        Error ("Cannot seek on file `%s': %s", Ctx->InFile, strerror (errno));
     }
     Size = ftell (F);
 
     /* The input offset must be smaller than the size */
-    if (InputOffs >= 0) {
-        if (InputOffs >= Size) {
+    if (Ctx->InputOffs >= 0) {
+        if (Ctx->InputOffs >= Size) {
             Error ("Input offset is greater than file size");
         }
     } else {
         /* Use a zero offset */
-        InputOffs = 0;
+        Ctx->InputOffs = 0;
     }
 
     /* Seek to the input offset and correct size to contain the remainder of
     ** the file.
     */
-    if (fseek (F, InputOffs, SEEK_SET) != 0) {
-        Error ("Cannot seek on file `%s': %s", InFile, strerror (errno));
+    if (fseek (F, Ctx->InputOffs, SEEK_SET) != 0) {
+        Error ("Cannot seek on file `%s': %s", Ctx->InFile, strerror (errno));
     }
-    Size -= InputOffs;
+    Size -= Ctx->InputOffs;
 
     /* Limit the size to the maximum input size if one is given */
-    if (InputSize >= 0) {
-        if (InputSize > Size) {
+    if (Ctx->InputSize >= 0) {
+        if (Ctx->InputSize > Size) {
             Error ("Input size is greater than what is available");
         }
-        Size = InputSize;
+        Size = Ctx->InputSize;
     }
 
     /* If the start address was not given, set it so that the code loads to
     ** 0x10000 - Size. This is a reasonable default assuming that the file
-    ** is a ROM that contains the hardware vectors at $FFFA.
+    ** is a ROM that contains the hardware vectors at $FFFA. If the file
+    ** consists of banks, each one is placed that way.
     */
-    if (StartAddr < 0) {
-        if (Size > 0x10000) {
-            StartAddr = 0;
+    if (Ctx->StartAddr < 0) {
+        if (Ctx->BankSize > 0) {
+            Ctx->StartAddr = 0x10000 - Ctx->BankSize;
+        } else if (Size > 0x10000) {
+            Ctx->StartAddr = 0;
         } else {
-            StartAddr = 0x10000 - Size;
+            Ctx->StartAddr = 0x10000 - Size;
         }
     }
 
-    /* Calculate the maximum code size */
-    MaxCount = 0x10000 - StartAddr;
+    /* Calculate the maximum code size. Banks are placed at the same address
+    ** in consecutive 64K banks, so they must not cross a bank boundary. Only
+    ** the 65816 can address more than 64K without banks.
+    */
+    if (Ctx->BankSize > 0) {
+        if ((Ctx->StartAddr & 0xFFFF) + Ctx->BankSize > 0x10000) {
+            Error ("Banks of size $%lX cannot start at $%04lX",
+                   Ctx->BankSize, Ctx->StartAddr & 0xFFFF);
+        }
+        MaxCount = ((0x1000000 - Ctx->StartAddr + 0xFFFF) >> 16) * Ctx->BankSize;
+    } else if (Ctx->CPU == CPU_65816) {
+        MaxCount = 0x1000000 - Ctx->StartAddr;
+    } else {
+        MaxCount = 0x10000 - (Ctx->StartAddr & 0xFFFF);
+    }
 
     /* Check if the size is larger than what we can read */
     if (Size == 0) {
-        Error ("Nothing to read from input file `%s'", InFile);
+        Error ("Nothing to read from input file `%s'", Ctx->InFile);
     }
     if (Size > MaxCount) {
         Warning ("File `%s' is too large, ignoring %ld bytes",
-                 InFile, Size - MaxCount);
+                 Ctx->InFile, Size - MaxCount);
     } else if (MaxCount > Size) {
         MaxCount = (unsigned) Size;
     }
 
     /* Read from the file and remember the number of bytes read */
-    Count = fread (CodeBuf + StartAddr, 1, MaxCount, F);
+    Ctx->CodeBuf = xmalloc (MaxCount);
+    Count = fread (Ctx->CodeBuf, 1, MaxCount, F);
     if (ferror (F) || Count != MaxCount) {
-        Error ("Error reading from `%s': %s", InFile, strerror (errno));
+        Error ("Error reading from `%s': %s", Ctx->InFile, strerror (errno));
     }
 
     /* Close the file */
     fclose (F);
 
-    /* Set the buffer variables */
-    CodeStart = PC = StartAddr;
-    CodeEnd = CodeStart + Count - 1;    /* CodeEnd is inclusive */
+    /* Set the buffer variables. CodeEnd is inclusive. */
+    Last = Count - 1;
+    if (Ctx->BankSize > 0) {
+        Last = ((Last / Ctx->BankSize) << 16) + (Last % Ctx->BankSize);
+    }
+    Ctx->CodeStart = Ctx->PC = Ctx->StartAddr;
+    Ctx->CodeEnd = Ctx->CodeStart + Last;
+}
+
+
+
+int IsCodeAddr (unsigned long Addr)
+/* Return true if the given address is part of the loaded code */
+{
+    return (Addr >= Ctx->CodeStart && Addr <= Ctx->CodeEnd &&
+            (Ctx->BankSize == 0 || ((Addr - Ctx->CodeStart) & 0xFFFF) < Ctx->BankSize));
+}
+
+
+
+unsigned long GetBankAddr (unsigned long From, unsigned Addr)
+/* Return the full address for the 16 bit address Addr used by code at the
+** address From. This is the address within the bank of From if it is part
+** of the loaded code, otherwise the 16 bit address itself.
+*/
+{
+    unsigned long BankAddr = (From & 0xFF0000UL) | Addr;
+    return IsCodeAddr (BankAddr)? BankAddr : Addr;
 }
 
 
@@ -158,8 +191,16 @@ void LoadCode (void)
 unsigned char GetCodeByte (unsigned Addr)
 /* Get a byte from the given address */
 {
-    PRECONDITION (Addr <= CodeEnd);
-    return CodeBuf [Addr];
+    unsigned long Offs;
+
+    PRECONDITION (IsCodeAddr (Addr));
+
+    /* Get the offset into the buffer */
+    Offs = Addr - Ctx->CodeStart;
+    if (Ctx->BankSize > 0) {
+        Offs = (Offs >> 16) * Ctx->BankSize + (Offs & 0xFFFF);
+    }
+    return Ctx->CodeBuf [Offs];
 }
 
 
@@ -197,11 +238,22 @@ unsigned long GetCodeDWord (unsigned Addr)
 unsigned GetRemainingBytes (void)
 /* Return the number of remaining code bytes */
 {
-    if (CodeEnd >= PC) {
-        return (CodeEnd - PC + 1);
-    } else {
+    unsigned long End;
+
+    if (!IsCodeAddr (Ctx->PC)) {
         return 0;
     }
+
+    /* Code never crosses the end of a bank */
+    if (Ctx->BankSize > 0) {
+        End = Ctx->PC - ((Ctx->PC - Ctx->CodeStart) & 0xFFFF) + Ctx->BankSize - 1;
+    } else {
+        End = Ctx->PC | 0xFFFFUL;
+    }
+    if (End > Ctx->CodeEnd) {
+        End = Ctx->CodeEnd;
+    }
+    return (End - Ctx->PC + 1);
 }
 
 
@@ -209,7 +261,34 @@ unsigned GetRemainingBytes (void)
 int CodeLeft (void)
 /* Return true if there are code bytes left */
 {
-    return (PC <= CodeEnd);
+    return IsCodeAddr (Ctx->PC);
+}
+
+
+
+int IsBankStart (void)
+/* Return true if the PC is at the start of a bank, and the code spans more
+** than bank zero, so the bank must be placed using .org.
+*/
+{
+    if (Ctx->CodeEnd <= 0xFFFF) {
+        return 0;
+    } else if (Ctx->BankSize > 0) {
+        return ((Ctx->PC - Ctx->CodeStart) & 0xFFFF) == 0;
+    } else {
+        return Ctx->PC == Ctx->CodeStart || (Ctx->PC & 0xFFFF) == 0;
+    }
+}
+
+
+
+int NextBank (void)
+/* Set the PC to the start of the next bank. Return false if there is none. */
+{
+    if (Ctx->BankSize > 0 && Ctx->PC > Ctx->CodeStart) {
+        Ctx->PC = Ctx->CodeStart + ((((Ctx->PC - 1) - Ctx->CodeStart) >> 16) + 1) * 0x10000UL;
+    }
+    return Ctx->PC <= Ctx->CodeEnd;
 }
 
 
@@ -217,5 +296,14 @@ int CodeLeft (void)
 void ResetCode (void)
 /* Reset the code input to start over for the next pass */
 {
-    PC = CodeStart;
+    Ctx->PC = Ctx->CodeStart;
+}
+
+
+
+void FreeCode (void)
+/* Free the loaded code */
+{
+    xfree (Ctx->CodeBuf);
+    Ctx->CodeBuf = 0;
 }
@@ -38,19 +38,6 @@
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-extern unsigned char CodeBuf [0x10000];         /* Code buffer */
-extern unsigned long CodeStart;                 /* Start address */
-extern unsigned long CodeEnd;                   /* End address */
-extern unsigned long PC;                        /* Current PC */
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -60,6 +47,15 @@ extern unsigned long PC;                        /* Current PC */
 void LoadCode (void);
 /* Load the code from the given file */
 
+int IsCodeAddr (unsigned long Addr);
+/* Return true if the given address is part of the loaded code */
+
+unsigned long GetBankAddr (unsigned long From, unsigned Addr);
+/* Return the full address for the 16 bit address Addr used by code at the
+** address From. This is the address within the bank of From if it is part
+** of the loaded code, otherwise the 16 bit address itself.
+*/
+
 unsigned char GetCodeByte (unsigned Addr);
 /* Get a byte from the given address */
 
@@ -78,9 +74,20 @@ unsigned GetRemainingBytes (void);
 int CodeLeft (void);
 /* Return true if there are code bytes left */
 
+int IsBankStart (void);
+/* Return true if the PC is at the start of a bank, and the code spans more
+** than bank zero, so the bank must be placed using .org.
+*/
+
+int NextBank (void);
+/* Set the PC to the start of the next bank. Return false if there is none. */
+
 void ResetCode (void);
 /* Reset the code input to start over for the next pass */
 
+void FreeCode (void);
+/* Free the loaded code */
+
 
 
 /* End of code.h */
@@ -37,23 +37,14 @@
 #include "xmalloc.h"
 
 /* da65 */        
+#include "addrmap.h"
 #include "attrtab.h"
 #include "comments.h"
+#include "context.h"
 #include "error.h"
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-/* Comment table */
-static const char* CommentTab[0x10000];
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -63,14 +54,17 @@ static const char* CommentTab[0x10000];
 void SetComment (unsigned Addr, const char* Comment)
 /* Set a comment for the given address */
 {
+    const char** C;
+
     /* Check the given address */
     AddrCheck (Addr);
 
     /* If we do already have a comment, warn and ignore the new one */
-    if (CommentTab[Addr]) {
+    C = AddrMapNeed (&Ctx->CommentTab, Addr);
+    if (*C) {
         Warning ("Duplicate comment for address $%04X", Addr);
     } else {
-        CommentTab[Addr] = xstrdup (Comment);
+        *C = xstrdup (Comment);
     }
 }
 
@@ -79,9 +73,28 @@ void SetComment (unsigned Addr, const char* Comment)
 const char* GetComment (unsigned Addr)
 /* Return the comment for an address */
 {
+    const char* const* C;
+
     /* Check the given address */
     AddrCheck (Addr);
 
     /* Return the label if any */
-    return CommentTab[Addr];
+    C = AddrMapGet (&Ctx->CommentTab, Addr);
+    return C? *C : 0;
+}
+
+
+
+static void FreeComment (void* Entry)
+/* Free the comment in an entry of the comment table */
+{
+    xfree (*(char**) Entry);
+}
+
+
+
+void FreeComments (void)
+/* Remove all comments */
+{
+    AddrMapClear (&Ctx->CommentTab, FreeComment);
 }
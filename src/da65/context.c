@@ -0,0 +1,153 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 context.c                                 */
+/*                                                                           */
+/*                    Disassembly state of one input file                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#include <string.h>
+
+/* common */
+#include "xmalloc.h"
+
+/* da65 */
+#include "attrtab.h"
+#include "code.h"
+#include "comments.h"
+#include "context.h"
+#include "handler.h"
+#include "labels.h"
+#include "opc6502.h"
+#include "segment.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The context of the input file that is disassembled by this thread */
+THREAD_LOCAL Context* Ctx = 0;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+Context* NewContext (const Context* Settings)
+/* Create a new context. If Settings is not NULL, the file names and settings
+** are copied from it, otherwise they have their default values.
+*/
+{
+    /* Allocate memory and clear everything */
+    Context* C = xmalloc (sizeof (Context));
+    memset (C, 0, sizeof (Context));
+
+    /* Settings */
+    if (Settings) {
+        C->InFile          = Settings->InFile;
+        C->OutFile         = Settings->OutFile;
+        C->CPU             = Settings->CPU;
+        C->OpcTable        = Settings->OpcTable;
+        C->DebugInfo       = Settings->DebugInfo;
+        C->FlowTrace       = Settings->FlowTrace;
+        C->FormFeeds       = Settings->FormFeeds;
+        C->UseHexOffs      = Settings->UseHexOffs;
+        C->NewlineAfterJMP = Settings->NewlineAfterJMP;
+        C->NewlineAfterRTS = Settings->NewlineAfterRTS;
+        C->StartAddr       = Settings->StartAddr;
+        C->BankSize        = Settings->BankSize;
+        C->SyncLines       = Settings->SyncLines;
+        C->InputOffs       = Settings->InputOffs;
+        C->InputSize       = Settings->InputSize;
+        C->Comments        = Settings->Comments;
+        C->PageLength      = Settings->PageLength;
+        C->LBreak          = Settings->LBreak;
+        C->MCol            = Settings->MCol;
+        C->ACol            = Settings->ACol;
+        C->CCol            = Settings->CCol;
+        C->TCol            = Settings->TCol;
+        C->BytesPerLine    = Settings->BytesPerLine;
+    } else {
+        C->CPU             = CPU_UNKNOWN;
+        C->OpcTable        = OpcTable_6502;
+        C->NewlineAfterJMP = -1;
+        C->NewlineAfterRTS = -1;
+        C->StartAddr       = -1L;
+        C->InputOffs       = -1L;
+        C->InputSize       = -1L;
+        C->LBreak          = 7;
+        C->MCol            = 9;
+        C->ACol            = 17;
+        C->CCol            = 49;
+        C->TCol            = 81;
+        C->BytesPerLine    = 8;
+    }
+
+    /* Tables */
+    InitAddrMap (&C->AttrTab, sizeof (unsigned short));
+    InitAddrMap (&C->SymTab, sizeof (const char*));
+    InitAddrMap (&C->CommentTab, sizeof (const char*));
+    InitAddrMap (&C->ParamSizes, sizeof (unsigned short));
+    InitAddrMap (&C->TraceState, sizeof (unsigned char));
+
+    /* Output */
+    C->Col  = 1;
+    C->Page = 1;
+
+    /* Return the new context */
+    return C;
+}
+
+
+
+void FreeContext (Context* C)
+/* Free a context and the code and tables it contains */
+{
+    /* The modules free their data in the current context */
+    Context* Current = Ctx;
+    Ctx = C;
+    FreeCode ();
+    FreeAttrTab ();
+    FreeLabels ();
+    FreeComments ();
+    FreeSegments ();
+    FreeSubroutineParamSizes ();
+    Ctx = Current;
+
+    /* Free the remaining trace data and the context itself */
+    xfree (C->WorkList);
+    AddrMapClear (&C->TraceState, 0);
+    xfree (C);
+}
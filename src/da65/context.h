@@ -0,0 +1,163 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 context.h                                 */
+/*                                                                           */
+/*                    Disassembly state of one input file                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#ifndef CONTEXT_H
+#define CONTEXT_H
+
+
+
+#include <stdio.h>
+#include <setjmp.h>
+
+/* common */
+#include "cpu.h"
+#include "tasks.h"
+
+/* da65 */
+#include "addrmap.h"
+#include "opcdesc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Size of the hash table for segment starts */
+#define SEGMENT_HASH_SIZE       53
+
+/* Everything that is needed to disassemble one input file. The settings are
+** taken from the command line and may be changed by the info file. In batch
+** mode, each input file has its own context, so the files can be
+** disassembled by worker threads at the same time. The opcode tables are
+** constant and shared.
+*/
+typedef struct Context Context;
+struct Context {
+
+    /* File names */
+    const char*         InFile;         /* Name of input file */
+    const char*         OutFile;        /* Name of output file */
+
+    /* Flags and other command line stuff */
+    cpu_t               CPU;            /* CPU of the code */
+    const OpcDesc*      OpcTable;       /* Descriptions for all opcodes */
+    unsigned char       DebugInfo;      /* Add debug info to the object file */
+    unsigned char       FlowTrace;      /* Trace the code flow */
+    unsigned char       FormFeeds;      /* Add form feeds to the output? */
+    unsigned char       UseHexOffs;     /* Use hexadecimal label offsets */
+    signed char         NewlineAfterJMP;/* Add a newline after a JMP insn? */
+    signed char         NewlineAfterRTS;/* Add a newline after a RTS insn? */
+    long                StartAddr;      /* Start/load address of the program */
+    unsigned long       BankSize;       /* Size of banks in the input, zero if none */
+    unsigned char       SyncLines;      /* Accept line markers in the info file */
+    long                InputOffs;      /* Offset into input file */
+    long                InputSize;      /* Number of bytes to read from input */
+    unsigned            Comments;       /* Add which comments to the output? */
+
+    /* Page formatting */
+    unsigned            PageLength;     /* Length of a listing page */
+    unsigned            LBreak;         /* Linefeed if labels exceed this limit */
+    unsigned            MCol;           /* Mnemonic column */
+    unsigned            ACol;           /* Argument column */
+    unsigned            CCol;           /* Comment column */
+    unsigned            TCol;           /* Text bytes column */
+    unsigned            BytesPerLine;   /* Max. number of data bytes per line */
+
+    /* Disassembler pass */
+    unsigned            Pass;
+
+    /* The code. If there are banks, they're stored one after the other */
+    unsigned long       CodeStart;      /* Start address */
+    unsigned long       CodeEnd;        /* End address */
+    unsigned long       PC;             /* Current PC */
+    unsigned char*      CodeBuf;        /* Code bytes */
+
+    /* Tables for the addresses */
+    AddrMap             AttrTab;        /* Attributes */
+    AddrMap             SymTab;         /* Labels */
+    AddrMap             CommentTab;     /* Comments */
+    AddrMap             ParamSizes;     /* Parameter sizes of subroutines */
+    struct Segment*     SegStarts[SEGMENT_HASH_SIZE];  /* Segment starts */
+
+    /* Flow tracing */
+    unsigned long*      WorkList;       /* Addresses still to trace */
+    unsigned            WorkCount;      /* Number of addresses in WorkList */
+    unsigned            WorkSize;       /* Allocated size of WorkList */
+    AddrMap             TraceState;     /* Trace state of each address */
+
+    /* Output */
+    FILE*               OutStream;      /* Output stream */
+    unsigned            Col;            /* Current column */
+    unsigned            Line;           /* Current line on page */
+    unsigned            Page;           /* Current output page */
+    const char*         SegmentName;    /* Name of current segment */
+
+    /* Buffers for names that are returned by some functions */
+    char                LabelBuf[32];   /* Default label names */
+    char                AddrBuf[32];    /* Addresses as arguments */
+
+    /* If CatchErrors is set, errors don't end the program. The message is
+    ** stored and Error jumps to ErrorJump instead.
+    */
+    int                 CatchErrors;
+    jmp_buf             ErrorJump;
+    char                ErrorMsg[256];
+};
+
+/* The context of the input file that is disassembled by this thread */
+extern THREAD_LOCAL Context* Ctx;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+Context* NewContext (const Context* Settings);
+/* Create a new context. If Settings is not NULL, the file names and settings
+** are copied from it, otherwise they have their default values.
+*/
+
+void FreeContext (Context* C);
+/* Free a context and the code and tables it contains */
+
+
+
+/* End of context.h */
+
+#endif
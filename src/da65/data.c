@@ -36,6 +36,7 @@
 /* da65 */
 #include "attrtab.h"
 #include "code.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 #include "labels.h"
@@ -63,10 +64,10 @@ static unsigned GetSpan (attr_t Style)
     unsigned Count = 1;
     while (Count < RemainingBytes) {
         attr_t Attr;
-        if (MustDefLabel(PC+Count)) {
+        if (MustDefLabel(Ctx->PC+Count)) {
             break;
         }
-        Attr = GetAttr (PC+Count);
+        Attr = GetAttr (Ctx->PC+Count);
         if ((Attr & atStyleMask) != Style) {
             break;
         }
@@ -96,7 +97,7 @@ static unsigned DoTable (attr_t Style, unsigned MemberSize, void (*TableFunc) (u
     */
     if (Count < MemberSize) {
         DataByteLine (Count);
-        PC += Count;
+        Ctx->PC += Count;
         return Count;
     }
 
@@ -108,18 +109,18 @@ static unsigned DoTable (attr_t Style, unsigned MemberSize, void (*TableFunc) (u
     while (BytesLeft > 0) {
 
         /* Calculate the number of bytes for the next line */
-        unsigned Chunk = (BytesLeft > BytesPerLine)? BytesPerLine : BytesLeft;
+        unsigned Chunk = (BytesLeft > Ctx->BytesPerLine)? Ctx->BytesPerLine : BytesLeft;
 
         /* Output a line with these bytes */
         TableFunc (Chunk);
 
         /* Next line */
         BytesLeft -= Chunk;
-        PC        += Chunk;
+        Ctx->PC        += Chunk;
     }
 
     /* If the next line is not the same style, add a separator */
-    if (CodeLeft() && GetStyleAttr (PC) != Style) {
+    if (CodeLeft() && GetStyleAttr (Ctx->PC) != Style) {
         SeparatorLine ();
     }
 
@@ -169,19 +170,19 @@ unsigned AddrTable (void)
 /* Output a table of addresses */
 {
     unsigned long BytesLeft = GetRemainingBytes ();
-    unsigned long Start = PC;
+    unsigned long Start = Ctx->PC;
 
     /* Loop while table bytes left and we don't need to create a label at the
     ** current position.
     */
-    while (BytesLeft && GetStyleAttr (PC) == atAddrTab) {
+    while (BytesLeft && GetStyleAttr (Ctx->PC) == atAddrTab) {
 
         unsigned Addr;
 
         /* If just one byte is left, define it and bail out */
-        if (BytesLeft == 1 || GetStyleAttr (PC+1) != atAddrTab) {
+        if (BytesLeft == 1 || GetStyleAttr (Ctx->PC+1) != atAddrTab) {
             DataByteLine (1);
-            ++PC;
+            ++Ctx->PC;
             break;
         }
 
@@ -189,44 +190,44 @@ unsigned AddrTable (void)
         ForwardLabel (1);
 
         /* Now get the address from the PC */
-        Addr = GetCodeWord (PC);
+        Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC));
 
         /* In pass 1, define a label, in pass 2 output the line */
-        if (Pass == 1) {
+        if (Ctx->Pass == 1) {
             if (!HaveLabel (Addr)) {
                 AddIntLabel (Addr);
             }
         } else {
-            const char* Label = GetLabel (Addr, PC);
+            const char* Label = GetLabel (Addr, Ctx->PC);
             if (Label == 0) {
                 /* OOPS! Should not happen */
                 Internal ("OOPS - Label for address 0x%06X disappeard!", Addr);
             }
-            Indent (MCol);
+            Indent (Ctx->MCol);
             Output (".addr");
-            Indent (ACol);
+            Indent (Ctx->ACol);
             Output ("%s", Label);
-            LineComment (PC, 2);
+            LineComment (Ctx->PC, 2);
             LineFeed ();
         }
 
         /* Next table entry */
-        PC        += 2;
+        Ctx->PC        += 2;
         BytesLeft -= 2;
 
         /* If we must define a label here, bail out */
-        if (BytesLeft && MustDefLabel (PC)) {
+        if (BytesLeft && MustDefLabel (Ctx->PC)) {
             break;
         }
     }
 
     /* If the next line is not an address table line, add a separator */
-    if (CodeLeft() && GetStyleAttr (PC) != atAddrTab) {
+    if (CodeLeft() && GetStyleAttr (Ctx->PC) != atAddrTab) {
         SeparatorLine ();
     }
 
     /* Return the number of bytes output */
-    return PC - Start;
+    return Ctx->PC - Start;
 }
 
 
@@ -235,19 +236,19 @@ unsigned RtsTable (void)
 /* Output a table of RTS addresses (address - 1) */
 {
     unsigned long BytesLeft = GetRemainingBytes ();
-    unsigned long Start = PC;
+    unsigned long Start = Ctx->PC;
 
     /* Loop while table bytes left and we don't need to create a label at the
     ** current position.
     */
-    while (BytesLeft && GetStyleAttr (PC) == atRtsTab) {
+    while (BytesLeft && GetStyleAttr (Ctx->PC) == atRtsTab) {
 
         unsigned Addr;
 
         /* If just one byte is left, define it and bail out */
-        if (BytesLeft == 1 || GetStyleAttr (PC+1) != atRtsTab) {
+        if (BytesLeft == 1 || GetStyleAttr (Ctx->PC+1) != atRtsTab) {
             DataByteLine (1);
-            ++PC;
+            ++Ctx->PC;
             break;
         }
 
@@ -255,44 +256,44 @@ unsigned RtsTable (void)
         ForwardLabel (1);
 
         /* Now get the address from the PC */
-        Addr = (GetCodeWord (PC) + 1) & 0xFFFF;
+        Addr = GetBankAddr (Ctx->PC, (GetCodeWord (Ctx->PC) + 1) & 0xFFFF);
 
         /* In pass 1, define a label, in pass 2 output the line */
-        if (Pass == 1) {
+        if (Ctx->Pass == 1) {
             if (!HaveLabel (Addr)) {
                 AddIntLabel (Addr);
             }
         } else {
-            const char* Label = GetLabel (Addr, PC);
+            const char* Label = GetLabel (Addr, Ctx->PC);
             if (Label == 0) {
                 /* OOPS! Should not happen */
                 Internal ("OOPS - Label for address 0x%06X disappeard!", Addr);
             }
-            Indent (MCol);
+            Indent (Ctx->MCol);
             Output (".word");
-            Indent (ACol);
+            Indent (Ctx->ACol);
             Output ("%s-1", Label);
-            LineComment (PC, 2);
+            LineComment (Ctx->PC, 2);
             LineFeed ();
         }
 
         /* Next table entry */
-        PC        += 2;
+        Ctx->PC        += 2;
         BytesLeft -= 2;
 
         /* If we must define a label here, bail out */
-        if (BytesLeft && MustDefLabel (PC)) {
+        if (BytesLeft && MustDefLabel (Ctx->PC)) {
             break;
         }
     }
 
     /* If the next line is not a return address table line, add a separator */
-    if (CodeLeft() && GetStyleAttr (PC) != atRtsTab) {
+    if (CodeLeft() && GetStyleAttr (Ctx->PC) != atRtsTab) {
         SeparatorLine ();
     }
 
     /* Return the number of bytes output */
-    return PC - Start;
+    return Ctx->PC - Start;
 }
 
 
@@ -311,8 +312,8 @@ unsigned TextTable (void)
 
         /* Count the number of characters that can be output as such */
         unsigned Count = 0;
-        while (Count < BytesLeft && Count < BytesPerLine*4-1) {
-            unsigned char C = GetCodeByte (PC + Count);
+        while (Count < BytesLeft && Count < Ctx->BytesPerLine*4-1) {
+            unsigned char C = GetCodeByte (Ctx->PC + Count);
             if (C >= 0x20 && C <= 0x7E && C != '\"') {
                 ++Count;
             } else {
@@ -323,32 +324,32 @@ unsigned TextTable (void)
         /* If we have text, output it */
         if (Count > 0) {
             unsigned CBytes;
-            Indent (MCol);
+            Indent (Ctx->MCol);
             Output (".byte");
-            Indent (ACol);
+            Indent (Ctx->ACol);
             Output ("\"");
             for (I = 0; I < Count; ++I) {
-                Output ("%c", GetCodeByte (PC+I));
+                Output ("%c", GetCodeByte (Ctx->PC+I));
             }
             Output ("\"");
             CBytes = Count;
             while (CBytes > 0) {
                 unsigned Chunk = CBytes;
-                if (Chunk > BytesPerLine) {
-                    Chunk = BytesPerLine;
+                if (Chunk > Ctx->BytesPerLine) {
+                    Chunk = Ctx->BytesPerLine;
                 }
-                LineComment (PC, Chunk);
+                LineComment (Ctx->PC, Chunk);
                 LineFeed ();
                 CBytes -= Chunk;
-                PC += Chunk;
+                Ctx->PC += Chunk;
             }
             BytesLeft -= Count;
         }
 
         /* Count the number of bytes that must be output as bytes */
         Count = 0;
-        while (Count < BytesLeft && Count < BytesPerLine) {
-            unsigned char C = GetCodeByte (PC + Count);
+        while (Count < BytesLeft && Count < Ctx->BytesPerLine) {
+            unsigned char C = GetCodeByte (Ctx->PC + Count);
             if (C < 0x20 || C > 0x7E || C == '\"') {
                 ++Count;
             } else {
@@ -359,14 +360,14 @@ unsigned TextTable (void)
         /* If we have raw output bytes, print them */
         if (Count > 0) {
             DataByteLine (Count);
-            PC += Count;
+            Ctx->PC += Count;
             BytesLeft -= Count;
         }
 
     }
 
     /* If the next line is not a byte table line, add a separator */
-    if (CodeLeft() && GetStyleAttr (PC) != atTextTab) {
+    if (CodeLeft() && GetStyleAttr (Ctx->PC) != atTextTab) {
         SeparatorLine ();
     }
 
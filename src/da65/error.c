@@ -36,8 +36,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <setjmp.h>
+
+/* common */
+#include "xsprintf.h"
 
 /* da65 */
+#include "context.h"
 #include "error.h"
 
 
@@ -48,6 +53,23 @@
 
 
 
+static int CatchError (const char* Prefix, const char* Format, va_list ap)
+/* If errors are caught in the current context, store the message there and
+** return true. Otherwise return false.
+*/
+{
+    if (Ctx && Ctx->CatchErrors) {
+        unsigned Len = xsprintf (Ctx->ErrorMsg, sizeof (Ctx->ErrorMsg),
+                                 "%s", Prefix);
+        xvsnprintf (Ctx->ErrorMsg + Len, sizeof (Ctx->ErrorMsg) - Len,
+                    Format, ap);
+        return 1;
+    }
+    return 0;
+}
+
+
+
 void Warning (const char* Format, ...)
 /* Print a warning message */
 {
@@ -62,10 +84,17 @@ void Warning (const char* Format, ...)
 
 
 void Error (const char* Format, ...)
-/* Print an error message and die */
+/* Print an error message and die. If errors are caught in the current
+** context, the message is stored there instead.
+*/
 {
     va_list ap;
     va_start (ap, Format);
+    if (CatchError ("Error: ", Format, ap)) {
+        /* Continue after the code that disassembles the context */
+        va_end (ap);
+        longjmp (Ctx->ErrorJump, 1);
+    }
     fprintf (stderr, "Error: ");
     vfprintf (stderr, Format, ap);
     putc ('\n', stderr);
@@ -76,10 +105,17 @@ void Error (const char* Format, ...)
 
 
 void Internal (const char* Format, ...)
-/* Print an internal error message and die */
+/* Print an internal error message and die. If errors are caught in the
+** current context, the message is stored there instead.
+*/
 {
     va_list ap;
     va_start (ap, Format);
+    if (CatchError ("Internal error: ", Format, ap)) {
+        /* Continue after the code that disassembles the context */
+        va_end (ap);
+        longjmp (Ctx->ErrorJump, 1);
+    }
     fprintf (stderr, "Internal error: ");
     vfprintf (stderr, Format, ap);
     putc ('\n', stderr);
@@ -53,10 +53,14 @@ void Warning (const char* Format, ...) attribute((format(printf,1,2)));
 /* Print a warning message */
 
 void Error (const char* Format, ...) attribute((noreturn, format(printf,1,2)));
-/* Print an error message and die */
+/* Print an error message and die. If errors are caught in the current
+** context, the message is stored there instead.
+*/
 
 void Internal (const char* Format, ...) attribute((noreturn, format(printf,1,2)));
-/* Print an internal error message and die */
+/* Print an internal error message and die. If errors are caught in the
+** current context, the message is stored there instead.
+*/
 
 
 
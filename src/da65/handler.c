@@ -40,8 +40,10 @@
 #include "xsprintf.h"
 
 /* da65 */
+#include "addrmap.h"
 #include "attrtab.h"
 #include "code.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 #include "handler.h"
@@ -51,8 +53,6 @@
 
 
 
-static unsigned short SubroutineParamSize[0x10000];
-
 /*****************************************************************************/
 /*                             Helper functions                              */
 /*****************************************************************************/
@@ -62,7 +62,7 @@ static unsigned short SubroutineParamSize[0x10000];
 static void Mnemonic (const char* M)
 /* Indent and output a mnemonic */
 {
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output ("%s", M);
 }
 
@@ -82,11 +82,11 @@ static void OneLine (const OpcDesc* D, const char* Arg, ...)
     va_start (ap, Arg);
     xvsprintf (Buf, sizeof (Buf), Arg, ap);
     va_end (ap);
-    Indent (ACol);
+    Indent (Ctx->ACol);
     Output ("%s", Buf);
 
     /* Add the code stuff as comment */
-    LineComment (PC, D->Size);
+    LineComment (Ctx->PC, D->Size);
 
     /* End the line */
     LineFeed ();
@@ -99,7 +99,7 @@ static const char* GetAbsOverride (unsigned Flags, unsigned Addr)
 ** string, otherwise return the empty string.
 */
 {
-    if ((Flags & flAbsOverride) != 0 && Addr < 0x100) {
+    if ((Flags & flAbsOverride) != 0 && (Addr & 0xFFFF) < 0x100) {
         return "a:";
     } else {
         return "";
@@ -113,18 +113,19 @@ static const char* GetAddrArg (unsigned Flags, unsigned Addr)
 {
     const char* Label = 0;
     if (Flags & flUseLabel) {
-        Label = GetLabel (Addr, PC);
+        Label = GetLabel (Addr, Ctx->PC);
     }
     if (Label) {
         return Label;
     } else {
-        static char Buf [32];
+        /* Use the address as seen by the CPU without the bank */
+        Addr &= 0xFFFF;
         if (Addr < 0x100) {
-            xsprintf (Buf, sizeof (Buf), "$%02X", Addr);
+            xsprintf (Ctx->AddrBuf, sizeof (Ctx->AddrBuf), "$%02X", Addr);
         } else {
-            xsprintf (Buf, sizeof (Buf), "$%04X", Addr);
+            xsprintf (Ctx->AddrBuf, sizeof (Ctx->AddrBuf), "$%04X", Addr);
         }
-        return Buf;
+        return Ctx->AddrBuf;
     }
 }
 
@@ -134,10 +135,10 @@ static void GenerateLabel (unsigned Flags, unsigned Addr)
 /* Generate a label in pass one if requested */
 {
     /* Generate labels in pass #1, and only if we don't have a label already */
-    if (Pass == 1 && !HaveLabel (Addr) &&
+    if (Ctx->Pass == 1 && !HaveLabel (Addr) &&
         /* Check if we must create a label */
         ((Flags & flGenLabel) != 0 ||
-         ((Flags & flUseLabel) != 0 && Addr >= CodeStart && Addr <= CodeEnd))) {
+         ((Flags & flUseLabel) != 0 && IsCodeAddr (Addr)))) {
 
         /* As a special case, handle ranges with tables or similar. Within
         ** such a range with a granularity > 1, do only generate dependent
@@ -161,7 +162,7 @@ static void GenerateLabel (unsigned Flags, unsigned Addr)
             unsigned Offs;
             attr_t LabelAttr;
             unsigned LabelAddr = Addr;
-            while (LabelAddr > CodeStart) {
+            while (LabelAddr > Ctx->CodeStart) {
 
                 if (Style != GetStyleAttr (LabelAddr-1)) {
                     /* End of range reached */
@@ -216,7 +217,7 @@ void OH_Accumulator (const OpcDesc* D)
 void OH_Implicit (const OpcDesc* D)
 {
     Mnemonic (D->Mnemo);
-    LineComment (PC, D->Size);
+    LineComment (Ctx->PC, D->Size);
     LineFeed ();
 }
 
@@ -224,14 +225,14 @@ void OH_Implicit (const OpcDesc* D)
 
 void OH_Immediate (const OpcDesc* D)
 {
-    OneLine (D, "#$%02X", GetCodeByte (PC+1));
+    OneLine (D, "#$%02X", GetCodeByte (Ctx->PC+1));
 }
 
 
 
 void OH_ImmediateWord (const OpcDesc* D)
 {
-    OneLine (D, "#$%04X", GetCodeWord (PC+1));
+    OneLine (D, "#$%04X", GetCodeWord (Ctx->PC+1));
 }
 
 
@@ -239,7 +240,7 @@ void OH_ImmediateWord (const OpcDesc* D)
 void OH_Direct (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -253,7 +254,7 @@ void OH_Direct (const OpcDesc* D)
 void OH_DirectX (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -267,7 +268,7 @@ void OH_DirectX (const OpcDesc* D)
 void OH_DirectY (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -281,7 +282,7 @@ void OH_DirectY (const OpcDesc* D)
 void OH_Absolute (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+1);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -295,7 +296,7 @@ void OH_Absolute (const OpcDesc* D)
 void OH_AbsoluteX (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+1);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -309,7 +310,7 @@ void OH_AbsoluteX (const OpcDesc* D)
 void OH_AbsoluteY (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+1);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -337,10 +338,10 @@ void OH_AbsoluteLongX (const OpcDesc* D attribute ((unused)))
 void OH_Relative (const OpcDesc* D)
 {
     /* Get the operand */
-    signed char Offs = GetCodeByte (PC+1);
+    signed char Offs = GetCodeByte (Ctx->PC+1);
 
     /* Calculate the target address */
-    unsigned Addr = (((int) PC+2) + Offs) & 0xFFFF;
+    unsigned Addr = GetBankAddr (Ctx->PC, (((int) Ctx->PC+2) + Offs) & 0xFFFF);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -361,10 +362,10 @@ void OH_RelativeLong (const OpcDesc* D attribute ((unused)))
 void OH_RelativeLong4510 (const OpcDesc* D attribute ((unused)))
 {
     /* Get the operand */
-    signed short Offs = GetCodeWord (PC+1);
+    signed short Offs = GetCodeWord (Ctx->PC+1);
 
     /* Calculate the target address */
-    unsigned Addr = (((int) PC+2) + Offs) & 0xFFFF;
+    unsigned Addr = GetBankAddr (Ctx->PC, (((int) Ctx->PC+2) + Offs) & 0xFFFF);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -378,7 +379,7 @@ void OH_RelativeLong4510 (const OpcDesc* D attribute ((unused)))
 void OH_DirectIndirect (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -392,7 +393,7 @@ void OH_DirectIndirect (const OpcDesc* D)
 void OH_DirectIndirectY (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -406,7 +407,7 @@ void OH_DirectIndirectY (const OpcDesc* D)
 void OH_DirectIndirectZ (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -420,7 +421,7 @@ void OH_DirectIndirectZ (const OpcDesc* D)
 void OH_DirectXIndirect (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -434,7 +435,7 @@ void OH_DirectXIndirect (const OpcDesc* D)
 void OH_AbsoluteIndirect (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+1);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -450,11 +451,11 @@ void OH_BitBranch (const OpcDesc* D)
     char* BranchLabel;
 
     /* Get the operands */
-    unsigned char TestAddr   = GetCodeByte (PC+1);
-    signed char   BranchOffs = GetCodeByte (PC+2);
+    unsigned char TestAddr   = GetCodeByte (Ctx->PC+1);
+    signed char   BranchOffs = GetCodeByte (Ctx->PC+2);
 
     /* Calculate the target address for the branch */
-    unsigned BranchAddr = (((int) PC+3) + BranchOffs) & 0xFFFF;
+    unsigned BranchAddr = GetBankAddr (Ctx->PC, (((int) Ctx->PC+3) + BranchOffs) & 0xFFFF);
 
     /* Generate labels in pass 1. The bit branch codes are special in that
     ** they don't really match the remainder of the 6502 instruction set (they
@@ -466,7 +467,7 @@ void OH_BitBranch (const OpcDesc* D)
 
     /* Make a copy of an operand, so that
     ** the other operand can't overwrite it.
-    ** [GetAddrArg() uses a statically-stored buffer.]
+    ** [GetAddrArg() uses a buffer in the context.]
     */
     BranchLabel = xstrdup (GetAddrArg (flLabel, BranchAddr));
 
@@ -481,13 +482,13 @@ void OH_BitBranch (const OpcDesc* D)
 void OH_ImmediateDirect (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+2);
+    unsigned Addr = GetCodeByte (Ctx->PC+2);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
 
     /* Output the line */
-    OneLine (D, "#$%02X,%s", GetCodeByte (PC+1), GetAddrArg (D->Flags, Addr));
+    OneLine (D, "#$%02X,%s", GetCodeByte (Ctx->PC+1), GetAddrArg (D->Flags, Addr));
 }
 
 
@@ -495,13 +496,13 @@ void OH_ImmediateDirect (const OpcDesc* D)
 void OH_ImmediateDirectX (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+2);
+    unsigned Addr = GetCodeByte (Ctx->PC+2);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
 
     /* Output the line */
-    OneLine (D, "#$%02X,%s,x", GetCodeByte (PC+1), GetAddrArg (D->Flags, Addr));
+    OneLine (D, "#$%02X,%s,x", GetCodeByte (Ctx->PC+1), GetAddrArg (D->Flags, Addr));
 }
 
 
@@ -509,13 +510,13 @@ void OH_ImmediateDirectX (const OpcDesc* D)
 void OH_ImmediateAbsolute (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+2);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+2));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
 
     /* Output the line */
-    OneLine (D, "#$%02X,%s%s", GetCodeByte (PC+1), GetAbsOverride (D->Flags, Addr), GetAddrArg (D->Flags, Addr));
+    OneLine (D, "#$%02X,%s%s", GetCodeByte (Ctx->PC+1), GetAbsOverride (D->Flags, Addr), GetAddrArg (D->Flags, Addr));
 }
 
 
@@ -523,13 +524,13 @@ void OH_ImmediateAbsolute (const OpcDesc* D)
 void OH_ImmediateAbsoluteX (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+2);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+2));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
 
     /* Output the line */
-    OneLine (D, "#$%02X,%s%s,x", GetCodeByte (PC+1), GetAbsOverride (D->Flags, Addr), GetAddrArg (D->Flags, Addr));
+    OneLine (D, "#$%02X,%s%s,x", GetCodeByte (Ctx->PC+1), GetAbsOverride (D->Flags, Addr), GetAddrArg (D->Flags, Addr));
 }
 
 
@@ -551,7 +552,7 @@ void OH_DirectIndirectLongX (const OpcDesc* D attribute ((unused)))
 void OH_StackRelativeIndirectY (const OpcDesc* D attribute ((unused)))
 {
     /* Output the line */
-    OneLine (D, "($%02X,s),y", GetCodeByte (PC+1));
+    OneLine (D, "($%02X,s),y", GetCodeByte (Ctx->PC+1));
 }
 
 
@@ -559,7 +560,7 @@ void OH_StackRelativeIndirectY (const OpcDesc* D attribute ((unused)))
 void OH_StackRelativeIndirectY4510 (const OpcDesc* D attribute ((unused)))
 {
     /* Output the line */
-    OneLine (D, "($%02X,sp),y", GetCodeByte (PC+1));
+    OneLine (D, "($%02X,sp),y", GetCodeByte (Ctx->PC+1));
 }
 
 
@@ -583,9 +584,9 @@ void OH_BlockMove (const OpcDesc* D)
     char* DstLabel;
 
     /* Get source operand */
-    unsigned Src = GetCodeWord (PC+1);
+    unsigned Src = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
     /* Get destination operand */
-    unsigned Dst = GetCodeWord (PC+3);
+    unsigned Dst = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+3));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Src);
@@ -593,7 +594,7 @@ void OH_BlockMove (const OpcDesc* D)
 
     /* Make a copy of an operand, so that
     ** the other operand can't overwrite it.
-    ** [GetAddrArg() uses a statically-stored buffer.]
+    ** [GetAddrArg() uses a buffer in the context.]
     */
     DstLabel = xstrdup (GetAddrArg (D->Flags, Dst));
 
@@ -601,7 +602,7 @@ void OH_BlockMove (const OpcDesc* D)
     OneLine (D, "%s%s,%s%s,$%04X",
              GetAbsOverride (D->Flags, Src), GetAddrArg (D->Flags, Src),
              GetAbsOverride (D->Flags, Dst), DstLabel,
-             GetCodeWord (PC+5));
+             GetCodeWord (Ctx->PC+5));
 
     xfree (DstLabel);
 }
@@ -611,7 +612,7 @@ void OH_BlockMove (const OpcDesc* D)
 void OH_AbsoluteXIndirect (const OpcDesc* D attribute ((unused)))
 {
     /* Get the operand */
-    unsigned Addr = GetCodeWord (PC+1);
+    unsigned Addr = GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1));
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -625,21 +626,21 @@ void OH_AbsoluteXIndirect (const OpcDesc* D attribute ((unused)))
 void OH_DirectImmediate (const OpcDesc* D)
 {
     /* Get the operand */
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
 
     /* Output the line */
-    OneLine (D, "%s, #$%02X", GetAddrArg (D->Flags, Addr), GetCodeByte (PC+2));
+    OneLine (D, "%s, #$%02X", GetAddrArg (D->Flags, Addr), GetCodeByte (Ctx->PC+2));
 }
 
 
 
 void OH_ZeroPageBit (const OpcDesc* D)
 {
-    unsigned Bit = GetCodeByte (PC) >> 5;
-    unsigned Addr = GetCodeByte (PC+1);
+    unsigned Bit = GetCodeByte (Ctx->PC) >> 5;
+    unsigned Addr = GetCodeByte (Ctx->PC+1);
 
     /* Generate a label in pass 1 */
     GenerateLabel (D->Flags, Addr);
@@ -652,7 +653,7 @@ void OH_ZeroPageBit (const OpcDesc* D)
 
 void OH_AccumulatorBit (const OpcDesc* D)
 {
-    unsigned Bit = GetCodeByte (PC) >> 5;
+    unsigned Bit = GetCodeByte (Ctx->PC) >> 5;
 
     /* Output the line */
     OneLine (D, "%01X,a", Bit);
@@ -662,11 +663,11 @@ void OH_AccumulatorBit (const OpcDesc* D)
 
 void OH_AccumulatorBitBranch (const OpcDesc* D)
 {
-    unsigned Bit = GetCodeByte (PC) >> 5;
-    signed char BranchOffs = GetCodeByte (PC+1);
+    unsigned Bit = GetCodeByte (Ctx->PC) >> 5;
+    signed char BranchOffs = GetCodeByte (Ctx->PC+1);
 
     /* Calculate the target address for the branch */
-    unsigned BranchAddr = (((int) PC+3) + BranchOffs) & 0xFFFF;
+    unsigned BranchAddr = GetBankAddr (Ctx->PC, (((int) Ctx->PC+3) + BranchOffs) & 0xFFFF);
 
     /* Generate labels in pass 1 */
     GenerateLabel (flLabel, BranchAddr);
@@ -680,7 +681,7 @@ void OH_AccumulatorBitBranch (const OpcDesc* D)
 void OH_JmpDirectIndirect (const OpcDesc* D)
 {
     OH_DirectIndirect (D);
-    if (NewlineAfterJMP) {
+    if (Ctx->NewlineAfterJMP) {
         LineFeed ();
     }
     SeparatorLine ();
@@ -691,7 +692,7 @@ void OH_JmpDirectIndirect (const OpcDesc* D)
 void OH_SpecialPage (const OpcDesc* D)
 {
   /* Get the operand */
-  unsigned Addr = 0xFF00 + GetCodeByte (PC+1);
+  unsigned Addr = GetBankAddr (Ctx->PC, 0xFF00 + GetCodeByte (Ctx->PC+1));
 
   /* Generate a label in pass 1 */
   GenerateLabel (D->Flags, Addr);
@@ -705,7 +706,7 @@ void OH_SpecialPage (const OpcDesc* D)
 void OH_Rts (const OpcDesc* D)
 {
     OH_Implicit (D);
-    if (NewlineAfterRTS) {
+    if (Ctx->NewlineAfterRTS) {
         LineFeed ();
     }
     SeparatorLine();
@@ -716,7 +717,7 @@ void OH_Rts (const OpcDesc* D)
 void OH_JmpAbsolute (const OpcDesc* D)
 {
     OH_Absolute (D);
-    if (NewlineAfterJMP) {
+    if (Ctx->NewlineAfterJMP) {
         LineFeed ();
     }
     SeparatorLine ();
@@ -727,7 +728,7 @@ void OH_JmpAbsolute (const OpcDesc* D)
 void OH_JmpAbsoluteIndirect (const OpcDesc* D)
 {
     OH_AbsoluteIndirect (D);
-    if (NewlineAfterJMP) {
+    if (Ctx->NewlineAfterJMP) {
         LineFeed ();
     }
     SeparatorLine ();
@@ -738,7 +739,7 @@ void OH_JmpAbsoluteIndirect (const OpcDesc* D)
 void OH_JmpAbsoluteXIndirect (const OpcDesc* D)
 {
     OH_AbsoluteXIndirect (D);
-    if (NewlineAfterJMP) {
+    if (Ctx->NewlineAfterJMP) {
         LineFeed ();
     }
     SeparatorLine ();
@@ -748,24 +749,24 @@ void OH_JmpAbsoluteXIndirect (const OpcDesc* D)
 
 void OH_JsrAbsolute (const OpcDesc* D)
 {
-    unsigned ParamSize = SubroutineParamSize[GetCodeWord (PC+1)];
+    unsigned ParamSize = GetSubroutineParamSize (GetBankAddr (Ctx->PC, GetCodeWord (Ctx->PC+1)));
     OH_Absolute (D);
     if (ParamSize > 0) {
         unsigned RemainingBytes;
         unsigned BytesLeft;
-        PC += D->Size;
+        Ctx->PC += D->Size;
         RemainingBytes = GetRemainingBytes ();
         if (RemainingBytes < ParamSize) {
             ParamSize = RemainingBytes;
         }
         BytesLeft = ParamSize;
         while (BytesLeft > 0) {
-            unsigned Chunk = (BytesLeft > BytesPerLine) ? BytesPerLine : BytesLeft;
+            unsigned Chunk = (BytesLeft > Ctx->BytesPerLine) ? Ctx->BytesPerLine : BytesLeft;
             DataByteLine (Chunk);
             BytesLeft -= Chunk;
-            PC        += Chunk;
+            Ctx->PC        += Chunk;
         }
-        PC -= D->Size;
+        Ctx->PC -= D->Size;
     }
 }
 
@@ -773,5 +774,20 @@ void OH_JsrAbsolute (const OpcDesc* D)
 
 void SetSubroutineParamSize (unsigned Addr, unsigned Size)
 {
-    SubroutineParamSize[Addr] = Size;
+    *(unsigned short*) AddrMapNeed (&Ctx->ParamSizes, Addr) = Size;
+}
+
+
+
+unsigned GetSubroutineParamSize (unsigned Addr)
+{
+    const unsigned short* Size = AddrMapGet (&Ctx->ParamSizes, Addr);
+    return Size? *Size : 0;
+}
+
+
+
+void FreeSubroutineParamSizes (void)
+{
+    AddrMapClear (&Ctx->ParamSizes, 0);
 }
@@ -107,6 +107,8 @@ void OH_JmpAbsoluteXIndirect (const OpcDesc* D);
 void OH_JsrAbsolute (const OpcDesc*);
 
 void SetSubroutineParamSize (unsigned Addr, unsigned Size);
+unsigned GetSubroutineParamSize (unsigned Addr);
+void FreeSubroutineParamSizes (void);
 
 
 /* End of handler.h */
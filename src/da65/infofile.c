@@ -52,6 +52,7 @@
 #include "asminc.h"
 #include "attrtab.h"
 #include "comments.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 #include "infofile.h"
@@ -180,10 +181,12 @@ static void GlobalSection (void)
     static const IdentTok GlobalDefs[] = {
         {   "ARGUMENTCOL",      INFOTOK_ARGUMENT_COLUMN },
         {   "ARGUMENTCOLUMN",   INFOTOK_ARGUMENT_COLUMN },
+        {   "BANKSIZE",         INFOTOK_BANKSIZE        },
         {   "COMMENTCOL",       INFOTOK_COMMENT_COLUMN  },
         {   "COMMENTCOLUMN",    INFOTOK_COMMENT_COLUMN  },
         {   "COMMENTS",         INFOTOK_COMMENTS        },
         {   "CPU",              INFOTOK_CPU             },
+        {   "FLOWTRACE",        INFOTOK_FLOWTRACE       },
         {   "HEXOFFS",          INFOTOK_HEXOFFS         },
         {   "INPUTNAME",        INFOTOK_INPUTNAME       },
         {   "INPUTOFFS",        INFOTOK_INPUTOFFS       },
@@ -219,7 +222,15 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (MIN_ACOL, MAX_ACOL);
-                ACol = InfoIVal;
+                Ctx->ACol = InfoIVal;
+                InfoNextTok ();
+                break;
+
+            case INFOTOK_BANKSIZE:
+                InfoNextTok ();
+                InfoAssureInt ();
+                InfoRangeCheck (1, 0x10000);
+                Ctx->BankSize = InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -227,7 +238,7 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (MIN_CCOL, MAX_CCOL);
-                CCol = InfoIVal;
+                Ctx->CCol = InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -235,18 +246,28 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (MIN_COMMENTS, MAX_COMMENTS);
-                Comments = InfoIVal;
+                Ctx->Comments = InfoIVal;
                 InfoNextTok ();
                 break;
 
             case INFOTOK_CPU:
                 InfoNextTok ();
                 InfoAssureStr ();
-                if (CPU != CPU_UNKNOWN) {
+                if (Ctx->CPU != CPU_UNKNOWN) {
                     InfoError ("CPU already specified");
                 }
-                CPU = FindCPU (InfoSVal);
-                SetOpcTable (CPU);
+                Ctx->CPU = FindCPU (InfoSVal);
+                SetOpcTable (Ctx->CPU);
+                InfoNextTok ();
+                break;
+
+            case INFOTOK_FLOWTRACE:
+                InfoNextTok ();
+                InfoBoolToken ();
+                switch (InfoTok) {
+                    case INFOTOK_FALSE: Ctx->FlowTrace = 0; break;
+                    case INFOTOK_TRUE:  Ctx->FlowTrace = 1; break;
+                }
                 InfoNextTok ();
                 break;
 
@@ -254,8 +275,8 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoBoolToken ();
                 switch (InfoTok) {
-                    case INFOTOK_FALSE: UseHexOffs = 0; break;
-                    case INFOTOK_TRUE:  UseHexOffs = 1; break;
+                    case INFOTOK_FALSE: Ctx->UseHexOffs = 0; break;
+                    case INFOTOK_TRUE:  Ctx->UseHexOffs = 1; break;
                 }
                 InfoNextTok ();
                 break;
@@ -263,25 +284,25 @@ static void GlobalSection (void)
             case INFOTOK_INPUTNAME:
                 InfoNextTok ();
                 InfoAssureStr ();
-                if (InFile) {
+                if (Ctx->InFile) {
                     InfoError ("Input file name already given");
                 }
-                InFile = xstrdup (InfoSVal);
+                Ctx->InFile = xstrdup (InfoSVal);
                 InfoNextTok ();
                 break;
 
             case INFOTOK_INPUTOFFS:
                 InfoNextTok ();
                 InfoAssureInt ();
-                InputOffs = InfoIVal;
+                Ctx->InputOffs = InfoIVal;
                 InfoNextTok ();
                 break;
 
             case INFOTOK_INPUTSIZE:
                 InfoNextTok ();
                 InfoAssureInt ();
-                InfoRangeCheck (1, 0x10000);
-                InputSize = InfoIVal;
+                InfoRangeCheck (1, 0x1000000);
+                Ctx->InputSize = InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -289,7 +310,7 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (0, UCHAR_MAX);
-                LBreak = (unsigned char) InfoIVal;
+                Ctx->LBreak = (unsigned char) InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -297,37 +318,37 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (MIN_MCOL, MAX_MCOL);
-                MCol = InfoIVal;
+                Ctx->MCol = InfoIVal;
                 InfoNextTok ();
                 break;
 
             case INFOTOK_NL_AFTER_JMP:
                 InfoNextTok ();
-                if (NewlineAfterJMP != -1) {
+                if (Ctx->NewlineAfterJMP != -1) {
                     InfoError ("NLAfterJMP already specified");
                 }
                 InfoBoolToken ();
-                NewlineAfterJMP = (InfoTok != INFOTOK_FALSE);
+                Ctx->NewlineAfterJMP = (InfoTok != INFOTOK_FALSE);
                 InfoNextTok ();
                 break;
 
             case INFOTOK_NL_AFTER_RTS:
                 InfoNextTok ();
                 InfoBoolToken ();
-                if (NewlineAfterRTS != -1) {
+                if (Ctx->NewlineAfterRTS != -1) {
                     InfoError ("NLAfterRTS already specified");
                 }
-                NewlineAfterRTS = (InfoTok != INFOTOK_FALSE);
+                Ctx->NewlineAfterRTS = (InfoTok != INFOTOK_FALSE);
                 InfoNextTok ();
                 break;
 
             case INFOTOK_OUTPUTNAME:
                 InfoNextTok ();
                 InfoAssureStr ();
-                if (OutFile) {
+                if (Ctx->OutFile) {
                     InfoError ("Output file name already given");
                 }
-                OutFile = xstrdup (InfoSVal);
+                Ctx->OutFile = xstrdup (InfoSVal);
                 InfoNextTok ();
                 break;
 
@@ -337,15 +358,15 @@ static void GlobalSection (void)
                 if (InfoIVal != 0) {
                     InfoRangeCheck (MIN_PAGE_LEN, MAX_PAGE_LEN);
                 }
-                PageLength = InfoIVal;
+                Ctx->PageLength = InfoIVal;
                 InfoNextTok ();
                 break;
 
             case INFOTOK_STARTADDR:
                 InfoNextTok ();
                 InfoAssureInt ();
-                InfoRangeCheck (0x0000, 0xFFFF);
-                StartAddr = InfoIVal;
+                InfoRangeCheck (0x0000, 0xFFFFFF);
+                Ctx->StartAddr = InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -353,7 +374,7 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 InfoAssureInt ();
                 InfoRangeCheck (MIN_TCOL, MAX_TCOL);
-                TCol = InfoIVal;
+                Ctx->TCol = InfoIVal;
                 InfoNextTok ();
                 break;
 
@@ -412,7 +433,7 @@ static void LabelSection (void)
                     InfoError ("Value already given");
                 }
                 InfoAssureInt ();
-                InfoRangeCheck (0, 0xFFFF);
+                InfoRangeCheck (0, 0xFFFFFF);
                 Value = InfoIVal;
                 InfoNextTok ();
                 break;
@@ -484,7 +505,7 @@ static void LabelSection (void)
         /* Use default */
         Size = 1;
     }
-    if (Value + Size > 0x10000) {
+    if (Value + Size > 0x1000000) {
         InfoError ("Invalid size (address out of range)");
     }
     if (HaveLabel ((unsigned) Value)) {
@@ -593,7 +614,7 @@ static void RangeSection (void)
                 AddAttr ("END", &Attributes, tEnd);
                 InfoNextTok ();
                 InfoAssureInt ();
-                InfoRangeCheck (0x0000, 0xFFFF);
+                InfoRangeCheck (0x0000, 0xFFFFFF);
                 End = InfoIVal;
                 InfoNextTok ();
                 break;
@@ -614,7 +635,7 @@ static void RangeSection (void)
                 AddAttr ("START", &Attributes, tStart);
                 InfoNextTok ();
                 InfoAssureInt ();
-                InfoRangeCheck (0x0000, 0xFFFF);
+                InfoRangeCheck (0x0000, 0xFFFFFF);
                 Start = InfoIVal;
                 InfoNextTok ();
                 break;
@@ -721,7 +742,7 @@ static void SegmentSection (void)
                     InfoError ("Value already given");
                 }
                 InfoAssureInt ();
-                InfoRangeCheck (0, 0xFFFF);
+                InfoRangeCheck (0, 0xFFFFFF);
                 End = InfoIVal;
                 InfoNextTok ();
                 break;
@@ -742,7 +763,7 @@ static void SegmentSection (void)
                     InfoError ("Value already given");
                 }
                 InfoAssureInt ();
-                InfoRangeCheck (0, 0xFFFF);
+                InfoRangeCheck (0, 0xFFFFFF);
                 Start = InfoIVal;
                 InfoNextTok ();
                 break;
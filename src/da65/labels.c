@@ -41,9 +41,11 @@
 #include "xsprintf.h"
 
 /* da65 */
+#include "addrmap.h"
 #include "attrtab.h"
 #include "code.h"
 #include "comments.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 #include "labels.h"
@@ -52,30 +54,27 @@
 
 
 /*****************************************************************************/
-/*                                   Data                                    */
+/*                                   Code                                    */
 /*****************************************************************************/
 
 
 
-/* Symbol table */
-static const char* SymTab[0x10000];
-
-
-
-/*****************************************************************************/
-/*                                   Code                                    */
-/*****************************************************************************/
+static const char* GetSym (unsigned Addr)
+/* Return the name from the symbol table for the given address */
+{
+    const char* const* Sym = AddrMapGet (&Ctx->SymTab, Addr);
+    return Sym? *Sym : 0;
+}
 
 
 
 static const char* MakeLabelName (unsigned Addr)
 /* Make the default label name from the given address and return it in a
-** static buffer.
+** buffer of the current context.
 */
 {
-    static char LabelBuf [32];
-    xsprintf (LabelBuf, sizeof (LabelBuf), "L%04X", Addr);
-    return LabelBuf;
+    xsprintf (Ctx->LabelBuf, sizeof (Ctx->LabelBuf), (Addr > 0xFFFF)? "L%06X" : "L%04X", Addr);
+    return Ctx->LabelBuf;
 }
 
 
@@ -85,6 +84,7 @@ static void AddLabel (unsigned Addr, attr_t Attr, const char* Name)
 {
     /* Get an existing label attribute */
     attr_t ExistingAttr = GetLabelAttr (Addr);
+    const char* ExistingName = GetSym (Addr);
 
     /* Must not have two symbols for one address */
     if (ExistingAttr != atNoLabel) {
@@ -92,16 +92,18 @@ static void AddLabel (unsigned Addr, attr_t Attr, const char* Name)
         ** have a name (you guessed that, didn't you?).
         */
         if (ExistingAttr == Attr &&
-            ((Name == 0 && SymTab[Addr] == 0) ||
-             (Name != 0 && SymTab[Addr] != 0 &&
-             strcmp (SymTab[Addr], Name) == 0))) {
+            ((Name == 0 && ExistingName == 0) ||
+             (Name != 0 && ExistingName != 0 &&
+             strcmp (ExistingName, Name) == 0))) {
             return;
         }
-        Error ("Duplicate label for address $%04X: %s/%s", Addr, SymTab[Addr], Name);
+        Error ("Duplicate label for address $%06X: %s/%s", Addr,
+               ExistingName? ExistingName : "<unnamed>",
+               Name? Name : "<unnamed>");
     }
 
     /* Create a new label (xstrdup will return NULL if input NULL) */
-    SymTab[Addr] = xstrdup (Name);
+    *(const char**) AddrMapNeed (&Ctx->SymTab, Addr) = xstrdup (Name);
 
     /* Remember the attribute */
     MarkAddr (Addr, Attr);
@@ -143,7 +145,7 @@ void AddDepLabel (unsigned Addr, attr_t Attr, const char* BaseName, unsigned Off
     char*    DepName = xmalloc (NameLen + 7);   /* "+$ABCD\0" */
 
     /* Create the new name in the buffer */
-    if (UseHexOffs) {
+    if (Ctx->UseHexOffs) {
         sprintf (DepName, "%s+$%02X", BaseName, Offs);
     } else {
         sprintf (DepName, "%s+%u", BaseName, Offs);
@@ -172,7 +174,7 @@ static void AddLabelRange (unsigned Addr, attr_t Attr,
         unsigned Offs;
 
         /* Setup the format string */
-        const char* Format = UseHexOffs? "$%02X" : "%u";
+        const char* Format = Ctx->UseHexOffs? "$%02X" : "%u";
 
         /* Allocate memory for the dependent label names */
         unsigned NameLen = strlen (Name);
@@ -254,7 +256,7 @@ const char* GetLabelName (unsigned Addr)
         return "";
     } else {
         /* Return the label if any */
-        return SymTab[Addr];
+        return GetSym (Addr);
     }
 }
 
@@ -327,7 +329,7 @@ const char* GetLabel (unsigned Addr, unsigned RefFrom)
 
     } else {
         /* Return the label if any */
-        return SymTab[Addr];
+        return GetSym (Addr);
     }
 }
 
@@ -339,7 +341,7 @@ void ForwardLabel (unsigned Offs)
 */
 {
     /* Calculate the actual address */
-    unsigned long Addr = PC + Offs;
+    unsigned long Addr = Ctx->PC + Offs;
 
     /* Get the type of the label */
     attr_t A = GetLabelAttr (Addr);
@@ -369,7 +371,7 @@ static void DefOutOfRangeLabel (unsigned long Addr)
 
         case atIntLabel:
         case atExtLabel:
-            DefConst (SymTab[Addr], GetComment (Addr), Addr);
+            DefConst (GetSym (Addr), GetComment (Addr), Addr);
             break;
 
         case atUnnamedLabel:
@@ -391,24 +393,32 @@ void DefOutOfRangeLabels (void)
 
     SeparatorLine ();
 
-    /* Low range */
-    Addr = 0;
-    while (Addr < CodeStart) {
-        DefOutOfRangeLabel (Addr++);
-    }
-
-    /* Skip areas in code range */
-    while (Addr <= CodeEnd) {
-        if (GetStyleAttr (Addr) == atSkip) {
+    /* Walk over all addresses that may have a label. Labels outside of the
+    ** code and in skipped areas must be defined.
+    */
+    Addr = NextAttrAddr (0);
+    while (Addr < ADDRMAP_END) {
+        if (!IsCodeAddr (Addr) || GetStyleAttr (Addr) == atSkip) {
             DefOutOfRangeLabel (Addr);
         }
-        ++Addr;
-    }
-
-    /* High range */
-    while (Addr < 0x10000) {
-        DefOutOfRangeLabel (Addr++);
+        Addr = NextAttrAddr (Addr + 1);
     }
 
     SeparatorLine ();
 }
+
+
+
+static void FreeLabel (void* Entry)
+/* Free the name in an entry of the symbol table */
+{
+    xfree (*(char**) Entry);
+}
+
+
+
+void FreeLabels (void)
+/* Remove all labels */
+{
+    AddrMapClear (&Ctx->SymTab, FreeLabel);
+}
@@ -97,6 +97,9 @@ void ForwardLabel (unsigned Offs);
 void DefOutOfRangeLabels (void);
 /* Output any labels that are out of the loaded code range */
 
+void FreeLabels (void);
+/* Remove all labels */
+
 
 
 /* End of labels.h */
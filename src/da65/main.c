@@ -38,29 +38,51 @@
 #include <string.h>
 #include <ctype.h>
 #include <limits.h>
+#include <setjmp.h>
 #include <time.h>
 
 /* common */
 #include "abend.h"
 #include "cmdline.h"
+#include "coll.h"
 #include "cpu.h"
 #include "fname.h"
 #include "print.h"
+#include "tasks.h"
 #include "version.h"
+#include "xmalloc.h"
 
 /* da65 */
 #include "attrtab.h"
 #include "code.h"
 #include "comments.h"
+#include "context.h"
 #include "data.h"
 #include "error.h"
 #include "global.h"
+#include "handler.h"
 #include "infofile.h"
 #include "labels.h"
 #include "opctable.h"
 #include "output.h"
 #include "scanner.h"
 #include "segment.h"
+#include "trace.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* In batch mode, all input files given on the command line are disassembled,
+** each one into a file with the output extension. Each input file has its
+** own context, so several files are disassembled by worker threads at the
+** same time.
+*/
+static unsigned char BatchMode = 0;
 
 
 
@@ -74,6 +96,7 @@ static void Usage (void)
 /* Print usage information and exit */
 {
     printf ("Usage: %s [options] [inputfile]\n"
+            "       %s --batch [options] inputfile ...\n"
             "Short options:\n"
             "  -g\t\t\tAdd debug info to object file\n"
             "  -h\t\t\tHelp (this text)\n"
@@ -87,10 +110,13 @@ static void Usage (void)
             "\n"
             "Long options:\n"
             "  --argument-column n\tSpecify argument start column\n"
+            "  --bank-size n\t\tSplit the input into banks of size n\n"
+            "  --batch\t\tDisassemble all input files into separate files\n"
             "  --comment-column n\tSpecify comment start column\n"
             "  --comments n\t\tSet the comment level for the output\n"
             "  --cpu type\t\tSet cpu type\n"
             "  --debug-info\t\tAdd debug info to object file\n"
+            "  --flow-trace\t\tTrace the code flow to separate code and data\n"
             "  --formfeeds\t\tAdd formfeeds to the output\n"
             "  --help\t\tHelp (this text)\n"
             "  --hexoffs\t\tUse hexadecimal label offsets\n"
@@ -103,7 +129,7 @@ static void Usage (void)
             "  --text-column n\tSpecify text start column\n"
             "  --verbose\t\tIncrease verbosity\n"
             "  --version\t\tPrint the disassembler version\n",
-            ProgName);
+            ProgName, ProgName);
 }
 
 
@@ -159,7 +185,31 @@ static void OptArgumentColumn (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_ACOL, MAX_ACOL);
 
     /* Use the value */
-    ACol = (unsigned char) Val;
+    Ctx->ACol = (unsigned char) Val;
+}
+
+
+
+static void OptBankSize (const char* Opt, const char* Arg)
+/* Handle the --bank-size option */
+{
+    /* Convert the argument to a number */
+    unsigned long Val = CvtNumber (Opt, Arg);
+
+    /* Check for a valid range */
+    RangeCheck (Opt, Val, 1, 0x10000);
+
+    /* Use the value */
+    Ctx->BankSize = Val;
+}
+
+
+
+static void OptBatch (const char* Opt attribute ((unused)),
+                      const char* Arg attribute ((unused)))
+/* Handle the --batch option */
+{
+    BatchMode = 1;
 }
 
 
@@ -174,7 +224,7 @@ static void OptBytesPerLine (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_BYTESPERLINE, MAX_BYTESPERLINE);
 
     /* Use the value */
-    BytesPerLine = (unsigned char) Val;
+    Ctx->BytesPerLine = (unsigned char) Val;
 }
 
 
@@ -189,7 +239,7 @@ static void OptCommentColumn (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_CCOL, MAX_CCOL);
 
     /* Use the value */
-    CCol = (unsigned char) Val;
+    Ctx->CCol = (unsigned char) Val;
 }
 
 
@@ -204,7 +254,7 @@ static void OptComments (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_COMMENTS, MAX_COMMENTS);
 
     /* Use the value */
-    Comments = (unsigned char) Val;
+    Ctx->Comments = (unsigned char) Val;
 }
 
 
@@ -213,8 +263,8 @@ static void OptCPU (const char* Opt attribute ((unused)), const char* Arg)
 /* Handle the --cpu option */
 {
     /* Find the CPU from the given name */
-    CPU = FindCPU (Arg);
-    SetOpcTable (CPU);
+    Ctx->CPU = FindCPU (Arg);
+    SetOpcTable (Ctx->CPU);
 }
 
 
@@ -223,7 +273,16 @@ static void OptDebugInfo (const char* Opt attribute ((unused)),
                           const char* Arg attribute ((unused)))
 /* Add debug info to the object file */
 {
-    DebugInfo = 1;
+    Ctx->DebugInfo = 1;
+}
+
+
+
+static void OptFlowTrace (const char* Opt attribute ((unused)),
+                          const char* Arg attribute ((unused)))
+/* Trace the code flow */
+{
+    Ctx->FlowTrace = 1;
 }
 
 
@@ -232,7 +291,7 @@ static void OptFormFeeds (const char* Opt attribute ((unused)),
                           const char* Arg attribute ((unused)))
 /* Add form feeds to the output */
 {
-    FormFeeds = 1;
+    Ctx->FormFeeds = 1;
 }
 
 
@@ -251,7 +310,7 @@ static void OptHexOffs (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Handle the --hexoffs option */
 {
-    UseHexOffs = 1;
+    Ctx->UseHexOffs = 1;
 }
 
 
@@ -274,7 +333,7 @@ static void OptLabelBreak (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_LABELBREAK, MAX_LABELBREAK);
 
     /* Use the value */
-    LBreak = (unsigned char) Val;
+    Ctx->LBreak = (unsigned char) Val;
 }
 
 
@@ -289,7 +348,7 @@ static void OptMnemonicColumn (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_MCOL, MAX_MCOL);
 
     /* Use the value */
-    MCol = (unsigned char) Val;
+    Ctx->MCol = (unsigned char) Val;
 }
 
 
@@ -301,7 +360,7 @@ static void OptPageLength (const char* Opt attribute ((unused)), const char* Arg
     if (Len != 0) {
         RangeCheck (Opt, Len, MIN_PAGE_LEN, MAX_PAGE_LEN);
     }
-    PageLength = Len;
+    Ctx->PageLength = Len;
 }
 
 
@@ -309,7 +368,8 @@ static void OptPageLength (const char* Opt attribute ((unused)), const char* Arg
 static void OptStartAddr (const char* Opt, const char* Arg)
 /* Set the default start address */
 {
-    StartAddr = CvtNumber (Opt, Arg);
+    Ctx->StartAddr = CvtNumber (Opt, Arg);
+    RangeCheck (Opt, Ctx->StartAddr, 0, 0xFFFFFF);
 }
 
 
@@ -318,7 +378,7 @@ static void OptSyncLines (const char* Opt attribute ((unused)),
                           const char* Arg attribute ((unused)))
 /* Handle the --sync-lines option */
 {
-    SyncLines = 1;
+    Ctx->SyncLines = 1;
 }
 
 
@@ -333,7 +393,7 @@ static void OptTextColumn (const char* Opt, const char* Arg)
     RangeCheck (Opt, Val, MIN_TCOL, MAX_TCOL);
 
     /* Use the value */
-    TCol = (unsigned char) Val;
+    Ctx->TCol = (unsigned char) Val;
 }
 
 
@@ -361,34 +421,34 @@ static void OneOpcode (unsigned RemainingBytes)
 /* Disassemble one opcode */
 {
     unsigned I;
-    unsigned OldPC = PC;
+    unsigned OldPC = Ctx->PC;
 
     /* Get the opcode from the current address */
-    unsigned char OPC = GetCodeByte (PC);
+    unsigned char OPC = GetCodeByte (Ctx->PC);
 
     /* Get the opcode description for the opcode byte */
-    const OpcDesc* D = &OpcTable[OPC];
+    const OpcDesc* D = &Ctx->OpcTable[OPC];
 
     /* Get the output style for the current PC */
-    attr_t Style = GetStyleAttr (PC);
+    attr_t Style = GetStyleAttr (Ctx->PC);
 
     /* If a segment begins here, then name that segment.
     ** Note that the segment is named even if its code is being skipped,
     ** because some of its later code might not be skipped.
     */
-    if (IsSegmentStart (PC)) {
-        StartSegment (GetSegmentStartName (PC), GetSegmentAddrSize (PC));
+    if (IsSegmentStart (Ctx->PC)) {
+        StartSegment (GetSegmentStartName (Ctx->PC), GetSegmentAddrSize (Ctx->PC));
     }
 
     /* If we have a label at this address, output the label and an attached
     ** comment, provided that we aren't in a skip area.
     */
-    if (Style != atSkip && MustDefLabel (PC)) {
-        const char* Comment = GetComment (PC);
+    if (Style != atSkip && MustDefLabel (Ctx->PC)) {
+        const char* Comment = GetComment (Ctx->PC);
         if (Comment) {
             UserComment (Comment);
         }
-        DefLabel (GetLabelName (PC));
+        DefLabel (GetLabelName (Ctx->PC));
     }
 
     /* Check...
@@ -401,22 +461,22 @@ static void OneOpcode (unsigned RemainingBytes)
     if (Style == atDefault) {
         if (D->Size > RemainingBytes) {
             Style = atIllegal;
-            MarkAddr (PC, Style);
+            MarkAddr (Ctx->PC, Style);
         } else if (D->Flags & flIllegal) {
             Style = atIllegal;
-            MarkAddr (PC, Style);
+            MarkAddr (Ctx->PC, Style);
         } else {
-            for (I = PC + D->Size; --I > PC; ) {
+            for (I = Ctx->PC + D->Size; --I > Ctx->PC; ) {
                 if (HaveLabel (I) || IsSegmentStart (I)) {
                     Style = atIllegal;
-                    MarkAddr (PC, Style);
+                    MarkAddr (Ctx->PC, Style);
                     break;
                 }
             }
             for (I = 0; I < D->Size - 1u; ++I) {
-                if (IsSegmentEnd (PC + I)) {
+                if (IsSegmentEnd (Ctx->PC + I)) {
                     Style = atIllegal;
-                    MarkAddr (PC, Style);
+                    MarkAddr (Ctx->PC, Style);
                     break;
                 }
             }
@@ -428,7 +488,7 @@ static void OneOpcode (unsigned RemainingBytes)
 
         case atDefault:
             D->Handler (D);
-            PC += D->Size;
+            Ctx->PC += D->Size;
             break;
 
         case atCode:
@@ -442,7 +502,7 @@ static void OneOpcode (unsigned RemainingBytes)
                 }
                 /* Output the insn */
                 D->Handler (D);
-                PC += D->Size;
+                Ctx->PC += D->Size;
                 break;
             }
             /* FALLTHROUGH */
@@ -476,20 +536,20 @@ static void OneOpcode (unsigned RemainingBytes)
             break;
 
         case atSkip:
-            ++PC;
+            ++Ctx->PC;
             break;
 
         default:
             DataByteLine (1);
-            ++PC;
+            ++Ctx->PC;
             break;
     }
 
     /* Change back to the default CODE segment if
     ** a named segment stops at the current address.
     */
-    for (I = PC - OldPC; I > 0; --I) {
-        if (IsSegmentEnd (PC - I)) {
+    for (I = Ctx->PC - OldPC; I > 0; --I) {
+        if (IsSegmentEnd (Ctx->PC - I)) {
             EndSegment ();
             break;
         }
@@ -503,10 +563,17 @@ static void OnePass (void)
 {
     unsigned Count;
 
-    /* Disassemble until nothing left */
-    while ((Count = GetRemainingBytes()) > 0) {
-        OneOpcode (Count);
-    }
+    /* Disassemble until nothing left. Code doesn't cross bank boundaries,
+    ** and every bank is placed at its own address, if there's more than one.
+    */
+    do {
+        if (IsBankStart ()) {
+            StartBank (Ctx->PC);
+        }
+        while ((Count = GetRemainingBytes()) > 0) {
+            OneOpcode (Count);
+        }
+    } while (NextBank ());
 }
 
 
@@ -514,15 +581,20 @@ static void OnePass (void)
 static void Disassemble (void)
 /* Disassemble the code */
 {
+    /* Separate code and data by following the code flow if requested */
+    if (Ctx->FlowTrace) {
+        TraceCode ();
+    }
+
     /* Pass 1 */
-    Pass = 1;
+    Ctx->Pass = 1;
     OnePass ();
 
     Output ("---------------------------");
     LineFeed ();
 
     /* Pass 2 */
-    Pass = 2;
+    Ctx->Pass = 2;
     ResetCode ();
     OutputSettings ();
     DefOutOfRangeLabels ();
@@ -531,17 +603,133 @@ static void Disassemble (void)
 
 
 
+static void PrepareFile (void)
+/* Read the info file, load the input file and open the output file of the
+** current context.
+*/
+{
+    /* Try to read the info file */
+    ReadInfoFile ();
+
+    /* Must have an input file */
+    if (Ctx->InFile == 0) {
+        AbEnd ("No input file");
+    }
+
+    /* Check the formatting options for reasonable values. Note: We will not
+    ** really check that they make sense, just that they aren't complete
+    ** garbage.
+    */
+    if (Ctx->MCol >= Ctx->ACol) {
+        AbEnd ("mnemonic-column value must be smaller than argument-column value");
+    }
+    if (Ctx->ACol >= Ctx->CCol) {
+        AbEnd ("argument-column value must be smaller than comment-column value");
+    }
+    if (Ctx->CCol >= Ctx->TCol) {
+        AbEnd ("comment-column value must be smaller than text-column value");
+    }
+
+    /* If no CPU given, use the default CPU */
+    if (Ctx->CPU == CPU_UNKNOWN) {
+        Ctx->CPU = CPU_6502;
+        SetOpcTable (Ctx->CPU);
+    }
+
+    /* Load the input file */
+    LoadCode ();
+
+    /* Open the output file */
+    OpenOutput (Ctx->OutFile);
+}
+
+
+
+static void DisassembleTask (void* Data, unsigned Index)
+/* Disassemble one of the contexts in the array Data. This is called by the
+** worker threads. Errors are stored in the context.
+*/
+{
+    Ctx = ((Context**) Data)[Index];
+    Ctx->CatchErrors = 1;
+    if (setjmp (Ctx->ErrorJump) == 0) {
+        Disassemble ();
+    }
+    Ctx->CatchErrors = 0;
+}
+
+
+
+static void DisassembleBatch (const Collection* InFiles)
+/* Disassemble all input files with the settings from the command line. The
+** output name is derived from the input name.
+*/
+{
+    Context*    Settings = Ctx;
+    unsigned    Max = ProcessorCount () * 2;
+    Context**   Contexts = xmalloc (Max * sizeof (Context*));
+    char**      Names = xmalloc (Max * sizeof (char*));
+    unsigned    First, Count, I;
+
+    /* Work on a group of files at a time, so the memory needed is limited.
+    ** Reading the info files, loading the code and reporting errors is done
+    ** here in the order of the files, only the disassembly itself is done
+    ** by the worker threads.
+    */
+    for (First = 0; First < CollCount (InFiles); First += Count) {
+
+        Count = CollCount (InFiles) - First;
+        if (Count > Max) {
+            Count = Max;
+        }
+
+        /* Prepare the files */
+        for (I = 0; I < Count; ++I) {
+            Ctx = Contexts[I] = NewContext (Settings);
+            Ctx->InFile = CollConstAt (InFiles, First + I);
+            Ctx->OutFile = Names[I] = MakeFilename (Ctx->InFile, OutExt);
+            Print (stderr, 1, "Disassembling `%s' to `%s'\n", Ctx->InFile, Ctx->OutFile);
+            PrepareFile ();
+        }
+
+        /* Disassemble them */
+        RunTasks (DisassembleTask, Contexts, Count);
+
+        /* Check for errors, close the output files and free the contexts */
+        for (I = 0; I < Count; ++I) {
+            Ctx = Contexts[I];
+            if (Ctx->ErrorMsg[0] != '\0') {
+                fprintf (stderr, "%s\n", Ctx->ErrorMsg);
+                exit (EXIT_FAILURE);
+            }
+            CloseOutput ();
+            FreeContext (Ctx);
+            xfree (Names[I]);
+        }
+    }
+
+    /* Restore the context and free the arrays */
+    Ctx = Settings;
+    xfree (Contexts);
+    xfree (Names);
+}
+
+
+
 int main (int argc, char* argv [])
 /* Assembler main program */
 {
     /* Program long options */
     static const LongOpt OptTab[] = {
         { "--argument-column",  1,      OptArgumentColumn       },
+        { "--bank-size",        1,      OptBankSize             },
+        { "--batch",            0,      OptBatch                },
         { "--bytes-per-line",   1,      OptBytesPerLine         },
         { "--comment-column",   1,      OptCommentColumn        },
         { "--comments",         1,      OptComments             },
         { "--cpu",              1,      OptCPU                  },
         { "--debug-info",       0,      OptDebugInfo            },
+        { "--flow-trace",       0,      OptFlowTrace            },
         { "--formfeeds",        0,      OptFormFeeds            },
         { "--help",             0,      OptHelp                 },
         { "--hexoffs",          0,      OptHexOffs              },
@@ -556,12 +744,16 @@ int main (int argc, char* argv [])
         { "--version",          0,      OptVersion              },
     };
 
+    Collection InFiles = STATIC_COLLECTION_INITIALIZER;
     unsigned I;
     time_t T;
 
     /* Initialize the cmdline module */
     InitCmdLine (&argc, &argv, "da65");
 
+    /* The command line options are stored in the first context */
+    Ctx = NewContext (0);
+
     /* Check the parameters */
     I = 1;
     while (I < ArgCount) {
@@ -590,7 +782,7 @@ int main (int argc, char* argv [])
                     break;
 
                 case 'o':
-                    OutFile = GetArg (&I, 2);
+                    Ctx->OutFile = GetArg (&I, 2);
                     break;
 
                 case 'v':
@@ -615,64 +807,48 @@ int main (int argc, char* argv [])
 
             }
         } else {
-            /* Filename. Check if we already had one */
-            if (InFile) {
-                fprintf (stderr, "%s: Don't know what to do with `%s'\n",
-                         ProgName, Arg);
-                exit (EXIT_FAILURE);
-            } else {
-                InFile = Arg;
-            }
+            /* Filename, checked below */
+            CollAppend (&InFiles, (void*) Arg);
         }
 
         /* Next argument */
         ++I;
     }
 
-    /* Try to read the info file */
-    ReadInfoFile ();
-
-    /* Must have an input file */
-    if (InFile == 0) {
-        AbEnd ("No input file");
-    }
-
-    /* Check the formatting options for reasonable values. Note: We will not
-    ** really check that they make sense, just that they aren't complete
-    ** garbage.
-    */
-    if (MCol >= ACol) {
-        AbEnd ("mnemonic-column value must be smaller than argument-column value");
-    }
-    if (ACol >= CCol) {
-        AbEnd ("argument-column value must be smaller than comment-column value");
-    }
-    if (CCol >= TCol) {
-        AbEnd ("comment-column value must be smaller than text-column value");
-    }
-
-    /* If no CPU given, use the default CPU */
-    if (CPU == CPU_UNKNOWN) {
-        CPU = CPU_6502;
-    }
-
     /* Get the current time and convert it to string so it can be used in
     ** the output page headers.
     */
     T = time (0);
     strftime (Now, sizeof (Now), "%Y-%m-%d %H:%M:%S", localtime (&T));
 
-    /* Load the input file */
-    LoadCode ();
+    if (!BatchMode) {
 
-    /* Open the output file */
-    OpenOutput (OutFile);
+        /* Only one input file is allowed */
+        if (CollCount (&InFiles) > 1) {
+            fprintf (stderr, "%s: Don't know what to do with `%s'\n",
+                     ProgName, (const char*) CollAt (&InFiles, 1));
+            exit (EXIT_FAILURE);
+        } else if (CollCount (&InFiles) == 1) {
+            Ctx->InFile = CollAt (&InFiles, 0);
+        }
+
+        /* Disassemble it */
+        PrepareFile ();
+        Disassemble ();
+        CloseOutput ();
 
-    /* Disassemble the code */
-    Disassemble ();
+    } else {
 
-    /* Close the output file */
-    CloseOutput ();
+        if (CollCount (&InFiles) == 0) {
+            AbEnd ("No input file");
+        }
+        if (Ctx->OutFile) {
+            AbEnd ("An output file name cannot be used in batch mode");
+        }
+
+        /* Disassemble all files */
+        DisassembleBatch (&InFiles);
+    }
 
     /* Done */
     return EXIT_SUCCESS;
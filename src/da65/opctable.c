@@ -34,6 +34,7 @@
 
 
 /* da65 */
+#include "context.h"
 #include "error.h"
 #include "opc4510.h"
 #include "opc6502.h"
@@ -47,17 +48,6 @@
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-/* Descriptions for all opcodes */
-const OpcDesc* OpcTable = OpcTable_6502;
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -65,16 +55,16 @@ const OpcDesc* OpcTable = OpcTable_6502;
 
 
 void SetOpcTable (cpu_t CPU)
-/* Set the correct opcode table for the given CPU */
+/* Set the correct opcode table of the current context for the given CPU */
 {
     switch (CPU) {
-        case CPU_6502:    OpcTable = OpcTable_6502;     break;
-        case CPU_6502X:   OpcTable = OpcTable_6502X;    break;
-        case CPU_65SC02:  OpcTable = OpcTable_65SC02;   break;
-        case CPU_65C02:   OpcTable = OpcTable_65C02;    break;
-        case CPU_HUC6280: OpcTable = OpcTable_HuC6280;  break;
-        case CPU_M740:    OpcTable = OpcTable_M740;     break;
-        case CPU_4510:    OpcTable = OpcTable_4510;     break;
+        case CPU_6502:    Ctx->OpcTable = OpcTable_6502;     break;
+        case CPU_6502X:   Ctx->OpcTable = OpcTable_6502X;    break;
+        case CPU_65SC02:  Ctx->OpcTable = OpcTable_65SC02;   break;
+        case CPU_65C02:   Ctx->OpcTable = OpcTable_65C02;    break;
+        case CPU_HUC6280: Ctx->OpcTable = OpcTable_HuC6280;  break;
+        case CPU_M740:    Ctx->OpcTable = OpcTable_M740;     break;
+        case CPU_4510:    Ctx->OpcTable = OpcTable_4510;     break;
         default:          Error ("Unsupported CPU");
     }
 }
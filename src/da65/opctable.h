@@ -46,17 +46,6 @@
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-/* Descriptions for all opcodes */
-extern const OpcDesc* OpcTable;
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -64,7 +53,7 @@ extern const OpcDesc* OpcTable;
 
 
 void SetOpcTable (cpu_t CPU);
-/* Set the correct opcode table for the given CPU */
+/* Set the correct opcode table of the current context for the given CPU */
 
 
 
@@ -46,27 +46,13 @@
 
 /* da65 */
 #include "code.h"
+#include "context.h"
 #include "error.h"
 #include "global.h"
 #include "output.h"
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-static FILE*    F       = 0;            /* Output stream */
-static unsigned Col     = 1;            /* Current column */
-static unsigned Line    = 0;            /* Current line on page */
-static unsigned Page    = 1;            /* Current output page */
-
-static const char* SegmentName = 0;     /* Name of current segment */
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -76,15 +62,15 @@ static const char* SegmentName = 0;     /* Name of current segment */
 static void PageHeader (void)
 /* Print a page header */
 {
-    fprintf (F,
+    fprintf (Ctx->OutStream,
              "; da65 V%s\n"
              "; Created:    %s\n"
              "; Input file: %s\n"
              "; Page:       %u\n\n",
              GetVersionAsString (),
              Now,
-             InFile,
-             Page);
+             Ctx->InFile,
+             Ctx->Page);
 }
 
 
@@ -94,18 +80,20 @@ void OpenOutput (const char* Name)
 {
     /* If we have a name given, open the output file, otherwise use stdout */
     if (Name != 0) {
-        F = fopen (Name, "w");
-        if (F == 0) {
+        Ctx->OutStream = fopen (Name, "w");
+        if (Ctx->OutStream == 0) {
             Error ("Cannot open `%s': %s", Name, strerror (errno));
         }
     } else {
-        F = stdout;
+        Ctx->OutStream = stdout;
     }
 
     /* Output the header and initialize stuff */
+    Ctx->Page = 1;
+    Ctx->SegmentName = 0;
     PageHeader ();
-    Line = 5;
-    Col  = 1;
+    Ctx->Line = 5;
+    Ctx->Col  = 1;
 }
 
 
@@ -113,7 +101,7 @@ void OpenOutput (const char* Name)
 void CloseOutput (void)
 /* Close the output file */
 {
-    if (F != stdout && fclose (F) != 0) {
+    if (Ctx->OutStream != stdout && fclose (Ctx->OutStream) != 0) {
         Error ("Error closing output file: %s", strerror (errno));
     }
 }
@@ -123,10 +111,10 @@ void CloseOutput (void)
 void Output (const char* Format, ...)
 /* Write to the output file */
 {
-    if (Pass == PassCount) {
+    if (Ctx->Pass == PassCount) {
         va_list ap;
         va_start (ap, Format);
-        Col += vfprintf (F, Format, ap);
+        Ctx->Col += vfprintf (Ctx->OutStream, Format, ap);
         va_end (ap);
     }
 }
@@ -136,10 +124,10 @@ void Output (const char* Format, ...)
 void Indent (unsigned N)
 /* Make sure the current line column is at position N (zero based) */
 {
-    if (Pass == PassCount) {
-        while (Col < N) {
-            fputc (' ', F);
-            ++Col;
+    if (Ctx->Pass == PassCount) {
+        while (Ctx->Col < N) {
+            fputc (' ', Ctx->OutStream);
+            ++Ctx->Col;
         }
     }
 }
@@ -149,17 +137,17 @@ void Indent (unsigned N)
 void LineFeed (void)
 /* Add a linefeed to the output file */
 {
-    if (Pass == PassCount) {
-        fputc ('\n', F);
-        if (PageLength > 0 && ++Line >= PageLength) {
-            if (FormFeeds) {
-                fputc ('\f', F);
+    if (Ctx->Pass == PassCount) {
+        fputc ('\n', Ctx->OutStream);
+        if (Ctx->PageLength > 0 && ++Ctx->Line >= Ctx->PageLength) {
+            if (Ctx->FormFeeds) {
+                fputc ('\f', Ctx->OutStream);
             }
-            ++Page;
+            ++Ctx->Page;
             PageHeader ();
-            Line = 5;
+            Ctx->Line = 5;
         }
-        Col = 1;
+        Ctx->Col = 1;
     }
 }
 
@@ -172,7 +160,7 @@ void DefLabel (const char* Name)
     /* If the label is longer than the configured maximum, or if it runs into
     ** the opcode column, start a new line.
     */
-    if (Col > LBreak+2 || Col > MCol) {
+    if (Ctx->Col > Ctx->LBreak+2 || Ctx->Col > Ctx->MCol) {
         LineFeed ();
     }
 }
@@ -184,22 +172,22 @@ void DefForward (const char* Name, const char* Comment, unsigned Offs)
 ** current PC.
 */
 {
-    if (Pass == PassCount) {
+    if (Ctx->Pass == PassCount) {
         /* Flush existing output if necessary */
-        if (Col > 1) {
+        if (Ctx->Col > 1) {
             LineFeed ();
         }
 
         /* Output the forward definition */
         Output ("%s", Name);
-        Indent (ACol);
-        if (UseHexOffs) {
+        Indent (Ctx->ACol);
+        if (Ctx->UseHexOffs) {
             Output (":= * + $%04X", Offs);
         } else {
             Output (":= * + %u", Offs);
         }
         if (Comment) {
-            Indent (CCol);
+            Indent (Ctx->CCol);
             Output ("; %s", Comment);
         }
         LineFeed ();
@@ -211,12 +199,12 @@ void DefForward (const char* Name, const char* Comment, unsigned Offs)
 void DefConst (const char* Name, const char* Comment, unsigned Addr)
 /* Define an address constant */
 {
-    if (Pass == PassCount) {
+    if (Ctx->Pass == PassCount) {
         Output ("%s", Name);
-        Indent (ACol);
+        Indent (Ctx->ACol);
         Output (":= $%04X", Addr);
         if (Comment) {
-            Indent (CCol);
+            Indent (Ctx->CCol);
             Output ("; %s", Comment);
         }
         LineFeed ();
@@ -230,17 +218,17 @@ void DataByteLine (unsigned ByteCount)
 {
     unsigned I;
 
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output (".byte");
-    Indent (ACol);
+    Indent (Ctx->ACol);
     for (I = 0; I < ByteCount; ++I) {
         if (I > 0) {
-            Output (",$%02X", CodeBuf[PC+I]);
+            Output (",$%02X", GetCodeByte (Ctx->PC+I));
         } else {
-            Output ("$%02X", CodeBuf[PC+I]);
+            Output ("$%02X", GetCodeByte (Ctx->PC+I));
         }
     }
-    LineComment (PC, ByteCount);
+    LineComment (Ctx->PC, ByteCount);
     LineFeed ();
 }
 
@@ -251,17 +239,17 @@ void DataDByteLine (unsigned ByteCount)
 {
     unsigned I;
 
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output (".dbyt");
-    Indent (ACol);
+    Indent (Ctx->ACol);
     for (I = 0; I < ByteCount; I += 2) {
         if (I > 0) {
-            Output (",$%04X", GetCodeDByte (PC+I));
+            Output (",$%04X", GetCodeDByte (Ctx->PC+I));
         } else {
-            Output ("$%04X", GetCodeDByte (PC+I));
+            Output ("$%04X", GetCodeDByte (Ctx->PC+I));
         }
     }
-    LineComment (PC, ByteCount);
+    LineComment (Ctx->PC, ByteCount);
     LineFeed ();
 }
 
@@ -272,17 +260,17 @@ void DataWordLine (unsigned ByteCount)
 {
     unsigned I;
 
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output (".word");
-    Indent (ACol);
+    Indent (Ctx->ACol);
     for (I = 0; I < ByteCount; I += 2) {
         if (I > 0) {
-            Output (",$%04X", GetCodeWord (PC+I));
+            Output (",$%04X", GetCodeWord (Ctx->PC+I));
         } else {
-            Output ("$%04X", GetCodeWord (PC+I));
+            Output ("$%04X", GetCodeWord (Ctx->PC+I));
         }
     }
-    LineComment (PC, ByteCount);
+    LineComment (Ctx->PC, ByteCount);
     LineFeed ();
 }
 
@@ -293,17 +281,17 @@ void DataDWordLine (unsigned ByteCount)
 {
     unsigned I;
 
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output (".dword");
-    Indent (ACol);
+    Indent (Ctx->ACol);
     for (I = 0; I < ByteCount; I += 4) {
         if (I > 0) {
-            Output (",$%08lX", GetCodeDWord (PC+I));
+            Output (",$%08lX", GetCodeDWord (Ctx->PC+I));
         } else {
-            Output ("$%08lX", GetCodeDWord (PC+I));
+            Output ("$%08lX", GetCodeDWord (Ctx->PC+I));
         }
     }
-    LineComment (PC, ByteCount);
+    LineComment (Ctx->PC, ByteCount);
     LineFeed ();
 }
 
@@ -312,7 +300,7 @@ void DataDWordLine (unsigned ByteCount)
 void SeparatorLine (void)
 /* Print a separator line */
 {
-    if (Pass == PassCount && Comments >= 1) {
+    if (Ctx->Pass == PassCount && Ctx->Comments >= 1) {
         Output ("; ----------------------------------------------------------------------------");
         LineFeed ();
     }
@@ -323,11 +311,11 @@ void SeparatorLine (void)
 void StartSegment (const char* Name, unsigned AddrSize)
 /* Start a segment */
 {
-    if (Pass == PassCount) {
+    if (Ctx->Pass == PassCount) {
         LineFeed ();
         Output (".segment");
-        Indent (ACol);
-        SegmentName = Name;
+        Indent (Ctx->ACol);
+        Ctx->SegmentName = Name;
         Output ("\"%s\"", Name);
         if (AddrSize != ADDR_SIZE_DEFAULT) {
             Output (": %s", AddrSizeToStr (AddrSize));
@@ -339,11 +327,28 @@ void StartSegment (const char* Name, unsigned AddrSize)
 
 
 
+void StartBank (unsigned long Addr)
+/* Place a new bank at the address the CPU sees it */
+{
+    if (Ctx->Pass == PassCount) {
+        LineFeed ();
+        Indent (Ctx->MCol);
+        Output (".org");
+        Indent (Ctx->ACol);
+        Output ("$%04lX", Addr & 0xFFFFUL);
+        LineComment (Addr, 0);
+        LineFeed ();
+        LineFeed ();
+    }
+}
+
+
+
 void EndSegment (void)
 /* End a segment */
 {
     LineFeed ();
-    Output ("; End of \"%s\" segment", SegmentName);
+    Output ("; End of \"%s\" segment", Ctx->SegmentName);
     LineFeed ();
     SeparatorLine ();
     Output (".code");
@@ -367,17 +372,17 @@ void LineComment (unsigned PC, unsigned Count)
 {
     unsigned I;
 
-    if (Pass == PassCount && Comments >= 2) {
-        Indent (CCol);
-        Output ("; %04X", PC);
-        if (Comments >= 3) {
+    if (Ctx->Pass == PassCount && Ctx->Comments >= 2) {
+        Indent (Ctx->CCol);
+        Output ((PC > 0xFFFF)? "; %06X" : "; %04X", PC);
+        if (Ctx->Comments >= 3) {
             for (I = 0; I < Count; ++I) {
-                Output (" %02X", CodeBuf [PC+I]);
+                Output (" %02X", GetCodeByte (PC+I));
             }
-            if (Comments >= 4) {
-                Indent (TCol);
+            if (Ctx->Comments >= 4) {
+                Indent (Ctx->TCol);
                 for (I = 0; I < Count; ++I) {
-                    unsigned char C = CodeBuf [PC+I];
+                    unsigned char C = GetCodeByte (PC+I);
                     if (!isprint (C)) {
                         C = '.';
                     }
@@ -394,10 +399,10 @@ void OutputSettings (void)
 /* Output CPU and other settings */
 {
     LineFeed ();
-    Indent (MCol);
+    Indent (Ctx->MCol);
     Output (".setcpu");
-    Indent (ACol);
-    Output ("\"%s\"", CPUNames[CPU]);
+    Indent (Ctx->ACol);
+    Output ("\"%s\"", CPUNames[Ctx->CPU]);
     LineFeed ();
     LineFeed ();
 }
@@ -96,6 +96,9 @@ void SeparatorLine (void);
 void StartSegment (const char* Name, unsigned AddrSize);
 /* Start a segment */
 
+void StartBank (unsigned long Addr);
+/* Place a new bank at the address the CPU sees it */
+
 void EndSegment (void);
 /* End a segment */
 
@@ -45,6 +45,7 @@
 #include "strbuf.h"
 
 /* ld65 */
+#include "context.h"
 #include "global.h"
 #include "error.h"
 #include "scanner.h"
@@ -448,7 +449,7 @@ Again:
 
         case '#':
             /* # lineno "sourcefile" or # comment */
-            if (SyncLines && InputCol == 1) {
+            if (Ctx->SyncLines && InputCol == 1) {
                 LineMarkerOrComment ();
             } else {
                 do {
@@ -686,10 +687,12 @@ void InfoOpenInput (void)
         Error ("Cannot open `%s': %s", InfoFile, strerror (errno));
     }
 
-    /* Initialize variables */
+    /* Initialize variables. The file may be read more than once. */
     C         = ' ';
     InputLine = 1;
     InputCol  = 0;
+    xfree (InputSrcName);
+    InputSrcName = xstrdup (InfoFile);
 
     /* Start the ball rolling ... */
     InfoNextTok ();
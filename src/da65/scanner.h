@@ -69,9 +69,11 @@ typedef enum token_t {
 
     /* Global section */
     INFOTOK_ARGUMENT_COLUMN,
+    INFOTOK_BANKSIZE,
     INFOTOK_COMMENT_COLUMN,
     INFOTOK_COMMENTS,
     INFOTOK_CPU,
+    INFOTOK_FLOWTRACE,
     INFOTOK_HEXOFFS,
     INFOTOK_INPUTNAME,
     INFOTOK_INPUTOFFS,
@@ -41,6 +41,7 @@
 
 /* da65 */
 #include "attrtab.h"
+#include "context.h"
 #include "segment.h"
 
 
@@ -51,9 +52,6 @@
 
 
 
-/* Hash definitions */
-#define HASH_SIZE       53
-
 /* Segment definition */
 typedef struct Segment Segment;
 struct Segment {
@@ -63,11 +61,6 @@ struct Segment {
     char                Name[1];        /* Name, dynamically allocated */
 };
 
-/* Table containing the segments. A segment is inserted using its hash
-** value. Collisions are handled by single-linked lists.
-*/
-static Segment* StartTab[HASH_SIZE];    /* Table containing segment starts */
-
 
 
 /*****************************************************************************/
@@ -91,8 +84,8 @@ void AddAbsSegment (unsigned Start, unsigned End, const char* Name)
     memcpy (S->Name, Name, Len + 1);
 
     /* Insert the segment into the hash table */
-    S->NextStart = StartTab[Start % HASH_SIZE];
-    StartTab[Start % HASH_SIZE] = S;
+    S->NextStart = Ctx->SegStarts[Start % SEGMENT_HASH_SIZE];
+    Ctx->SegStarts[Start % SEGMENT_HASH_SIZE] = S;
 
     /* Mark start and end of the segment */
     MarkAddr (Start, atSegmentStart);
@@ -107,7 +100,7 @@ void AddAbsSegment (unsigned Start, unsigned End, const char* Name)
 char* GetSegmentStartName (unsigned Addr)
 /* Return the name of the segment which starts at the given address */
 {
-    Segment* S = StartTab[Addr % HASH_SIZE];
+    Segment* S = Ctx->SegStarts[Addr % SEGMENT_HASH_SIZE];
 
     /* Search the collision list for the exact address */
     while (S != 0) {
@@ -125,7 +118,7 @@ char* GetSegmentStartName (unsigned Addr)
 unsigned GetSegmentAddrSize (unsigned Addr)
 /* Return the address size of the segment which starts at the given address */
 {
-    Segment* S = StartTab[Addr % HASH_SIZE];
+    Segment* S = Ctx->SegStarts[Addr % SEGMENT_HASH_SIZE];
 
     /* Search the collision list for the exact address */
     while (S != 0) {
@@ -137,3 +130,18 @@ unsigned GetSegmentAddrSize (unsigned Addr)
 
     return 0;
 }
+
+
+
+void FreeSegments (void)
+/* Remove all segments */
+{
+    unsigned I;
+    for (I = 0; I < SEGMENT_HASH_SIZE; ++I) {
+        while (Ctx->SegStarts[I] != 0) {
+            Segment* S = Ctx->SegStarts[I];
+            Ctx->SegStarts[I] = S->NextStart;
+            xfree (S);
+        }
+    }
+}
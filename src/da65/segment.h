@@ -53,6 +53,9 @@ char* GetSegmentStartName (unsigned Addr);
 unsigned GetSegmentAddrSize (unsigned Addr);
 /* Return the address size of the segment which starts at the given address */
 
+void FreeSegments (void);
+/* Remove all segments */
+
 
 
 /* End of segment.h */
@@ -0,0 +1,326 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  trace.c                                  */
+/*                                                                           */
+/*                         Code flow tracing for da65                        */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "print.h"
+#include "xmalloc.h"
+
+/* da65 */
+#include "addrmap.h"
+#include "attrtab.h"
+#include "code.h"
+#include "context.h"
+#include "handler.h"
+#include "opctable.h"
+#include "trace.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Trace state of each address in the context: Added to the work list, and
+** the start of an instruction that was traced.
+*/
+#define TR_QUEUED       0x01
+#define TR_TRACED       0x02
+
+/* Hardware vectors of the 6502 */
+#define VECTORS         0xFFFA
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void AddEntry (unsigned long Addr)
+/* Add an address to the work list if it is within the code and was neither
+** queued nor traced before.
+*/
+{
+    unsigned char* Q;
+
+    if (!IsCodeAddr (Addr)) {
+        return;
+    }
+    Q = AddrMapNeed (&Ctx->TraceState, Addr);
+    if (*Q == 0) {
+        *Q = TR_QUEUED;
+        if (Ctx->WorkCount == Ctx->WorkSize) {
+            Ctx->WorkSize = (Ctx->WorkSize == 0)? 256 : Ctx->WorkSize * 2;
+            Ctx->WorkList = xrealloc (Ctx->WorkList, Ctx->WorkSize * sizeof (Ctx->WorkList[0]));
+        }
+        Ctx->WorkList[Ctx->WorkCount++] = Addr;
+    }
+}
+
+
+
+static void AddTarget (unsigned long From, unsigned long Target)
+/* Add the target of a branch or jump from the code at From. The CPU only
+** sees the low 16 bits of the target, it is in the bank of From.
+*/
+{
+    AddEntry (GetBankAddr (From, (unsigned) (Target & 0xFFFF)));
+}
+
+
+
+static int MayBeCode (unsigned long Addr)
+/* Return true if the info file allows code at the given address */
+{
+    attr_t Style = GetStyleAttr (Addr);
+    return (Style == atDefault || Style == atCode);
+}
+
+
+
+static int IsMnemo (const OpcDesc* D, const char* Mnemo)
+/* Return true if the instruction has the given mnemonic */
+{
+    return strcmp (D->Mnemo, Mnemo) == 0;
+}
+
+
+
+static void TraceFrom (unsigned long Addr)
+/* Trace one path of execution starting at Addr. Branch and call targets are
+** added to the work list. The path ends at an instruction that was traced
+** before, since everything after it was traced, too.
+*/
+{
+    while (1) {
+
+        const OpcDesc*  D;
+        unsigned        I;
+        unsigned long   Next;
+        unsigned char*  State;
+
+        /* Stop if this instruction was traced before, or if the info file
+        ** says this isn't code.
+        */
+        State = AddrMapNeed (&Ctx->TraceState, Addr);
+        if ((*State & TR_TRACED) != 0 || !MayBeCode (Addr)) {
+            return;
+        }
+
+        /* Check the instruction. Be sure it is complete, within one bank,
+        ** and doesn't overlap with data.
+        */
+        D = &Ctx->OpcTable[GetCodeByte (Addr)];
+        if ((D->Flags & flIllegal) != 0) {
+            return;
+        }
+        for (I = 1; I < D->Size; ++I) {
+            if (((Addr + I) & 0xFFFF) == 0 || !IsCodeAddr (Addr + I) ||
+                !MayBeCode (Addr + I)) {
+                return;
+            }
+        }
+
+        /* Mark the instruction as code and as traced */
+        *State |= TR_TRACED;
+        for (I = 0; I < D->Size; ++I) {
+            if (GetStyleAttr (Addr + I) == atDefault) {
+                MarkAddr (Addr + I, atCode);
+            }
+        }
+        Next = Addr + D->Size;
+
+        /* Check for instructions that change the flow of control */
+        if (D->Handler == OH_Relative) {
+            AddTarget (Addr, Next + (signed char) GetCodeByte (Addr+1));
+            if (IsMnemo (D, "bra")) {
+                return;
+            }
+        } else if (D->Handler == OH_RelativeLong4510) {
+            AddTarget (Addr, Addr + 2 + (signed short) GetCodeWord (Addr+1));
+            if (IsMnemo (D, "lbra")) {
+                return;
+            }
+        } else if (D->Handler == OH_BitBranch) {
+            AddTarget (Addr, Addr + 3 + (signed char) GetCodeByte (Addr+2));
+        } else if (D->Handler == OH_AccumulatorBitBranch) {
+            AddTarget (Addr, Addr + 3 + (signed char) GetCodeByte (Addr+1));
+        } else if (D->Handler == OH_JmpAbsolute) {
+            AddTarget (Addr, GetCodeWord (Addr+1));
+            return;
+        } else if (D->Handler == OH_JsrAbsolute) {
+            unsigned long Target = GetBankAddr (Addr, GetCodeWord (Addr+1));
+            AddEntry (Target);
+            /* Skip the parameters of the subroutine */
+            Next += GetSubroutineParamSize (Target);
+        } else if (D->Handler == OH_SpecialPage && IsMnemo (D, "jsr")) {
+            AddTarget (Addr, 0xFF00 + GetCodeByte (Addr+1));
+        } else if (IsMnemo (D, "jsr")) {
+            /* jsr with a target we cannot know, or one given as absolute
+            ** operand by the opcode table of the CPU.
+            */
+            if (D->Handler == OH_Absolute) {
+                AddTarget (Addr, GetCodeWord (Addr+1));
+            }
+        } else if (D->Handler == OH_Rts                 ||
+                   D->Handler == OH_JmpAbsoluteIndirect ||
+                   D->Handler == OH_JmpAbsoluteXIndirect ||
+                   D->Handler == OH_JmpDirectIndirect   ||
+                   IsMnemo (D, "brk")                   ||
+                   IsMnemo (D, "brl")                   ||
+                   IsMnemo (D, "jml")                   ||
+                   IsMnemo (D, "stp")                   ||
+                   IsMnemo (D, "jam")) {
+            /* Execution doesn't continue with the next instruction, and we
+            ** don't know where it does.
+            */
+            return;
+        }
+
+        /* Continue with the next instruction if it is part of the code. The
+        ** PC doesn't cross banks.
+        */
+        if ((Next & 0xFFFF0000UL) != (Addr & 0xFFFF0000UL) ||
+            !IsCodeAddr (Next)) {
+            return;
+        }
+        Addr = Next;
+    }
+}
+
+
+
+static void AddTableEntries (void)
+/* Add the targets of all jump tables declared in the info file */
+{
+    unsigned long Addr = NextAttrAddr (Ctx->CodeStart);
+    while (Addr < Ctx->CodeEnd) {
+        attr_t Style = GetStyleAttr (Addr);
+        if ((Style == atAddrTab || Style == atRtsTab) &&
+            GetStyleAttr (Addr + 1) == Style &&
+            IsCodeAddr (Addr) && IsCodeAddr (Addr + 1)) {
+            unsigned Target = GetCodeWord (Addr);
+            if (Style == atRtsTab) {
+                /* RTS tables contain the target address minus one */
+                ++Target;
+            }
+            AddTarget (Addr, Target);
+            Addr += 2;
+        } else {
+            Addr = NextAttrAddr (Addr + 1);
+        }
+    }
+}
+
+
+
+void TraceCode (void)
+/* Follow the code flow from all entry points, mark all instructions reached
+** as code and all other bytes without a style as data.
+*/
+{
+    unsigned long Addr;
+    unsigned long Bank;
+    unsigned      Entries;
+    unsigned long CodeBytes;
+
+    /* If the code contains the hardware vectors and the info file didn't say
+    ** anything else, they're an address table. Each bank of a banked image
+    ** has its own set.
+    */
+    for (Bank = Ctx->CodeStart & 0xFF0000UL; Bank <= Ctx->CodeEnd; Bank += 0x10000UL) {
+        if (IsCodeAddr (Bank + VECTORS) && IsCodeAddr (Bank + 0xFFFF)) {
+            for (Addr = Bank + VECTORS; Addr <= Bank + 0xFFFF; ++Addr) {
+                if (GetStyleAttr (Addr) != atDefault) {
+                    break;
+                }
+            }
+            if (Addr > Bank + 0xFFFF) {
+                MarkRange (Bank + VECTORS, Bank + 0xFFFF, atAddrTab);
+            }
+        }
+    }
+
+    /* Entry points are the targets of address tables including the vectors,
+    ** and all labels from the info file that may be code.
+    */
+    AddTableEntries ();
+    Addr = NextAttrAddr (Ctx->CodeStart);
+    while (Addr <= Ctx->CodeEnd) {
+        if (GetLabelAttr (Addr) == atExtLabel && MayBeCode (Addr)) {
+            AddEntry (Addr);
+        }
+        Addr = NextAttrAddr (Addr + 1);
+    }
+
+    /* If there are no entry points, start at the load address */
+    if (Ctx->WorkCount == 0) {
+        AddEntry (Ctx->CodeStart);
+    }
+    Entries = Ctx->WorkCount;
+
+    /* Trace until there's nothing left */
+    while (Ctx->WorkCount > 0) {
+        TraceFrom (Ctx->WorkList[--Ctx->WorkCount]);
+    }
+
+    /* Everything not reached is data */
+    CodeBytes = 0;
+    for (Addr = Ctx->CodeStart; Addr <= Ctx->CodeEnd; ++Addr) {
+        if (!IsCodeAddr (Addr)) {
+            /* Skip the gap to the next bank */
+            Addr = (Addr | 0xFFFFUL) + (Ctx->CodeStart & 0xFFFFUL);
+            continue;
+        }
+        switch (GetStyleAttr (Addr)) {
+            case atDefault:
+                MarkAddr (Addr, atByteTab);
+                break;
+            case atCode:
+                ++CodeBytes;
+                break;
+            default:
+                break;
+        }
+    }
+
+    Print (stderr, 1, "Traced %u entry points, %lu code bytes\n",
+           Entries, CodeBytes);
+
+    /* The trace state is no longer needed */
+    AddrMapClear (&Ctx->TraceState, 0);
+}
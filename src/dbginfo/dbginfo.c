@@ -41,9 +41,35 @@
 #include <limits.h>
 #include <assert.h>
 #include <errno.h>
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
 
 #include "dbginfo.h"
 
+/* Large text files are parsed by worker threads if the host has a thread
+** API. Define DBGINFO_THREADS as 0 to build the library without them.
+*/
+#if !defined(DBGINFO_THREADS)
+#  if defined(_WIN32) || (defined(_POSIX_THREADS) && _POSIX_THREADS > 0)
+#    define DBGINFO_THREADS     1
+#  else
+#    define DBGINFO_THREADS     0
+#  endif
+#endif
+#if DBGINFO_THREADS
+#  if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#    include <process.h>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
 
 
 /*****************************************************************************/
@@ -59,6 +85,59 @@
 #define VER_MAJOR       2U
 #define VER_MINOR       0U
 
+/* The binary debug file format written by "ld65 --dbgfile-format binary" is
+** a pre-tokenized version of the text format. It starts with the magic bytes
+** below, followed by a byte with the encoding version. Numbers are unsigned
+** LEB128 varints, identifiers and strings are stored once in a string table
+** that is built while reading and referenced by index afterwards. These
+** values must match the ones in src/ld65/dbgfile.c.
+*/
+static const unsigned char BinMagic[8] = {
+    0x89, 'c', 'c', '6', '5', 'd', 'b', 'g'
+};
+#define BIN_VERSION     1U
+#define BIN_BUFSIZE     0x10000U
+
+/* Text files are split into chunks of lines that are parsed in parallel if
+** each chunk has at least this size. The number of chunks is limited by the
+** number of processors and the constant below.
+*/
+#define PARSE_CHUNK_MIN         0x40000UL
+#define PARSE_MAX_CHUNKS        8U
+
+/* Size of the hash table used to look up keywords. Must be a power of two
+** and larger than the number of keywords.
+*/
+#define KEYWORD_HASH_SIZE       256U
+
+/* Tokens in the binary format */
+#define BT_EOL          0x00U           /* End of record */
+#define BT_EQUAL        0x01U           /* = */
+#define BT_COMMA        0x02U           /* , */
+#define BT_MINUS        0x03U           /* - */
+#define BT_PLUS         0x04U           /* + */
+#define BT_INTCON       0x05U           /* Integer, varint follows */
+#define BT_STRCON       0x06U           /* String constant, varint index */
+#define BT_IDENT        0x07U           /* Identifier, varint index */
+#define BT_DEFSTRCON    0x08U           /* New string constant, length+data */
+#define BT_DEFIDENT     0x09U           /* New identifier, length+data */
+
+/* The index cache is a compiled image of a debug info file that was read
+** without errors. It is written next to the debug info file with the name
+** extension below and contains all items in id order, a string table and
+** the pre-sorted index collections as lists of ids. The header contains the
+** size and a hash of the debug info file, so a stale cache is detected and
+** replaced, and a hash of the cache contents. All numbers are 32 bit little
+** endian.
+*/
+static const unsigned char IdxMagic[8] = {
+    0x89, 'c', 'c', '6', '5', 'i', 'd', 'x'
+};
+#define IDX_VERSION     1U
+#define IDX_HDRSIZE     40U             /* Magic + 8 header words */
+#define IDX_EXT         ".idx"
+#define IDX_HASHINIT    2166136261UL    /* FNV-1a offset basis */
+
 /* Dynamic strings */
 typedef struct StrBuf StrBuf;
 struct StrBuf {
@@ -102,10 +181,25 @@ struct SpanInfoListEntry {
     void*               Data;           /* Either SpanInfo* or SpanInfo** */
 };
 
+/* To find the entry for an address in constant time, the addresses of the
+** 65816 address space are additionally mapped through a page table. Pages
+** are only allocated if there are spans in the address range of the page.
+*/
+#define SPAN_PAGE_SHIFT 8U
+#define SPAN_PAGE_SIZE  (1U << SPAN_PAGE_SHIFT)
+#define SPAN_MAX_ADDR   0xFFFFFFUL
+
+typedef struct SpanInfoPage SpanInfoPage;
+struct SpanInfoPage {
+    SpanInfoListEntry*  Entries[SPAN_PAGE_SIZE];    /* Entry or NULL */
+};
+
 typedef struct SpanInfoList SpanInfoList;
 struct SpanInfoList {
     unsigned            Count;          /* Number of entries */
     SpanInfoListEntry*  List;           /* Dynamic array with entries */
+    unsigned            PageCount;      /* Number of pages in the table */
+    SpanInfoPage**      Pages;          /* Page table, indexed by address */
 };
 
 /* Input tokens */
@@ -206,6 +300,9 @@ struct DbgInfo {
     Collection          SegInfoByName;  /* Segment infos sorted by name */
     Collection          SymInfoByName;  /* Symbol infos sorted by name */
     Collection          SymInfoByVal;   /* Symbol infos sorted by value */
+    Collection          LabelByVal;     /* Labels only, sorted by value */
+    unsigned            LabelPageCount; /* Number of entries in LabelPages */
+    unsigned*           LabelPages;     /* First label index for each page */
 
     /* Other stuff */
     SpanInfoList        SpanInfoByAddr; /* Span infos sorted by unique address */
@@ -233,6 +330,34 @@ struct InputData {
     StrBuf              SVal;           /* String constant */
     cc65_errorfunc      Error;          /* Function called in case of errors */
     DbgInfo*            Info;           /* Pointer to debug info */
+    int                 Binary;         /* True if input is in binary format */
+    unsigned char*      Buf;            /* Input buffer */
+    unsigned            BufPos;         /* Read position in Buf */
+    unsigned            BufLen;         /* Number of bytes in Buf */
+    Collection          BinStrings;     /* String table for binary format */
+    unsigned char       KeywordHash[KEYWORD_HASH_SIZE]; /* Keyword lookup */
+    Collection*         Messages;       /* Parse errors kept for later or NULL */
+};
+
+/* A function that is run as a task, possibly on a worker thread */
+typedef struct Task Task;
+struct Task {
+    void                (*Func) (void* Data);   /* Function to run */
+    void*               Data;           /* Argument for the function */
+#if DBGINFO_THREADS && defined(_WIN32)
+    HANDLE              Thread;         /* Thread running the task */
+#elif DBGINFO_THREADS
+    pthread_t           Thread;         /* Thread running the task */
+#endif
+    int                 Started;        /* True if the thread was started */
+};
+
+/* An entry in the string table of a binary debug file */
+typedef struct BinString BinString;
+struct BinString {
+    Token               Tok;            /* Keyword token if identifier */
+    unsigned            Len;            /* Length of the string */
+    char                Str[1];         /* String, dynamically allocated */
 };
 
 /* Typedefs for the item structures. Do also serve as forwards */
@@ -923,6 +1048,14 @@ static void CollQuickSort (Collection* C, int Lo, int Hi,
     while (Hi > Lo) {
         int I = Lo + 1;
         int J = Hi;
+
+        /* Use the middle element as pivot. Debug info is often sorted
+        ** already, and the first element would make this quadratic.
+        */
+        CollEntry Pivot = Items[(Lo + Hi) / 2];
+        Items[(Lo + Hi) / 2] = Items[Lo];
+        Items[Lo] = Pivot;
+
         while (I <= J) {
             while (I <= J && Compare (Items[Lo].Ptr, Items[I].Ptr) >= 0) {
                 ++I;
@@ -967,6 +1100,99 @@ static void CollSort (Collection* C, int (*Compare) (const void*, const void*))
 
 
 
+/*****************************************************************************/
+/*                              Worker threads                               */
+/*****************************************************************************/
+
+
+
+static unsigned ProcessorCount (void)
+/* Return the number of processors that may run worker threads */
+{
+#if DBGINFO_THREADS && defined(_WIN32)
+    SYSTEM_INFO SI;
+    GetSystemInfo (&SI);
+    return SI.dwNumberOfProcessors > 0? (unsigned) SI.dwNumberOfProcessors : 1;
+#elif DBGINFO_THREADS && defined(_SC_NPROCESSORS_ONLN)
+    long Count = sysconf (_SC_NPROCESSORS_ONLN);
+    return Count > 0? (unsigned) Count : 1;
+#else
+    return 1;
+#endif
+}
+
+
+
+#if DBGINFO_THREADS && defined(_WIN32)
+static unsigned __stdcall TaskThread (void* Arg)
+/* Thread function that runs a task */
+{
+    Task* T = Arg;
+    T->Func (T->Data);
+    return 0;
+}
+#elif DBGINFO_THREADS
+static void* TaskThread (void* Arg)
+/* Thread function that runs a task */
+{
+    Task* T = Arg;
+    T->Func (T->Data);
+    return 0;
+}
+#endif
+
+
+
+static void RunTasks (Task* Tasks, unsigned Count)
+/* Run the given tasks and return when all of them are done. If there is
+** more than one processor, all tasks but the first one run on worker
+** threads. A task that cannot get a thread is run by the caller.
+*/
+{
+    unsigned I;
+    int      Parallel = (Count > 1 && ProcessorCount () > 1);
+
+    /* Start the threads */
+    for (I = 0; I < Count; ++I) {
+        Tasks[I].Started = 0;
+#if DBGINFO_THREADS && defined(_WIN32)
+        if (Parallel && I > 0) {
+            Tasks[I].Thread = (HANDLE) _beginthreadex (0, 0, TaskThread,
+                                                       &Tasks[I], 0, 0);
+            Tasks[I].Started = (Tasks[I].Thread != 0);
+        }
+#elif DBGINFO_THREADS
+        if (Parallel && I > 0) {
+            Tasks[I].Started = (pthread_create (&Tasks[I].Thread, 0,
+                                                TaskThread, &Tasks[I]) == 0);
+        }
+#else
+        (void) Parallel;
+#endif
+    }
+
+    /* Run the remaining tasks here */
+    for (I = 0; I < Count; ++I) {
+        if (!Tasks[I].Started) {
+            Tasks[I].Func (Tasks[I].Data);
+        }
+    }
+
+    /* Wait for the threads */
+    for (I = 0; I < Count; ++I) {
+        if (Tasks[I].Started) {
+#if DBGINFO_THREADS && defined(_WIN32)
+            WaitForSingleObject (Tasks[I].Thread, INFINITE);
+            CloseHandle (Tasks[I].Thread);
+#elif DBGINFO_THREADS
+            pthread_join (Tasks[I].Thread, 0);
+#endif
+        }
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                              Debugging stuff                              */
 /*****************************************************************************/
@@ -1121,11 +1347,16 @@ static void ParseError (InputData* D, cc65_error_severity Type, const char* Msg,
     vsnprintf (E->errormsg, MsgSize+1, Msg, ap);
     va_end (ap);
 
-    /* Call the caller:-) */
-    D->Error (E);
-
-    /* Free the data structure */
-    xfree (E);
+    /* A worker keeps the message, so the messages of all chunks can be
+    ** passed to the caller in the order of the file. Otherwise call the
+    ** caller:-)
+    */
+    if (D->Messages) {
+        CollAppend (D->Messages, E);
+    } else {
+        D->Error (E);
+        xfree (E);
+    }
 
     /* Count errors */
     if (Type == CC65_ERROR) {
@@ -2185,8 +2416,55 @@ static TypeInfo* ParseTypeString (InputData* D, StrBuf* Type)
 static void InitSpanInfoList (SpanInfoList* L)
 /* Initialize a span info list */
 {
-    L->Count = 0;
-    L->List  = 0;
+    L->Count     = 0;
+    L->List      = 0;
+    L->PageCount = 0;
+    L->Pages     = 0;
+}
+
+
+
+static void CreateSpanInfoPages (SpanInfoList* L)
+/* Create the page table for a span info list */
+{
+    unsigned I;
+    cc65_addr MaxAddr;
+
+    /* Determine the size of the page table. Addresses above the 65816
+    ** address space are not covered.
+    */
+    MaxAddr = L->List[L->Count - 1].Addr;
+    if (MaxAddr > SPAN_MAX_ADDR) {
+        MaxAddr = SPAN_MAX_ADDR;
+    }
+    L->PageCount = (unsigned) (MaxAddr >> SPAN_PAGE_SHIFT) + 1;
+    L->Pages = xmalloc (L->PageCount * sizeof (L->Pages[0]));
+    for (I = 0; I < L->PageCount; ++I) {
+        L->Pages[I] = 0;
+    }
+
+    /* Enter all entries */
+    for (I = 0; I < L->Count; ++I) {
+
+        SpanInfoListEntry* E = &L->List[I];
+        SpanInfoPage* P;
+
+        /* Ignore addresses not covered by the table */
+        unsigned long Page = E->Addr >> SPAN_PAGE_SHIFT;
+        if (Page >= L->PageCount) {
+            break;
+        }
+
+        /* Allocate the page if needed */
+        P = L->Pages[Page];
+        if (P == 0) {
+            P = L->Pages[Page] = xmalloc (sizeof (*P));
+            memset (P->Entries, 0, sizeof (P->Entries));
+        }
+
+        /* Remember the entry */
+        P->Entries[E->Addr & (SPAN_PAGE_SIZE - 1)] = E;
+    }
 }
 
 
@@ -2205,8 +2483,7 @@ static void CreateSpanInfoList (SpanInfoList* L, Collection* SpanInfos)
     cc65_addr End;
 
     /* Initialize and check if there's something to do */
-    L->Count = 0;
-    L->List  = 0;
+    InitSpanInfoList (L);
     if (CollCount (SpanInfos) == 0) {
         /* No entries */
         return;
@@ -2339,6 +2616,9 @@ static void CreateSpanInfoList (SpanInfoList* L, Collection* SpanInfos)
             }
         }
     }
+
+    /* Step 6: Create the page table */
+    CreateSpanInfoPages (L);
 }
 
 
@@ -2363,6 +2643,12 @@ static void DoneSpanInfoList (SpanInfoList* L)
 
     /* Delete the list */
     xfree (L->List);
+
+    /* Delete the page table */
+    for (I = 0; I < L->PageCount; ++I) {
+        xfree (L->Pages[I]);
+    }
+    xfree (L->Pages);
 }
 
 
@@ -2401,6 +2687,9 @@ static DbgInfo* NewDbgInfo (const char* FileName)
     CollInit (&Info->SegInfoByName);
     CollInit (&Info->SymInfoByName);
     CollInit (&Info->SymInfoByVal);
+    CollInit (&Info->LabelByVal);
+    Info->LabelPageCount = 0;
+    Info->LabelPages     = 0;
 
     InitSpanInfoList (&Info->SpanInfoByAddr);
 
@@ -2472,6 +2761,8 @@ static void FreeDbgInfo (DbgInfo* Info)
     CollDone (&Info->SegInfoByName);
     CollDone (&Info->SymInfoByName);
     CollDone (&Info->SymInfoByVal);
+    CollDone (&Info->LabelByVal);
+    xfree (Info->LabelPages);
 
     /* Free span info */
     DoneSpanInfoList (&Info->SpanInfoByAddr);
@@ -2482,6 +2773,74 @@ static void FreeDbgInfo (DbgInfo* Info)
 
 
 
+static void MergeById (Collection* Target, Collection* Source)
+/* Move the items from a collection indexed by id into another one. Items
+** with the same id replace the ones already there.
+*/
+{
+    unsigned I;
+    if (CollCount (Target) == 0) {
+        CollMove (Source, Target);
+        return;
+    }
+    for (I = 0; I < CollCount (Source); ++I) {
+        void* Item = CollAt (Source, I);
+        if (Item) {
+            CollReplaceExpand (Target, Item, I);
+        }
+    }
+    CollDone (Source);
+}
+
+
+
+static void MergeAppend (Collection* Target, Collection* Source)
+/* Move the items from a collection to the end of another one */
+{
+    unsigned I;
+    if (CollCount (Target) == 0) {
+        CollMove (Source, Target);
+        return;
+    }
+    CollGrow (Target, CollCount (Target) + CollCount (Source));
+    for (I = 0; I < CollCount (Source); ++I) {
+        CollAppend (Target, CollAt (Source, I));
+    }
+    CollDone (Source);
+}
+
+
+
+static void MergeDbgInfo (DbgInfo* Target, DbgInfo* Source)
+/* Move the items parsed from a chunk of the input file into the debug info
+** for the whole file, then free the debug info of the chunk. The result is
+** the same as if the chunk was parsed after the items already in Target.
+*/
+{
+    MergeById (&Target->CSymInfoById,  &Source->CSymInfoById);
+    MergeById (&Target->FileInfoById,  &Source->FileInfoById);
+    MergeById (&Target->LibInfoById,   &Source->LibInfoById);
+    MergeById (&Target->LineInfoById,  &Source->LineInfoById);
+    MergeById (&Target->ModInfoById,   &Source->ModInfoById);
+    MergeById (&Target->ScopeInfoById, &Source->ScopeInfoById);
+    MergeById (&Target->SegInfoById,   &Source->SegInfoById);
+    MergeById (&Target->SpanInfoById,  &Source->SpanInfoById);
+    MergeById (&Target->SymInfoById,   &Source->SymInfoById);
+    MergeById (&Target->TypeInfoById,  &Source->TypeInfoById);
+
+    MergeAppend (&Target->FileInfoByName,  &Source->FileInfoByName);
+    MergeAppend (&Target->ModInfoByName,   &Source->ModInfoByName);
+    MergeAppend (&Target->ScopeInfoByName, &Source->ScopeInfoByName);
+    MergeAppend (&Target->SegInfoByName,   &Source->SegInfoByName);
+    MergeAppend (&Target->SymInfoByName,   &Source->SymInfoByName);
+    MergeAppend (&Target->SymInfoByVal,    &Source->SymInfoByVal);
+
+    /* The collections of Source are empty now */
+    FreeDbgInfo (Source);
+}
+
+
+
 /*****************************************************************************/
 /*                            Scanner and parser                             */
 /*****************************************************************************/
@@ -2491,10 +2850,12 @@ static void FreeDbgInfo (DbgInfo* Info)
 static int DigitVal (int C)
 /* Return the value for a numeric digit. Return -1 if C is invalid */
 {
-    if (isdigit (C)) {
+    if (C >= '0' && C <= '9') {
         return C - '0';
-    } else if (isxdigit (C)) {
-        return toupper (C) - 'A' + 10;
+    } else if (C >= 'A' && C <= 'F') {
+        return C - 'A' + 10;
+    } else if (C >= 'a' && C <= 'f') {
+        return C - 'a' + 10;
     } else {
         return -1;
     }
@@ -2502,6 +2863,44 @@ static int DigitVal (int C)
 
 
 
+static int IsIdentStart (int C)
+/* Return true if C may start an identifier. We don't use isalpha here,
+** since the debug info format is plain ASCII and the library functions are
+** locale dependent and comparably slow.
+*/
+{
+    return C == '_' || (C >= 'a' && C <= 'z') || (C >= 'A' && C <= 'Z');
+}
+
+
+
+static int IsIdentChar (int C)
+/* Return true if C may be part of an identifier */
+{
+    return IsIdentStart (C) || (C >= '0' && C <= '9');
+}
+
+
+
+static int ReadByte (InputData* D)
+/* Read the next byte from the input file. Return EOF at end of file */
+{
+    if (D->BufPos >= D->BufLen) {
+        /* Chunks of a file in memory have no file */
+        if (D->F == 0) {
+            return EOF;
+        }
+        D->BufLen = fread (D->Buf, 1, BIN_BUFSIZE, D->F);
+        D->BufPos = 0;
+        if (D->BufLen == 0) {
+            return EOF;
+        }
+    }
+    return D->Buf[D->BufPos++];
+}
+
+
+
 static void NextChar (InputData* D)
 /* Read the next character from the input. Count lines and columns */
 {
@@ -2511,151 +2910,356 @@ static void NextChar (InputData* D)
             ++D->Line;
             D->Col = 0;
         }
-        D->C = fgetc (D->F);
+        /* Take the character from the input buffer if possible. This avoids
+        ** the overhead of a library call per character.
+        */
+        if (D->BufPos < D->BufLen) {
+            D->C = D->Buf[D->BufPos++];
+        } else {
+            D->C = ReadByte (D);
+        }
         ++D->Col;
     }
 }
 
 
 
-static void NextToken (InputData* D)
-/* Read the next token from the input stream */
-{
-    static const struct KeywordEntry  {
-        const char      Keyword[12];
-        Token           Tok;
-    } KeywordTable[] = {
-        { "abs",        TOK_ABSOLUTE    },
-        { "addrsize",   TOK_ADDRSIZE    },
-        { "auto",       TOK_AUTO        },
-        { "count",      TOK_COUNT       },
-        { "csym",       TOK_CSYM        },
-        { "def",        TOK_DEF         },
-        { "enum",       TOK_ENUM        },
-        { "equ",        TOK_EQUATE      },
-        { "exp",        TOK_EXPORT      },
-        { "ext",        TOK_EXTERN      },
-        { "file",       TOK_FILE        },
-        { "func",       TOK_FUNC        },
-        { "global",     TOK_GLOBAL      },
-        { "id",         TOK_ID          },
-        { "imp",        TOK_IMPORT      },
-        { "info",       TOK_INFO        },
-        { "lab",        TOK_LABEL       },
-        { "lib",        TOK_LIBRARY     },
-        { "line",       TOK_LINE        },
-        { "long",       TOK_LONG        },
-        { "major",      TOK_MAJOR       },
-        { "minor",      TOK_MINOR       },
-        { "mod",        TOK_MODULE      },
-        { "mtime",      TOK_MTIME       },
-        { "name",       TOK_NAME        },
-        { "offs",       TOK_OFFS        },
-        { "oname",      TOK_OUTPUTNAME  },
-        { "ooffs",      TOK_OUTPUTOFFS  },
-        { "parent",     TOK_PARENT      },
-        { "ref",        TOK_REF         },
-        { "reg",        TOK_REGISTER    },
-        { "ro",         TOK_RO          },
-        { "rw",         TOK_RW          },
-        { "sc",         TOK_SC          },
-        { "scope",      TOK_SCOPE       },
-        { "seg",        TOK_SEGMENT     },
-        { "size",       TOK_SIZE        },
-        { "span",       TOK_SPAN        },
-        { "start",      TOK_START       },
-        { "static",     TOK_STATIC      },
-        { "struct",     TOK_STRUCT      },
-        { "sym",        TOK_SYM         },
-        { "type",       TOK_TYPE        },
-        { "val",        TOK_VALUE       },
-        { "var",        TOK_VAR         },
-        { "version",    TOK_VERSION     },
-        { "zp",         TOK_ZEROPAGE    },
-    };
+/* Keywords of the text format */
+static const struct KeywordEntry {
+    const char      Keyword[12];
+    Token           Tok;
+} KeywordTable[] = {
+    { "abs",        TOK_ABSOLUTE    },
+    { "addrsize",   TOK_ADDRSIZE    },
+    { "auto",       TOK_AUTO        },
+    { "count",      TOK_COUNT       },
+    { "csym",       TOK_CSYM        },
+    { "def",        TOK_DEF         },
+    { "enum",       TOK_ENUM        },
+    { "equ",        TOK_EQUATE      },
+    { "exp",        TOK_EXPORT      },
+    { "ext",        TOK_EXTERN      },
+    { "file",       TOK_FILE        },
+    { "func",       TOK_FUNC        },
+    { "global",     TOK_GLOBAL      },
+    { "id",         TOK_ID          },
+    { "imp",        TOK_IMPORT      },
+    { "info",       TOK_INFO        },
+    { "lab",        TOK_LABEL       },
+    { "lib",        TOK_LIBRARY     },
+    { "line",       TOK_LINE        },
+    { "long",       TOK_LONG        },
+    { "major",      TOK_MAJOR       },
+    { "minor",      TOK_MINOR       },
+    { "mod",        TOK_MODULE      },
+    { "mtime",      TOK_MTIME       },
+    { "name",       TOK_NAME        },
+    { "offs",       TOK_OFFS        },
+    { "oname",      TOK_OUTPUTNAME  },
+    { "ooffs",      TOK_OUTPUTOFFS  },
+    { "parent",     TOK_PARENT      },
+    { "ref",        TOK_REF         },
+    { "reg",        TOK_REGISTER    },
+    { "ro",         TOK_RO          },
+    { "rw",         TOK_RW          },
+    { "sc",         TOK_SC          },
+    { "scope",      TOK_SCOPE       },
+    { "seg",        TOK_SEGMENT     },
+    { "size",       TOK_SIZE        },
+    { "span",       TOK_SPAN        },
+    { "start",      TOK_START       },
+    { "static",     TOK_STATIC      },
+    { "struct",     TOK_STRUCT      },
+    { "sym",        TOK_SYM         },
+    { "type",       TOK_TYPE        },
+    { "val",        TOK_VALUE       },
+    { "var",        TOK_VAR         },
+    { "version",    TOK_VERSION     },
+    { "zp",         TOK_ZEROPAGE    },
+};
 
 
-    /* Skip whitespace */
-    while (D->C == ' ' || D->C == '\t' || D->C == '\r') {
-        NextChar (D);
-    }
 
-    /* Remember the current position as start of the next token */
-    D->SLine = D->Line;
-    D->SCol  = D->Col;
+static unsigned HashKeyword (const char* Ident)
+/* Return the slot in the keyword hash table for the given identifier */
+{
+    unsigned Hash = 0;
+    while (*Ident) {
+        Hash = Hash * 33 + (unsigned char) *Ident++;
+    }
+    return Hash & (KEYWORD_HASH_SIZE - 1);
+}
 
-    /* Identifier? */
-    if (D->C == '_' || isalpha (D->C)) {
 
-        const struct KeywordEntry* Entry;
 
-        /* Read the identifier */
-        SB_Clear (&D->SVal);
-        while (D->C == '_' || isalnum (D->C)) {
-            SB_AppendChar (&D->SVal, D->C);
-            NextChar (D);
+static void InitKeywordHash (InputData* D)
+/* Initialize the hash table used to look up keywords. Collisions are resolved
+** by using the next free slot.
+*/
+{
+    unsigned I;
+    for (I = 0; I < sizeof (KeywordTable) / sizeof (KeywordTable[0]); ++I) {
+        unsigned Hash = HashKeyword (KeywordTable[I].Keyword);
+        while (D->KeywordHash[Hash] != 0) {
+            Hash = (Hash + 1) & (KEYWORD_HASH_SIZE - 1);
         }
-        SB_Terminate (&D->SVal);
+        D->KeywordHash[Hash] = (unsigned char) (I + 1);
+    }
+}
 
-        /* Search the identifier in the keyword table */
-        Entry = bsearch (SB_GetConstBuf (&D->SVal),
-                         KeywordTable,
-                         sizeof (KeywordTable) / sizeof (KeywordTable[0]),
-                         sizeof (KeywordTable[0]),
-                         (int (*)(const void*, const void*)) strcmp);
-        if (Entry == 0) {
-            D->Tok = TOK_IDENT;
-        } else {
-            D->Tok = Entry->Tok;
+
+
+static Token FindKeyword (const InputData* D, const char* Ident)
+/* Return the keyword token for the given identifier or TOK_IDENT if the
+** identifier is not a keyword.
+*/
+{
+    unsigned Hash = HashKeyword (Ident);
+    unsigned Index;
+
+    /* Search the identifier in the hash table */
+    while ((Index = D->KeywordHash[Hash]) != 0) {
+        if (strcmp (KeywordTable[Index-1].Keyword, Ident) == 0) {
+            return KeywordTable[Index-1].Tok;
         }
-        return;
+        Hash = (Hash + 1) & (KEYWORD_HASH_SIZE - 1);
     }
+    return TOK_IDENT;
+}
 
-    /* Number? */
-    if (isdigit (D->C)) {
-        int Base = 10;
-        int Val;
-        if (D->C == '0') {
-            NextChar (D);
-            if (toupper (D->C) == 'X') {
-                NextChar (D);
-                Base = 16;
-            } else {
-                Base = 8;
-            }
-        } else {
-            Base = 10;
+
+
+static int BinGetVarInt (InputData* D, unsigned long* Val)
+/* Read an unsigned LEB128 varint from a binary input file. Return false if
+** the end of file was reached before the number was complete.
+*/
+{
+    unsigned Shift = 0;
+    int C;
+
+    *Val = 0;
+    do {
+        C = ReadByte (D);
+        if (C == EOF) {
+            return 0;
         }
-        D->IVal = 0;
-        while ((Val = DigitVal (D->C)) >= 0 && Val < Base) {
-            D->IVal = D->IVal * Base + Val;
-            NextChar (D);
+        if (Shift < sizeof (*Val) * CHAR_BIT) {
+            *Val |= ((unsigned long) (C & 0x7F)) << Shift;
         }
-        D->Tok = TOK_INTCON;
-        return;
+        Shift += 7;
+    } while (C & 0x80);
+    return 1;
+}
+
+
+
+static const BinString* BinDefString (InputData* D)
+/* Read the definition of a new string table entry from a binary input file
+** and add it to the table. Return NULL in case of errors.
+*/
+{
+    unsigned long Len;
+    unsigned long I;
+    BinString* S;
+
+    if (!BinGetVarInt (D, &Len) || Len > BIN_BUFSIZE) {
+        ParseError (D, CC65_ERROR, "Invalid string in binary debug file");
+        return 0;
+    }
+    S = xmalloc (sizeof (BinString) + Len);
+    for (I = 0; I < Len; ++I) {
+        int C = ReadByte (D);
+        if (C == EOF) {
+            ParseError (D, CC65_ERROR, "Unexpected end of binary debug file");
+            xfree (S);
+            return 0;
+        }
+        S->Str[I] = (char) C;
+    }
+    S->Str[Len] = '\0';
+    S->Len = (unsigned) Len;
+    S->Tok = FindKeyword (D, S->Str);
+    CollAppend (&D->BinStrings, S);
+    return S;
+}
+
+
+
+static const BinString* BinRefString (InputData* D)
+/* Read a reference to an existing string table entry from a binary input
+** file. Return NULL in case of errors.
+*/
+{
+    unsigned long Index;
+    if (!BinGetVarInt (D, &Index) || Index >= CollCount (&D->BinStrings)) {
+        ParseError (D, CC65_ERROR, "Invalid string index in binary debug file");
+        return 0;
     }
+    return CollAt (&D->BinStrings, (unsigned) Index);
+}
 
-    /* Other characters */
-    switch (D->C) {
 
-        case '-':
-            NextChar (D);
-            D->Tok = TOK_MINUS;
+
+static void NextBinToken (InputData* D)
+/* Read the next token from a binary input file */
+{
+    const BinString* S;
+    int C;
+
+    /* Lines are records, columns are tokens within a record */
+    D->SLine = D->Line;
+    D->SCol  = ++D->Col;
+
+    C = ReadByte (D);
+    switch (C) {
+
+        case BT_EOL:
+            ++D->Line;
+            D->Col = 0;
+            D->Tok = TOK_EOL;
             break;
 
-        case '+':
-            NextChar (D);
-            D->Tok = TOK_PLUS;
+        case BT_EQUAL:
+            D->Tok = TOK_EQUAL;
             break;
 
-        case ',':
-            NextChar (D);
+        case BT_COMMA:
             D->Tok = TOK_COMMA;
             break;
 
-        case '=':
-            NextChar (D);
-            D->Tok = TOK_EQUAL;
+        case BT_MINUS:
+            D->Tok = TOK_MINUS;
+            break;
+
+        case BT_PLUS:
+            D->Tok = TOK_PLUS;
+            break;
+
+        case BT_INTCON:
+            if (BinGetVarInt (D, &D->IVal)) {
+                D->Tok = TOK_INTCON;
+            } else {
+                ParseError (D, CC65_ERROR, "Unexpected end of binary debug file");
+                D->Tok = TOK_EOF;
+            }
+            break;
+
+        case BT_STRCON:
+        case BT_DEFSTRCON:
+        case BT_IDENT:
+        case BT_DEFIDENT:
+            if (C == BT_STRCON || C == BT_IDENT) {
+                S = BinRefString (D);
+            } else {
+                S = BinDefString (D);
+            }
+            if (S == 0) {
+                /* Error recovery is not possible in a binary file */
+                D->Tok = TOK_EOF;
+                break;
+            }
+            SB_CopyBuf (&D->SVal, S->Str, S->Len);
+            SB_Terminate (&D->SVal);
+            if (C == BT_STRCON || C == BT_DEFSTRCON) {
+                D->Tok = TOK_STRCON;
+            } else {
+                D->Tok = S->Tok;
+            }
+            break;
+
+        case EOF:
+            D->Tok = TOK_EOF;
+            break;
+
+        default:
+            ParseError (D, CC65_ERROR, "Invalid token 0x%02X in binary debug file", C);
+            D->Tok = TOK_EOF;
+            break;
+
+    }
+}
+
+
+
+static void NextToken (InputData* D)
+/* Read the next token from the input stream */
+{
+    /* Binary files have their own scanner */
+    if (D->Binary) {
+        NextBinToken (D);
+        return;
+    }
+
+    /* Skip whitespace */
+    while (D->C == ' ' || D->C == '\t' || D->C == '\r') {
+        NextChar (D);
+    }
+
+    /* Remember the current position as start of the next token */
+    D->SLine = D->Line;
+    D->SCol  = D->Col;
+
+    /* Identifier? */
+    if (IsIdentStart (D->C)) {
+
+        /* Read the identifier */
+        SB_Clear (&D->SVal);
+        while (IsIdentChar (D->C)) {
+            SB_AppendChar (&D->SVal, D->C);
+            NextChar (D);
+        }
+        SB_Terminate (&D->SVal);
+
+        /* Check for keywords */
+        D->Tok = FindKeyword (D, SB_GetConstBuf (&D->SVal));
+        return;
+    }
+
+    /* Number? */
+    if (D->C >= '0' && D->C <= '9') {
+        int Base = 10;
+        int Val;
+        if (D->C == '0') {
+            NextChar (D);
+            if (toupper (D->C) == 'X') {
+                NextChar (D);
+                Base = 16;
+            } else {
+                Base = 8;
+            }
+        } else {
+            Base = 10;
+        }
+        D->IVal = 0;
+        while ((Val = DigitVal (D->C)) >= 0 && Val < Base) {
+            D->IVal = D->IVal * Base + Val;
+            NextChar (D);
+        }
+        D->Tok = TOK_INTCON;
+        return;
+    }
+
+    /* Other characters */
+    switch (D->C) {
+
+        case '-':
+            NextChar (D);
+            D->Tok = TOK_MINUS;
+            break;
+
+        case '+':
+            NextChar (D);
+            D->Tok = TOK_PLUS;
+            break;
+
+        case ',':
+            NextChar (D);
+            D->Tok = TOK_COMMA;
+            break;
+
+        case '=':
+            NextChar (D);
+            D->Tok = TOK_EQUAL;
             break;
 
         case '\"':
@@ -4609,6 +5213,224 @@ ErrorExit:
 
 
 
+static void ParseLines (InputData* D)
+/* Parse the lines of the debug info file up to the end of the input */
+{
+    while (D->Tok != TOK_EOF) {
+
+        switch (D->Tok) {
+
+            case TOK_CSYM:
+                ParseCSym (D);
+                break;
+
+            case TOK_FILE:
+                ParseFile (D);
+                break;
+
+            case TOK_INFO:
+                ParseInfo (D);
+                break;
+
+            case TOK_LIBRARY:
+                ParseLibrary (D);
+                break;
+
+            case TOK_LINE:
+                ParseLine (D);
+                break;
+
+            case TOK_MODULE:
+                ParseModule (D);
+                break;
+
+            case TOK_SCOPE:
+                ParseScope (D);
+                break;
+
+            case TOK_SEGMENT:
+                ParseSegment (D);
+                break;
+
+            case TOK_SPAN:
+                ParseSpan (D);
+                break;
+
+            case TOK_SYM:
+                ParseSym (D);
+                break;
+
+            case TOK_TYPE:
+                ParseType (D);
+                break;
+
+            case TOK_IDENT:
+                /* Output a warning, then skip the line with the unknown
+                ** keyword that may have been added by a later version.
+                */
+                ParseError (D, CC65_WARNING,
+                            "Unknown keyword \"%s\" - skipping",
+                            SB_GetConstBuf (&D->SVal));
+
+                SkipLine (D);
+                break;
+
+            default:
+                UnexpectedToken (D);
+
+        }
+
+        /* EOL or EOF must follow */
+        ConsumeEOL (D);
+    }
+}
+
+
+
+static void ParseChunk (void* Data)
+/* Parse a chunk of the input file. Runs on a worker thread. */
+{
+    InputData* D = Data;
+
+    /* Prime the pump, then parse the lines */
+    NextToken (D);
+    ParseLines (D);
+}
+
+
+
+static void ParseChunks (InputData* D, unsigned long Size, unsigned Count)
+/* The input file of Size bytes is in the buffer of D, and the first line
+** has been parsed. Split the remaining lines into Count chunks, and parse
+** them in parallel into separate debug infos. Then merge these into the
+** debug info of D, and pass the errors of all chunks to the caller in the
+** order of the file.
+*/
+{
+    static const StrBuf EmptyStrBuf = STRBUF_INITIALIZER;
+
+    InputData*    Chunks = xmalloc (Count * sizeof (InputData));
+    Collection*   Messages = xmalloc (Count * sizeof (Collection));
+    Task*         Tasks = xmalloc (Count * sizeof (Task));
+    unsigned long Start;
+    cc65_line     Line = D->Line;
+    const char*   P;
+    unsigned      I, J;
+
+    /* The scanner of D has consumed the first line, and tried to read more
+    ** at its end, so the length of the line must be determined again.
+    */
+    P     = memchr (D->Buf, '\n', Size);
+    Start = (unsigned long) (P - (const char*) D->Buf) + 1;
+
+    for (I = 0; I < Count; ++I) {
+
+        InputData*    C = &Chunks[I];
+        unsigned long End = Size;
+
+        /* Each chunk ends after the first line end at or after an even share
+        ** of the remaining input.
+        */
+        if (I < Count - 1) {
+            End = Start + (Size - Start) / (Count - I);
+            if (End > Start) {
+                P = memchr (D->Buf + End - 1, '\n', Size - End + 1);
+                End = P? (unsigned long) (P - (const char*) D->Buf) + 1 : Size;
+            }
+        }
+
+        /* The chunk has its own scanner and debug info. It starts at the
+        ** beginning of a line, so only the line number must be known.
+        */
+        *C = *D;
+        C->Line     = Line;
+        C->Col      = 0;
+        C->SLine    = Line;
+        C->SCol     = 0;
+        C->Errors   = 0;
+        C->F        = 0;
+        C->C        = ' ';
+        C->Tok      = TOK_INVALID;
+        C->SVal     = EmptyStrBuf;
+        C->Info     = NewDbgInfo (D->FileName);
+        C->Buf      = D->Buf + Start;
+        C->BufPos   = 0;
+        C->BufLen   = End - Start;
+        C->Messages = CollInit (&Messages[I]);
+        CollInit (&C->BinStrings);
+
+        Tasks[I].Func = ParseChunk;
+        Tasks[I].Data = C;
+
+        /* Count the lines for the next chunk */
+        P = (const char*) C->Buf;
+        while ((P = memchr (P, '\n', (const char*) D->Buf + End - P)) != 0) {
+            ++P;
+            ++Line;
+        }
+        Start = End;
+    }
+
+    /* Parse all chunks */
+    RunTasks (Tasks, Count);
+
+    /* Merge the results in the order of the file */
+    for (I = 0; I < Count; ++I) {
+        InputData* C = &Chunks[I];
+        for (J = 0; J < CollCount (&Messages[I]); ++J) {
+            cc65_parseerror* E = CollAt (&Messages[I], J);
+            D->Error (E);
+            xfree (E);
+        }
+        CollDone (&Messages[I]);
+        D->Errors += C->Errors;
+        MergeDbgInfo (D->Info, C->Info);
+        SB_Done (&C->SVal);
+    }
+
+    xfree (Tasks);
+    xfree (Messages);
+    xfree (Chunks);
+}
+
+
+
+static unsigned ChunkCount (FILE* F, unsigned long* Size)
+/* Return the number of chunks for a parallel parse of the text file F, and
+** its size. F is at the start of the file.
+*/
+{
+    long     Len;
+    unsigned Count = 1;
+
+#if DBGINFO_THREADS
+    if (fseek (F, 0, SEEK_END) == 0 && (Len = ftell (F)) > 0 &&
+        fseek (F, 0, SEEK_SET) == 0) {
+        *Size = (unsigned long) Len;
+        Count = ProcessorCount ();
+        if (Count > PARSE_MAX_CHUNKS) {
+            Count = PARSE_MAX_CHUNKS;
+        }
+        if (Count > *Size / PARSE_CHUNK_MIN) {
+            Count = (unsigned) (*Size / PARSE_CHUNK_MIN);
+        }
+        if (Count < 1) {
+            Count = 1;
+        }
+    } else {
+        rewind (F);
+    }
+#else
+    (void) F;
+    (void) Size;
+    (void) Len;
+#endif
+
+    return Count;
+}
+
+
+
 /*****************************************************************************/
 /*                              Data processing                              */
 /*****************************************************************************/
@@ -4708,9 +5530,18 @@ static SpanInfoListEntry* FindSpanInfoByAddr (const SpanInfoList* L, cc65_addr A
 ** SpanInfo was found.
 */
 {
+    int Lo;
+    int Hi;
+
+    /* Use the page table if it covers the address */
+    if ((Addr >> SPAN_PAGE_SHIFT) < L->PageCount) {
+        const SpanInfoPage* P = L->Pages[Addr >> SPAN_PAGE_SHIFT];
+        return P? P->Entries[Addr & (SPAN_PAGE_SIZE - 1)] : 0;
+    }
+
     /* Do a binary search */
-    int Lo = 0;
-    int Hi = (int) L->Count - 1;
+    Lo = 0;
+    Hi = (int) L->Count - 1;
     while (Lo <= Hi) {
 
         /* Mid of range */
@@ -4934,6 +5765,91 @@ static int FindSymInfoByValue (const Collection* SymInfos, long Value,
 
 
 
+static void CreateLabelList (DbgInfo* Info)
+/* Create the list of labels sorted by value from the list of all symbols
+** sorted by value. This is used for address range lookups. To find the
+** first label for an address in constant time, the same page size as for
+** spans is used to remember the index of the first label in each page of
+** the 65816 address space.
+*/
+{
+    unsigned I, J;
+    long     MaxValue;
+
+    /* Create the list */
+    for (I = 0; I < CollCount (&Info->SymInfoByVal); ++I) {
+        SymInfo* S = CollAt (&Info->SymInfoByVal, I);
+        if (S->Type == CC65_SYM_LABEL) {
+            CollAppend (&Info->LabelByVal, S);
+        }
+    }
+    if (CollCount (&Info->LabelByVal) == 0) {
+        return;
+    }
+
+    /* Determine the number of pages */
+    MaxValue = ((const SymInfo*) CollAt (&Info->LabelByVal,
+                                         CollCount (&Info->LabelByVal) - 1))->Value;
+    if (MaxValue < 0) {
+        return;
+    } else if (MaxValue > (long) SPAN_MAX_ADDR) {
+        MaxValue = (long) SPAN_MAX_ADDR;
+    }
+    Info->LabelPageCount = (unsigned) (MaxValue >> SPAN_PAGE_SHIFT) + 1;
+    Info->LabelPages = xmalloc (Info->LabelPageCount * sizeof (Info->LabelPages[0]));
+
+    /* Fill in the index of the first label with an address in or above
+    ** each page.
+    */
+    J = 0;
+    for (I = 0; I < Info->LabelPageCount; ++I) {
+        long PageStart = (long) I << SPAN_PAGE_SHIFT;
+        while (((const SymInfo*) CollAt (&Info->LabelByVal, J))->Value < PageStart) {
+            ++J;
+        }
+        Info->LabelPages[I] = J;
+    }
+}
+
+
+
+static unsigned FindLabelRange (const DbgInfo* Info, cc65_addr Start,
+                                cc65_addr End, unsigned* Index)
+/* Search for the labels within Start and End (inclusive). The index of the
+** first one in LabelByVal is stored in Index, the index following the last
+** one is returned.
+*/
+{
+    unsigned Last;
+
+    /* Search for the first label. Use the page table if it covers the start
+    ** address, otherwise do a binary search. Because we're searching for a
+    ** range, we cannot make use of the function result.
+    */
+    if ((Start >> SPAN_PAGE_SHIFT) < Info->LabelPageCount) {
+        *Index = Info->LabelPages[Start >> SPAN_PAGE_SHIFT];
+        while (*Index < CollCount (&Info->LabelByVal) &&
+               ((const SymInfo*) CollAt (&Info->LabelByVal, *Index))->Value < (long) Start) {
+            ++*Index;
+        }
+    } else {
+        FindSymInfoByValue (&Info->LabelByVal, Start, Index);
+    }
+
+    /* The collection contains only labels and is sorted by address, so all
+    ** labels up to the first one with a value larger than the end address
+    ** are within the range.
+    */
+    Last = *Index;
+    while (Last < CollCount (&Info->LabelByVal) &&
+           ((const SymInfo*) CollAt (&Info->LabelByVal, Last))->Value <= (long) End) {
+        ++Last;
+    }
+    return Last;
+}
+
+
+
 static void ProcessCSymInfo (InputData* D)
 /* Postprocess c symbol infos */
 {
@@ -5031,9 +5947,6 @@ static void ProcessCSymInfo (InputData* D)
             CollSort (S->CSymInfoByName, CompareCSymInfoByName);
         }
     }
-
-    /* Sort the main list of all C functions by name */
-    CollSort (&D->Info->CSymFuncByName, CompareCSymInfoByName);
 }
 
 
@@ -5088,9 +6001,6 @@ static void ProcessFileInfo (InputData* D)
         /* Sort the files by name */
         CollSort (&M->FileInfoByName, CompareFileInfoByName);
     }
-
-    /* Sort the file infos by name, so we can do a binary search */
-    CollSort (&D->Info->FileInfoByName, CompareFileInfoByName);
 }
 
 
@@ -5206,9 +6116,6 @@ static void ProcessModInfo (InputData* D)
             M->Lib.Info = CollAt (&D->Info->LibInfoById, M->Lib.Id);
         }
     }
-
-    /* Sort the collection that contains the module info by name */
-    CollSort (&D->Info->ModInfoByName, CompareModInfoByName);
 }
 
 
@@ -5344,18 +6251,6 @@ static void ProcessScopeInfo (InputData* D)
         /* Sort the C functions in this module by name */
         CollSort (&M->CSymFuncByName, CompareCSymInfoByName);
     }
-
-    /* Sort the scope infos */
-    CollSort (&D->Info->ScopeInfoByName, CompareScopeInfoByName);
-}
-
-
-
-static void ProcessSegInfo (InputData* D)
-/* Postprocess segment infos */
-{
-    /* Sort the segment infos by name */
-    CollSort (&D->Info->SegInfoByName, CompareSegInfoByName);
 }
 
 
@@ -5365,12 +6260,6 @@ static void ProcessSpanInfo (InputData* D)
 {
     unsigned I;
 
-    /* Temporary collection with span infos sorted by address */
-    Collection SpanInfoByAddr = COLLECTION_INITIALIZER;
-
-    /* Resize the temporary collection */
-    CollGrow (&SpanInfoByAddr, CollCount (&D->Info->SpanInfoById));
-
     /* Walk over all spans and resolve the ids */
     for (I = 0; I < CollCount (&D->Info->SpanInfoById); ++I) {
 
@@ -5402,21 +6291,7 @@ static void ProcessSpanInfo (InputData* D)
         } else {
             S->Type.Info = CollAt (&D->Info->TypeInfoById, S->Type.Id);
         }
-
-        /* Append this span info to the temporary collection that is later
-        ** sorted by address.
-        */
-        CollAppend (&SpanInfoByAddr, S);
     }
-
-    /* Sort the collection with all span infos by address */
-    CollSort (&SpanInfoByAddr, CompareSpanInfoByAddr);
-
-    /* Create the span info list from the span info collection */
-    CreateSpanInfoList (&D->Info->SpanInfoByAddr, &SpanInfoByAddr);
-
-    /* Remove the temporary collection */
-    CollDone (&SpanInfoByAddr);
 }
 
 
@@ -5575,10 +6450,1014 @@ static void ProcessSymInfo (InputData* D)
         /* Sort the symbols in this scope by name */
         CollSort (&S->SymInfoByName, CompareSymInfoByName);
     }
+}
+
+
+
+static void SortNames (void* Data)
+/* Sort the smaller lists of items by name. Runs on a worker thread. */
+{
+    DbgInfo* Info = Data;
+    CollSort (&Info->CSymFuncByName,  CompareCSymInfoByName);
+    CollSort (&Info->FileInfoByName,  CompareFileInfoByName);
+    CollSort (&Info->ModInfoByName,   CompareModInfoByName);
+    CollSort (&Info->ScopeInfoByName, CompareScopeInfoByName);
+    CollSort (&Info->SegInfoByName,   CompareSegInfoByName);
+}
+
+
+
+static void SortSymsByName (void* Data)
+/* Sort the symbols by name. Runs on a worker thread. */
+{
+    DbgInfo* Info = Data;
+    CollSort (&Info->SymInfoByName, CompareSymInfoByName);
+}
+
+
+
+static void SortSymsByVal (void* Data)
+/* Sort the symbols by value and create the list of labels from them. Runs
+** on a worker thread.
+*/
+{
+    DbgInfo* Info = Data;
+    CollSort (&Info->SymInfoByVal, CompareSymInfoByVal);
+    CreateLabelList (Info);
+}
+
+
+
+static void SortSpans (void* Data)
+/* Create the list of spans sorted by address. Runs on a worker thread. */
+{
+    DbgInfo* Info = Data;
+    unsigned I;
+
+    /* Temporary collection with span infos sorted by address */
+    Collection SpanInfoByAddr = COLLECTION_INITIALIZER;
+    CollGrow (&SpanInfoByAddr, CollCount (&Info->SpanInfoById));
+    for (I = 0; I < CollCount (&Info->SpanInfoById); ++I) {
+        CollAppend (&SpanInfoByAddr, CollAt (&Info->SpanInfoById, I));
+    }
+
+    /* Sort it and create the span info list from it */
+    CollSort (&SpanInfoByAddr, CompareSpanInfoByAddr);
+    CreateSpanInfoList (&Info->SpanInfoByAddr, &SpanInfoByAddr);
+    CollDone (&SpanInfoByAddr);
+}
+
+
+
+static void SortDbgInfo (DbgInfo* Info)
+/* Create the indexes of the debug info. This must be done after all ids are
+** resolved, since spans are sorted by their address in the segment. Each
+** task sorts other collections, so they may run in parallel.
+*/
+{
+    Task Tasks[4];
+
+    /* The caller runs the first task while waiting for the others */
+    Tasks[0].Func = SortNames;
+    Tasks[1].Func = SortSpans;
+    Tasks[2].Func = SortSymsByName;
+    Tasks[3].Func = SortSymsByVal;
+    Tasks[0].Data = Tasks[1].Data = Tasks[2].Data = Tasks[3].Data = Info;
+    RunTasks (Tasks, sizeof (Tasks) / sizeof (Tasks[0]));
+}
+
+
+
+/*****************************************************************************/
+/*                                Index cache                                */
+/*****************************************************************************/
+
+
+
+/* Reader for a memory mapped index cache */
+typedef struct IdxReader IdxReader;
+struct IdxReader {
+    const unsigned char*    Buf;        /* Cache contents */
+    unsigned long           Pos;        /* Read position in Buf */
+    unsigned long           Len;        /* Size of Buf */
+    const char*             Strings;    /* String table */
+    unsigned long           StrLen;     /* Size of the string table */
+    int                     Error;      /* True if the cache is corrupt */
+};
+
+
+
+static char* IdxFileName (const char* FileName)
+/* Return the name of the index cache for a debug info file. The result must
+** be freed by the caller.
+*/
+{
+    unsigned Len = strlen (FileName);
+    char* Name = xmalloc (Len + sizeof (IDX_EXT));
+    memcpy (Name, FileName, Len);
+    memcpy (Name + Len, IDX_EXT, sizeof (IDX_EXT));
+    return Name;
+}
+
+
+
+static unsigned long HashBuf (unsigned long H, const unsigned char* Buf,
+                              unsigned long Len)
+/* Add the contents of Buf to the hash H and return the result. This is
+** FNV-1a applied to 32 bit words instead of bytes, which is four times as
+** fast. Trailing bytes are hashed one by one.
+*/
+{
+    while (Len >= 4) {
+        H ^= (unsigned long) Buf[0]        |
+            ((unsigned long) Buf[1] << 8)  |
+            ((unsigned long) Buf[2] << 16) |
+            ((unsigned long) Buf[3] << 24);
+        H = (H * 16777619UL) & 0xFFFFFFFFUL;
+        Buf += 4;
+        Len -= 4;
+    }
+    while (Len--) {
+        H = ((H ^ *Buf++) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return H;
+}
+
+
+
+static int HashDbgFile (const char* FileName, unsigned long* Size,
+                        unsigned long* Hash)
+/* Determine size and hash of a debug info file. Return false if the
+** file cannot be read.
+*/
+{
+    unsigned char* Buf;
+    size_t Count;
+    unsigned long H = IDX_HASHINIT;
+    unsigned long S = 0;
+
+    FILE* F = fopen (FileName, "rb");
+    if (F == 0) {
+        return 0;
+    }
+    Buf = xmalloc (BIN_BUFSIZE);
+    while ((Count = fread (Buf, 1, BIN_BUFSIZE, F)) > 0) {
+        H = HashBuf (H, Buf, Count);
+        S += Count;
+    }
+    xfree (Buf);
+    if (ferror (F)) {
+        fclose (F);
+        return 0;
+    }
+    fclose (F);
+
+    *Size = S & 0xFFFFFFFFUL;
+    *Hash = H;
+    return 1;
+}
+
+
+
+static const unsigned char* IdxMap (const char* Name, unsigned long* Len)
+/* Map the index cache with the given name into memory. Returns NULL if the
+** file doesn't exist or cannot be mapped.
+*/
+{
+#if defined(_WIN32)
+    /* No mmap, read the file instead */
+    unsigned char* Buf;
+    long Size;
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        return 0;
+    }
+    if (fseek (F, 0, SEEK_END) != 0 || (Size = ftell (F)) <= 0 ||
+        fseek (F, 0, SEEK_SET) != 0) {
+        fclose (F);
+        return 0;
+    }
+    Buf = xmalloc (Size);
+    if (fread (Buf, 1, Size, F) != (size_t) Size) {
+        xfree (Buf);
+        fclose (F);
+        return 0;
+    }
+    fclose (F);
+    *Len = (unsigned long) Size;
+    return Buf;
+#else
+    struct stat St;
+    void* Buf;
+    int FD = open (Name, O_RDONLY);
+    if (FD < 0) {
+        return 0;
+    }
+    if (fstat (FD, &St) != 0 || St.st_size <= 0) {
+        close (FD);
+        return 0;
+    }
+    Buf = mmap (0, St.st_size, PROT_READ, MAP_PRIVATE, FD, 0);
+    close (FD);
+    if (Buf == MAP_FAILED) {
+        return 0;
+    }
+    *Len = (unsigned long) St.st_size;
+    return Buf;
+#endif
+}
+
+
+
+static void IdxUnmap (const unsigned char* Buf, unsigned long Len)
+/* Release an index cache mapped by IdxMap */
+{
+#if defined(_WIN32)
+    (void) Len;
+    xfree ((void*) Buf);
+#else
+    munmap ((void*) Buf, Len);
+#endif
+}
+
+
+
+static unsigned long IdxGet32 (IdxReader* R)
+/* Read a 32 bit number from the cache */
+{
+    const unsigned char* P;
+
+    if (R->Len - R->Pos < 4) {
+        R->Error = 1;
+        R->Pos   = R->Len;
+        return 0;
+    }
+    P = R->Buf + R->Pos;
+    R->Pos += 4;
+    return  (unsigned long) P[0]        |
+           ((unsigned long) P[1] << 8)  |
+           ((unsigned long) P[2] << 16) |
+           ((unsigned long) P[3] << 24);
+}
+
+
+
+static long IdxGetSigned (IdxReader* R)
+/* Read a signed 32 bit number from the cache */
+{
+    unsigned long Val = IdxGet32 (R);
+    if (Val & 0x80000000UL) {
+        return -(long) (~Val & 0x7FFFFFFFUL) - 1;
+    }
+    return (long) Val;
+}
+
+
+
+static unsigned IdxGetCount (IdxReader* R)
+/* Read an item count. Every item uses at least one word in the cache, so
+** this is used to reject bogus counts before allocating memory.
+*/
+{
+    unsigned long Count = IdxGet32 (R);
+    if (Count > (R->Len - R->Pos) / 4) {
+        R->Error = 1;
+        return 0;
+    }
+    return (unsigned) Count;
+}
+
+
+
+static const char* IdxGetOptStr (IdxReader* R)
+/* Read a reference to the string table. Returns NULL for CC65_INV_ID. */
+{
+    unsigned long Offs = IdxGet32 (R);
+    if (Offs == CC65_INV_ID) {
+        return 0;
+    } else if (Offs >= R->StrLen) {
+        R->Error = 1;
+        return "";
+    }
+    return R->Strings + Offs;
+}
+
+
+
+static const char* IdxGetStr (IdxReader* R)
+/* Read a reference to the string table */
+{
+    const char* S = IdxGetOptStr (R);
+    if (S == 0) {
+        R->Error = 1;
+        S = "";
+    }
+    return S;
+}
+
+
+
+static void* IdxGetRef (IdxReader* R, const Collection* Items)
+/* Read an item id and return the item from the given collection. Returns
+** NULL for CC65_INV_ID.
+*/
+{
+    unsigned long Id = IdxGet32 (R);
+    if (Id == CC65_INV_ID) {
+        return 0;
+    } else if (Id >= CollCount (Items)) {
+        R->Error = 1;
+        return 0;
+    }
+    return CollAt (Items, (unsigned) Id);
+}
+
+
+
+static void IdxGetList (IdxReader* R, Collection* C, const Collection* Items)
+/* Read a list of item ids into C */
+{
+    unsigned Count = IdxGetCount (R);
+    CollGrow (C, Count);
+    while (Count--) {
+        void* Item = IdxGetRef (R, Items);
+        if (Item == 0) {
+            R->Error = 1;
+            return;
+        }
+        CollAppend (C, Item);
+    }
+}
+
+
+
+static Collection* IdxGetOptList (IdxReader* R, const Collection* Items)
+/* Read a list of item ids into a new collection. Returns NULL for an empty
+** list.
+*/
+{
+    Collection* C;
+    unsigned long Pos = R->Pos;
+    if (IdxGet32 (R) == 0) {
+        return 0;
+    }
+    R->Pos = Pos;
+    C = CollNew ();
+    IdxGetList (R, C, Items);
+    return C;
+}
+
+
+
+static void IdxGetTypeInfo (IdxReader* R, DbgInfo* Info)
+/* Read a type info from the cache */
+{
+    unsigned I;
+    unsigned Count = IdxGetCount (R);
+    TypeInfo* T;
+
+    /* There must be at least one typedata item */
+    if (Count == 0) {
+        R->Error = 1;
+        Count = 1;
+    }
+
+    /* Allocate the type */
+    T = xmalloc (sizeof (*T) - sizeof (T->Data[0]) + Count * sizeof (T->Data[0]));
+    T->Id = CollCount (&Info->TypeInfoById);
+    CollAppend (&Info->TypeInfoById, T);
+
+    /* Read the items. References to other items are stored as indices */
+    for (I = 0; I < Count; ++I) {
+        cc65_typedata* Data = &T->Data[I];
+        unsigned long  Next;
+        unsigned long  A, B;
+
+        Data->what = (cc65_typetoken) IdxGet32 (R);
+        Data->size = IdxGet32 (R);
+        Next = IdxGet32 (R);
+        A = IdxGet32 (R);
+        B = IdxGet32 (R);
+
+        Data->next = (Next < Count)? &T->Data[Next] : 0;
+        switch (Data->what) {
+            case CC65_TYPE_PTR:
+            case CC65_TYPE_FARPTR:
+                Data->data.ptr.ind_type = (A < Count)? &T->Data[A] : 0;
+                break;
+            case CC65_TYPE_ARRAY:
+                Data->data.array.ele_count = A;
+                if (B >= Count) {
+                    R->Error = 1;
+                    B = 0;
+                }
+                Data->data.array.ele_type = &T->Data[B];
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+
+
+static DbgInfo* ReadIndexCache (const char* FileName, const char* IdxName,
+                                unsigned long Size, unsigned long Hash)
+/* Read the index cache for a debug info file. Returns NULL if there is no
+** cache, if it is stale or if it is corrupt.
+*/
+{
+    IdxReader R;
+    DbgInfo*  Info;
+    unsigned  I;
+    unsigned  Count;
+    unsigned long BodyLen;
+    unsigned long BodyHash;
+    StrBuf    Name = STRBUF_INITIALIZER;
+
+    /* Map the cache */
+    R.Buf = IdxMap (IdxName, &R.Len);
+    if (R.Buf == 0) {
+        return 0;
+    }
+    R.Pos   = sizeof (IdxMagic);
+    R.Error = 0;
+
+    /* Check the header */
+    if (R.Len < IDX_HDRSIZE                                     ||
+        memcmp (R.Buf, IdxMagic, sizeof (IdxMagic)) != 0        ||
+        IdxGet32 (&R) != IDX_VERSION                            ||
+        IdxGet32 (&R) != Size                                   ||
+        IdxGet32 (&R) != Hash) {
+        IdxUnmap (R.Buf, R.Len);
+        return 0;
+    }
+
+    /* Create the debug info */
+    Info = NewDbgInfo (FileName);
+    Info->MajorVersion = IdxGet32 (&R);
+    Info->MinorVersion = IdxGet32 (&R);
+    R.StrLen = IdxGet32 (&R);
+    BodyLen  = IdxGet32 (&R);
+    BodyHash = IdxGet32 (&R);
+    if (R.StrLen == 0 || R.StrLen > R.Len - R.Pos ||
+        BodyLen != R.Len - R.Pos - R.StrLen ||
+        HashBuf (IDX_HASHINIT, R.Buf + R.Pos, R.Len - R.Pos) != BodyHash) {
+        goto Corrupt;
+    }
+
+    /* The string table follows the header. The last string must be
+    ** terminated, so all strings are.
+    */
+    R.Strings = (const char*) R.Buf + R.Pos;
+    if (R.Strings[R.StrLen - 1] != '\0') {
+        goto Corrupt;
+    }
+    R.Pos += R.StrLen;
+
+    /* First part: Create all items in id order. Everything that doesn't
+    ** reference other items is read here.
+    */
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->CSymInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        CSymInfo* S;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        S = NewCSymInfo (&Name);
+        S->Id    = I;
+        S->Kind  = (unsigned short) IdxGet32 (&R);
+        S->SC    = (unsigned short) IdxGet32 (&R);
+        S->Offs  = (int) IdxGetSigned (&R);
+        CollAppend (&Info->CSymInfoById, S);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->FileInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        FileInfo* F;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        F = NewFileInfo (&Name);
+        F->Id    = I;
+        F->Size  = IdxGet32 (&R);
+        F->MTime = IdxGet32 (&R);
+        CollAppend (&Info->FileInfoById, F);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->LibInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        LibInfo* L;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        L = NewLibInfo (&Name);
+        L->Id = I;
+        CollAppend (&Info->LibInfoById, L);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->LineInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        LineInfo* L = NewLineInfo ();
+        L->Id    = I;
+        L->Line  = IdxGet32 (&R);
+        L->Type  = (cc65_line_type) IdxGet32 (&R);
+        L->Count = IdxGet32 (&R);
+        CollAppend (&Info->LineInfoById, L);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->ModInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        ModInfo* M;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        M = NewModInfo (&Name);
+        M->Id = I;
+        CollAppend (&Info->ModInfoById, M);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->ScopeInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        ScopeInfo* S;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        S = NewScopeInfo (&Name);
+        S->Id   = I;
+        S->Type = (cc65_scope_type) IdxGet32 (&R);
+        S->Size = IdxGet32 (&R);
+        CollAppend (&Info->ScopeInfoById, S);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->SegInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        StrBuf OutputName = STRBUF_INITIALIZER;
+        cc65_addr Start;
+        cc65_size SegSize;
+        unsigned long OutputOffs;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        Start = IdxGet32 (&R);
+        SegSize = IdxGet32 (&R);
+        OutputName.Buf = (char*) IdxGetOptStr (&R);
+        OutputName.Len = OutputName.Buf? strlen (OutputName.Buf) : 0;
+        OutputOffs = IdxGet32 (&R);
+        CollAppend (&Info->SegInfoById,
+                    NewSegInfo (&Name, I, Start, SegSize, &OutputName, OutputOffs));
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->SpanInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        SpanInfo* S = NewSpanInfo ();
+        S->Id    = I;
+        S->Start = IdxGet32 (&R);
+        S->End   = IdxGet32 (&R);
+        CollAppend (&Info->SpanInfoById, S);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->SymInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        SymInfo* S;
+        Name.Buf = (char*) IdxGetStr (&R);
+        Name.Len = strlen (Name.Buf);
+        S = NewSymInfo (&Name);
+        S->Id    = I;
+        S->Type  = (cc65_symbol_type) IdxGet32 (&R);
+        S->Value = IdxGetSigned (&R);
+        S->Size  = IdxGet32 (&R);
+        CollAppend (&Info->SymInfoById, S);
+    }
+
+    Count = IdxGetCount (&R);
+    CollGrow (&Info->TypeInfoById, Count);
+    for (I = 0; I < Count && !R.Error; ++I) {
+        IdxGetTypeInfo (&R, Info);
+    }
+
+    if (R.Error) {
+        goto Corrupt;
+    }
+
+    /* Second part: Resolve the references between the items */
+    for (I = 0; I < CollCount (&Info->CSymInfoById); ++I) {
+        CSymInfo* S = CollAt (&Info->CSymInfoById, I);
+        S->Sym.Info   = IdxGetRef (&R, &Info->SymInfoById);
+        S->Type.Info  = IdxGetRef (&R, &Info->TypeInfoById);
+        S->Scope.Info = IdxGetRef (&R, &Info->ScopeInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->FileInfoById); ++I) {
+        FileInfo* F = CollAt (&Info->FileInfoById, I);
+        IdxGetList (&R, &F->ModInfoByName, &Info->ModInfoById);
+        IdxGetList (&R, &F->LineInfoByLine, &Info->LineInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->LineInfoById); ++I) {
+        LineInfo* L = CollAt (&Info->LineInfoById, I);
+        L->File.Info = IdxGetRef (&R, &Info->FileInfoById);
+        IdxGetList (&R, &L->SpanInfoList, &Info->SpanInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->ModInfoById); ++I) {
+        ModInfo* M = CollAt (&Info->ModInfoById, I);
+        M->File.Info = IdxGetRef (&R, &Info->FileInfoById);
+        M->Lib.Info  = IdxGetRef (&R, &Info->LibInfoById);
+        M->MainScope = IdxGetRef (&R, &Info->ScopeInfoById);
+        IdxGetList (&R, &M->CSymFuncByName, &Info->CSymInfoById);
+        IdxGetList (&R, &M->FileInfoByName, &Info->FileInfoById);
+        IdxGetList (&R, &M->ScopeInfoByName, &Info->ScopeInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->ScopeInfoById); ++I) {
+        ScopeInfo* S = CollAt (&Info->ScopeInfoById, I);
+        S->Mod.Info       = IdxGetRef (&R, &Info->ModInfoById);
+        S->Parent.Info    = IdxGetRef (&R, &Info->ScopeInfoById);
+        S->Label.Info     = IdxGetRef (&R, &Info->SymInfoById);
+        S->CSymFunc       = IdxGetRef (&R, &Info->CSymInfoById);
+        IdxGetList (&R, &S->SpanInfoList, &Info->SpanInfoById);
+        IdxGetList (&R, &S->SymInfoByName, &Info->SymInfoById);
+        S->CSymInfoByName = IdxGetOptList (&R, &Info->CSymInfoById);
+        S->ChildScopeList = IdxGetOptList (&R, &Info->ScopeInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->SpanInfoById); ++I) {
+        SpanInfo* S = CollAt (&Info->SpanInfoById, I);
+        S->Seg.Info      = IdxGetRef (&R, &Info->SegInfoById);
+        S->Type.Info     = IdxGetRef (&R, &Info->TypeInfoById);
+        S->ScopeInfoList = IdxGetOptList (&R, &Info->ScopeInfoById);
+        S->LineInfoList  = IdxGetOptList (&R, &Info->LineInfoById);
+    }
+    for (I = 0; I < CollCount (&Info->SymInfoById); ++I) {
+        SymInfo* S = CollAt (&Info->SymInfoById, I);
+        S->Exp.Info    = IdxGetRef (&R, &Info->SymInfoById);
+        S->Seg.Info    = IdxGetRef (&R, &Info->SegInfoById);
+        S->Scope.Info  = IdxGetRef (&R, &Info->ScopeInfoById);
+        S->Parent.Info = IdxGetRef (&R, &Info->SymInfoById);
+        S->CSym        = IdxGetRef (&R, &Info->CSymInfoById);
+        S->ImportList  = IdxGetOptList (&R, &Info->SymInfoById);
+        S->CheapLocals = IdxGetOptList (&R, &Info->SymInfoById);
+        IdxGetList (&R, &S->DefLineInfoList, &Info->LineInfoById);
+        IdxGetList (&R, &S->RefLineInfoList, &Info->LineInfoById);
+    }
+
+    /* Third part: The global indices, already sorted */
+    IdxGetList (&R, &Info->CSymFuncByName, &Info->CSymInfoById);
+    IdxGetList (&R, &Info->FileInfoByName, &Info->FileInfoById);
+    IdxGetList (&R, &Info->ModInfoByName, &Info->ModInfoById);
+    IdxGetList (&R, &Info->ScopeInfoByName, &Info->ScopeInfoById);
+    IdxGetList (&R, &Info->SegInfoByName, &Info->SegInfoById);
+    IdxGetList (&R, &Info->SymInfoByName, &Info->SymInfoById);
+    IdxGetList (&R, &Info->SymInfoByVal, &Info->SymInfoById);
+    if (!R.Error) {
+        /* Spans sorted by address */
+        Collection SpanInfoByAddr = COLLECTION_INITIALIZER;
+        IdxGetList (&R, &SpanInfoByAddr, &Info->SpanInfoById);
+        if (!R.Error && R.Pos == R.Len) {
+            CreateSpanInfoList (&Info->SpanInfoByAddr, &SpanInfoByAddr);
+            CreateLabelList (Info);
+        } else {
+            R.Error = 1;
+        }
+        CollDone (&SpanInfoByAddr);
+    }
+    if (R.Error) {
+        goto Corrupt;
+    }
+
+    /* Done */
+    IdxUnmap (R.Buf, R.Len);
+    return Info;
+
+Corrupt:
+    /* Ignore the cache */
+    IdxUnmap (R.Buf, R.Len);
+    FreeDbgInfo (Info);
+    return 0;
+}
+
+
+
+static void IdxPut32 (StrBuf* B, unsigned long Val)
+/* Write a 32 bit number to the cache */
+{
+    unsigned NewLen = B->Len + 4;
+    if (NewLen > B->Allocated) {
+        SB_Realloc (B, NewLen);
+    }
+    B->Buf[B->Len++] = (char) (Val & 0xFF);
+    B->Buf[B->Len++] = (char) ((Val >> 8) & 0xFF);
+    B->Buf[B->Len++] = (char) ((Val >> 16) & 0xFF);
+    B->Buf[B->Len++] = (char) ((Val >> 24) & 0xFF);
+}
+
+
+
+static void IdxPutStr (StrBuf* B, StrBuf* Strings, const char* S)
+/* Add a string to the string table and write a reference to it. NULL is
+** written as CC65_INV_ID.
+*/
+{
+    if (S == 0) {
+        IdxPut32 (B, CC65_INV_ID);
+    } else {
+        unsigned Len = strlen (S) + 1;
+        IdxPut32 (B, Strings->Len);
+        if (Strings->Len + Len > Strings->Allocated) {
+            SB_Realloc (Strings, Strings->Len + Len);
+        }
+        memcpy (Strings->Buf + Strings->Len, S, Len);
+        Strings->Len += Len;
+    }
+}
+
+
+
+static void IdxPutRef (StrBuf* B, const void* Item)
+/* Write the id of an item, CC65_INV_ID for NULL. All item structures start
+** with the id.
+*/
+{
+    IdxPut32 (B, Item? *(const unsigned*) Item : CC65_INV_ID);
+}
+
+
+
+static void IdxPutList (StrBuf* B, const Collection* C)
+/* Write a list of item ids. C may be NULL. */
+{
+    unsigned I;
+    IdxPut32 (B, CollCount (C));
+    for (I = 0; I < CollCount (C); ++I) {
+        IdxPutRef (B, CollAt (C, I));
+    }
+}
+
+
+
+static unsigned TypeDataCount (const cc65_typedata* Base, const cc65_typedata* T)
+/* Return the number of typedata items used by the type starting at T */
+{
+    unsigned Count = 0;
+    unsigned Sub;
+    while (T) {
+        if ((unsigned) (T - Base) + 1 > Count) {
+            Count = (unsigned) (T - Base) + 1;
+        }
+        if (T->what == CC65_TYPE_PTR || T->what == CC65_TYPE_FARPTR) {
+            Sub = TypeDataCount (Base, T->data.ptr.ind_type);
+        } else if (T->what == CC65_TYPE_ARRAY) {
+            Sub = TypeDataCount (Base, T->data.array.ele_type);
+        } else {
+            Sub = 0;
+        }
+        if (Sub > Count) {
+            Count = Sub;
+        }
+        T = T->next;
+    }
+    return Count;
+}
+
+
+
+static unsigned long TypeDataIndex (const cc65_typedata* Base,
+                                    const cc65_typedata* T)
+/* Return the index of a typedata item, CC65_INV_ID for NULL */
+{
+    return T? (unsigned long) (T - Base) : CC65_INV_ID;
+}
+
+
+
+static void WriteIndexCache (const DbgInfo* Info, const char* IdxName,
+                             unsigned long Size, unsigned long Hash)
+/* Write the index cache for a debug info file that was read without errors.
+** Failure to write the cache is not an error, it is just removed.
+*/
+{
+    StrBuf   B = STRBUF_INITIALIZER;
+    StrBuf   Strings = STRBUF_INITIALIZER;
+    StrBuf   Header = STRBUF_INITIALIZER;
+    unsigned I, J;
+    unsigned long BodyHash;
+    FILE*    F;
+    int      Ok;
+
+    /* First part: All items with the data that doesn't reference others */
+    IdxPut32 (&B, CollCount (&Info->CSymInfoById));
+    for (I = 0; I < CollCount (&Info->CSymInfoById); ++I) {
+        const CSymInfo* S = CollAt (&Info->CSymInfoById, I);
+        IdxPutStr (&B, &Strings, S->Name);
+        IdxPut32 (&B, S->Kind);
+        IdxPut32 (&B, S->SC);
+        IdxPut32 (&B, (unsigned long) S->Offs);
+    }
+    IdxPut32 (&B, CollCount (&Info->FileInfoById));
+    for (I = 0; I < CollCount (&Info->FileInfoById); ++I) {
+        const FileInfo* F = CollAt (&Info->FileInfoById, I);
+        IdxPutStr (&B, &Strings, F->Name);
+        IdxPut32 (&B, F->Size);
+        IdxPut32 (&B, F->MTime);
+    }
+    IdxPut32 (&B, CollCount (&Info->LibInfoById));
+    for (I = 0; I < CollCount (&Info->LibInfoById); ++I) {
+        const LibInfo* L = CollAt (&Info->LibInfoById, I);
+        IdxPutStr (&B, &Strings, L->Name);
+    }
+    IdxPut32 (&B, CollCount (&Info->LineInfoById));
+    for (I = 0; I < CollCount (&Info->LineInfoById); ++I) {
+        const LineInfo* L = CollAt (&Info->LineInfoById, I);
+        IdxPut32 (&B, L->Line);
+        IdxPut32 (&B, L->Type);
+        IdxPut32 (&B, L->Count);
+    }
+    IdxPut32 (&B, CollCount (&Info->ModInfoById));
+    for (I = 0; I < CollCount (&Info->ModInfoById); ++I) {
+        const ModInfo* M = CollAt (&Info->ModInfoById, I);
+        IdxPutStr (&B, &Strings, M->Name);
+    }
+    IdxPut32 (&B, CollCount (&Info->ScopeInfoById));
+    for (I = 0; I < CollCount (&Info->ScopeInfoById); ++I) {
+        const ScopeInfo* S = CollAt (&Info->ScopeInfoById, I);
+        IdxPutStr (&B, &Strings, S->Name);
+        IdxPut32 (&B, S->Type);
+        IdxPut32 (&B, S->Size);
+    }
+    IdxPut32 (&B, CollCount (&Info->SegInfoById));
+    for (I = 0; I < CollCount (&Info->SegInfoById); ++I) {
+        const SegInfo* S = CollAt (&Info->SegInfoById, I);
+        IdxPutStr (&B, &Strings, S->Name);
+        IdxPut32 (&B, S->Start);
+        IdxPut32 (&B, S->Size);
+        IdxPutStr (&B, &Strings, S->OutputName);
+        IdxPut32 (&B, S->OutputOffs);
+    }
+    IdxPut32 (&B, CollCount (&Info->SpanInfoById));
+    for (I = 0; I < CollCount (&Info->SpanInfoById); ++I) {
+        const SpanInfo* S = CollAt (&Info->SpanInfoById, I);
+        IdxPut32 (&B, S->Start);
+        IdxPut32 (&B, S->End);
+    }
+    IdxPut32 (&B, CollCount (&Info->SymInfoById));
+    for (I = 0; I < CollCount (&Info->SymInfoById); ++I) {
+        const SymInfo* S = CollAt (&Info->SymInfoById, I);
+        IdxPutStr (&B, &Strings, S->Name);
+        IdxPut32 (&B, S->Type);
+        IdxPut32 (&B, (unsigned long) S->Value);
+        IdxPut32 (&B, S->Size);
+    }
+    IdxPut32 (&B, CollCount (&Info->TypeInfoById));
+    for (I = 0; I < CollCount (&Info->TypeInfoById); ++I) {
+        const TypeInfo* T = CollAt (&Info->TypeInfoById, I);
+        const cc65_typedata* Base = T->Data;
+        unsigned Count = TypeDataCount (Base, Base);
+        IdxPut32 (&B, Count);
+        for (J = 0; J < Count; ++J) {
+            const cc65_typedata* D = &Base[J];
+            IdxPut32 (&B, D->what);
+            IdxPut32 (&B, D->size);
+            IdxPut32 (&B, TypeDataIndex (Base, D->next));
+            if (D->what == CC65_TYPE_PTR || D->what == CC65_TYPE_FARPTR) {
+                IdxPut32 (&B, TypeDataIndex (Base, D->data.ptr.ind_type));
+                IdxPut32 (&B, 0);
+            } else if (D->what == CC65_TYPE_ARRAY) {
+                IdxPut32 (&B, D->data.array.ele_count);
+                IdxPut32 (&B, TypeDataIndex (Base, D->data.array.ele_type));
+            } else {
+                IdxPut32 (&B, 0);
+                IdxPut32 (&B, 0);
+            }
+        }
+    }
 
-    /* Sort the symbol infos */
-    CollSort (&D->Info->SymInfoByName, CompareSymInfoByName);
-    CollSort (&D->Info->SymInfoByVal,  CompareSymInfoByVal);
+    /* Second part: References between the items */
+    for (I = 0; I < CollCount (&Info->CSymInfoById); ++I) {
+        const CSymInfo* S = CollAt (&Info->CSymInfoById, I);
+        IdxPutRef (&B, S->Sym.Info);
+        IdxPutRef (&B, S->Type.Info);
+        IdxPutRef (&B, S->Scope.Info);
+    }
+    for (I = 0; I < CollCount (&Info->FileInfoById); ++I) {
+        const FileInfo* F = CollAt (&Info->FileInfoById, I);
+        IdxPutList (&B, &F->ModInfoByName);
+        IdxPutList (&B, &F->LineInfoByLine);
+    }
+    for (I = 0; I < CollCount (&Info->LineInfoById); ++I) {
+        const LineInfo* L = CollAt (&Info->LineInfoById, I);
+        IdxPutRef (&B, L->File.Info);
+        IdxPutList (&B, &L->SpanInfoList);
+    }
+    for (I = 0; I < CollCount (&Info->ModInfoById); ++I) {
+        const ModInfo* M = CollAt (&Info->ModInfoById, I);
+        IdxPutRef (&B, M->File.Info);
+        IdxPutRef (&B, M->Lib.Info);
+        IdxPutRef (&B, M->MainScope);
+        IdxPutList (&B, &M->CSymFuncByName);
+        IdxPutList (&B, &M->FileInfoByName);
+        IdxPutList (&B, &M->ScopeInfoByName);
+    }
+    for (I = 0; I < CollCount (&Info->ScopeInfoById); ++I) {
+        const ScopeInfo* S = CollAt (&Info->ScopeInfoById, I);
+        IdxPutRef (&B, S->Mod.Info);
+        IdxPutRef (&B, S->Parent.Info);
+        IdxPutRef (&B, S->Label.Info);
+        IdxPutRef (&B, S->CSymFunc);
+        IdxPutList (&B, &S->SpanInfoList);
+        IdxPutList (&B, &S->SymInfoByName);
+        IdxPutList (&B, S->CSymInfoByName);
+        IdxPutList (&B, S->ChildScopeList);
+    }
+    for (I = 0; I < CollCount (&Info->SpanInfoById); ++I) {
+        const SpanInfo* S = CollAt (&Info->SpanInfoById, I);
+        IdxPutRef (&B, S->Seg.Info);
+        IdxPutRef (&B, S->Type.Info);
+        IdxPutList (&B, S->ScopeInfoList);
+        IdxPutList (&B, S->LineInfoList);
+    }
+    for (I = 0; I < CollCount (&Info->SymInfoById); ++I) {
+        const SymInfo* S = CollAt (&Info->SymInfoById, I);
+        IdxPutRef (&B, S->Exp.Info);
+        IdxPutRef (&B, S->Seg.Info);
+        IdxPutRef (&B, S->Scope.Info);
+        IdxPutRef (&B, S->Parent.Info);
+        IdxPutRef (&B, S->CSym);
+        IdxPutList (&B, S->ImportList);
+        IdxPutList (&B, S->CheapLocals);
+        IdxPutList (&B, &S->DefLineInfoList);
+        IdxPutList (&B, &S->RefLineInfoList);
+    }
+
+    /* Third part: The global indices */
+    IdxPutList (&B, &Info->CSymFuncByName);
+    IdxPutList (&B, &Info->FileInfoByName);
+    IdxPutList (&B, &Info->ModInfoByName);
+    IdxPutList (&B, &Info->ScopeInfoByName);
+    IdxPutList (&B, &Info->SegInfoByName);
+    IdxPutList (&B, &Info->SymInfoByName);
+    IdxPutList (&B, &Info->SymInfoByVal);
+
+    /* The spans sorted by address. Walking the address list and taking each
+    ** span at its start address gives them in the original sort order.
+    */
+    IdxPut32 (&B, CollCount (&Info->SpanInfoById));
+    for (I = 0; I < Info->SpanInfoByAddr.Count; ++I) {
+        const SpanInfoListEntry* E = &Info->SpanInfoByAddr.List[I];
+        if (E->Count == 1) {
+            const SpanInfo* S = E->Data;
+            if (S->Start == E->Addr) {
+                IdxPutRef (&B, S);
+            }
+        } else {
+            for (J = 0; J < E->Count; ++J) {
+                const SpanInfo* S = ((SpanInfo**) E->Data)[J];
+                if (S->Start == E->Addr) {
+                    IdxPutRef (&B, S);
+                }
+            }
+        }
+    }
+
+    /* Make sure the string table isn't empty and pad it to a multiple of
+    ** four bytes, so the body hash can be calculated in two parts.
+    */
+    do {
+        SB_AppendChar (&Strings, '\0');
+    } while ((SB_GetLen (&Strings) & 0x03) != 0);
+
+    /* Hash the cache contents */
+    BodyHash = HashBuf (IDX_HASHINIT,
+                        (const unsigned char*) SB_GetConstBuf (&Strings),
+                        SB_GetLen (&Strings));
+    BodyHash = HashBuf (BodyHash,
+                        (const unsigned char*) SB_GetConstBuf (&B),
+                        SB_GetLen (&B));
+
+    /* Create the header */
+    SB_CopyBuf (&Header, (const char*) IdxMagic, sizeof (IdxMagic));
+    IdxPut32 (&Header, IDX_VERSION);
+    IdxPut32 (&Header, Size);
+    IdxPut32 (&Header, Hash);
+    IdxPut32 (&Header, Info->MajorVersion);
+    IdxPut32 (&Header, Info->MinorVersion);
+    IdxPut32 (&Header, SB_GetLen (&Strings));
+    IdxPut32 (&Header, SB_GetLen (&B));
+    IdxPut32 (&Header, BodyHash);
+
+    /* Write the cache */
+    F = fopen (IdxName, "wb");
+    if (F != 0) {
+        Ok = fwrite (SB_GetConstBuf (&Header), SB_GetLen (&Header), 1, F) == 1 &&
+             fwrite (SB_GetConstBuf (&Strings), SB_GetLen (&Strings), 1, F) == 1 &&
+             fwrite (SB_GetConstBuf (&B), SB_GetLen (&B), 1, F) == 1;
+        if (fclose (F) != 0 || !Ok) {
+            remove (IdxName);
+        }
+    }
+
+    /* Free the buffers */
+    SB_Done (&B);
+    SB_Done (&Strings);
+    SB_Done (&Header);
 }
 
 
@@ -5589,12 +7468,11 @@ static void ProcessSymInfo (InputData* D)
 
 
 
-cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
-/* Parse the debug info file with the given name. On success, the function
-** will return a pointer to an opaque cc65_dbginfo structure, that must be
-** passed to the other functions in this module to retrieve information.
-** errorfunc is called in case of warnings and errors. If the file cannot be
-** read successfully, NULL is returned.
+static DbgInfo* ReadDbgInfo (const char* FileName, cc65_errorfunc ErrFunc,
+                             unsigned* Errors)
+/* Parse the debug info file with the given name and return the debug info.
+** The number of errors is returned in Errors. If the file cannot be read
+** successfully, NULL is returned.
 */
 {
     /* Data structure used to control scanning and parsing */
@@ -5612,12 +7490,29 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
         STRBUF_INITIALIZER,     /* String constant */
         0,                      /* Function called in case of errors */
         0,                      /* Pointer to debug info */
+        0,                      /* Input is in binary format */
+        0,                      /* Input buffer */
+        0,                      /* Read position in input buffer */
+        0,                      /* Number of bytes in input buffer */
+        COLLECTION_INITIALIZER, /* String table for binary format */
+        { 0 },                  /* Keyword lookup table */
+        0,                      /* Parse errors are passed on immediately */
     };
+    unsigned char Magic[sizeof (BinMagic)];
+    unsigned I;
+    int C;
+    unsigned long Size = 0;
+    unsigned Chunks = 1;
+
     D.FileName = FileName;
     D.Error    = ErrFunc;
+    *Errors    = 0;
+    InitKeywordHash (&D);
 
-    /* Open the input file */
-    D.F = fopen (FileName, "rt");
+    /* Open the input file. The scanner ignores carriage returns, so we can
+    ** open it in binary mode even if it's a text file.
+    */
+    D.F = fopen (FileName, "rb");
     if (D.F == 0) {
         /* Cannot open */
         ParseError (&D, CC65_ERROR,
@@ -5626,6 +7521,48 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
         return 0;
     }
 
+    /* Check if this is a binary debug file */
+    C = getc (D.F);
+    if (C == BinMagic[0]) {
+        Magic[0] = (unsigned char) C;
+        for (I = 1; I < sizeof (Magic); ++I) {
+            Magic[I] = (unsigned char) getc (D.F);
+        }
+        if (memcmp (Magic, BinMagic, sizeof (Magic)) != 0) {
+            ParseError (&D, CC65_ERROR, "Not a valid debug info file");
+            fclose (D.F);
+            return 0;
+        }
+        if ((C = getc (D.F)) != BIN_VERSION) {
+            ParseError (&D, CC65_ERROR,
+                        "Unsupported binary debug file encoding %d", C);
+            fclose (D.F);
+            return 0;
+        }
+        D.Binary = 1;
+    } else if (C != EOF) {
+        ungetc (C, D.F);
+        Chunks = ChunkCount (D.F, &Size);
+    }
+
+    /* A text file that is parsed in chunks is read into memory. The scanner
+    ** gets the first line only, the remaining lines are split later.
+    */
+    if (Chunks > 1) {
+        const unsigned char* EOL;
+        D.Buf = xmalloc (Size);
+        D.BufLen = fread (D.Buf, 1, Size, D.F);
+        EOL = memchr (D.Buf, '\n', D.BufLen);
+        if (D.BufLen != Size || EOL == 0) {
+            /* Parse what we have serially */
+            Chunks = 1;
+        } else {
+            D.BufLen = (unsigned) (EOL - D.Buf) + 1;
+        }
+    } else {
+        D.Buf = xmalloc (BIN_BUFSIZE);
+    }
+
     /* Create a new debug info struct */
     D.Info = NewDbgInfo (FileName);
 
@@ -5676,73 +7613,11 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
     }
     ConsumeEOL (&D);
 
-    /* Parse lines */
-    while (D.Tok != TOK_EOF) {
-
-        switch (D.Tok) {
-
-            case TOK_CSYM:
-                ParseCSym (&D);
-                break;
-
-            case TOK_FILE:
-                ParseFile (&D);
-                break;
-
-            case TOK_INFO:
-                ParseInfo (&D);
-                break;
-
-            case TOK_LIBRARY:
-                ParseLibrary (&D);
-                break;
-
-            case TOK_LINE:
-                ParseLine (&D);
-                break;
-
-            case TOK_MODULE:
-                ParseModule (&D);
-                break;
-
-            case TOK_SCOPE:
-                ParseScope (&D);
-                break;
-
-            case TOK_SEGMENT:
-                ParseSegment (&D);
-                break;
-
-            case TOK_SPAN:
-                ParseSpan (&D);
-                break;
-
-            case TOK_SYM:
-                ParseSym (&D);
-                break;
-
-            case TOK_TYPE:
-                ParseType (&D);
-                break;
-
-            case TOK_IDENT:
-                /* Output a warning, then skip the line with the unknown
-                ** keyword that may have been added by a later version.
-                */
-                ParseError (&D, CC65_WARNING,
-                            "Unknown keyword \"%s\" - skipping",
-                            SB_GetConstBuf (&D.SVal));
-
-                SkipLine (&D);
-                break;
-
-            default:
-                UnexpectedToken (&D);
-
-        }
-
-        /* EOL or EOF must follow */
-        ConsumeEOL (&D);
+    /* Parse the remaining lines */
+    if (Chunks > 1) {
+        ParseChunks (&D, Size, Chunks);
+    } else {
+        ParseLines (&D);
     }
 
 CloseAndExit:
@@ -5752,9 +7627,17 @@ CloseAndExit:
     /* Free memory allocated for SVal */
     SB_Done (&D.SVal);
 
+    /* Free memory allocated for the binary format */
+    for (I = 0; I < CollCount (&D.BinStrings); ++I) {
+        xfree (CollAt (&D.BinStrings, I));
+    }
+    CollDone (&D.BinStrings);
+    xfree (D.Buf);
+
     /* In case of errors, delete the debug info already allocated and
     ** return NULL
     */
+    *Errors = D.Errors;
     if (D.Errors > 0) {
         /* Free allocated stuff */
         FreeDbgInfo (D.Info);
@@ -5770,9 +7653,9 @@ CloseAndExit:
     ProcessLineInfo (&D);
     ProcessModInfo (&D);
     ProcessScopeInfo (&D);
-    ProcessSegInfo (&D);
     ProcessSpanInfo (&D);
     ProcessSymInfo (&D);
+    SortDbgInfo (D.Info);
 
 #if DEBUG
     /* Debug output */
@@ -5780,11 +7663,61 @@ CloseAndExit:
 #endif
 
     /* Return the debug info struct that was created */
+    *Errors = D.Errors;
     return D.Info;
 }
 
 
 
+cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
+/* Parse the debug info file with the given name. On success, the function
+** will return a pointer to an opaque cc65_dbginfo structure, that must be
+** passed to the other functions in this module to retrieve information.
+** errorfunc is called in case of warnings and errors. If the file cannot be
+** read successfully, NULL is returned.
+*/
+{
+    unsigned Errors;
+    return ReadDbgInfo (FileName, ErrFunc, &Errors);
+}
+
+
+
+cc65_dbginfo cc65_read_dbginfo_cached (const char* FileName,
+                                       cc65_errorfunc ErrFunc)
+/* Like cc65_read_dbginfo, but use the index cache next to the debug info
+** file if it is up to date. Otherwise the file is parsed, and if that
+** succeeds without errors, the cache is (re)written.
+*/
+{
+    unsigned long Size;
+    unsigned long Hash;
+    unsigned      Errors;
+    char*         IdxName;
+    DbgInfo*      Info;
+
+    /* If we cannot hash the file, let the parser output the error */
+    if (!HashDbgFile (FileName, &Size, &Hash)) {
+        return cc65_read_dbginfo (FileName, ErrFunc);
+    }
+
+    /* Try the cache, parse the file if it's not usable */
+    IdxName = IdxFileName (FileName);
+    Info = ReadIndexCache (FileName, IdxName, Size, Hash);
+    if (Info == 0) {
+        Info = ReadDbgInfo (FileName, ErrFunc, &Errors);
+        if (Info != 0 && Errors == 0) {
+            WriteIndexCache (Info, IdxName, Size, Hash);
+        }
+    }
+    xfree (IdxName);
+
+    /* Return the debug info */
+    return Info;
+}
+
+
+
 void cc65_free_dbginfo (cc65_dbginfo Handle)
 /* Free debug information read from a file */
 {
@@ -5994,6 +7927,32 @@ const cc65_csyminfo* cc65_csym_byscope (cc65_dbginfo Handle, unsigned ScopeId)
 
 
 
+int cc65_next_csym (cc65_dbginfo Handle, unsigned* Iter,
+                    cc65_csymdata* Data)
+/* Store the c symbol with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more c symbols.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->CSymInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopyCSymInfo (Data, CollAt (&Info->CSymInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_csyminfo (cc65_dbginfo Handle, const cc65_csyminfo* Info)
 /* Free a c symbol info record */
 {
@@ -6048,27 +8007,53 @@ const cc65_libraryinfo* cc65_library_byid (cc65_dbginfo Handle, unsigned Id)
 */
 {
     const DbgInfo*      Info;
-    cc65_libraryinfo*   D;
+    cc65_libraryinfo*   D;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if the id is valid */
+    if (Id >= CollCount (&Info->LibInfoById)) {
+        return 0;
+    }
+
+    /* Allocate memory for the data structure returned to the caller */
+    D = new_cc65_libraryinfo (1);
+
+    /* Fill in the data */
+    CopyLibInfo (D->data, CollAt (&Info->LibInfoById, Id));
+
+    /* Return the result */
+    return D;
+}
+
+
+
+int cc65_next_library (cc65_dbginfo Handle, unsigned* Iter,
+                       cc65_librarydata* Data)
+/* Store the library with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more libraries.
+*/
+{
+    const DbgInfo*      Info;
 
-    /* Check the parameter */
-    assert (Handle != 0);
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
 
     /* The handle is actually a pointer to a debug info struct */
     Info = Handle;
 
-    /* Check if the id is valid */
-    if (Id >= CollCount (&Info->LibInfoById)) {
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->LibInfoById)) {
         return 0;
     }
 
-    /* Allocate memory for the data structure returned to the caller */
-    D = new_cc65_libraryinfo (1);
-
-    /* Fill in the data */
-    CopyLibInfo (D->data, CollAt (&Info->LibInfoById, Id));
-
-    /* Return the result */
-    return D;
+    /* Copy the data and advance */
+    CopyLibInfo (Data, CollAt (&Info->LibInfoById, (*Iter)++));
+    return 1;
 }
 
 
@@ -6327,6 +8312,69 @@ const cc65_lineinfo* cc65_line_byspan (cc65_dbginfo Handle, unsigned SpanId)
 
 
 
+unsigned cc65_line_byspan_buf (cc65_dbginfo Handle, unsigned SpanId,
+                               cc65_linedata* Buf, unsigned Count)
+/* Like cc65_line_byspan, but store up to Count lines in Buf. Returns the
+** number of lines for the span, which is zero for an invalid span id.
+*/
+{
+    const DbgInfo*  Info;
+    const SpanInfo* S;
+    unsigned        Lines;
+    unsigned        I;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if the span id is valid */
+    if (SpanId >= CollCount (&Info->SpanInfoById)) {
+        return 0;
+    }
+
+    /* Get the span */
+    S = CollAt (&Info->SpanInfoById, SpanId);
+
+    /* Fill in as many lines as fit into the buffer */
+    Lines = CollCount (S->LineInfoList);
+    for (I = 0; I < Lines && I < Count; ++I) {
+        CopyLineInfo (Buf + I, CollAt (S->LineInfoList, I));
+    }
+
+    /* Return the number of lines available */
+    return Lines;
+}
+
+
+
+int cc65_next_line (cc65_dbginfo Handle, unsigned* Iter,
+                    cc65_linedata* Data)
+/* Store the line with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more lines.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->LineInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopyLineInfo (Data, CollAt (&Info->LineInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_lineinfo (cc65_dbginfo Handle, const cc65_lineinfo* Info)
 /* Free line info returned by one of the other functions */
 {
@@ -6406,6 +8454,32 @@ const cc65_moduleinfo* cc65_module_byid (cc65_dbginfo Handle, unsigned Id)
 
 
 
+int cc65_next_module (cc65_dbginfo Handle, unsigned* Iter,
+                      cc65_moduledata* Data)
+/* Store the module with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more modules.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->ModInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopyModInfo (Data, CollAt (&Info->ModInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_moduleinfo (cc65_dbginfo Handle, const cc65_moduleinfo* Info)
 /* Free a module info record */
 {
@@ -6604,6 +8678,108 @@ const cc65_spaninfo* cc65_span_byscope (cc65_dbginfo Handle, unsigned ScopeId)
 
 
 
+unsigned cc65_span_byaddr_buf (cc65_dbginfo Handle, unsigned long Addr,
+                               cc65_spandata* Buf, unsigned Count)
+/* Like cc65_span_byaddr, but store up to Count spans in Buf. Returns the
+** number of spans that cover the address.
+*/
+{
+    const DbgInfo*      Info;
+    SpanInfoListEntry*  E;
+    unsigned            I;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Search for spans that cover this address */
+    E = FindSpanInfoByAddr (&Info->SpanInfoByAddr, Addr);
+    if (E == 0) {
+        return 0;
+    }
+
+    /* Fill in as many spans as fit into the buffer */
+    if (E->Count == 1) {
+        if (Count > 0) {
+            CopySpanInfo (Buf, E->Data);
+        }
+    } else {
+        for (I = 0; I < E->Count && I < Count; ++I) {
+            CopySpanInfo (Buf + I, ((SpanInfo**) E->Data)[I]);
+        }
+    }
+
+    /* Return the number of spans available */
+    return E->Count;
+}
+
+
+
+unsigned cc65_span_byline_buf (cc65_dbginfo Handle, unsigned LineId,
+                               cc65_spandata* Buf, unsigned Count)
+/* Like cc65_span_byline, but store up to Count spans in Buf. Returns the
+** number of spans for the line, which is zero for an invalid line id.
+*/
+{
+    const DbgInfo*      Info;
+    const LineInfo*     L;
+    unsigned            Spans;
+    unsigned            I;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if the line id is valid */
+    if (LineId >= CollCount (&Info->LineInfoById)) {
+        return 0;
+    }
+
+    /* Get the line with this id */
+    L = CollAt (&Info->LineInfoById, LineId);
+
+    /* Fill in as many spans as fit into the buffer */
+    Spans = CollCount (&L->SpanInfoList);
+    for (I = 0; I < Spans && I < Count; ++I) {
+        CopySpanInfo (Buf + I, CollAt (&L->SpanInfoList, I));
+    }
+
+    /* Return the number of spans available */
+    return Spans;
+}
+
+
+
+int cc65_next_span (cc65_dbginfo Handle, unsigned* Iter,
+                    cc65_spandata* Data)
+/* Store the span with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more spans.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->SpanInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopySpanInfo (Data, CollAt (&Info->SpanInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_spaninfo (cc65_dbginfo Handle, const cc65_spaninfo* Info)
 /* Free a span info record */
 {
@@ -6723,6 +8899,32 @@ const cc65_sourceinfo* cc65_source_bymodule (cc65_dbginfo Handle, unsigned Id)
 
 
 
+int cc65_next_source (cc65_dbginfo Handle, unsigned* Iter,
+                      cc65_sourcedata* Data)
+/* Store the source file with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more source files.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->FileInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopyFileInfo (Data, CollAt (&Info->FileInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_sourceinfo (cc65_dbginfo Handle, const cc65_sourceinfo* Info)
 /* Free a source info record */
 {
@@ -6972,6 +9174,69 @@ const cc65_scopeinfo* cc65_childscopes_byid (cc65_dbginfo Handle, unsigned Id)
 
 
 
+unsigned cc65_scope_byspan_buf (cc65_dbginfo Handle, unsigned SpanId,
+                                cc65_scopedata* Buf, unsigned Count)
+/* Like cc65_scope_byspan, but store up to Count scopes in Buf. Returns the
+** number of scopes for the span, which is zero for an invalid span id.
+*/
+{
+    const DbgInfo*      Info;
+    const SpanInfo*     S;
+    unsigned            Scopes;
+    unsigned            I;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if the span id is valid */
+    if (SpanId >= CollCount (&Info->SpanInfoById)) {
+        return 0;
+    }
+
+    /* Get the span */
+    S = CollAt (&Info->SpanInfoById, SpanId);
+
+    /* Fill in as many scopes as fit into the buffer */
+    Scopes = CollCount (S->ScopeInfoList);
+    for (I = 0; I < Scopes && I < Count; ++I) {
+        CopyScopeInfo (Buf + I, CollAt (S->ScopeInfoList, I));
+    }
+
+    /* Return the number of scopes available */
+    return Scopes;
+}
+
+
+
+int cc65_next_scope (cc65_dbginfo Handle, unsigned* Iter,
+                     cc65_scopedata* Data)
+/* Store the scope with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more scopes.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->ScopeInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopyScopeInfo (Data, CollAt (&Info->ScopeInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_scopeinfo (cc65_dbginfo Handle, const cc65_scopeinfo* Info)
 /* Free a scope info record */
 {
@@ -7086,6 +9351,32 @@ const cc65_segmentinfo* cc65_segment_byname (cc65_dbginfo Handle,
 
 
 
+int cc65_next_segment (cc65_dbginfo Handle, unsigned* Iter,
+                       cc65_segmentdata* Data)
+/* Store the segment with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more segments.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->SegInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopySegInfo (Data, CollAt (&Info->SegInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_segmentinfo (cc65_dbginfo Handle, const cc65_segmentinfo* Info)
 /* Free a segment info record */
 {
@@ -7235,10 +9526,10 @@ const cc65_symbolinfo* cc65_symbol_inrange (cc65_dbginfo Handle, cc65_addr Start
 */
 {
     const DbgInfo*      Info;
-    Collection          SymInfoList = COLLECTION_INITIALIZER;
     cc65_symbolinfo*    D;
     unsigned            I;
     unsigned            Index;
+    unsigned            Last;
 
     /* Check the parameter */
     assert (Handle != 0);
@@ -7246,60 +9537,87 @@ const cc65_symbolinfo* cc65_symbol_inrange (cc65_dbginfo Handle, cc65_addr Start
     /* The handle is actually a pointer to a debug info struct */
     Info = Handle;
 
-    /* Search for the symbol. Because we're searching for a range, we cannot
-    ** make use of the function result.
-    */
-    FindSymInfoByValue (&Info->SymInfoByVal, Start, &Index);
-
-    /* Start from the given index, check all symbols until the end address is
-    ** reached. Place all symbols into SymInfoList for later.
-    */
-    for (I = Index; I < CollCount (&Info->SymInfoByVal); ++I) {
-
-        /* Get the item */
-        SymInfo* Item = CollAt (&Info->SymInfoByVal, I);
-
-        /* The collection is sorted by address, so if we get a value larger
-        ** than the end address, we're done.
-        */
-        if (Item->Value > (long) End) {
-            break;
-        }
-
-        /* Ignore non-labels (this will also ignore imports) */
-        if (Item->Type != CC65_SYM_LABEL) {
-            continue;
-        }
-
-        /* Ok, remember this one */
-        CollAppend (&SymInfoList, Item);
-    }
+    /* Search for the labels */
+    Last = FindLabelRange (Info, Start, End, &Index);
 
-    /* If we don't have any labels within the range, bail out. No memory has
-    ** been allocated for SymInfoList.
-    */
-    if (CollCount (&SymInfoList) == 0) {
+    /* If we don't have any labels within the range, bail out */
+    if (Last == Index) {
         return 0;
     }
 
     /* Allocate memory for the data structure returned to the caller */
-    D = new_cc65_symbolinfo (CollCount (&SymInfoList));
+    D = new_cc65_symbolinfo (Last - Index);
 
     /* Fill in the data */
-    for (I = 0; I < CollCount (&SymInfoList); ++I) {
+    for (I = Index; I < Last; ++I) {
         /* Copy the data */
-        CopySymInfo (D->data + I, CollAt (&SymInfoList, I));
+        CopySymInfo (D->data + I - Index, CollAt (&Info->LabelByVal, I));
     }
 
-    /* Free the collection */
-    CollDone (&SymInfoList);
-
     /* Return the result */
     return D;
 }
 
 
 
+unsigned cc65_symbol_inrange_buf (cc65_dbginfo Handle,
+                                  cc65_addr Start, cc65_addr End,
+                                  cc65_symboldata* Buf, unsigned Count)
+/* Like cc65_symbol_inrange, but store up to Count labels in Buf. Returns the
+** number of labels within the range.
+*/
+{
+    const DbgInfo*      Info;
+    unsigned            I;
+    unsigned            Index;
+    unsigned            Last;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Search for the labels */
+    Last = FindLabelRange (Info, Start, End, &Index);
+
+    /* Fill in as many labels as fit into the buffer */
+    for (I = Index; I < Last && I - Index < Count; ++I) {
+        CopySymInfo (Buf + I - Index, CollAt (&Info->LabelByVal, I));
+    }
+
+    /* Return the number of labels available */
+    return Last - Index;
+}
+
+
+
+int cc65_next_symbol (cc65_dbginfo Handle, unsigned* Iter,
+                      cc65_symboldata* Data)
+/* Store the symbol with the id *Iter in Data, increment *Iter and return true.
+** Return false if there are no more symbols.
+*/
+{
+    const DbgInfo*      Info;
+
+    /* Check the parameters */
+    assert (Handle != 0 && Iter != 0 && Data != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Check if we're done */
+    if (*Iter >= CollCount (&Info->SymInfoById)) {
+        return 0;
+    }
+
+    /* Copy the data and advance */
+    CopySymInfo (Data, CollAt (&Info->SymInfoById, (*Iter)++));
+    return 1;
+}
+
+
+
 void cc65_free_symbolinfo (cc65_dbginfo Handle, const cc65_symbolinfo* Info)
 /* Free a symbol info record */
 {
@@ -103,9 +103,30 @@ cc65_dbginfo cc65_read_dbginfo (const char* filename, cc65_errorfunc errorfunc);
 ** read successfully, NULL is returned.
 */
 
+cc65_dbginfo cc65_read_dbginfo_cached (const char* filename,
+                                       cc65_errorfunc errorfunc);
+/* Like cc65_read_dbginfo, but use a binary index cache named filename.idx.
+** If the cache matches the debug info file, it is mapped into memory and the
+** data is taken from it without parsing. Otherwise the file is parsed and,
+** if there were no errors, the cache is (re)written. Failure to write the
+** cache is silently ignored.
+*/
+
 void cc65_free_dbginfo (cc65_dbginfo Handle);
 /* Free debug information read from a file */
 
+/* Allocation free queries: Functions with a _buf suffix work like the
+** function without the suffix, but instead of allocating a result that must
+** be freed, they store up to count items in a buffer supplied by the caller.
+** They return the number of items available, which may be larger than count.
+** Passing a count of zero may be used to determine the required buffer size.
+** Iterators: The cc65_next_xxx functions store the item with the id *iter
+** in data, increment *iter and return true. If there are no more items, they
+** return false. Set *iter to zero to enumerate all items of a kind.
+** Strings in the returned data are part of the debug information and valid
+** until it is freed.
+*/
+
 
 
 /*****************************************************************************/
@@ -175,6 +196,12 @@ const cc65_csyminfo* cc65_csym_byscope (cc65_dbginfo handle, unsigned scope_id);
 ** given id is invalid.
 */
 
+int cc65_next_csym (cc65_dbginfo handle, unsigned* iter,
+                    cc65_csymdata* data);
+/* Iterate over all c symbols without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_csyminfo (cc65_dbginfo handle, const cc65_csyminfo* info);
 /* Free a c symbol info record */
 
@@ -211,6 +238,12 @@ const cc65_libraryinfo* cc65_library_byid (cc65_dbginfo handle, unsigned id);
 ** library information.
 */
 
+int cc65_next_library (cc65_dbginfo handle, unsigned* iter,
+                       cc65_librarydata* data);
+/* Iterate over all libraries without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_libraryinfo (cc65_dbginfo handle, const cc65_libraryinfo* info);
 /* Free a library info record */
 
@@ -281,6 +314,18 @@ const cc65_lineinfo* cc65_line_byspan (cc65_dbginfo handle, unsigned span_id);
 ** span id is invalid, otherwise a list of line infos.
 */
 
+unsigned cc65_line_byspan_buf (cc65_dbginfo handle, unsigned span_id,
+                               cc65_linedata* buf, unsigned count);
+/* Like cc65_line_byspan, but store up to count lines in buf. Returns the
+** number of lines for the span, which is zero for an invalid span id.
+*/
+
+int cc65_next_line (cc65_dbginfo handle, unsigned* iter,
+                    cc65_linedata* data);
+/* Iterate over all lines without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_lineinfo (cc65_dbginfo handle, const cc65_lineinfo* info);
 /* Free line info returned by one of the other functions */
 
@@ -324,6 +369,12 @@ const cc65_moduleinfo* cc65_module_byid (cc65_dbginfo handle, unsigned id);
 ** module information.
 */
 
+int cc65_next_module (cc65_dbginfo handle, unsigned* iter,
+                      cc65_moduledata* data);
+/* Iterate over all modules without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_moduleinfo (cc65_dbginfo handle, const cc65_moduleinfo* info);
 /* Free a module info record */
 
@@ -381,6 +432,24 @@ const cc65_spaninfo* cc65_span_byscope (cc65_dbginfo handle, unsigned scope_id);
 ** the scope id is invalid, otherwise the spans for this scope (possibly zero).
 */
 
+unsigned cc65_span_byaddr_buf (cc65_dbginfo handle, unsigned long addr,
+                               cc65_spandata* buf, unsigned count);
+/* Like cc65_span_byaddr, but store up to count spans in buf. Returns the
+** number of spans that cover the address.
+*/
+
+unsigned cc65_span_byline_buf (cc65_dbginfo handle, unsigned line_id,
+                               cc65_spandata* buf, unsigned count);
+/* Like cc65_span_byline, but store up to count spans in buf. Returns the
+** number of spans for the line, which is zero for an invalid line id.
+*/
+
+int cc65_next_span (cc65_dbginfo handle, unsigned* iter,
+                    cc65_spandata* data);
+/* Iterate over all spans without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_spaninfo (cc65_dbginfo handle, const cc65_spaninfo* info);
 /* Free a span info record */
 
@@ -426,6 +495,12 @@ const cc65_sourceinfo* cc65_source_bymodule (cc65_dbginfo handle,
 ** otherwise a cc65_sourceinfo structure with one entry per source file.
 */
 
+int cc65_next_source (cc65_dbginfo handle, unsigned* iter,
+                      cc65_sourcedata* data);
+/* Iterate over all source files without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_sourceinfo (cc65_dbginfo handle, const cc65_sourceinfo* info);
 /* Free a source info record */
 
@@ -494,6 +569,18 @@ const cc65_scopeinfo* cc65_childscopes_byid (cc65_dbginfo handle, unsigned id);
 ** direct childs.
 */
 
+unsigned cc65_scope_byspan_buf (cc65_dbginfo handle, unsigned span_id,
+                                cc65_scopedata* buf, unsigned count);
+/* Like cc65_scope_byspan, but store up to count scopes in buf. Returns the
+** number of scopes for the span, which is zero for an invalid span id.
+*/
+
+int cc65_next_scope (cc65_dbginfo handle, unsigned* iter,
+                     cc65_scopedata* data);
+/* Iterate over all scopes without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_scopeinfo (cc65_dbginfo Handle, const cc65_scopeinfo* Info);
 /* Free a scope info record */
 
@@ -547,6 +634,12 @@ const cc65_segmentinfo* cc65_segment_byname (cc65_dbginfo handle,
 ** information.
 */
 
+int cc65_next_segment (cc65_dbginfo handle, unsigned* iter,
+                       cc65_segmentdata* data);
+/* Iterate over all segments without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_segmentinfo (cc65_dbginfo handle, const cc65_segmentinfo* info);
 /* Free a segment info record */
 
@@ -624,6 +717,19 @@ const cc65_symbolinfo* cc65_symbol_inrange (cc65_dbginfo handle,
 ** symbols are ignored and not returned.
 */
 
+unsigned cc65_symbol_inrange_buf (cc65_dbginfo handle,
+                                  cc65_addr start, cc65_addr end,
+                                  cc65_symboldata* buf, unsigned count);
+/* Like cc65_symbol_inrange, but store up to count labels in buf. Returns the
+** number of labels within the range.
+*/
+
+int cc65_next_symbol (cc65_dbginfo handle, unsigned* iter,
+                      cc65_symboldata* data);
+/* Iterate over all symbols without allocating memory. See the notes on
+** iterators above.
+*/
+
 void cc65_free_symbolinfo (cc65_dbginfo handle, const cc65_symbolinfo* info);
 /* Free a symbol info record */
 
@@ -57,12 +57,30 @@
 
 
 
+static void CmdBench (Collection* Args);
+/* Run benchmarks on the loaded debug info file */
+
+static void CmdBenchAddr (Collection* Args);
+/* Benchmark address lookups */
+
+static void CmdBenchHelp (Collection* Args);
+/* Print help for the bench command */
+
+static void CmdBenchIter (Collection* Args);
+/* Benchmark enumeration of all items */
+
+static void CmdBenchLine (Collection* Args);
+/* Benchmark source line lookups by address */
+
 static void CmdHelp (Collection* Args attribute ((unused)));
 /* Output a help text */
 
 static void CmdLoad (Collection* Args);
 /* Load a debug info file */
 
+static void CmdLoadCached (Collection* Args);
+/* Load a debug info file using the index cache */
+
 static void CmdQuit (Collection* Args attribute ((unused)));
 /* Terminate the application */
 
@@ -135,6 +153,9 @@ static cc65_dbginfo     Info = 0;
 static unsigned FileErrors   = 0;
 static unsigned FileWarnings = 0;
 
+/* Size of the result buffers used by the benchmarks */
+#define BENCH_BUFSIZE   16
+
 /* Type of an id */
 enum {
     InvalidId,
@@ -162,6 +183,11 @@ struct CmdEntry {
 /* Table with main commands */
 static const CmdEntry MainCmds[] = {
     {
+        "bench",
+        "Run benchmarks on the loaded file",
+        -2,
+        CmdBench
+    }, {
         "exit",
         0,
         1,
@@ -176,6 +202,11 @@ static const CmdEntry MainCmds[] = {
         "Load a debug info file",
         2,
         CmdLoad
+    }, {
+        "loadcached",
+        "Load a debug info file using the index cache",
+        2,
+        CmdLoadCached
     }, {
         "quit",
         "Terminate the shell",
@@ -194,6 +225,31 @@ static const CmdEntry MainCmds[] = {
     },
 };
 
+/* Table with bench commands */
+static const CmdEntry BenchCmds[] = {
+    {
+        "addr",
+        "Random address lookups. May be followed by the number of lookups.",
+        -1,
+        CmdBenchAddr
+    }, {
+        "help",
+        "Show available subcommands.",
+        1,
+        CmdBenchHelp
+    }, {
+        "iter",
+        "Enumerate spans and symbols. May be followed by the number of rounds.",
+        -1,
+        CmdBenchIter
+    }, {
+        "line",
+        "Source lines for random addresses. May be followed by the number of lookups.",
+        -1,
+        CmdBenchLine
+    },
+};
+
 /* Table with show commands */
 static const CmdEntry ShowCmds[] = {
     {
@@ -950,12 +1006,309 @@ static int FileIsLoaded (void)
 
 
 
+static unsigned long BenchCount (Collection* Args, unsigned long Count)
+/* Return the number of iterations for a benchmark from the optional argument
+** in Args, or Count if there is no argument. Prints a message and returns
+** zero if the argument is invalid.
+*/
+{
+    char C;
+    if (CollCount (Args) > 0 &&
+        (sscanf (CollConstAt (Args, 0), "%lu%c", &Count, &C) != 1 || Count == 0)) {
+        PrintLine ("Invalid count: %s", (const char*) CollConstAt (Args, 0));
+        return 0;
+    }
+    return Count;
+}
+
+
+
+static unsigned long BenchRandom (unsigned long* Seed)
+/* Return the next number from a simple linear congruential generator. We
+** don't use rand(), so the sequence doesn't depend on the C library.
+*/
+{
+    *Seed = (*Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return *Seed >> 8;
+}
+
+
+
+static int BenchAddrRange (cc65_addr* Lo, cc65_addr* Hi)
+/* Determine the range of addresses covered by the segments. Prints a message
+** and returns false if there are no segments.
+*/
+{
+    cc65_segmentdata D;
+    unsigned         Iter = 0;
+
+    if (!cc65_next_segment (Info, &Iter, &D)) {
+        PrintLine ("No segments");
+        return 0;
+    }
+    *Lo = D.segment_start;
+    *Hi = D.segment_start;
+    do {
+        if (D.segment_start < *Lo) {
+            *Lo = D.segment_start;
+        }
+        if (D.segment_size > 0 && D.segment_start + D.segment_size - 1 > *Hi) {
+            *Hi = D.segment_start + D.segment_size - 1;
+        }
+    } while (cc65_next_segment (Info, &Iter, &D));
+
+    PrintLine ("Address range $%06lX-$%06lX", (unsigned long) *Lo,
+               (unsigned long) *Hi);
+    return 1;
+}
+
+
+
+static void BenchResult (const char* Name, unsigned long Count, clock_t Ticks,
+                         unsigned long Found)
+/* Print the result of a benchmark */
+{
+    double Secs = (double) Ticks / CLOCKS_PER_SEC;
+    if (Secs <= 0.0) {
+        Secs = 1.0 / CLOCKS_PER_SEC;
+    }
+    PrintLine ("%-24s %10lu calls %8.3f s %12.0f calls/s %10lu items",
+               Name, Count, Secs, Count / Secs, Found);
+}
+
+
+
 /*****************************************************************************/
 /*                             Command handlers                              */
 /*****************************************************************************/
 
 
 
+static void CmdBench (Collection* Args)
+/* Run benchmarks on the loaded debug info file */
+{
+    /* Search for the subcommand, check number of args, then execute it */
+    ExecCmd (Args, BenchCmds, sizeof (BenchCmds) / sizeof (BenchCmds[0]));
+}
+
+
+
+static void CmdBenchAddr (Collection* Args)
+/* Benchmark address lookups */
+{
+    cc65_spandata   Spans[BENCH_BUFSIZE];
+    cc65_symboldata Syms[BENCH_BUFSIZE];
+    cc65_addr       Lo;
+    cc65_addr       Hi;
+    unsigned long   Range;
+    unsigned long   Count;
+    unsigned long   Found;
+    unsigned long   Seed;
+    unsigned long   I;
+    clock_t         Start;
+
+    /* Be sure a file is loaded and get the number of lookups */
+    if (!FileIsLoaded () || (Count = BenchCount (Args, 1000000UL)) == 0) {
+        return;
+    }
+
+    /* Use addresses within the segments */
+    if (!BenchAddrRange (&Lo, &Hi)) {
+        return;
+    }
+    Range = (unsigned long) Hi - Lo + 1;
+
+    /* Spans by address */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        const cc65_spaninfo* D;
+        D = cc65_span_byaddr (Info, Lo + BenchRandom (&Seed) % Range);
+        if (D) {
+            Found += D->count;
+            cc65_free_spaninfo (Info, D);
+        }
+    }
+    BenchResult ("cc65_span_byaddr", Count, clock () - Start, Found);
+
+    /* Same without allocating memory */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        Found += cc65_span_byaddr_buf (Info, Lo + BenchRandom (&Seed) % Range,
+                                       Spans, BENCH_BUFSIZE);
+    }
+    BenchResult ("cc65_span_byaddr_buf", Count, clock () - Start, Found);
+
+    /* Labels in a 16 byte window */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        const cc65_symbolinfo* D;
+        cc65_addr A = Lo + BenchRandom (&Seed) % Range;
+        D = cc65_symbol_inrange (Info, A, A + 15);
+        if (D) {
+            Found += D->count;
+            cc65_free_symbolinfo (Info, D);
+        }
+    }
+    BenchResult ("cc65_symbol_inrange", Count, clock () - Start, Found);
+
+    /* Same without allocating memory */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        cc65_addr A = Lo + BenchRandom (&Seed) % Range;
+        Found += cc65_symbol_inrange_buf (Info, A, A + 15, Syms, BENCH_BUFSIZE);
+    }
+    BenchResult ("cc65_symbol_inrange_buf", Count, clock () - Start, Found);
+}
+
+
+
+static void CmdBenchHelp (Collection* Args attribute ((unused)))
+/* Print help for the bench command */
+{
+    PrintHelp (BenchCmds, sizeof (BenchCmds) / sizeof (BenchCmds[0]));
+}
+
+
+
+static void CmdBenchIter (Collection* Args)
+/* Benchmark enumeration of all items */
+{
+    cc65_spandata   Span;
+    cc65_symboldata Sym;
+    unsigned        Iter;
+    unsigned long   Count;
+    unsigned long   Found;
+    unsigned long   I;
+    clock_t         Start;
+
+    /* Be sure a file is loaded and get the number of rounds */
+    if (!FileIsLoaded () || (Count = BenchCount (Args, 1000UL)) == 0) {
+        return;
+    }
+
+    /* All spans as one list */
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        const cc65_spaninfo* D = cc65_get_spanlist (Info);
+        Found += D->count;
+        cc65_free_spaninfo (Info, D);
+    }
+    BenchResult ("cc65_get_spanlist", Count, clock () - Start, Found);
+
+    /* All spans using an iterator */
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        Iter = 0;
+        while (cc65_next_span (Info, &Iter, &Span)) {
+            ++Found;
+        }
+    }
+    BenchResult ("cc65_next_span", Count, clock () - Start, Found);
+
+    /* All symbols by id. There is no list function for symbols. */
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        const cc65_symbolinfo* D;
+        Iter = 0;
+        while ((D = cc65_symbol_byid (Info, Iter++)) != 0) {
+            ++Found;
+            cc65_free_symbolinfo (Info, D);
+        }
+    }
+    BenchResult ("cc65_symbol_byid", Count, clock () - Start, Found);
+
+    /* All symbols using an iterator */
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        Iter = 0;
+        while (cc65_next_symbol (Info, &Iter, &Sym)) {
+            ++Found;
+        }
+    }
+    BenchResult ("cc65_next_symbol", Count, clock () - Start, Found);
+}
+
+
+
+static void CmdBenchLine (Collection* Args)
+/* Benchmark source line lookups by address. This is what a debugger or
+** profiler does for each executed instruction.
+*/
+{
+    cc65_spandata   Spans[BENCH_BUFSIZE];
+    cc65_linedata   Lines[BENCH_BUFSIZE];
+    cc65_addr       Lo;
+    cc65_addr       Hi;
+    unsigned long   Range;
+    unsigned long   Count;
+    unsigned long   Found;
+    unsigned long   Seed;
+    unsigned long   I;
+    unsigned        J;
+    unsigned        N;
+    clock_t         Start;
+
+    /* Be sure a file is loaded and get the number of lookups */
+    if (!FileIsLoaded () || (Count = BenchCount (Args, 1000000UL)) == 0) {
+        return;
+    }
+
+    /* Use addresses within the segments */
+    if (!BenchAddrRange (&Lo, &Hi)) {
+        return;
+    }
+    Range = (unsigned long) Hi - Lo + 1;
+
+    /* Lines for all spans covering an address */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        const cc65_spaninfo* S;
+        S = cc65_span_byaddr (Info, Lo + BenchRandom (&Seed) % Range);
+        if (S) {
+            for (J = 0; J < S->count; ++J) {
+                const cc65_lineinfo* L;
+                L = cc65_line_byspan (Info, S->data[J].span_id);
+                if (L) {
+                    Found += L->count;
+                    cc65_free_lineinfo (Info, L);
+                }
+            }
+            cc65_free_spaninfo (Info, S);
+        }
+    }
+    BenchResult ("cc65_line_byspan", Count, clock () - Start, Found);
+
+    /* Same without allocating memory */
+    Seed  = 1;
+    Found = 0;
+    Start = clock ();
+    for (I = 0; I < Count; ++I) {
+        N = cc65_span_byaddr_buf (Info, Lo + BenchRandom (&Seed) % Range,
+                                  Spans, BENCH_BUFSIZE);
+        for (J = 0; J < N && J < BENCH_BUFSIZE; ++J) {
+            Found += cc65_line_byspan_buf (Info, Spans[J].span_id,
+                                           Lines, BENCH_BUFSIZE);
+        }
+    }
+    BenchResult ("cc65_line_byspan_buf", Count, clock () - Start, Found);
+}
+
+
+
 static void CmdHelp (Collection* Args attribute ((unused)))
 /* Output a help text */
 {
@@ -989,6 +1342,31 @@ static void CmdLoad (Collection* Args)
 
 
 
+static void CmdLoadCached (Collection* Args)
+/* Load a debug info file using the index cache */
+{
+    /* Unload a loaded file */
+    UnloadFile ();
+
+    /* Clear the counters */
+    FileErrors   = 0;
+    FileWarnings = 0;
+
+    /* Open the debug info file */
+    Info = cc65_read_dbginfo_cached (CollAt (Args, 0), FileError);
+
+    /* Print a status */
+    if (FileErrors > 0) {
+        PrintLine ("File loaded with %u errors", FileErrors);
+    } else if (FileWarnings > 0) {
+        PrintLine ("File loaded with %u warnings", FileWarnings);
+    } else {
+        PrintLine ("File loaded successfully");
+    }
+}
+
+
+
 static void CmdQuit (Collection* Args attribute ((unused)))
 /* Terminate the application */
 {
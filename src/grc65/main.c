@@ -24,14 +24,16 @@
 /* common stuff */
 #include "abend.h"
 #include "cmdline.h"
+#include "exprdefs.h"
 #include "fname.h"
 #include "chartype.h"
 #include "target.h"
 #include "version.h"
 #include "xmalloc.h"
+#include "xsprintf.h"
 
-/* I hope that no one will be able to create a .grc bigger than this... */
-#define BLOODY_BIG_BUFFER 65000
+/* grc65 */
+#include "objfile.h"
 
 
 
@@ -102,11 +104,9 @@ const unsigned char icon1[] = {255, 255, 255, 128,   0,   1, 128,   0,   1,
 
 const char *outputCName = NULL;
 const char *outputSName = NULL;
-FILE *outputCFile, *outputSFile;
-int CFnum = 0, SFnum = 0;
+FILE *outputCFile = NULL, *outputSFile = NULL;
 int apple = 0;
-char outputCMode[2] = "w";
-char outputSMode[2] = "w";
+int objOutput = 0;
 
 
 static void Usage (void)
@@ -117,11 +117,12 @@ static void Usage (void)
         "  -V\t\t\tPrint the version number\n"
         "  -h\t\t\tHelp (this text)\n"
         "  -o name\t\tName the C output file\n"
-        "  -s name\t\tName the asm output file\n"
+        "  -s name\t\tName the asm or object output file\n"
         "  -t sys\t\tSet the target system\n"
         "\n"
         "Long options:\n"
         "  --help\t\tHelp (this text)\n"
+        "  --object\t\tWrite an object file instead of asm source\n"
         "  --target sys\t\tSet the target system\n"
         "  --version\t\tPrint the version number\n",
         ProgName);
@@ -137,6 +138,14 @@ static void OptHelp (const char* Opt attribute ((unused)),
 }
 
 
+static void OptObject (const char* Opt attribute ((unused)),
+                       const char* Arg attribute ((unused)))
+/* Write an object file instead of assembler source */
+{
+    objOutput = 1;
+}
+
+
 static void OptTarget (const char* Opt attribute ((unused)), const char* Arg)
 /* Set the target system */
 {
@@ -200,28 +209,42 @@ static void printSHeader (void)
 
 static void openCFile (void)
 {
-    if ((outputCFile = fopen (outputCName,outputCMode)) == 0) {
-        AbEnd ("Can't open file %s for writing: %s", outputCName, strerror (errno));
+    /* the file stays open until all input files are processed */
+    if (outputCFile != NULL) {
+        return;
     }
 
-    if (CFnum == 0) {
-        outputCMode[0] = 'a';
-        printCHeader ();
-        CFnum++;
+    if ((outputCFile = fopen (outputCName, "w")) == 0) {
+        AbEnd ("Can't open file %s for writing: %s", outputCName, strerror (errno));
     }
+
+    printCHeader ();
 }
 
 
 static void openSFile (void)
 {
-    if ((outputSFile = fopen (outputSName, outputSMode)) == 0) {
+    /* the file stays open until all input files are processed */
+    if (outputSFile != NULL) {
+        return;
+    }
+
+    if ((outputSFile = fopen (outputSName, "w")) == 0) {
         AbEnd ("Can't open file %s for writing: %s", outputSName, strerror (errno));
     }
 
-    if (SFnum == 0) {
-        outputSMode[0] = 'a';
-        printSHeader ();
-        SFnum++;
+    printSHeader ();
+}
+
+
+static void closeFiles (void)
+{
+    if (outputCFile != NULL && fclose (outputCFile) != 0) {
+        AbEnd ("Error closing %s: %s", outputCName, strerror (errno));
+    }
+
+    if (outputSFile != NULL && fclose (outputSFile) != 0) {
+        AbEnd ("Error closing %s: %s", outputSName, strerror (errno));
     }
 }
 
@@ -261,16 +284,25 @@ static void setLen (char *name, unsigned len)
 }
 
 
-static void fillOut (char *name, int len, char *filler)
+static void fillOut (char *name, int len, unsigned char filler)
 {
     int a;
 
     setLen (name, len);
+    a = strlen (name);
+
+    if (objOutput) {
+        ObjEmitData (name, a);
+        for (; a < len; a++) {
+            ObjEmitByte (filler);
+        }
+        return;
+    }
+
     fprintf (outputSFile, "\t.byte \"%s\"\n", name);
 
-    a = strlen (name);
     if (a < len) {
-        fprintf (outputSFile, "\t.res  (%i - %i), %s\n", len, a, filler);
+        fprintf (outputSFile, "\t.res  (%i - %i), $%02x\n", len, a, filler);
     }
 }
 
@@ -334,7 +366,7 @@ static void DoMenu (void)
                 strcat (namebuff, " ");
                 strcat (namebuff, token);
             } while (token[strlen (token) - 1] != '"');
-            token = xmalloc (strlen (namebuff));
+            token = xmalloc (strlen (namebuff) + 1);
             strcpy (token, namebuff);
         }
         curItem->name = token;
@@ -408,10 +440,132 @@ static void DoMenu (void)
 
     fprintf (outputCFile,
         "};\n\n");
+}
 
-    if (fclose (outputCFile) != 0) {
-        AbEnd ("Error closing %s: %s", outputCName, strerror (errno));
+
+static void readIcon (const char *name, unsigned char icon[63])
+{
+    /* loads the icon bitmap from the first 63 bytes of a file */
+    FILE *F;
+
+    if ((F = fopen (name, "rb")) == 0) {
+        AbEnd ("Can't open file %s for reading: %s", name, strerror (errno));
+    }
+    if (fread (icon, 1, 63, F) != 63) {
+        AbEnd ("Icon file %s is too short", name);
+    }
+    fclose (F);
+}
+
+
+static ObjExpr *vlirSize (int number)
+{
+    /* returns the size of a VLIR record without the BSS, as an expression */
+    char start[32], last[32];
+    ObjExpr *size;
+
+    xsprintf (start, sizeof (start), "__VLIR%i_START__", number);
+    xsprintf (last, sizeof (last), "__VLIR%i_LAST__", number);
+
+    size = ObjBinaryExpr (EXPR_MINUS, ObjSymbolExpr (last), ObjSymbolExpr (start));
+    if (number == 0) {
+        size = ObjBinaryExpr (EXPR_MINUS, size, ObjSymbolExpr ("__BSS_SIZE__"));
+    }
+
+    return size;
+}
+
+
+static void flushHeaderObj (struct appheader *h)
+{
+    /* writes the header into the object file, the same as DoHeader's asm source */
+    unsigned char icon[63];
+    long date, daytime;
+    int a;
+
+    ObjUseSeg ("DIRENTRY");
+
+    if (apple == 1) {
+
+        date = (long) h->year << 9 | (long) h->month << 5 | h->day;
+        daytime = (long) h->hour << 8 | h->min;
+
+        ObjEmitByte ((long) (h->structure + 2) << 4 | (long) strlen (h->dosname));
+        fillOut (h->dosname, 15, 0);
+        ObjEmitByte (h->geostype);
+        ObjEmitWord (0);
+        ObjEmitWord (0);
+        if (h->structure == 0) {
+            ObjEmitExpr (2, vlirSize (0));
+        } else {
+            ObjEmitWord (0);
+        }
+        ObjEmitByte (0);
+        ObjEmitWord (date);
+        ObjEmitWord (daytime);
+        ObjEmitByte (0);
+        ObjEmitByte (0);
+        ObjEmitByte (0);
+        ObjEmitWord (0);
+        ObjEmitWord (date);
+        ObjEmitWord (daytime);
+        ObjEmitWord (0);
+
+    } else {
+
+        ObjEmitByte (h->dostype);
+        ObjEmitWord (0);
+        fillOut (h->dosname, 16, 0xa0);
+        ObjEmitWord (0);
+        ObjEmitByte (h->structure);
+        ObjEmitByte (h->geostype);
+        ObjEmitByte (h->year);
+        ObjEmitByte (h->month);
+        ObjEmitByte (h->day);
+        ObjEmitByte (h->hour);
+        ObjEmitByte (h->min);
+        ObjEmitWord (0);
+        ObjEmitData ("PRG formatted GEOS file V1.0", 28);
     }
+
+    ObjUseSeg ("FILEINFO");
+
+    ObjEmitByte (3);
+    ObjEmitByte (21);
+    ObjEmitByte (63 | 0x80);
+
+    if (h->icon != NULL) {
+        readIcon (h->icon, icon);
+        ObjEmitData (icon, sizeof (icon));
+    } else {
+        ObjEmitData (icon1, sizeof (icon1));
+    }
+
+    ObjEmitByte (h->dostype);
+    ObjEmitByte (h->geostype);
+    ObjEmitByte (h->structure);
+    ObjEmitExpr (2, ObjSymbolExpr ("__VLIR0_START__"));
+    ObjEmitExpr (2, ObjBinaryExpr (EXPR_MINUS, ObjSymbolExpr ("__VLIR0_START__"), ObjLiteralExpr (1)));
+    ObjEmitExpr (2, ObjSymbolExpr ("__STARTUP_RUN__"));
+
+    fillOut (h->classname, 12, 0x20);
+
+    fillOut (h->version, 4, 0);
+
+    ObjEmitByte (0);
+    ObjEmitByte (0);
+    ObjEmitByte (0);
+    ObjEmitByte (h->mode);
+
+    setLen (h->author, 62);
+    a = strlen (h->author);
+    ObjEmitData (h->author, a);
+    ObjEmitByte (0);
+    ObjEmitFill (63 - (a + 1));
+
+    setLen (h->info, 95);
+    ObjEmitData (h->info, strlen (h->info));
+    ObjEmitByte (0);
 }
 
 
@@ -425,7 +579,9 @@ static void DoHeader (void)
     char i1[9], i2[9], i3[9];
     int i;
 
-    openSFile ();
+    if (objOutput == 0) {
+        openSFile ();
+    }
 
     token = nextWord ();
 
@@ -557,6 +713,11 @@ static void DoHeader (void)
 
     /* OK, all information is gathered, do flushout */
 
+    if (objOutput) {
+        flushHeaderObj (&myHead);
+        return;
+    }
+
     fprintf (outputSFile,
         "\t\t.segment \"DIRENTRY\"\n\n");
 
@@ -570,7 +731,7 @@ static void DoHeader (void)
             "\t.byte %i << 4 | %u\n",
             myHead.structure + 2, (unsigned)strlen (myHead.dosname));
 
-        fillOut (myHead.dosname, 15, "0");
+        fillOut (myHead.dosname, 15, 0);
 
         fprintf (outputSFile,
             "\t.byte $%02x\n"
@@ -598,7 +759,7 @@ static void DoHeader (void)
             "\t.word 0\n",
             myHead.dostype);
 
-        fillOut (myHead.dosname, 16, "$a0");
+        fillOut (myHead.dosname, 16, 0xa0);
 
         fprintf (outputSFile,
             "\t.word 0\n"
@@ -633,9 +794,9 @@ static void DoHeader (void)
         "\t.word __VLIR0_START__, __VLIR0_START__ - 1, __STARTUP_RUN__\n\n",
         myHead.dostype, myHead.geostype, myHead.structure);
 
-    fillOut (myHead.classname, 12, "$20");
+    fillOut (myHead.classname, 12, 0x20);
 
-    fillOut (myHead.version, 4, "0");
+    fillOut (myHead.version, 4, 0);
 
     fprintf (outputSFile,
         "\t.byte 0, 0, 0\n"
@@ -654,9 +815,135 @@ static void DoHeader (void)
         "\t.byte \"%s\"\n"
         "\t.byte 0\n\n",
         myHead.info);
+}
 
-    if (fclose (outputSFile) != 0) {
-        AbEnd ("Error closing %s: %s", outputSName, strerror (errno));
+
+static void flushRecordsAsm (const int *overlaytable, int lastnumber)
+{
+    /* writes the VLIR record table as asm source */
+    int number;
+
+    fprintf (outputSFile,
+        "\t\t.segment \"RECORDS\"\n\n");
+
+    if (apple == 1) {
+
+        for (number = 0; number <= lastnumber; number++) {
+            fprintf (outputSFile,
+                "\t.byte %s\n",
+                overlaytable[number] == 1 ? "$00" : "$FF");
+        }
+        fprintf (outputSFile,
+            "\n");
+
+        for (number = 0; number <= lastnumber; number++) {
+            if (overlaytable[number] == 1) {
+                fprintf (outputSFile,
+                    "\t\t.segment \"VLIRIDX%i\"\n\n"
+                    "\t.import __VLIR%i_START__, __VLIR%i_LAST__%s\n\n"
+                    "\t.res  255\n"
+                    "\t.byte .lobyte (__VLIR%i_LAST__ - __VLIR%i_START__%s)\n"
+                    "\t.res  255\n"
+                    "\t.byte .hibyte (__VLIR%i_LAST__ - __VLIR%i_START__%s)\n\n",
+                    number, number, number,
+                    number == 0 ? ", __BSS_SIZE__" : "",
+                    number, number,
+                    number == 0 ? " - __BSS_SIZE__" : "",
+                    number, number,
+                    number == 0 ? " - __BSS_SIZE__" : "");
+            }
+        }
+
+    } else {
+
+        for (number = 0; number <= lastnumber; number++) {
+            if (overlaytable[number] == 1) {
+                fprintf (outputSFile,
+                    "\t.import __VLIR%i_START__, __VLIR%i_LAST__%s\n",
+                    number, number, number == 0 ? ", __BSS_SIZE__" : "");
+            }
+        }
+        fprintf (outputSFile,
+            "\n");
+
+        for (number = 0; number <= lastnumber; number++) {
+            if (overlaytable[number] == 1) {
+                fprintf (outputSFile,
+                    "\t.byte .lobyte ((__VLIR%i_LAST__ - __VLIR%i_START__%s - 1) /    254) + 1\n"
+                    "\t.byte .lobyte ((__VLIR%i_LAST__ - __VLIR%i_START__%s - 1) .MOD 254) + 2\n",
+                    number, number, number == 0 ? " - __BSS_SIZE__" : "",
+                    number, number, number == 0 ? " - __BSS_SIZE__" : "");
+            } else {
+                fprintf (outputSFile,
+                    "\t.byte $00\n"
+                    "\t.byte $FF\n");
+            }
+        }
+        fprintf (outputSFile,
+            "\n");
+    }
+}
+
+
+static void flushRecordsObj (const int *overlaytable, int lastnumber)
+{
+    /* writes the VLIR record table into the object file */
+    char segname[16];
+    int number;
+
+    ObjUseSeg ("RECORDS");
+
+    if (apple == 1) {
+
+        for (number = 0; number <= lastnumber; number++) {
+            ObjEmitByte (overlaytable[number] == 1 ? 0x00 : 0xFF);
+        }
+
+        for (number = 0; number <= lastnumber; number++) {
+            if (overlaytable[number] == 1) {
+                xsprintf (segname, sizeof (segname), "VLIRIDX%i", number);
+                ObjUseSeg (segname);
+                ObjEmitFill (255);
+                ObjEmitExpr (1, ObjUnaryExpr (EXPR_BYTE0, vlirSize (number)));
+                ObjEmitFill (255);
+                ObjEmitExpr (1, ObjUnaryExpr (EXPR_BYTE1, vlirSize (number)));
+            }
+        }
+
+    } else {
+
+        for (number = 0; number <= lastnumber; number++) {
+            if (overlaytable[number] == 1) {
+                ObjEmitExpr (1, ObjBinaryExpr (EXPR_PLUS,
+                    ObjUnaryExpr (EXPR_BYTE0,
+                        ObjBinaryExpr (EXPR_DIV,
+                            ObjBinaryExpr (EXPR_MINUS, vlirSize (number), ObjLiteralExpr (1)),
+                            ObjLiteralExpr (254))),
+                    ObjLiteralExpr (1)));
+                ObjEmitExpr (1, ObjBinaryExpr (EXPR_PLUS,
+                    ObjUnaryExpr (EXPR_BYTE0,
+                        ObjBinaryExpr (EXPR_MOD,
+                            ObjBinaryExpr (EXPR_MINUS, vlirSize (number), ObjLiteralExpr (1)),
+                            ObjLiteralExpr (254))),
+                    ObjLiteralExpr (2)));
+            } else {
+                ObjEmitByte (0x00);
+                ObjEmitByte (0xFF);
+            }
+        }
+    }
+}
+
+
+static void exportConst (const char *name, int value)
+{
+    /* exports a constant from the asm source or the object file */
+    if (objOutput) {
+        ObjExportConst (name, (unsigned) value);
+    } else {
+        fprintf (outputSFile,
+            "\t.export %s : absolute = $%04x\n\n",
+            name, value);
     }
 }
 
@@ -669,7 +956,9 @@ static void DoMemory (void)
     int number, lastnumber;
     int backbuffer;
 
-    openSFile ();
+    if (objOutput == 0) {
+        openSFile ();
+    }
 
     stacksize = -1;
     overlaysize = -1;
@@ -748,64 +1037,10 @@ static void DoMemory (void)
     /* OK, all information is gathered, do flushout */
 
     if (lastnumber != -1) {
-        fprintf (outputSFile,
-            "\t\t.segment \"RECORDS\"\n\n");
-
-        if (apple == 1) {
-
-            for (number = 0; number <= lastnumber; number++) {
-                fprintf (outputSFile,
-                    "\t.byte %s\n",
-                    overlaytable[number] == 1 ? "$00" : "$FF");
-            }
-            fprintf (outputSFile,
-                "\n");
-
-            for (number = 0; number <= lastnumber; number++) {
-                if (overlaytable[number] == 1) {
-                    fprintf (outputSFile,
-                        "\t\t.segment \"VLIRIDX%i\"\n\n"
-                        "\t.import __VLIR%i_START__, __VLIR%i_LAST__%s\n\n"
-                        "\t.res  255\n"
-                        "\t.byte .lobyte (__VLIR%i_LAST__ - __VLIR%i_START__%s)\n"
-                        "\t.res  255\n"
-                        "\t.byte .hibyte (__VLIR%i_LAST__ - __VLIR%i_START__%s)\n\n",
-                        number, number, number,
-                        number == 0 ? ", __BSS_SIZE__" : "",
-                        number, number,
-                        number == 0 ? " - __BSS_SIZE__" : "",
-                        number, number,
-                        number == 0 ? " - __BSS_SIZE__" : "");
-                }
-            }
-
+        if (objOutput) {
+            flushRecordsObj (overlaytable, lastnumber);
         } else {
-
-            for (number = 0; number <= lastnumber; number++) {
-                if (overlaytable[number] == 1) {
-                    fprintf (outputSFile,
-                        "\t.import __VLIR%i_START__, __VLIR%i_LAST__%s\n",
-                        number, number, number == 0 ? ", __BSS_SIZE__" : "");
-                }
-            }
-            fprintf (outputSFile,
-                "\n");
-
-            for (number = 0; number <= lastnumber; number++) {
-                if (overlaytable[number] == 1) {
-                    fprintf (outputSFile,
-                        "\t.byte .lobyte ((__VLIR%i_LAST__ - __VLIR%i_START__%s - 1) /    254) + 1\n"
-                        "\t.byte .lobyte ((__VLIR%i_LAST__ - __VLIR%i_START__%s - 1) .MOD 254) + 2\n",
-                        number, number, number == 0 ? " - __BSS_SIZE__" : "",
-                        number, number, number == 0 ? " - __BSS_SIZE__" : "");
-                } else {
-                    fprintf (outputSFile,
-                        "\t.byte $00\n"
-                        "\t.byte $FF\n");
-                }
-            }
-            fprintf (outputSFile,
-                "\n");
+            flushRecordsAsm (overlaytable, lastnumber);
         }
 
         openCFile ();
@@ -815,43 +1050,52 @@ static void DoMemory (void)
             "extern void _OVERLAYSIZE__[];\n\n"
             "#define OVERLAY_ADDR (char*)   _OVERLAYADDR__\n"
             "#define OVERLAY_SIZE (unsigned)_OVERLAYSIZE__\n\n");
-
-        if (fclose (outputCFile) != 0) {
-            AbEnd ("Error closing %s: %s", outputCName, strerror (errno));
-        }
     }
 
     if (stacksize != -1) {
-        fprintf (outputSFile,
-            "\t.export __STACKSIZE__ : absolute = $%04x\n\n",
-            stacksize);
+        exportConst ("__STACKSIZE__", stacksize);
     }
 
     if (overlaysize != -1) {
-        fprintf (outputSFile,
-            "\t.export __OVERLAYSIZE__ : absolute = $%04x\n\n",
-            overlaysize);
+        exportConst ("__OVERLAYSIZE__", overlaysize);
     }
 
     if (backbuffer != -1) {
-        fprintf (outputSFile,
-            "\t.export __BACKBUFSIZE__ : absolute = $%04x\n\n",
-            backbuffer ? 0x2000 : 0x0000);
+        exportConst ("__BACKBUFSIZE__", backbuffer ? 0x2000 : 0x0000);
     }
+}
 
-    if (fclose (outputSFile) != 0) {
-        AbEnd ("Error closing %s: %s", outputSName, strerror (errno));
+
+static char *readInput (FILE *F, const char *filename)
+{
+    /* loads the whole file into a buffer with one read per 16K block */
+    size_t size = 0, max = 0x4000, n;
+    char *tbl = xmalloc (max + 1);
+
+    while ((n = fread (tbl + size, 1, max - size, F)) > 0) {
+        size += n;
+        if (size == max) {
+            max *= 2;
+            tbl = xrealloc (tbl, max + 1);
+        }
+    }
+    if (ferror (F)) {
+        AbEnd ("Error reading %s: %s", filename, strerror (errno));
     }
+    tbl[size] = '\0';
+
+    return tbl;
 }
 
 
-static char *filterInput (FILE *F, char *tbl)
+static char *filterInput (char *tbl)
 {
-    /* loads file into buffer filtering it out */
-    int a, prevchar = -1, i = 0, bracket = 0, quote = 1;
+    /* filters the buffer in place: drops comments, turns line ends and commas
+       outside of strings into spaces and squeezes spaces */
+    char *in = tbl, *out = tbl;
+    int a, prevchar = -1, bracket = 0, quote = 1;
 
-    for (;;) {
-        a = getc(F);
+    while ((a = (unsigned char) *in++) != '\0') {
         if ((a == '\n') || (a == '\015')) a = ' ';
         if (a == ',' && quote) a = ' ';
         if (a == '\042') quote =! quote;
@@ -859,28 +1103,23 @@ static char *filterInput (FILE *F, char *tbl)
             if ((a == '{') || (a == '(')) bracket++;
             if ((a == '}') || (a == ')')) bracket--;
         }
-        if (a == EOF) {
-            tbl[i] = '\0';
-            xrealloc (tbl, i + 1);
-            break;
-        }
         if (IsSpace (a)) {
             if ((prevchar != ' ') && (prevchar != -1)) {
-                tbl[i++] = ' ';
+                *out++ = ' ';
                 prevchar = ' ';
             }
         } else {
             if (a == ';' && quote) {
-                do {
-                    a = getc (F);
-                } while (a != '\n');
-                fseek (F, -1, SEEK_CUR);
+                while ((*in != '\0') && (*in != '\n')) {
+                    in++;
+                }
             } else {
-                tbl[i++] = a;
+                *out++ = a;
                 prevchar = a;
             }
         }
     }
+    *out = '\0';
 
     if (bracket != 0) AbEnd ("There are unclosed brackets!");
 
@@ -898,11 +1137,16 @@ static void processFile (const char *filename)
     int head = 0;   /* number of processed HEADER sections */
     int memory = 0; /* number of processed MEMORY sections */
 
-    if ((F = fopen (filename, "r")) == 0) {
+    if ((F = fopen (filename, "rb")) == 0) {
         AbEnd ("Can't open file %s for reading: %s", filename, strerror (errno));
     }
 
-    str = filterInput (F, xmalloc (BLOODY_BIG_BUFFER));
+    str = filterInput (readInput (F, filename));
+    fclose (F);
+
+    if (objOutput) {
+        ObjAddFile (filename);
+    }
 
     token = strtok (str, " ");
 
@@ -935,6 +1179,8 @@ static void processFile (const char *filename)
         }
         token = nextWord ();
     } while (token != NULL);
+
+    xfree (str);
 }
 
 
@@ -943,16 +1189,21 @@ int main (int argc, char *argv[])
     /* Program long options */
     static const LongOpt OptTab[] = {
         { "--help",    0, OptHelp},
+        { "--object",  0, OptObject},
         { "--target",  1, OptTarget},
         { "--version", 0, OptVersion},
     };
 
+    const char **files;
     unsigned ffile = 0;
     unsigned I;
 
     /* Initialize the cmdline module */
     InitCmdLine (&argc, &argv, "grc65");
 
+    /* The input files are processed after all options are known */
+    files = xmalloc (ArgCount * sizeof (files[0]));
+
     /* Check the parameters */
     I = 1;
     while (I < ArgCount) {
@@ -994,12 +1245,7 @@ int main (int argc, char *argv[])
             }
 
         } else {
-            ffile++;
-
-            if (outputCName == NULL) outputCName = MakeFilename (Arg, ".h");
-            if (outputSName == NULL) outputSName = MakeFilename (Arg, ".s");
-
-            processFile (Arg);
+            files[ffile++] = Arg;
         }
 
         /* Next argument */
@@ -1008,5 +1254,18 @@ int main (int argc, char *argv[])
 
     if (ffile == 0) AbEnd ("No input file");
 
+    if (outputCName == NULL) outputCName = MakeFilename (files[0], ".h");
+    if (outputSName == NULL) outputSName = MakeFilename (files[0], objOutput ? ".o" : ".s");
+
+    for (I = 0; I < ffile; I++) {
+        processFile (files[I]);
+    }
+
+    closeFiles ();
+
+    if (objOutput) {
+        WriteObjFile (outputSName);
+    }
+
     return EXIT_SUCCESS;
 }
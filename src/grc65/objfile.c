@@ -0,0 +1,563 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objfile.c                                 */
+/*                                                                           */
+/*             Object file output for the GEOS resource compiler             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+/* common */
+#include "abend.h"
+#include "addrsize.h"
+#include "check.h"
+#include "coll.h"
+#include "exprdefs.h"
+#include "filestat.h"
+#include "fragdefs.h"
+#include "lidefs.h"
+#include "objdefs.h"
+#include "objwrite.h"
+#include "optdefs.h"
+#include "strbuf.h"
+#include "strpool.h"
+#include "symdefs.h"
+#include "version.h"
+#include "xmalloc.h"
+#include "xsprintf.h"
+
+/* grc65 */
+#include "objfile.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An expression node */
+struct ObjExpr {
+    unsigned char   Op;             /* Operator */
+    long            Val;            /* Value of a literal */
+    unsigned        ImportId;       /* Import id of a symbol */
+    ObjExpr*        Left;           /* Left operand */
+    ObjExpr*        Right;          /* Right operand */
+};
+
+/* An input file. Each input file has one line info with the same id as the
+** file, which is used for everything generated from it.
+*/
+typedef struct InputFile InputFile;
+struct InputFile {
+    char*           Name;           /* Name of the file */
+    unsigned long   MTime;          /* Time of last modification */
+    unsigned long   Size;           /* Size of the file */
+};
+
+/* A segment with its fragments. Literal data is collected until something
+** else is emitted, so that it goes into as few fragments as possible.
+*/
+typedef struct Segment Segment;
+struct Segment {
+    char*           Name;           /* Name of the segment */
+    unsigned long   Size;           /* Size of the data */
+    unsigned        FragCount;      /* Number of fragments */
+    StrBuf          Frags;          /* Fragments written so far */
+    StrBuf          Lit;            /* Pending literal data */
+    unsigned        LitLineInfo;    /* Line info of the pending data */
+};
+
+/* An imported or exported symbol */
+typedef struct Symbol Symbol;
+struct Symbol {
+    char*           Name;           /* Name of the symbol */
+    unsigned long   Val;            /* Value of an export */
+    unsigned        LineInfo;       /* Line info of the definition */
+};
+
+/* Everything emitted so far */
+static Collection Files    = STATIC_COLLECTION_INITIALIZER;
+static Collection Segments = STATIC_COLLECTION_INITIALIZER;
+static Collection Imports  = STATIC_COLLECTION_INITIALIZER;
+static Collection Exports  = STATIC_COLLECTION_INITIALIZER;
+
+/* The segment in use */
+static Segment* CurSeg = 0;
+
+
+
+/*****************************************************************************/
+/*                                  Helpers                                  */
+/*****************************************************************************/
+
+
+
+static unsigned CurLineInfo (void)
+/* Return the line info id for data emitted now */
+{
+    PRECONDITION (CollCount (&Files) > 0);
+    return CollCount (&Files) - 1;
+}
+
+
+
+static void PutLineInfo (StrBuf* B, unsigned Id)
+/* Append a line info list containing just the given line info */
+{
+    ObjPutVar (B, 1);
+    ObjPutVar (B, Id);
+}
+
+
+
+static unsigned long ObjPos (const StrBuf* Obj)
+/* Return the current position in the object file */
+{
+    return OBJ_HDR_SIZE + SB_GetLen (Obj);
+}
+
+
+
+static Symbol* NewSymbol (const char* Name, unsigned long Val)
+/* Create a new symbol defined in the current input file */
+{
+    Symbol* S   = xmalloc (sizeof (Symbol));
+    S->Name     = xstrdup (Name);
+    S->Val      = Val;
+    S->LineInfo = CurLineInfo ();
+    return S;
+}
+
+
+
+static void FlushLiteral (Segment* S)
+/* Write the pending literal data of a segment as fragment */
+{
+    if (SB_GetLen (&S->Lit) > 0) {
+        ObjPut8 (&S->Frags, FRAG_LITERAL);
+        ObjPutVar (&S->Frags, SB_GetLen (&S->Lit));
+        SB_Append (&S->Frags, &S->Lit);
+        PutLineInfo (&S->Frags, S->LitLineInfo);
+        ++S->FragCount;
+        SB_Clear (&S->Lit);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                Expressions                                */
+/*****************************************************************************/
+
+
+
+static ObjExpr* NewExpr (unsigned char Op)
+/* Create a new expression node */
+{
+    ObjExpr* E  = xmalloc (sizeof (ObjExpr));
+    E->Op       = Op;
+    E->Val      = 0;
+    E->ImportId = 0;
+    E->Left     = 0;
+    E->Right    = 0;
+    return E;
+}
+
+
+
+static void FreeExpr (ObjExpr* E)
+/* Free an expression tree */
+{
+    if (E) {
+        FreeExpr (E->Left);
+        FreeExpr (E->Right);
+        xfree (E);
+    }
+}
+
+
+
+static void PutExpr (StrBuf* B, const ObjExpr* E)
+/* Append an expression tree in object file format */
+{
+    if (E == 0) {
+        ObjPut8 (B, EXPR_NULL);
+        return;
+    }
+    ObjPut8 (B, E->Op);
+    switch (E->Op) {
+
+        case EXPR_LITERAL:
+            ObjPut32 (B, (unsigned long) E->Val);
+            break;
+
+        case EXPR_SYMBOL:
+            ObjPutVar (B, E->ImportId);
+            break;
+
+        default:
+            PutExpr (B, E->Left);
+            PutExpr (B, E->Right);
+            break;
+    }
+}
+
+
+
+ObjExpr* ObjLiteralExpr (long Val)
+/* Return an expression for a constant value */
+{
+    ObjExpr* E = NewExpr (EXPR_LITERAL);
+    E->Val = Val;
+    return E;
+}
+
+
+
+ObjExpr* ObjSymbolExpr (const char* Name)
+/* Return an expression for a symbol. The symbol is imported */
+{
+    ObjExpr* E = NewExpr (EXPR_SYMBOL);
+    unsigned I;
+
+    /* Search for an existing import */
+    for (I = 0; I < CollCount (&Imports); ++I) {
+        const Symbol* S = CollConstAt (&Imports, I);
+        if (strcmp (S->Name, Name) == 0) {
+            break;
+        }
+    }
+    if (I == CollCount (&Imports)) {
+        CollAppend (&Imports, NewSymbol (Name, 0));
+    }
+    E->ImportId = I;
+    return E;
+}
+
+
+
+ObjExpr* ObjUnaryExpr (unsigned char Op, ObjExpr* Expr)
+/* Return an expression for a unary operator applied to Expr */
+{
+    ObjExpr* E = NewExpr (Op);
+    E->Left = Expr;
+    return E;
+}
+
+
+
+ObjExpr* ObjBinaryExpr (unsigned char Op, ObjExpr* Left, ObjExpr* Right)
+/* Return an expression for a binary operator */
+{
+    ObjExpr* E = NewExpr (Op);
+    E->Left  = Left;
+    E->Right = Right;
+    return E;
+}
+
+
+
+/*****************************************************************************/
+/*                                Data output                                */
+/*****************************************************************************/
+
+
+
+void ObjAddFile (const char* Name)
+/* Add an input file. All data emitted afterwards is attributed to it */
+{
+    struct stat StatBuf;
+    InputFile*  F;
+
+    if (FileStat (Name, &StatBuf) != 0) {
+        AbEnd ("Cannot stat input file `%s': %s", Name, strerror (errno));
+    }
+
+    F = xmalloc (sizeof (InputFile));
+    F->Name  = xstrdup (Name);
+    F->MTime = (unsigned long) StatBuf.st_mtime;
+    F->Size  = (unsigned long) StatBuf.st_size;
+    CollAppend (&Files, F);
+}
+
+
+
+void ObjUseSeg (const char* Name)
+/* Switch to the segment with the given name, creating it if needed */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&Segments); ++I) {
+        Segment* S = CollAt (&Segments, I);
+        if (strcmp (S->Name, Name) == 0) {
+            CurSeg = S;
+            return;
+        }
+    }
+
+    CurSeg = xmalloc (sizeof (Segment));
+    CurSeg->Name        = xstrdup (Name);
+    CurSeg->Size        = 0;
+    CurSeg->FragCount   = 0;
+    SB_Init (&CurSeg->Frags);
+    SB_Init (&CurSeg->Lit);
+    CurSeg->LitLineInfo = 0;
+    CollAppend (&Segments, CurSeg);
+}
+
+
+
+void ObjEmitData (const void* Data, unsigned long Size)
+/* Emit literal data into the current segment */
+{
+    unsigned LineInfo = CurLineInfo ();
+
+    PRECONDITION (CurSeg != 0);
+
+    if (CurSeg->LitLineInfo != LineInfo) {
+        FlushLiteral (CurSeg);
+        CurSeg->LitLineInfo = LineInfo;
+    }
+    SB_AppendBuf (&CurSeg->Lit, Data, Size);
+    CurSeg->Size += Size;
+}
+
+
+
+void ObjEmitByte (long Val)
+/* Emit a constant byte into the current segment */
+{
+    unsigned char Buf[1];
+
+    if ((Val & ~0xFFL) != 0) {
+        AbEnd ("Range error (%ld not in [0..255])", Val);
+    }
+    Buf[0] = (unsigned char) Val;
+    ObjEmitData (Buf, sizeof (Buf));
+}
+
+
+
+void ObjEmitWord (long Val)
+/* Emit a constant word into the current segment */
+{
+    unsigned char Buf[2];
+
+    if ((Val & ~0xFFFFL) != 0) {
+        AbEnd ("Range error (%ld not in [0..65535])", Val);
+    }
+    Buf[0] = (unsigned char) Val;
+    Buf[1] = (unsigned char) (Val >> 8);
+    ObjEmitData (Buf, sizeof (Buf));
+}
+
+
+
+void ObjEmitExpr (unsigned Size, ObjExpr* Expr)
+/* Emit an expression with the given size in bytes into the current segment.
+** The expression is freed.
+*/
+{
+    PRECONDITION (CurSeg != 0 && Size >= 1 && Size <= 4);
+
+    FlushLiteral (CurSeg);
+    ObjPut8 (&CurSeg->Frags, FRAG_EXPR | Size);
+    PutExpr (&CurSeg->Frags, Expr);
+    PutLineInfo (&CurSeg->Frags, CurLineInfo ());
+    ++CurSeg->FragCount;
+    CurSeg->Size += Size;
+
+    FreeExpr (Expr);
+}
+
+
+
+void ObjEmitFill (unsigned long Count)
+/* Emit Count bytes of uninitialized data into the current segment */
+{
+    PRECONDITION (CurSeg != 0);
+
+    if (Count > 0) {
+        FlushLiteral (CurSeg);
+        ObjPut8 (&CurSeg->Frags, FRAG_FILL);
+        ObjPutVar (&CurSeg->Frags, Count);
+        PutLineInfo (&CurSeg->Frags, CurLineInfo ());
+        ++CurSeg->FragCount;
+        CurSeg->Size += Count;
+    }
+}
+
+
+
+void ObjExportConst (const char* Name, unsigned long Val)
+/* Export a symbol with a constant value */
+{
+    CollAppend (&Exports, NewSymbol (Name, Val));
+}
+
+
+
+/*****************************************************************************/
+/*                                Object file                                */
+/*****************************************************************************/
+
+
+
+void WriteObjFile (const char* Name)
+/* Write everything emitted so far as object file with the given name */
+{
+    ObjHeader   H;
+    StrBuf      Obj = STATIC_STRBUF_INITIALIZER;
+    StringPool* Pool;
+    char        Buf[256];
+    unsigned    I;
+    int         Err;
+
+    /* Initialize the data, the empty string has always id zero */
+    memset (&H, 0, sizeof (H));
+    H.Magic   = OBJ_MAGIC;
+    H.Version = OBJ_VERSION;
+    Pool = NewStringPool (47);
+    SP_AddStr (Pool, "");
+
+    /* Options */
+    H.OptionOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, 2);
+    xsprintf (Buf, sizeof (Buf), "grc65 V%s", GetVersionAsString ());
+    ObjPut8 (&Obj, OPT_TRANSLATOR);
+    ObjPutVar (&Obj, SP_AddStr (Pool, Buf));
+    ObjPut8 (&Obj, OPT_DATETIME);
+    ObjPutVar (&Obj, (unsigned long) time (0));
+    H.OptionSize = ObjPos (&Obj) - H.OptionOffs;
+
+    /* Input files */
+    H.FileOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, CollCount (&Files));
+    for (I = 0; I < CollCount (&Files); ++I) {
+        const InputFile* F = CollConstAt (&Files, I);
+        ObjPutVar (&Obj, SP_AddStr (Pool, F->Name));
+        ObjPut32 (&Obj, F->MTime);
+        ObjPutVar (&Obj, F->Size);
+    }
+    H.FileSize = ObjPos (&Obj) - H.FileOffs;
+
+    /* Segments, each preceeded by the size of its data */
+    H.SegOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, CollCount (&Segments));
+    for (I = 0; I < CollCount (&Segments); ++I) {
+        Segment* S = CollAt (&Segments, I);
+        StrBuf   B = STATIC_STRBUF_INITIALIZER;
+
+        FlushLiteral (S);
+        ObjPutVar (&B, SP_AddStr (Pool, S->Name));
+        ObjPutVar (&B, 0);                      /* Segment flags */
+        ObjPutVar (&B, S->Size);
+        ObjPutVar (&B, 1);                      /* Alignment */
+        ObjPut8 (&B, ADDR_SIZE_ABS);
+        ObjPutVar (&B, S->FragCount);
+        SB_Append (&B, &S->Frags);
+
+        ObjPut32 (&Obj, SB_GetLen (&B));
+        SB_Append (&Obj, &B);
+        SB_Done (&B);
+    }
+    H.SegSize = ObjPos (&Obj) - H.SegOffs;
+
+    /* Imports */
+    H.ImportOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, CollCount (&Imports));
+    for (I = 0; I < CollCount (&Imports); ++I) {
+        const Symbol* S = CollConstAt (&Imports, I);
+        ObjPut8 (&Obj, ADDR_SIZE_ABS);
+        ObjPutVar (&Obj, SP_AddStr (Pool, S->Name));
+        PutLineInfo (&Obj, S->LineInfo);
+        PutLineInfo (&Obj, S->LineInfo);
+    }
+    H.ImportSize = ObjPos (&Obj) - H.ImportOffs;
+
+    /* Exports */
+    H.ExportOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, CollCount (&Exports));
+    for (I = 0; I < CollCount (&Exports); ++I) {
+        const Symbol* S = CollConstAt (&Exports, I);
+        ObjPutVar (&Obj, SYM_CONST | SYM_EQUATE | SYM_EXPORT);
+        ObjPut8 (&Obj, ADDR_SIZE_ABS);
+        ObjPutVar (&Obj, SP_AddStr (Pool, S->Name));
+        ObjPut32 (&Obj, S->Val);
+        PutLineInfo (&Obj, S->LineInfo);
+        ObjPutVar (&Obj, 0);                    /* No references */
+    }
+    H.ExportSize = ObjPos (&Obj) - H.ExportOffs;
+
+    /* No debug symbols, and no high level language symbols */
+    H.DbgSymOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, 0);
+    ObjPutVar (&Obj, 0);
+    H.DbgSymSize = ObjPos (&Obj) - H.DbgSymOffs;
+
+    /* Line infos, one for each input file */
+    H.LineInfoOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, CollCount (&Files));
+    for (I = 0; I < CollCount (&Files); ++I) {
+        ObjPutVar (&Obj, 0);                    /* Line */
+        ObjPutVar (&Obj, 0);                    /* Column */
+        ObjPutVar (&Obj, I);                    /* File */
+        ObjPutVar (&Obj, LI_MAKE_TYPE (LI_TYPE_ASM, 0));
+        ObjPutVar (&Obj, 0);                    /* No spans */
+    }
+    H.LineInfoSize = ObjPos (&Obj) - H.LineInfoOffs;
+
+    /* String pool */
+    H.StrPoolOffs = ObjPos (&Obj);
+    ObjPutStrPool (&Obj, Pool);
+    H.StrPoolSize = ObjPos (&Obj) - H.StrPoolOffs;
+
+    /* Empty assertion, scope and span tables */
+    H.AssertOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, 0);
+    H.AssertSize = ObjPos (&Obj) - H.AssertOffs;
+    H.ScopeOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, 0);
+    H.ScopeSize = ObjPos (&Obj) - H.ScopeOffs;
+    H.SpanOffs = ObjPos (&Obj);
+    ObjPutVar (&Obj, 0);
+    H.SpanSize = ObjPos (&Obj) - H.SpanOffs;
+
+    /* Write the file */
+    Err = ObjWriteFile (Name, &H, &Obj);
+    if (Err != 0) {
+        AbEnd ("Cannot write to `%s': %s", Name, strerror (Err));
+    }
+
+    SB_Done (&Obj);
+    FreeStringPool (Pool);
+}
@@ -0,0 +1,100 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objfile.h                                 */
+/*                                                                           */
+/*             Object file output for the GEOS resource compiler             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJFILE_H
+#define OBJFILE_H
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An expression tree. The operators are those of the object file format */
+typedef struct ObjExpr ObjExpr;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+ObjExpr* ObjLiteralExpr (long Val);
+/* Return an expression for a constant value */
+
+ObjExpr* ObjSymbolExpr (const char* Name);
+/* Return an expression for a symbol. The symbol is imported */
+
+ObjExpr* ObjUnaryExpr (unsigned char Op, ObjExpr* Expr);
+/* Return an expression for a unary operator applied to Expr */
+
+ObjExpr* ObjBinaryExpr (unsigned char Op, ObjExpr* Left, ObjExpr* Right);
+/* Return an expression for a binary operator */
+
+void ObjAddFile (const char* Name);
+/* Add an input file. All data emitted afterwards is attributed to it */
+
+void ObjUseSeg (const char* Name);
+/* Switch to the segment with the given name, creating it if needed */
+
+void ObjEmitData (const void* Data, unsigned long Size);
+/* Emit literal data into the current segment */
+
+void ObjEmitByte (long Val);
+/* Emit a constant byte into the current segment */
+
+void ObjEmitWord (long Val);
+/* Emit a constant word into the current segment */
+
+void ObjEmitExpr (unsigned Size, ObjExpr* Expr);
+/* Emit an expression with the given size in bytes into the current segment.
+** The expression is freed.
+*/
+
+void ObjEmitFill (unsigned long Count);
+/* Emit Count bytes of uninitialized data into the current segment */
+
+void ObjExportConst (const char* Name, unsigned long Val);
+/* Export a symbol with a constant value */
+
+void WriteObjFile (const char* Name);
+/* Write everything emitted so far as object file with the given name */
+
+
+
+/* End of objfile.h */
+
+#endif
@@ -0,0 +1,463 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  banks.c                                  */
+/*                                                                           */
+/*             Banked memory and trampolines for the ld65 linker             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "addrsize.h"
+#include "check.h"
+#include "coll.h"
+#include "exprdefs.h"
+#include "fragdefs.h"
+#include "print.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "banks.h"
+#include "config.h"
+#include "error.h"
+#include "exports.h"
+#include "expr.h"
+#include "fragment.h"
+#include "memarea.h"
+#include "segments.h"
+#include "spool.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* 6502 opcodes that are redirected to trampolines */
+#define OP_JSR          0x20
+#define OP_JMP          0x4C
+#define OP_RTS          0x60
+
+/* Size of one trampoline: JSR call, bank byte, target word, RTS */
+#define TRAMPOLINE_SIZE 7
+
+/* One trampoline */
+typedef struct Trampoline Trampoline;
+struct Trampoline {
+    Export*             Target;         /* Export called through the trampoline */
+    ExprNode*           TargetExpr;     /* Expression referencing the target */
+    unsigned long       Bank;           /* Bank of the target */
+    unsigned            Offs;           /* Offset in the trampoline section */
+    unsigned            Calls;          /* Number of JSR instructions */
+    unsigned            Jumps;          /* Number of JMP instructions */
+};
+
+/* Segment for the trampolines and the bank switch routine */
+static unsigned         TrampolineSegName = INVALID_STRING_ID;
+static ExprNode*        BankCallExpr      = 0;
+
+/* Section that contains the trampolines */
+static Section*         TrampolineSec     = 0;
+
+/* List of all trampolines */
+static Collection       Trampolines       = STATIC_COLLECTION_INITIALIZER;
+
+/* Banks of the segments indexed by segment id. Segments in memory areas
+** without a bank attribute are resident and have BANK_RESIDENT here.
+*/
+#define BANK_RESIDENT   (~0UL)
+static unsigned long*   SegBanks          = 0;
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static void InitSegBanks (void)
+/* Determine the banks of all segments */
+{
+    unsigned I;
+    unsigned Count = SegmentCount ();
+
+    SegBanks = xmalloc (Count * sizeof (SegBanks[0]));
+    for (I = 0; I < Count; ++I) {
+
+        const Segment* S = GetSegmentById (I);
+        const MemoryArea* M = CfgGetSegmentRunArea (S->Name);
+
+        SegBanks[I] = BANK_RESIDENT;
+        if (M != 0 && M->BankExpr != 0) {
+            long Bank;
+            if (!IsConstExpr (M->BankExpr)) {
+                Error ("Bank of memory area `%s' is not constant",
+                       GetString (M->Name));
+            }
+            /* Trampolines pass the bank as one byte */
+            Bank = GetExprVal (M->BankExpr);
+            if (Bank < 0 || Bank > 0xFF) {
+                Error ("Bank %ld of memory area `%s' is out of range for "
+                       "trampolines", Bank, GetString (M->Name));
+            }
+            SegBanks[I] = (unsigned long) Bank;
+        }
+    }
+}
+
+
+
+static Section* FindTargetSection (ExprNode* Expr)
+/* Return the one section that is referenced by an expression, or NULL if
+** there is no such section or more than one.
+*/
+{
+    Export*  E;
+    Section* L;
+    Section* R;
+
+    switch (Expr->Op) {
+
+        case EXPR_SECTION:
+            return GetExprSection (Expr);
+
+        case EXPR_SYMBOL:
+            E = GetExprExport (Expr);
+            if (E == 0 || E->Expr == 0 || ExportHasMark (E)) {
+                return 0;
+            }
+            MarkExport (E);
+            L = FindTargetSection (E->Expr);
+            UnmarkExport (E);
+            return L;
+
+        case EXPR_PLUS:
+            L = FindTargetSection (Expr->Left);
+            R = FindTargetSection (Expr->Right);
+            return (L != 0 && R != 0)? 0 : (L? L : R);
+
+        case EXPR_MINUS:
+            return FindTargetSection (Expr->Right)? 0 : FindTargetSection (Expr->Left);
+
+        default:
+            return 0;
+    }
+}
+
+
+
+static Trampoline* GetTrampoline (ExprNode* Expr, Export* Target, unsigned long Bank)
+/* Return the trampoline for the given target, create it if needed */
+{
+    unsigned    I;
+    Trampoline* T;
+    Fragment*   F;
+
+    /* Search for an existing trampoline */
+    for (I = 0; I < CollCount (&Trampolines); ++I) {
+        T = CollAtUnchecked (&Trampolines, I);
+        if (T->Target == Target) {
+            return T;
+        }
+    }
+
+    /* Create the section on first use */
+    if (TrampolineSec == 0) {
+        Segment* Seg = GetSegment (TrampolineSegName, ADDR_SIZE_ABS, 0);
+        TrampolineSec = NewSection (Seg, 1, ADDR_SIZE_ABS);
+    }
+
+    /* Create a new trampoline */
+    T = xmalloc (sizeof (Trampoline));
+    T->Target     = Target;
+    T->TargetExpr = Expr;
+    T->Bank       = Bank;
+    T->Offs       = TrampolineSec->Size;
+    T->Calls      = 0;
+    T->Jumps      = 0;
+    CollAppend (&Trampolines, T);
+
+    /* Generate the code:
+    **
+    **          jsr     bankcall
+    **          .byte   bank
+    **          .word   target
+    **          rts
+    **
+    ** The bank switch routine reads the bank and target following the call,
+    ** and returns to the RTS.
+    */
+    F = NewFragment (FRAG_LITERAL, 1, TrampolineSec);
+    F->LitBuf[0] = OP_JSR;
+    F = NewFragment (FRAG_EXPR, 2, TrampolineSec);
+    F->Expr = BankCallExpr;
+    F = NewFragment (FRAG_LITERAL, 1, TrampolineSec);
+    F->LitBuf[0] = (unsigned char) Bank;
+    F = NewFragment (FRAG_EXPR, 2, TrampolineSec);
+    F->Expr = Expr;
+    F = NewFragment (FRAG_LITERAL, 1, TrampolineSec);
+    F->LitBuf[0] = OP_RTS;
+    CHECK (TrampolineSec->Size - T->Offs == TRAMPOLINE_SIZE);
+
+    /* Return the new trampoline */
+    return T;
+}
+
+
+
+static void ScanSection (Section* S, unsigned long Bank)
+/* Search a section for cross bank JSR and JMP instructions and redirect them
+** to trampolines.
+*/
+{
+    const Fragment* Prev = 0;
+    Fragment* F;
+
+    for (F = S->FragRoot; F; Prev = F, F = F->Next) {
+
+        unsigned char Opcode;
+        Export*       Target;
+        Section*      TargetSec;
+        unsigned long TargetBank;
+        Trampoline*   T;
+
+        /* The instruction operand is a 16 bit expression marked as operand
+        ** by the assembler, the opcode is the last byte of the literal
+        ** fragment before it. Data is never marked, so it isn't touched.
+        */
+        if (F->Type != FRAG_EXPR || F->Size != 2 ||
+            (F->Flags & FRAG_OPERAND) == 0 || Prev == 0 ||
+            Prev->Type != FRAG_LITERAL || Prev->Size == 0) {
+            continue;
+        }
+        Opcode = Prev->LitBuf[Prev->Size - 1];
+        if (Opcode != OP_JSR && Opcode != OP_JMP) {
+            continue;
+        }
+
+        /* Only plain symbol references are redirected */
+        if (F->Expr->Op != EXPR_SYMBOL) {
+            continue;
+        }
+        Target = GetExprExport (F->Expr);
+        if (Target == 0 || Target->Expr == 0) {
+            continue;
+        }
+        TargetSec = FindTargetSection (F->Expr);
+        if (TargetSec == 0) {
+            continue;
+        }
+
+        /* A trampoline is needed if the target is banked, and the bank of
+        ** the caller is a different one or the caller is resident.
+        */
+        TargetBank = SegBanks[TargetSec->Seg->Id];
+        if (TargetBank == BANK_RESIDENT || TargetBank == Bank) {
+            continue;
+        }
+
+        /* Redirect the instruction */
+        T = GetTrampoline (F->Expr, Target, TargetBank);
+        if (Opcode == OP_JSR) {
+            ++T->Calls;
+        } else {
+            ++T->Jumps;
+        }
+        F->Expr = SectionExpr (TrampolineSec, T->Offs, 0);
+    }
+}
+
+
+
+static int CmpTrampolines (void* Data attribute ((unused)),
+                           const void* Left, const void* Right)
+/* Compare function for CollSort, sorts by use count, most used first */
+{
+    const Trampoline* L = Left;
+    const Trampoline* R = Right;
+    unsigned LUses = L->Calls + L->Jumps;
+    unsigned RUses = R->Calls + R->Jumps;
+    if (LUses != RUses) {
+        return (LUses < RUses)? 1 : -1;
+    }
+    return (L->Offs > R->Offs) - (L->Offs < R->Offs);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void BankSetTrampolines (unsigned SegName, struct ExprNode* CallExpr)
+/* Enable automatic trampolines. They are placed into the segment with the
+** given name and call the bank switch routine given as expression.
+*/
+{
+    /* Setting the segment twice is bad */
+    CHECK (TrampolineSegName == INVALID_STRING_ID);
+
+    TrampolineSegName = SegName;
+    BankCallExpr      = CallExpr;
+}
+
+
+
+int BankHasTrampolines (void)
+/* Return true if trampolines have been enabled in the config */
+{
+    return (TrampolineSegName != INVALID_STRING_ID);
+}
+
+
+
+void BankCreateTrampolines (void)
+/* Search for JSR and JMP instructions that reference code in another bank,
+** create trampolines for the targets and redirect the instructions to them.
+** Does nothing if trampolines aren't enabled.
+*/
+{
+    unsigned I, J;
+    unsigned Count;
+    unsigned Uses = 0;
+
+    if (!BankHasTrampolines ()) {
+        return;
+    }
+
+    /* Determine the banks of the segments */
+    InitSegBanks ();
+
+    /* Scan all sections. Sections created here are appended to the
+    ** trampoline segment and never contain cross bank calls, so we may
+    ** remember the count of segments before starting.
+    */
+    Count = SegmentCount ();
+    for (I = 0; I < Count; ++I) {
+        Segment* Seg = (Segment*) GetSegmentById (I);
+        unsigned long Bank = SegBanks[I];
+        for (J = 0; J < CollCount (&Seg->Sections); ++J) {
+            Section* S = CollAtUnchecked (&Seg->Sections, J);
+            if (S != TrampolineSec) {
+                ScanSection (S, Bank);
+            }
+        }
+    }
+
+    /* Keep the user informed */
+    for (I = 0; I < CollCount (&Trampolines); ++I) {
+        const Trampoline* T = CollConstAt (&Trampolines, I);
+        Uses += T->Calls + T->Jumps;
+    }
+    Print (stdout, 1, "Created %u trampoline(s) for %u cross bank reference(s)\n",
+           CollCount (&Trampolines), Uses);
+}
+
+
+
+void PrintBankMap (FILE* F)
+/* Print the usage of all banks and the trampoline statistics to a map file.
+** Nothing is printed if there are no banked memory areas.
+*/
+{
+    unsigned I, J;
+    Collection Sorted = STATIC_COLLECTION_INITIALIZER;
+    Collection Banked = STATIC_COLLECTION_INITIALIZER;
+
+    /* Collect all memory areas with a constant bank attribute */
+    for (I = 0; I < CfgMemoryAreaCount (); ++I) {
+        const MemoryArea* M = CfgGetMemoryArea (I);
+        if (M->BankExpr != 0 && IsConstExpr (M->BankExpr)) {
+            CollAppend (&Banked, (void*) M);
+        }
+    }
+
+    /* Nothing to do if there is no banked memory */
+    if (CollCount (&Banked) == 0) {
+        DoneCollection (&Banked);
+        return;
+    }
+
+    /* Print the usage of the banks */
+    fprintf (F, "\n\n"
+                "Bank usage:\n"
+                "-----------\n"
+                "Bank   Memory area        Start   Size    Used    Free\n");
+    for (I = 0; I < CollCount (&Banked); ++I) {
+
+        const MemoryArea* M = CollConstAt (&Banked, I);
+        unsigned long Bank  = GetExprVal (M->BankExpr);
+        unsigned long Used  = 0;
+        unsigned      Calls = 0;
+
+        /* The fill level includes fill bytes, so add up the segments */
+        for (J = 0; J < CollCount (&M->SegList); ++J) {
+            const SegDesc* S = CollConstAt (&M->SegList, J);
+            if (S->Load == M) {
+                Used += S->Seg->Size;
+            }
+        }
+
+        /* Count the trampolines that switch to this bank */
+        for (J = 0; J < CollCount (&Trampolines); ++J) {
+            const Trampoline* T = CollConstAt (&Trampolines, J);
+            if (T->Bank == Bank) {
+                ++Calls;
+            }
+        }
+
+        fprintf (F, "%-6lu %-18s %06lX  %06lX  %06lX  %06lX  %u trampoline(s)\n",
+                 Bank, GetString (M->Name), M->Start, M->Size, Used,
+                 (Used < M->Size)? M->Size - Used : 0, Calls);
+    }
+    DoneCollection (&Banked);
+
+    /* Print the trampolines, most used first */
+    if (CollCount (&Trampolines) == 0) {
+        return;
+    }
+    CollTransfer (&Sorted, &Trampolines);
+    CollSort (&Sorted, CmpTrampolines, 0);
+
+    fprintf (F, "\n\n"
+                "Trampolines:\n"
+                "------------\n"
+                "Target                            Addr    Bank   JSR     JMP\n");
+    for (I = 0; I < CollCount (&Sorted); ++I) {
+        const Trampoline* T = CollConstAt (&Sorted, I);
+        unsigned long Addr  = TrampolineSec->Seg->PC + TrampolineSec->Offs + T->Offs;
+        fprintf (F, "%-33s %06lX  %-6lu %-7u %u\n",
+                 GetString (T->Target->Name), Addr, T->Bank, T->Calls, T->Jumps);
+    }
+    DoneCollection (&Sorted);
+}
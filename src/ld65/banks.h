@@ -0,0 +1,81 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  banks.h                                  */
+/*                                                                           */
+/*             Banked memory and trampolines for the ld65 linker             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef BANKS_H
+#define BANKS_H
+
+
+
+#include <stdio.h>
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct ExprNode;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void BankSetTrampolines (unsigned SegName, struct ExprNode* CallExpr);
+/* Enable automatic trampolines. They are placed into the segment with the
+** given name and call the bank switch routine given as expression.
+*/
+
+int BankHasTrampolines (void);
+/* Return true if trampolines have been enabled in the config */
+
+void BankCreateTrampolines (void);
+/* Search for JSR and JMP instructions that reference code in another bank,
+** create trampolines for the targets and redirect the instructions to them.
+** Does nothing if trampolines aren't enabled.
+*/
+
+void PrintBankMap (FILE* F);
+/* Print the usage of all banks and the trampoline statistics to a map file.
+** Nothing is printed if there are no banked memory areas.
+*/
+
+
+
+/* End of banks.h */
+
+#endif
@@ -54,6 +54,7 @@
 
 /* ld65 */
 #include "alignment.h"
+#include "banks.h"
 #include "bin.h"
 #include "binfmt.h"
 #include "cfgexpr.h"
@@ -1277,12 +1278,99 @@ static void ParseStartAddress (void)
 
 
 
+static void ParseTrampolines (void)
+/* Parse the TRAMPOLINES feature */
+{
+    static const IdentTok Attributes [] = {
+        {   "CALL",             CFGTOK_CALL             },
+        {   "SEGMENT",          CFGTOK_SEGMENT          },
+    };
+
+    /* Attribute values. */
+    unsigned SegName = INVALID_STRING_ID;
+    ExprNode* CallExpr = 0;
+
+    /* Bitmask to remember the attributes we got already */
+    enum {
+        atNone          = 0x0000,
+        atCall          = 0x0001,
+        atSegName       = 0x0002,
+    };
+    unsigned AttrFlags = atNone;
+
+    /* Parse the attributes */
+    while (1) {
+
+        /* Map the identifier to a token */
+        cfgtok_t AttrTok;
+        CfgSpecialToken (Attributes, ENTRY_COUNT (Attributes), "Attribute");
+        AttrTok = CfgTok;
+
+        /* An optional assignment follows */
+        CfgNextTok ();
+        CfgOptionalAssign ();
+
+        /* Check which attribute was given */
+        switch (AttrTok) {
+
+            case CFGTOK_CALL:
+                /* Don't allow this twice */
+                FlagAttr (&AttrFlags, atCall, "CALL");
+                /* We expect an identifier. Generate an import for it, so
+                ** the bank switch routine is linked in.
+                */
+                CfgAssureIdent ();
+                CallExpr = NewExprNode (0, EXPR_SYMBOL);
+                CallExpr->V.Imp = InsertImport (GenImport (GetStrBufId (&CfgSVal),
+                                                           ADDR_SIZE_ABS));
+                CollAppend (&CallExpr->V.Imp->RefLines, GenLineInfo (&CfgErrorPos));
+                break;
+
+            case CFGTOK_SEGMENT:
+                /* Don't allow this twice */
+                FlagAttr (&AttrFlags, atSegName, "SEGMENT");
+                /* We expect an identifier */
+                CfgAssureIdent ();
+                /* Remember the value for later */
+                SegName = GetStrBufId (&CfgSVal);
+                break;
+
+            default:
+                FAIL ("Unexpected attribute token");
+
+        }
+
+        /* Skip the attribute value */
+        CfgNextTok ();
+
+        /* Semicolon ends the decl, otherwise accept an optional comma */
+        if (CfgTok == CFGTOK_SEMI) {
+            break;
+        } else if (CfgTok == CFGTOK_COMMA) {
+            CfgNextTok ();
+        }
+    }
+
+    /* Check if we have all mandatory attributes */
+    AttrCheck (AttrFlags, atSegName, "SEGMENT");
+    AttrCheck (AttrFlags, atCall, "CALL");
+
+    /* The feature may be given only once */
+    if (BankHasTrampolines ()) {
+        CfgError (&CfgErrorPos, "TRAMPOLINES attributes are already defined");
+    }
+    BankSetTrampolines (SegName, CallExpr);
+}
+
+
+
 static void ParseFeatures (void)
 /* Parse a features section */
 {
     static const IdentTok Features [] = {
         {   "CONDES",       CFGTOK_CONDES       },
         {   "STARTADDRESS", CFGTOK_STARTADDRESS },
+        {   "TRAMPOLINES",  CFGTOK_TRAMPOLINES  },
     };
 
     while (CfgTok == CFGTOK_IDENT) {
@@ -1307,6 +1395,10 @@ static void ParseFeatures (void)
                 ParseStartAddress ();
                 break;
 
+            case CFGTOK_TRAMPOLINES:
+                ParseTrampolines ();
+                break;
+
 
             default:
                 FAIL ("Unexpected feature token");
@@ -2132,3 +2224,30 @@ void CfgWriteTarget (void)
         }
     }
 }
+
+
+
+unsigned CfgMemoryAreaCount (void)
+/* Return the number of memory areas defined in the config */
+{
+    return CollCount (&MemoryAreas);
+}
+
+
+
+const MemoryArea* CfgGetMemoryArea (unsigned Index)
+/* Return the memory area with the given index */
+{
+    return CollConstAt (&MemoryAreas, Index);
+}
+
+
+
+const MemoryArea* CfgGetSegmentRunArea (unsigned Name)
+/* Return the run memory area for the segment with the given name. Return
+** NULL if the segment is not listed in the config.
+*/
+{
+    const SegDesc* S = CfgFindSegDesc (Name);
+    return S? S->Run : 0;
+}
@@ -121,6 +121,17 @@ unsigned CfgProcess (void);
 void CfgWriteTarget (void);
 /* Write the target file(s) */
 
+unsigned CfgMemoryAreaCount (void);
+/* Return the number of memory areas defined in the config */
+
+const struct MemoryArea* CfgGetMemoryArea (unsigned Index);
+/* Return the memory area with the given index */
+
+const struct MemoryArea* CfgGetSegmentRunArea (unsigned Name);
+/* Return the run memory area for the segment with the given name. Return
+** NULL if the segment is not listed in the config.
+*/
+
 
 
 /* End of config.h */
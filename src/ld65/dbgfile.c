@@ -37,6 +37,9 @@
 #include <string.h>
 #include <errno.h>
 
+/* common */
+#include "strpool.h"
+
 /* ld65 */
 #include "dbgfile.h"
 #include "dbgsyms.h"
@@ -52,6 +55,352 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Magic bytes at the start of a binary debug file, followed by one byte with
+** the encoding version. The text format always starts with "version", so the
+** reader can tell both formats apart by looking at the first byte.
+*/
+static const unsigned char BinMagic[8] = {
+    0x89, 'c', 'c', '6', '5', 'd', 'b', 'g'
+};
+#define BIN_VERSION     1U
+
+/* Tokens in the binary format. The binary file is a pre-tokenized version of
+** the text file: Numbers are stored as unsigned LEB128 varints, identifiers
+** and string constants are stored once in a string table that is built while
+** writing and referenced by a varint index afterwards. The DEF variants of
+** the string tokens define the next table entry and use it at the same time.
+** These values must match the ones in src/dbginfo/dbginfo.c.
+*/
+#define BT_EOL          0x00U           /* End of record */
+#define BT_EQUAL        0x01U           /* = */
+#define BT_COMMA        0x02U           /* , */
+#define BT_MINUS        0x03U           /* - */
+#define BT_PLUS         0x04U           /* + */
+#define BT_INTCON       0x05U           /* Integer, varint follows */
+#define BT_STRCON       0x06U           /* String constant, varint index */
+#define BT_IDENT        0x07U           /* Identifier, varint index */
+#define BT_DEFSTRCON    0x08U           /* New string constant, length+data */
+#define BT_DEFIDENT     0x09U           /* New identifier, length+data */
+
+/* Size of the output buffer. Records are formatted directly into the buffer
+** which is written to disk when it's full.
+*/
+#define OUTBUF_SIZE     0x10000U
+
+/* Maximum number of bytes a single token (without string data) may need */
+#define MAX_TOKEN_SIZE  32U
+
+/* Format of the debug file */
+unsigned char           DbgFileFormat = DBGFILE_FORMAT_TEXT;
+
+/* Output state */
+static FILE*            DbgF;           /* Output file */
+static unsigned char    OutBuf[OUTBUF_SIZE];
+static unsigned         OutLen;         /* Number of bytes in OutBuf */
+static unsigned         AttrCount;      /* Number of attributes in record */
+static unsigned         ListCount;      /* Number of items in current list */
+static StringPool*      BinStrings;     /* String table for binary format */
+
+
+
+/*****************************************************************************/
+/*                              Output buffering                             */
+/*****************************************************************************/
+
+
+
+static void FlushOutBuf (void)
+/* Write the contents of the output buffer to the file */
+{
+    if (OutLen > 0) {
+        if (fwrite (OutBuf, 1, OutLen, DbgF) != OutLen) {
+            Error ("Cannot write to debug file `%s': %s",
+                   DbgFileName, strerror (errno));
+        }
+        OutLen = 0;
+    }
+}
+
+
+
+static unsigned char* Reserve (unsigned Size)
+/* Make sure there's room for Size bytes in the output buffer and return a
+** pointer to the first free byte. Size must not exceed MAX_TOKEN_SIZE.
+*/
+{
+    if (OutLen + Size > OUTBUF_SIZE) {
+        FlushOutBuf ();
+    }
+    return OutBuf + OutLen;
+}
+
+
+
+static void PutByte (unsigned char B)
+/* Add a byte to the output */
+{
+    *Reserve (1) = B;
+    ++OutLen;
+}
+
+
+
+static void PutData (const char* Data, unsigned Size)
+/* Add a block of data of arbitrary size to the output */
+{
+    if (OutLen + Size > OUTBUF_SIZE) {
+        FlushOutBuf ();
+        if (Size > OUTBUF_SIZE) {
+            /* Too large for the buffer, write it directly */
+            if (fwrite (Data, 1, Size, DbgF) != Size) {
+                Error ("Cannot write to debug file `%s': %s",
+                       DbgFileName, strerror (errno));
+            }
+            return;
+        }
+    }
+    memcpy (OutBuf + OutLen, Data, Size);
+    OutLen += Size;
+}
+
+
+
+static void PutStr (const char* S)
+/* Add a string to the output */
+{
+    PutData (S, strlen (S));
+}
+
+
+
+static void PutDec (unsigned long Val)
+/* Add a number in decimal notation to the output */
+{
+    char Tmp[24];
+    unsigned I = sizeof (Tmp);
+    do {
+        Tmp[--I] = (char) ('0' + (Val % 10));
+        Val /= 10;
+    } while (Val);
+    PutData (Tmp + I, sizeof (Tmp) - I);
+}
+
+
+
+static void PutHex (unsigned long Val, unsigned Digits)
+/* Add a number in hex notation with at least Digits digits to the output */
+{
+    static const char HexTab[16] = "0123456789ABCDEF";
+    char Tmp[24];
+    unsigned I = sizeof (Tmp);
+    do {
+        Tmp[--I] = HexTab[Val & 0x0F];
+        Val >>= 4;
+    } while (Val || I > sizeof (Tmp) - Digits);
+    Tmp[--I] = 'x';
+    Tmp[--I] = '0';
+    PutData (Tmp + I, sizeof (Tmp) - I);
+}
+
+
+
+static void PutVarInt (unsigned long Val)
+/* Add a number as unsigned LEB128 varint to the output */
+{
+    unsigned char* P = Reserve (MAX_TOKEN_SIZE);
+    unsigned char* Start = P;
+    while (Val >= 0x80) {
+        *P++ = (unsigned char) (Val | 0x80);
+        Val >>= 7;
+    }
+    *P++ = (unsigned char) Val;
+    OutLen += (unsigned) (P - Start);
+}
+
+
+
+static void PutBinString (const char* S, unsigned RefTok, unsigned DefTok)
+/* Add a string in binary format. If the string is already in the string
+** table, output a reference, otherwise add and define it.
+*/
+{
+    unsigned Count = SP_GetCount (BinStrings);
+    unsigned Index = SP_AddStr (BinStrings, S);
+    if (Index < Count) {
+        PutByte ((unsigned char) RefTok);
+        PutVarInt (Index);
+    } else {
+        unsigned Len = strlen (S);
+        PutByte ((unsigned char) DefTok);
+        PutVarInt (Len);
+        PutData (S, Len);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                               Record output                               */
+/*****************************************************************************/
+
+
+
+static void AttrStart (const char* Name)
+/* Output the separator and the name of a new attribute */
+{
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        if (AttrCount > 0) {
+            PutByte (BT_COMMA);
+        }
+        PutBinString (Name, BT_IDENT, BT_DEFIDENT);
+        PutByte (BT_EQUAL);
+    } else {
+        if (AttrCount > 0) {
+            PutByte (',');
+        }
+        PutStr (Name);
+        PutByte ('=');
+    }
+    ++AttrCount;
+}
+
+
+
+void DbgRecStart (const char* Type)
+/* Start a new record of the given type in the debug file */
+{
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutBinString (Type, BT_IDENT, BT_DEFIDENT);
+    } else {
+        PutStr (Type);
+        PutByte ('\t');
+    }
+    AttrCount = 0;
+}
+
+
+
+void DbgRecEnd (void)
+/* Terminate the current record */
+{
+    PutByte (DbgFileFormat == DBGFILE_FORMAT_BINARY? BT_EOL : '\n');
+}
+
+
+
+void DbgAttrNum (const char* Name, unsigned long Val)
+/* Add a numeric attribute in decimal notation to the current record */
+{
+    AttrStart (Name);
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutByte (BT_INTCON);
+        PutVarInt (Val);
+    } else {
+        PutDec (Val);
+    }
+}
+
+
+
+void DbgAttrSigned (const char* Name, long Val)
+/* Add a signed numeric attribute in decimal notation to the current record */
+{
+    unsigned long UVal = (unsigned long) Val;
+
+    AttrStart (Name);
+    if (Val < 0) {
+        PutByte (DbgFileFormat == DBGFILE_FORMAT_BINARY? BT_MINUS : '-');
+        UVal = 0UL - UVal;
+    }
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutByte (BT_INTCON);
+        PutVarInt (UVal);
+    } else {
+        PutDec (UVal);
+    }
+}
+
+
+
+void DbgAttrHex (const char* Name, unsigned long Val, unsigned Digits)
+/* Add a numeric attribute in hex notation with at least Digits digits to the
+** current record. The binary format doesn't distinguish between notations.
+*/
+{
+    AttrStart (Name);
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutByte (BT_INTCON);
+        PutVarInt (Val);
+    } else {
+        PutHex (Val, Digits);
+    }
+}
+
+
+
+void DbgAttrStr (const char* Name, const char* Val)
+/* Add a string attribute to the current record */
+{
+    AttrStart (Name);
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutBinString (Val, BT_STRCON, BT_DEFSTRCON);
+    } else {
+        PutByte ('\"');
+        PutStr (Val);
+        PutByte ('\"');
+    }
+}
+
+
+
+void DbgAttrKeyword (const char* Name, const char* Val)
+/* Add an attribute with a keyword as value to the current record */
+{
+    AttrStart (Name);
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutBinString (Val, BT_IDENT, BT_DEFIDENT);
+    } else {
+        PutStr (Val);
+    }
+}
+
+
+
+void DbgAttrListStart (const char* Name)
+/* Start an attribute that takes a list of ids joined by '+' */
+{
+    AttrStart (Name);
+    ListCount = 0;
+}
+
+
+
+void DbgAttrListItem (unsigned long Id)
+/* Add an id to the list started with DbgAttrListStart */
+{
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        if (ListCount > 0) {
+            PutByte (BT_PLUS);
+        }
+        PutByte (BT_INTCON);
+        PutVarInt (Id);
+    } else {
+        if (ListCount > 0) {
+            PutByte ('+');
+        }
+        PutDec (Id);
+    }
+    ++ListCount;
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -105,67 +454,84 @@ void CreateDbgFile (void)
 /* Create a debug info file */
 {
     /* Open the debug info file */
-    FILE* F = fopen (DbgFileName, "w");
-    if (F == 0) {
+    DbgF = fopen (DbgFileName, DbgFileFormat == DBGFILE_FORMAT_BINARY? "wb" : "w");
+    if (DbgF == 0) {
         Error ("Cannot create debug file `%s': %s", DbgFileName, strerror (errno));
     }
+    OutLen = 0;
+
+    /* The binary format starts with a header and needs a string table */
+    if (DbgFileFormat == DBGFILE_FORMAT_BINARY) {
+        PutData ((const char*) BinMagic, sizeof (BinMagic));
+        PutByte (BIN_VERSION);
+        BinStrings = NewStringPool (1103);
+    }
 
     /* Output version information */
-    fprintf (F, "version\tmajor=2,minor=0\n");
+    DbgRecStart ("version");
+    DbgAttrNum ("major", 2);
+    DbgAttrNum ("minor", 0);
+    DbgRecEnd ();
 
     /* Output a line with the item numbers so the debug info module is able
     ** to preallocate the required memory.
     */
-    fprintf (
-        F,
-        "info\tcsym=%u,file=%u,lib=%u,line=%u,mod=%u,scope=%u,seg=%u,span=%u,sym=%u,type=%u\n",
-        HLLDbgSymCount (),
-        FileInfoCount (),
-        LibraryCount (),
-        LineInfoCount (),
-        ObjDataCount (),
-        ScopeCount (),
-        SegmentCount (),
-        SpanCount (),
-        DbgSymCount (),
-        TypeCount ()
-    );
+    DbgRecStart ("info");
+    DbgAttrNum ("csym", HLLDbgSymCount ());
+    DbgAttrNum ("file", FileInfoCount ());
+    DbgAttrNum ("lib", LibraryCount ());
+    DbgAttrNum ("line", LineInfoCount ());
+    DbgAttrNum ("mod", ObjDataCount ());
+    DbgAttrNum ("scope", ScopeCount ());
+    DbgAttrNum ("seg", SegmentCount ());
+    DbgAttrNum ("span", SpanCount ());
+    DbgAttrNum ("sym", DbgSymCount ());
+    DbgAttrNum ("type", TypeCount ());
+    DbgRecEnd ();
 
     /* Assign the ids to the items */
     AssignIds ();
 
     /* Output high level language symbols */
-    PrintHLLDbgSyms (F);
+    PrintHLLDbgSyms ();
 
     /* Output files */
-    PrintDbgFileInfo (F);
+    PrintDbgFileInfo ();
 
     /* Output libraries */
-    PrintDbgLibraries (F);
+    PrintDbgLibraries ();
 
     /* Output line info */
-    PrintDbgLineInfo (F);
+    PrintDbgLineInfo ();
 
     /* Output modules */
-    PrintDbgModules (F);
+    PrintDbgModules ();
 
     /* Output the segment info */
-    PrintDbgSegments (F);
+    PrintDbgSegments ();
 
     /* Output spans */
-    PrintDbgSpans (F);
+    PrintDbgSpans ();
 
     /* Output scopes */
-    PrintDbgScopes (F);
+    PrintDbgScopes ();
 
     /* Output symbols */
-    PrintDbgSyms (F);
+    PrintDbgSyms ();
 
     /* Output types */
-    PrintDbgTypes (F);
+    PrintDbgTypes ();
+
+    /* Write remaining data and release the string table */
+    FlushOutBuf ();
+    if (BinStrings) {
+        FreeStringPool (BinStrings);
+        BinStrings = 0;
+    }
 
     /* Close the file */
-    if (fclose (F) != 0) {
+    if (fclose (DbgF) != 0) {
         Error ("Error closing debug file `%s': %s", DbgFileName, strerror (errno));
     }
+    DbgF = 0;
 }
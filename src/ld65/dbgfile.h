@@ -38,12 +38,56 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Debug file formats */
+#define DBGFILE_FORMAT_TEXT     0U      /* Line oriented text format */
+#define DBGFILE_FORMAT_BINARY   1U      /* Pre-tokenized binary format */
+
+/* Format of the debug file */
+extern unsigned char    DbgFileFormat;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
+void DbgRecStart (const char* Type);
+/* Start a new record of the given type in the debug file */
+
+void DbgRecEnd (void);
+/* Terminate the current record */
+
+void DbgAttrNum (const char* Name, unsigned long Val);
+/* Add a numeric attribute in decimal notation to the current record */
+
+void DbgAttrSigned (const char* Name, long Val);
+/* Add a signed numeric attribute in decimal notation to the current record */
+
+void DbgAttrHex (const char* Name, unsigned long Val, unsigned Digits);
+/* Add a numeric attribute in hex notation with at least Digits digits to the
+** current record. The binary format doesn't distinguish between notations.
+*/
+
+void DbgAttrStr (const char* Name, const char* Val);
+/* Add a string attribute to the current record */
+
+void DbgAttrKeyword (const char* Name, const char* Val);
+/* Add an attribute with a keyword as value to the current record */
+
+void DbgAttrListStart (const char* Name);
+/* Start an attribute that takes a list of ids joined by '+' */
+
+void DbgAttrListItem (unsigned long Id);
+/* Add an id to the list started with DbgAttrListStart */
+
 void CreateDbgFile (void);
 /* Create a debug info file */
 
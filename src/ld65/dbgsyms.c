@@ -44,6 +44,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "exports.h"
@@ -294,16 +295,15 @@ static long GetDbgSymVal (const DbgSym* D)
 
 
 
-static void PrintLineInfo (FILE* F, const Collection* LineInfos, const char* Format)
+static void PrintLineInfo (const Collection* LineInfos, const char* Name)
 /* Output an attribute with line infos */
 {
     if (CollCount (LineInfos) > 0) {
         unsigned I;
-        const LineInfo* LI = CollConstAt (LineInfos, 0);
-        fprintf (F, Format, LI->Id);
-        for (I = 1; I < CollCount (LineInfos); ++I) {
-            LI = CollConstAt (LineInfos, I);
-            fprintf (F, "+%u", LI->Id);
+        DbgAttrListStart (Name);
+        for (I = 0; I < CollCount (LineInfos); ++I) {
+            const LineInfo* LI = CollConstAt (LineInfos, I);
+            DbgAttrListItem (LI->Id);
         }
     }
 }
@@ -348,7 +348,7 @@ unsigned HLLDbgSymCount (void)
 
 
 
-void PrintDbgSyms (FILE* F)
+void PrintDbgSyms (void)
 /* Print the debug symbols in a debug file */
 {
     unsigned I, J;
@@ -365,29 +365,28 @@ void PrintDbgSyms (FILE* F)
             const DbgSym* S = CollConstAt (&O->DbgSyms, J);
 
             /* Emit the base data for the entry */
-            fprintf (F,
-                     "sym\tid=%u,name=\"%s\",addrsize=%s",
-                     O->SymBaseId + J,
-                     GetString (S->Name),
-                     AddrSizeToStr ((unsigned char) S->AddrSize));
+            DbgRecStart ("sym");
+            DbgAttrNum ("id", O->SymBaseId + J);
+            DbgAttrStr ("name", GetString (S->Name));
+            DbgAttrKeyword ("addrsize", AddrSizeToStr ((unsigned char) S->AddrSize));
 
             /* Emit the size only if we know it */
             if (S->Size != 0) {
-                fprintf (F, ",size=%u", S->Size);
+                DbgAttrNum ("size", S->Size);
             }
 
             /* For cheap local symbols, add the owner symbol, for others,
             ** add the owner scope.
             */
             if (SYM_IS_STD (S->Type)) {
-                fprintf (F, ",scope=%u", O->ScopeBaseId + S->OwnerId);
+                DbgAttrNum ("scope", O->ScopeBaseId + S->OwnerId);
             } else {
-                fprintf (F, ",parent=%u", O->SymBaseId + S->OwnerId);
+                DbgAttrNum ("parent", O->SymBaseId + S->OwnerId);
             }
 
             /* Output line infos */
-            PrintLineInfo (F, &S->DefLines, ",def=%u");
-            PrintLineInfo (F, &S->RefLines, ",ref=%u");
+            PrintLineInfo (&S->DefLines, "def");
+            PrintLineInfo (&S->RefLines, "ref");
 
             /* If this is an import, output the id of the matching export.
             ** If this is not an import, output its value and - if we have
@@ -402,14 +401,14 @@ void PrintDbgSyms (FILE* F)
                 const Export* Exp = Imp->Exp;
 
                 /* Output the type */
-                fputs (",type=imp", F);
+                DbgAttrKeyword ("type", "imp");
 
                 /* If this is not a linker generated symbol, and the module
                 ** that contains the export has debug info, output the debug
                 ** symbol id for the export
                 */
                 if (Exp->Obj && OBJ_HAS_DBGINFO (Exp->Obj->Header.Flags)) {
-                    fprintf (F, ",exp=%u", Exp->Obj->SymBaseId + Exp->DbgSymId);
+                    DbgAttrNum ("exp", Exp->Obj->SymBaseId + Exp->DbgSymId);
                 }
 
             } else {
@@ -420,29 +419,29 @@ void PrintDbgSyms (FILE* F)
                 long Val = GetDbgSymVal (S);
 
                 /* Output it */
-                fprintf (F, ",val=0x%lX", Val);
+                DbgAttrHex ("val", (unsigned long) Val, 1);
 
                 /* Check for a segmented expression and add the segment id to
                 ** the debug info if we have one.
                 */
                 GetSegExprVal (S->Expr, &D);
                 if (!D.TooComplex && D.Seg != 0) {
-                    fprintf (F, ",seg=%u", D.Seg->Id);
+                    DbgAttrNum ("seg", D.Seg->Id);
                 }
 
                 /* Output the type */
-                fprintf (F, ",type=%s", SYM_IS_LABEL (S->Type)? "lab" : "equ");
+                DbgAttrKeyword ("type", SYM_IS_LABEL (S->Type)? "lab" : "equ");
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgRecEnd ();
         }
     }
 }
 
 
 
-void PrintHLLDbgSyms (FILE* F)
+void PrintHLLDbgSyms (void)
 /* Print the high level language debug symbols in a debug file */
 {
     unsigned I, J;
@@ -462,16 +461,16 @@ void PrintHLLDbgSyms (FILE* F)
             unsigned SC = HLL_GET_SC (S->Flags);
 
             /* Output the base info */
-            fprintf (F, "csym\tid=%u,name=\"%s\",scope=%u,type=%u,sc=",
-                     O->HLLSymBaseId + J,
-                     GetString (S->Name),
-                     O->ScopeBaseId + S->ScopeId,
-                     S->Type);
+            DbgRecStart ("csym");
+            DbgAttrNum ("id", O->HLLSymBaseId + J);
+            DbgAttrStr ("name", GetString (S->Name));
+            DbgAttrNum ("scope", O->ScopeBaseId + S->ScopeId);
+            DbgAttrNum ("type", S->Type);
             switch (SC) {
-                case HLL_SC_AUTO:       fputs ("auto", F);      break;
-                case HLL_SC_REG:        fputs ("reg", F);       break;
-                case HLL_SC_STATIC:     fputs ("static", F);    break;
-                case HLL_SC_EXTERN:     fputs ("ext", F);       break;
+                case HLL_SC_AUTO:   DbgAttrKeyword ("sc", "auto");      break;
+                case HLL_SC_REG:    DbgAttrKeyword ("sc", "reg");       break;
+                case HLL_SC_STATIC: DbgAttrKeyword ("sc", "static");    break;
+                case HLL_SC_EXTERN: DbgAttrKeyword ("sc", "ext");       break;
                 default:
                     Error ("Invalid storage class %u for hll symbol", SC);
                     break;
@@ -479,16 +478,16 @@ void PrintHLLDbgSyms (FILE* F)
 
             /* Output the offset if it is not zero */
             if (S->Offs) {
-                fprintf (F, ",offs=%d", S->Offs);
+                DbgAttrSigned ("offs", S->Offs);
             }
 
             /* For non auto symbols output the debug symbol id of the asm sym */
             if (HLL_HAS_SYM (S->Flags)) {
-                fprintf (F, ",sym=%u", O->SymBaseId + S->Sym->Id);
+                DbgAttrNum ("sym", O->SymBaseId + S->Sym->Id);
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgRecEnd ();
         }
     }
 }
@@ -76,7 +76,7 @@ DbgSym* ReadDbgSym (FILE* F, ObjData* Obj, unsigned Id);
 struct HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* Obj, unsigned Id);
 /* Read a hll debug symbol from a file, insert and return it */
 
-void PrintDbgSyms (FILE* F);
+void PrintDbgSyms (void);
 /* Print the debug symbols in a debug file */
 
 unsigned DbgSymCount (void);
@@ -85,7 +85,7 @@ unsigned DbgSymCount (void);
 unsigned HLLDbgSymCount (void);
 /* Return the total number of high level language debug symbols */
 
-void PrintHLLDbgSyms (FILE* F);
+void PrintHLLDbgSyms (void);
 /* Print the high level language debug symbols in a debug file */
 
 void PrintDbgSymLabels (FILE* F);
@@ -76,7 +76,16 @@ static unsigned         ImpOpen  = 0;           /* Count of open imports */
 
 /* Export management variables */
 static unsigned         ExpCount = 0;           /* Export count */
-static Export**         ExpPool  = 0;           /* Exports array */
+
+/* Export indexes. ExpPool contains all exports sorted by name and is built
+** once all modules are loaded. The values of the exports and the order by
+** value are calculated on first use, after all addresses are known, and are
+** shared by the map and label file generators.
+*/
+static unsigned         ExpPoolCount = 0;       /* Number of exports in pool */
+static Export**         ExpPool  = 0;           /* Exports sorted by name */
+static long*            ExpVal = 0;             /* Export values by name */
+static unsigned*        ExpValXlat = 0;         /* Pool indices by value */
 
 /* Defines for the flags in Import */
 #define IMP_INLIST      0x0001U                 /* Import is in exports list */
@@ -644,6 +653,24 @@ int IsUnresolvedExport (const Export* E)
 
 
 
+void WalkUnresolved (void (*F) (unsigned Name, void* Data), void* Data)
+/* Call F for the names of all unresolved exports */
+{
+    unsigned I;
+
+    for (I = 0; I < sizeof (HashTab) / sizeof (HashTab [0]); ++I) {
+        const Export* E = HashTab[I];
+        while (E) {
+            if (IsUnresolvedExport (E)) {
+                F (E->Name, Data);
+            }
+            E = E->Next;
+        }
+    }
+}
+
+
+
 int IsConstExport (const Export* E)
 /* Return true if the expression associated with this export is const */
 {
@@ -745,7 +772,7 @@ static void CheckSymTypes (void)
     unsigned I;
 
     /* Print all open imports */
-    for (I = 0; I < ExpCount; ++I) {
+    for (I = 0; I < ExpPoolCount; ++I) {
         const Export* E = ExpPool [I];
         if (E->Expr != 0 && E->ImpCount > 0) {
             /* External with matching imports */
@@ -764,7 +791,7 @@ static void PrintUnresolved (ExpCheckFunc F, void* Data)
     unsigned I;
 
     /* Print all open imports */
-    for (I = 0; I < ExpCount; ++I) {
+    for (I = 0; I < ExpPoolCount; ++I) {
         Export* E = ExpPool [I];
         if (E->Expr == 0 && E->ImpCount > 0 && F (E->Name, Data) == 0) {
             /* Unresolved external */
@@ -803,11 +830,14 @@ static void CreateExportPool (void)
 {
     unsigned I, J;
 
-    /* Allocate memory */
-    if (ExpPool) {
-        xfree (ExpPool);
-    }
+    /* Allocate memory. Values calculated for an old pool are invalid. */
+    xfree (ExpPool);
+    xfree (ExpVal);
+    xfree (ExpValXlat);
+    ExpVal = 0;
+    ExpValXlat = 0;
     ExpPool = xmalloc (ExpCount * sizeof (Export*));
+    ExpPoolCount = ExpCount;
 
     /* Walk through the list and insert the exports */
     for (I = 0, J = 0; I < sizeof (HashTab) / sizeof (HashTab [0]); ++I) {
@@ -870,77 +900,111 @@ static char GetAddrSizeCode (unsigned char AddrSize)
 
 
 
-void PrintExportMapByName (FILE* F)
-/* Print an export map, sorted by symbol name, to the given file */
+static int CmpExpValue (const void* I1, const void* I2)
+/* Compare function for qsort */
+{
+    unsigned X1 = *(const unsigned*) I1;
+    unsigned X2 = *(const unsigned*) I2;
+    long V1 = ExpVal [X1];
+    long V2 = ExpVal [X2];
+
+    /* Symbols with the same value are sorted by name */
+    if (V1 != V2) {
+        return V1 < V2 ? -1 : 1;
+    }
+    return X1 < X2 ? -1 : X1 > X2;
+}
+
+
+
+static void CreateExportValues (void)
+/* Calculate the values of all exports in the pool and create the index that
+** sorts them by value. Must not be called before all addresses are known.
+** Does nothing if the values have already been calculated.
+*/
 {
     unsigned I;
-    unsigned Count;
 
-    /* Print all exports */
-    Count = 0;
-    for (I = 0; I < ExpCount; ++I) {
-        const Export* E = ExpPool [I];
+    /* Rebuild the pool if exports were added after it was created */
+    if (ExpPool == 0 || ExpPoolCount != ExpCount) {
+        CreateExportPool ();
+    }
 
-        /* Print unreferenced symbols only if explictly requested */
-        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
-            fprintf (F,
-                     "%-25s %06lX %c%c%c%c   ",
-                     GetString (E->Name),
-                     GetExportVal (E),
-                     E->ImpCount? 'R' : ' ',
-                     SYM_IS_LABEL (E->Type)? 'L' : 'E',
-                     GetAddrSizeCode ((unsigned char) E->AddrSize),
-                     SYM_IS_CONDES (E->Type)? 'I' : ' ');
-            if (++Count == 2) {
-                Count = 0;
-                fprintf (F, "\n");
-            }
+    if (ExpVal == 0) {
+
+        /* Evaluate each export exactly once */
+        ExpVal     = xmalloc (ExpPoolCount * sizeof (long));
+        ExpValXlat = xmalloc (ExpPoolCount * sizeof (unsigned));
+        for (I = 0; I < ExpPoolCount; ++I) {
+            ExpVal [I]     = GetExportVal (ExpPool [I]);
+            ExpValXlat [I] = I;
         }
+
+        /* Sort the translation table by value */
+        qsort (ExpValXlat, ExpPoolCount, sizeof (unsigned), CmpExpValue);
     }
-    fprintf (F, "\n");
 }
 
 
 
-static int CmpExpValue (const void* I1, const void* I2)
-/* Compare function for qsort */
+unsigned ExportCount (void)
+/* Return the number of exports in the sorted export indexes */
 {
-    long V1 = GetExportVal (ExpPool [*(unsigned *)I1]);
-    long V2 = GetExportVal (ExpPool [*(unsigned *)I2]);
+    CreateExportValues ();
+    return ExpPoolCount;
+}
+
 
-    return V1 < V2 ? -1 : V1 == V2 ? 0 : 1;
+
+const Export* GetExportByName (unsigned Index, long* Val)
+/* Return the export with the given index in the list of exports sorted by
+** name. If Val is not NULL, the value of the export is stored there.
+*/
+{
+    CreateExportValues ();
+    PRECONDITION (Index < ExpPoolCount);
+    if (Val) {
+        *Val = ExpVal [Index];
+    }
+    return ExpPool [Index];
 }
 
 
 
-void PrintExportMapByValue (FILE* F)
-/* Print an export map, sorted by symbol value, to the given file */
+const Export* GetExportByValue (unsigned Index, long* Val)
+/* Return the export with the given index in the list of exports sorted by
+** value. If Val is not NULL, the value of the export is stored there.
+*/
+{
+    CreateExportValues ();
+    PRECONDITION (Index < ExpPoolCount);
+    return GetExportByName (ExpValXlat [Index], Val);
+}
+
+
+
+static void PrintExportMap (FILE* F, int ByValue)
+/* Print an export map, sorted by name or by value, to the given file */
 {
     unsigned I;
     unsigned Count;
-    unsigned *ExpValXlat;
-
-    /* Create a translation table where the symbols are sorted by value. */
-    ExpValXlat = xmalloc (ExpCount * sizeof (unsigned));
-    for (I = 0; I < ExpCount; ++I) {
-        /* Initialize table with current sort order.  */
-        ExpValXlat [I] = I;
-    }
 
-    /* Sort them by value */
-    qsort (ExpValXlat, ExpCount, sizeof (unsigned), CmpExpValue);
+    /* Make sure the indexes are valid */
+    CreateExportValues ();
 
     /* Print all exports */
     Count = 0;
-    for (I = 0; I < ExpCount; ++I) {
-        const Export* E = ExpPool [ExpValXlat [I]];
+    for (I = 0; I < ExpPoolCount; ++I) {
+        long Val;
+        const Export* E = ByValue? GetExportByValue (I, &Val) :
+                                   GetExportByName (I, &Val);
 
         /* Print unreferenced symbols only if explictly requested */
         if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
                      GetString (E->Name),
-                     GetExportVal (E),
+                     Val,
                      E->ImpCount? 'R' : ' ',
                      SYM_IS_LABEL (E->Type)? 'L' : 'E',
                      GetAddrSizeCode ((unsigned char) E->AddrSize),
@@ -952,7 +1016,22 @@ void PrintExportMapByValue (FILE* F)
         }
     }
     fprintf (F, "\n");
-    xfree (ExpValXlat);
+}
+
+
+
+void PrintExportMapByName (FILE* F)
+/* Print an export map, sorted by symbol name, to the given file */
+{
+    PrintExportMap (F, 0);
+}
+
+
+
+void PrintExportMapByValue (FILE* F)
+/* Print an export map, sorted by symbol value, to the given file */
+{
+    PrintExportMap (F, 1);
 }
 
 
@@ -964,7 +1043,7 @@ void PrintImportMap (FILE* F)
     const Import* Imp;
 
     /* Loop over all exports */
-    for (I = 0; I < ExpCount; ++I) {
+    for (I = 0; I < ExpPoolCount; ++I) {
 
         /* Get the export */
         const Export* Exp = ExpPool [I];
@@ -1016,10 +1095,14 @@ void PrintExportLabels (FILE* F)
 {
     unsigned I;
 
+    /* Make sure the indexes are valid */
+    CreateExportValues ();
+
     /* Print all exports */
-    for (I = 0; I < ExpCount; ++I) {
-        const Export* E = ExpPool [I];
-        fprintf (F, "al %06lX .%s\n", GetExportVal (E), GetString (E->Name));
+    for (I = 0; I < ExpPoolCount; ++I) {
+        long Val;
+        const Export* E = GetExportByName (I, &Val);
+        fprintf (F, "al %06lX .%s\n", Val, GetString (E->Name));
     }
 }
 
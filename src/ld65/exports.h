@@ -170,6 +170,9 @@ int IsUnresolved (unsigned Name);
 int IsUnresolvedExport (const Export* E);
 /* Return true if the given export is unresolved */
 
+void WalkUnresolved (void (*F) (unsigned Name, void* Data), void* Data);
+/* Call F for the names of all unresolved exports */
+
 int IsConstExport (const Export* E);
 /* Return true if the expression associated with this export is const */
 
@@ -186,6 +189,19 @@ void CheckUnresolvedImports (ExpCheckFunc F, void* Data);
 ** called (see the comments on ExpCheckFunc in the data section).
 */
 
+unsigned ExportCount (void);
+/* Return the number of exports in the sorted export indexes */
+
+const Export* GetExportByName (unsigned Index, long* Val);
+/* Return the export with the given index in the list of exports sorted by
+** name. If Val is not NULL, the value of the export is stored there.
+*/
+
+const Export* GetExportByValue (unsigned Index, long* Val);
+/* Return the export with the given index in the list of exports sorted by
+** value. If Val is not NULL, the value of the export is stored there.
+*/
+
 void PrintExportMapByName (FILE* F);
 /* Print an export map to the given file (sorted by symbol name) */
 
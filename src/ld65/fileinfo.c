@@ -38,8 +38,9 @@
 #include "xmalloc.h"
 
 /* ld65 */
-#include "fileio.h"
+#include "dbgfile.h"
 #include "fileinfo.h"
+#include "fileio.h"
 #include "objdata.h"
 #include "spool.h"
 
@@ -227,7 +228,7 @@ void AssignFileInfoIds (void)
 
 
 
-void PrintDbgFileInfo (FILE* F)
+void PrintDbgFileInfo (void)
 /* Output the file info to a debug info file */
 {
     unsigned I, J;
@@ -239,25 +240,24 @@ void PrintDbgFileInfo (FILE* F)
         const FileInfo* FI = CollAtUnchecked (&FileInfos, I);
 
         /* Base info */
-        fprintf (F,
-                 "file\tid=%u,name=\"%s\",size=%lu,mtime=0x%08lX,mod=",
-                 FI->Id, GetString (FI->Name), FI->Size, FI->MTime);
+        DbgRecStart ("file");
+        DbgAttrNum ("id", FI->Id);
+        DbgAttrStr ("name", GetString (FI->Name));
+        DbgAttrNum ("size", FI->Size);
+        DbgAttrHex ("mtime", FI->MTime, 8);
 
         /* Modules that use the file */
+        DbgAttrListStart ("mod");
         for (J = 0; J < CollCount (&FI->Modules); ++J) {
 
             /* Get the module */
             const ObjData* O = CollConstAt (&FI->Modules, J);
 
             /* Output its id */
-            if (J > 0) {
-                fprintf (F, "+%u", O->Id);
-            } else {
-                fprintf (F, "%u", O->Id);
-            }
+            DbgAttrListItem (O->Id);
         }
 
         /* Terminate the output line */
-        fputc ('\n', F);
+        DbgRecEnd ();
     }
 }
@@ -81,7 +81,7 @@ unsigned FileInfoCount (void);
 void AssignFileInfoIds (void);
 /* Assign the ids to the file infos */
 
-void PrintDbgFileInfo (FILE* F);
+void PrintDbgFileInfo (void);
 /* Output the file info to a debug info file */
 
 
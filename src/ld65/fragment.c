@@ -75,6 +75,7 @@ Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
     F->Expr      = 0;
     F->LineInfos = EmptyCollection;
     F->Type      = Type;
+    F->Flags     = 0;
 
     /* Insert the code fragment into the section */
     if (S->FragRoot == 0) {
@@ -73,6 +73,7 @@ struct Fragment {
     struct ExprNode*    Expr;           /* Expression if FRAG_EXPR */
     Collection          LineInfos;      /* Line info for this fragment */
     unsigned char       Type;           /* Type of fragment */
+    unsigned char       Flags;          /* Fragment flags */
     unsigned char       LitBuf [1];     /* Dynamically alloc'ed literal buffer */
 };
 
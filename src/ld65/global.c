@@ -56,3 +56,7 @@ unsigned char VerboseMap    = 0;        /* Verbose map file */
 const char* MapFileName     = 0;        /* Name of the map file */
 const char* LabelFileName   = 0;        /* Name of the label file */
 const char* DbgFileName     = 0;        /* Name of the debug file */
+const char* SizeReportName  = 0;        /* Name of the size report */
+const char* SizeBaselineName = 0;       /* Previous size report */
+unsigned char HaveSizeLimit = 0;        /* Size limit not given */
+unsigned long SizeLimit     = 0;        /* Allowed growth of an item */
@@ -56,6 +56,10 @@ extern unsigned char    VerboseMap;     /* Verbose map file */
 extern const char*      MapFileName;    /* Name of the map file */
 extern const char*      LabelFileName;  /* Name of the label file */
 extern const char*      DbgFileName;    /* Name of the debug file */
+extern const char*      SizeReportName; /* Name of the size report */
+extern const char*      SizeBaselineName; /* Previous size report */
+extern unsigned char    HaveSizeLimit;  /* True if a size limit was given */
+extern unsigned long    SizeLimit;      /* Allowed growth of an item */
 
 
 
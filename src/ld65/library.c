@@ -38,14 +38,17 @@
 #include <errno.h>
 
 /* common */
+#include "attrib.h"
 #include "coll.h"
 #include "exprdefs.h"
+#include "hashfunc.h"
 #include "libdefs.h"
 #include "objdefs.h"
 #include "symdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "exports.h"
 #include "fileio.h"
@@ -70,6 +73,9 @@ struct Library {
     FILE*       F;              /* Open file stream */
     LibHeader   Header;         /* Library header */
     Collection  Modules;        /* Modules */
+    unsigned char* ExpTab;      /* Export table from the library or NULL */
+    unsigned long  ExpBuckets;  /* Number of buckets in the export table */
+    unsigned long  ExpCount;    /* Number of entries in the export table */
 };
 
 /* List of open libraries */
@@ -100,6 +106,9 @@ static Library* NewLibrary (FILE* F, const char* Name)
     L->Name     = GetStringId (Name);
     L->F        = F;
     L->Modules  = EmptyCollection;
+    L->ExpTab     = 0;
+    L->ExpBuckets = 0;
+    L->ExpCount   = 0;
 
     /* Return the new struct */
     return L;
@@ -125,8 +134,9 @@ static void FreeLibrary (Library* L)
     /* Close the library */
     CloseLibrary (L);
 
-    /* Free the module index */
+    /* Free the module index and the export table */
     DoneCollection (&L->Modules);
+    xfree (L->ExpTab);
 
     /* Free the library structure */
     xfree (L);
@@ -253,6 +263,50 @@ static void ReadBasicData (Library* L, ObjData* O)
 
     /* Read the exports */
     ObjReadExports (L->F, O->Start + O->Header.ExportOffs, O);
+
+    /* Remember that we have the data */
+    O->Flags |= OBJ_BASICDATA;
+}
+
+
+
+static void LibReadExpTab (Library* L)
+/* Read the export table that may follow the index. If there is none or if it
+** is invalid, L->ExpTab is left empty.
+*/
+{
+    unsigned char   Buf[8];
+    unsigned long   Pos;
+    unsigned long   Size;
+    long            End;
+
+    /* Libraries written by older versions of ar65 end after the index */
+    Pos = ftell (L->F);
+    if (fread (Buf, 1, sizeof (Buf), L->F) != sizeof (Buf) ||
+        GetExpTab32 (Buf) != LIB_EXP_MAGIC) {
+        return;
+    }
+
+    /* Check that the table is actually in the file */
+    Size = GetExpTab32 (Buf + 4);
+    if (fseek (L->F, 0, SEEK_END) != 0 || (End = ftell (L->F)) < 0 ||
+        (unsigned long) End - Pos - sizeof (Buf) < Size) {
+        Warning ("Ignoring invalid export table in `%s'", GetString (L->Name));
+        return;
+    }
+
+    /* Read and check the table */
+    L->ExpTab = xmalloc (Size);
+    LibSeek (L, Pos + sizeof (Buf));
+    ReadData (L->F, L->ExpTab, Size);
+    if (!CheckExpTab (L->ExpTab, Size, CollCount (&L->Modules))) {
+        Warning ("Ignoring invalid export table in `%s'", GetString (L->Name));
+        xfree (L->ExpTab);
+        L->ExpTab = 0;
+        return;
+    }
+    L->ExpBuckets = GetExpTab32 (L->ExpTab);
+    L->ExpCount   = GetExpTab32 (L->ExpTab + 4 + L->ExpBuckets * 4);
 }
 
 
@@ -274,6 +328,14 @@ static void LibReadIndex (Library* L)
         CollAppend (&L->Modules, ReadIndexEntry (L));
     }
 
+    /* If the library has an export table, the basic data is read only for
+    ** the modules that are actually checked when resolving imports.
+    */
+    LibReadExpTab (L);
+    if (L->ExpTab) {
+        return;
+    }
+
     /* Walk over the index and read basic data for all object files in the
     ** library.
     */
@@ -290,6 +352,91 @@ static void LibReadIndex (Library* L)
 
 
 
+static void LibMarkExporters (unsigned Name, void* Data attribute ((unused)))
+/* Use the export tables to mark all modules in the open libraries that export
+** the given name as candidates.
+*/
+{
+    unsigned    I;
+    const char* S = GetString (Name);
+    unsigned    Hash = HashStr (S);
+
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+
+        /* Get the library and its export table */
+        const Library* L = CollConstAt (&OpenLibs, I);
+        const unsigned char* Start;
+        const unsigned char* Entries;
+        const char* Names;
+        unsigned long E, Last;
+
+        /* Get the entries in the bucket for this name */
+        Start   = L->ExpTab + 4 + (Hash & (L->ExpBuckets - 1)) * 4;
+        Entries = L->ExpTab + (L->ExpBuckets + 2) * 4;
+        Names   = (const char*) Entries + L->ExpCount * 8;
+        Last    = GetExpTab32 (Start + 4);
+        for (E = GetExpTab32 (Start); E < Last; ++E) {
+            if (strcmp (Names + GetExpTab32 (Entries + E * 8 + 4), S) == 0) {
+                ObjData* O = CollAt (&L->Modules, GetExpTab32 (Entries + E * 8));
+                O->Flags |= OBJ_CANDIDATE;
+            }
+        }
+    }
+}
+
+
+
+static void LibMarkImports (const ObjData* O)
+/* Mark all modules that may resolve an open import of O as candidates */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&O->Imports); ++I) {
+        const Import* Imp = CollConstAt (&O->Imports, I);
+        if (IsUnresolved (Imp->Name)) {
+            LibMarkExporters (Imp->Name, 0);
+        }
+    }
+}
+
+
+
+static int LibPrepareResolve (void)
+/* Prepare resolving imports from the open libraries. If all libraries have
+** export tables, mark the modules that may resolve one of the currently
+** unresolved imports as candidates, and return true. Otherwise read the
+** basic data for all modules, and return false.
+*/
+{
+    unsigned I, J;
+
+    /* Check if all open libraries have export tables */
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+        const Library* L = CollConstAt (&OpenLibs, I);
+        if (L->ExpTab == 0) {
+            break;
+        }
+    }
+    if (I == CollCount (&OpenLibs)) {
+        WalkUnresolved (LibMarkExporters, 0);
+        return 1;
+    }
+
+    /* Read basic data for all modules where this wasn't done before */
+    for (I = 0; I < CollCount (&OpenLibs); ++I) {
+        Library* L = CollAt (&OpenLibs, I);
+        for (J = 0; J < CollCount (&L->Modules); ++J) {
+            ObjData* O = CollAtUnchecked (&L->Modules, J);
+            if ((O->Flags & OBJ_BASICDATA) == 0) {
+                ReadBasicData (L, O);
+            }
+        }
+    }
+    return 0;
+}
+
+
+
 static void LibCheckExports (ObjData* O)
 /* Check if the exports from this file can satisfy any import requests. If so,
 ** insert the imports and exports from this file and mark the file as added.
@@ -297,6 +444,11 @@ static void LibCheckExports (ObjData* O)
 {
     unsigned I;
 
+    /* Read the basic data if we don't have it already */
+    if ((O->Flags & OBJ_BASICDATA) == 0) {
+        ReadBasicData (O->Lib, O);
+    }
+
     /* Check all exports */
     for (I = 0; I < CollCount (&O->Exports); ++I) {
         const Export* E = CollConstAt (&O->Exports, I);
@@ -334,9 +486,15 @@ static void LibResolve (void)
 {
     unsigned I, J;
     unsigned Additions;
+    int      Indexed;
+
+    /* Use the export tables of the libraries if possible */
+    Indexed = LibPrepareResolve ();
 
     /* Walk repeatedly over all open libraries until there's nothing more
-    ** to add.
+    ** to add. If the export tables are used, only the candidates are
+    ** checked. Since candidates are marked for each new import, this will
+    ** add the same modules in the same order as checking all modules.
     */
     do {
 
@@ -358,11 +516,16 @@ static void LibResolve (void)
                 ObjData* O = CollAtUnchecked (&L->Modules, J);
 
                 /* We only need to check this module if it wasn't added before */
-                if ((O->Flags & OBJ_REF) == 0) {
+                if ((O->Flags & OBJ_REF) == 0 &&
+                    (!Indexed || (O->Flags & OBJ_CANDIDATE) != 0)) {
+                    O->Flags &= ~OBJ_CANDIDATE;
                     LibCheckExports (O);
                     if (O->Flags & OBJ_REF) {
                         /* The routine added the file */
                         ++Additions;
+                        if (Indexed) {
+                            LibMarkImports (O);
+                        }
                     }
                 }
             }
@@ -539,7 +702,7 @@ unsigned LibraryCount (void)
 
 
 
-void PrintDbgLibraries (FILE* F)
+void PrintDbgLibraries (void)
 /* Output the libraries to a debug info file */
 {
     unsigned I;
@@ -550,6 +713,9 @@ void PrintDbgLibraries (FILE* F)
         const Library* L = CollAtUnchecked (&LibraryList, I);
 
         /* Output the info */
-        fprintf (F, "lib\tid=%u,name=\"%s\"\n", L->Id, GetString (L->Name));
+        DbgRecStart ("lib");
+        DbgAttrNum ("id", L->Id);
+        DbgAttrStr ("name", GetString (L->Name));
+        DbgRecEnd ();
     }
 }
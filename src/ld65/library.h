@@ -84,7 +84,7 @@ unsigned GetLibId (const struct Library* L);
 unsigned LibraryCount (void);
 /* Return the total number of libraries */
 
-void PrintDbgLibraries (FILE* F);
+void PrintDbgLibraries (void);
 /* Output the libraries to a debug info file */
 
 
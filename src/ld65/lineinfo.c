@@ -39,6 +39,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "fileinfo.h"
 #include "fileio.h"
@@ -242,7 +243,7 @@ void AssignLineInfoIds (void)
 
 
 
-void PrintDbgLineInfo (FILE* F)
+void PrintDbgLineInfo (void)
 /* Output the line infos to a debug info file */
 {
     unsigned I, J;
@@ -264,23 +265,24 @@ void PrintDbgLineInfo (FILE* F)
             unsigned Count = LI_GET_COUNT (LI->Type);
 
             /* Print the start of the line */
-            fprintf (F,
-                     "line\tid=%u,file=%u,line=%u",
-                     LI->Id, LI->File->Id, GetSourceLine (LI));
+            DbgRecStart ("line");
+            DbgAttrNum ("id", LI->Id);
+            DbgAttrNum ("file", LI->File->Id);
+            DbgAttrNum ("line", GetSourceLine (LI));
 
             /* Print type if not LI_TYPE_ASM and count if not zero */
             if (Type != LI_TYPE_ASM) {
-                fprintf (F, ",type=%u", Type);
+                DbgAttrNum ("type", Type);
             }
             if (Count != 0) {
-                fprintf (F, ",count=%u", Count);
+                DbgAttrNum ("count", Count);
             }
 
             /* Add spans if the line info has it */
-            PrintDbgSpanList (F, O, LI->Spans);
+            PrintDbgSpanList (O, LI->Spans);
 
             /* Terminate line */
-            fputc ('\n', F);
+            DbgRecEnd ();
         }
     }
 }
@@ -180,7 +180,7 @@ unsigned LineInfoCount (void);
 void AssignLineInfoIds (void);
 /* Assign the ids to the line infos */
 
-void PrintDbgLineInfo (FILE* F);
+void PrintDbgLineInfo (void);
 /* Output the line infos to a debug info file */
 
 
@@ -52,6 +52,7 @@
 
 /* ld65 */
 #include "asserts.h"
+#include "banks.h"
 #include "binfmt.h"
 #include "condes.h"
 #include "config.h"
@@ -66,6 +67,7 @@
 #include "objfile.h"
 #include "scanner.h"
 #include "segments.h"
+#include "sizereport.h"
 #include "spool.h"
 #include "tpool.h"
 
@@ -131,6 +133,7 @@ static void Usage (void)
             "  --cfg-path path\tSpecify a config file search path\n"
             "  --config name\t\tUse linker config file\n"
             "  --dbgfile name\tGenerate debug information\n"
+            "  --dbgfile-format fmt\tDebug file format (text or binary)\n"
             "  --define sym=val\tDefine a symbol\n"
             "  --end-group\t\tEnd a library group\n"
             "  --force-import sym\tForce an import of symbol `sym'\n"
@@ -138,9 +141,13 @@ static void Usage (void)
             "  --lib file\t\tLink this library\n"
             "  --lib-path path\tSpecify a library search path\n"
             "  --mapfile name\tCreate a map file\n"
+            "  --mapfile-format fmt\tMap file format (text or json)\n"
             "  --module-id id\tSpecify a module id\n"
             "  --obj file\t\tLink this object file\n"
             "  --obj-path path\tSpecify an object file search path\n"
+            "  --size-baseline name\tCompare the size report against name\n"
+            "  --size-limit n\t\tFail if an item grew by more than n bytes\n"
+            "  --size-report name\tCreate a size report\n"
             "  --start-addr addr\tSet the default start address\n"
             "  --start-group\t\tStart a library group\n"
             "  --target sys\t\tSet the target system\n"
@@ -340,6 +347,20 @@ static void OptDbgFile (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptDbgFileFormat (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the format of the debug file */
+{
+    if (strcmp (Arg, "text") == 0) {
+        DbgFileFormat = DBGFILE_FORMAT_TEXT;
+    } else if (strcmp (Arg, "binary") == 0) {
+        DbgFileFormat = DBGFILE_FORMAT_BINARY;
+    } else {
+        Error ("Invalid debug file format: `%s'", Arg);
+    }
+}
+
+
+
 static void OptDefine (const char* Opt attribute ((unused)), const char* Arg)
 /* Define a symbol on the command line */
 {
@@ -435,6 +456,20 @@ static void OptMapFile (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptMapFileFormat (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the format of the map file */
+{
+    if (strcmp (Arg, "text") == 0) {
+        MapFileFormat = MAPFILE_FORMAT_TEXT;
+    } else if (strcmp (Arg, "json") == 0) {
+        MapFileFormat = MAPFILE_FORMAT_JSON;
+    } else {
+        Error ("Invalid map file format: `%s'", Arg);
+    }
+}
+
+
+
 static void OptModuleId (const char* Opt, const char* Arg)
 /* Specify a module id */
 {
@@ -479,6 +514,34 @@ static void OptOutputName (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptSizeBaseline (const char* Opt attribute ((unused)), const char* Arg)
+/* Give the name of a previous size report */
+{
+    SizeBaselineName = Arg;
+}
+
+
+
+static void OptSizeLimit (const char* Opt, const char* Arg)
+/* Set the allowed growth of the items in the size report */
+{
+    SizeLimit = CvtNumber (Opt, Arg);
+    HaveSizeLimit = 1;
+}
+
+
+
+static void OptSizeReport (const char* Opt attribute ((unused)), const char* Arg)
+/* Give the name of the size report */
+{
+    if (SizeReportName) {
+        Error ("Cannot use --size-report twice");
+    }
+    SizeReportName = Arg;
+}
+
+
+
 static void OptStartAddr (const char* Opt, const char* Arg)
 /* Set the default start address */
 {
@@ -602,6 +665,7 @@ static void ParseCommandLine(void)
         { "--cfg-path",         1,      OptCfgPath              },
         { "--config",           1,      CmdlOptConfig           },
         { "--dbgfile",          1,      OptDbgFile              },
+        { "--dbgfile-format",   1,      OptDbgFileFormat        },
         { "--define",           1,      OptDefine               },
         { "--end-group",        0,      CmdlOptEndGroup         },
         { "--force-import",     1,      OptForceImport          },
@@ -609,9 +673,13 @@ static void ParseCommandLine(void)
         { "--lib",              1,      OptLib                  },
         { "--lib-path",         1,      OptLibPath              },
         { "--mapfile",          1,      OptMapFile              },
+        { "--mapfile-format",   1,      OptMapFileFormat        },
         { "--module-id",        1,      OptModuleId             },
         { "--obj",              1,      OptObj                  },
         { "--obj-path",         1,      OptObjPath              },
+        { "--size-baseline",    1,      OptSizeBaseline         },
+        { "--size-limit",       1,      OptSizeLimit            },
+        { "--size-report",      1,      OptSizeReport           },
         { "--start-addr",       1,      OptStartAddr            },
         { "--start-group",      0,      CmdlOptStartGroup       },
         { "--target",           1,      CmdlOptTarget           },
@@ -789,6 +857,11 @@ int main (int argc, char* argv [])
         Error ("No object files to link");
     }
 
+    /* The size limit is checked against the baseline of the size report */
+    if (HaveSizeLimit && (SizeReportName == 0 || SizeBaselineName == 0)) {
+        Error ("--size-limit needs --size-report and --size-baseline");
+    }
+
     /* Check if we have a valid configuration */
     if (!CfgAvail ()) {
         Error ("Memory configuration missing");
@@ -800,6 +873,9 @@ int main (int argc, char* argv [])
     /* Create the condes tables if requested */
     ConDesCreate ();
 
+    /* Redirect cross bank calls through trampolines if requested */
+    BankCreateTrampolines ();
+
     /* Process data from the config file. Assign start addresses for the
     ** segments, define linker symbols. The function will return the number
     ** of memory area overflows (zero on success).
@@ -820,6 +896,9 @@ int main (int argc, char* argv [])
         if (MapFileName) {
             CreateMapFile (SHORT_MAPFILE);
         }
+        if (SizeReportName) {
+            CreateSizeReport ();
+        }
         Error ("Cannot generate most of the files due to memory area overflow%c",
                (MemoryAreaOverflows > 1) ? 's' : ' ');
     }
@@ -840,6 +919,9 @@ int main (int argc, char* argv [])
     if (DbgFileName) {
         CreateDbgFile ();
     }
+    if (SizeReportName) {
+        CreateSizeReport ();
+    }
 
     /* Dump the data for debugging */
     if (Verbosity > 1) {
@@ -37,7 +37,12 @@
 #include <string.h>
 #include <errno.h>
 
+/* common */
+#include "addrsize.h"
+#include "symdefs.h"
+
 /* ld65 */
+#include "banks.h"
 #include "config.h"
 #include "dbgsyms.h"
 #include "exports.h"
@@ -45,12 +50,219 @@
 #include "error.h"
 #include "library.h"
 #include "mapfile.h"
+#include "memarea.h"
 #include "objdata.h"
 #include "segments.h"
 #include "spool.h"
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Format of the map file */
+unsigned char           MapFileFormat = MAPFILE_FORMAT_TEXT;
+
+
+
+/*****************************************************************************/
+/*                              JSON map files                               */
+/*****************************************************************************/
+
+
+
+static void PrintJSONString (FILE* F, const char* S)
+/* Print a string as JSON string constant including the quotes */
+{
+    fputc ('"', F);
+    while (*S) {
+        unsigned char C = (unsigned char) *S++;
+        if (C == '"' || C == '\\') {
+            fputc ('\\', F);
+            fputc (C, F);
+        } else if (C < 0x20) {
+            fprintf (F, "\\u%04X", C);
+        } else {
+            fputc (C, F);
+        }
+    }
+    fputc ('"', F);
+}
+
+
+
+static void PrintJSONModules (FILE* F)
+/* Print the list of modules with their sections */
+{
+    unsigned I, J;
+
+    fputs ("  \"modules\": [", F);
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        unsigned long Size = 0;
+        unsigned Count = 0;
+
+        /* Get the object file */
+        const ObjData* O = CollConstAt (&ObjDataList, I);
+
+        /* Calculate the size of the module */
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            const Section* S = CollConstAt (&O->Sections, J);
+            Size += S->Size;
+        }
+
+        fputs (I? ",\n    { \"name\": " : "\n    { \"name\": ", F);
+        PrintJSONString (F, GetObjFileName (O));
+        fputs (", \"library\": ", F);
+        if (O->Lib) {
+            PrintJSONString (F, GetLibFileName (O->Lib));
+        } else {
+            fputs ("null", F);
+        }
+        fprintf (F, ", \"size\": %lu,\n      \"sections\": [", Size);
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            const Section* S = CollConstAt (&O->Sections, J);
+            /* Don't include zero sized sections if not explicitly
+            ** requested
+            */
+            if (VerboseMap || S->Size > 0) {
+                fputs (Count++? ",\n        { \"segment\": " :
+                                "\n        { \"segment\": ", F);
+                PrintJSONString (F, GetString (S->Seg->Name));
+                fprintf (F,
+                         ", \"start\": %lu, \"offs\": %lu, \"size\": %lu, "
+                         "\"align\": %lu, \"fill\": %lu }",
+                         S->Seg->PC + S->Offs, S->Offs, S->Size,
+                         S->Alignment, S->Fill);
+            }
+        }
+        fputs (Count? "\n      ] }" : "] }", F);
+    }
+    fputs ("\n  ]", F);
+}
+
+
+
+static void PrintJSONSegments (FILE* F)
+/* Print the list of segments */
+{
+    unsigned I;
+    unsigned Count = 0;
+
+    fputs ("  \"segments\": [", F);
+    for (I = 0; I < SegmentCount (); ++I) {
+
+        /* Get the segment */
+        const Segment* S = GetSegmentById (I);
+
+        /* Print empty segments only if explicitly requested */
+        if (VerboseMap || S->Size > 0) {
+            fputs (Count++? ",\n    { \"name\": " : "\n    { \"name\": ", F);
+            PrintJSONString (F, GetString (S->Name));
+            fprintf (F,
+                     ", \"start\": %lu, \"size\": %lu, \"align\": %lu, "
+                     "\"addrsize\": \"%s\", \"type\": \"%s\", \"memory\": ",
+                     S->PC, S->Size, S->Alignment,
+                     AddrSizeToStr (S->AddrSize),
+                     S->ReadOnly? "ro" : "rw");
+            if (S->MemArea) {
+                PrintJSONString (F, GetString (S->MemArea->Name));
+            } else {
+                fputs ("null", F);
+            }
+            fputs (" }", F);
+        }
+    }
+    fputs ("\n  ]", F);
+}
+
+
+
+static void PrintJSONMemoryAreas (FILE* F)
+/* Print the list of memory areas */
+{
+    unsigned I;
+
+    fputs ("  \"memory\": [", F);
+    for (I = 0; I < CfgMemoryAreaCount (); ++I) {
+
+        /* Get the memory area */
+        const MemoryArea* M = CfgGetMemoryArea (I);
+
+        fputs (I? ",\n    { \"name\": " : "\n    { \"name\": ", F);
+        PrintJSONString (F, GetString (M->Name));
+        fprintf (F,
+                 ", \"start\": %lu, \"size\": %lu, \"used\": %lu, "
+                 "\"overflow\": %s }",
+                 M->Start, M->Size, M->FillLevel,
+                 (M->Flags & MF_OVERFLOW)? "true" : "false");
+    }
+    fputs ("\n  ]", F);
+}
+
+
+
+static void PrintJSONExports (FILE* F)
+/* Print the list of exports sorted by name */
+{
+    unsigned I;
+    unsigned Count = 0;
+
+    fputs ("  \"exports\": [", F);
+    for (I = 0; I < ExportCount (); ++I) {
+
+        long Val;
+        const Export* E = GetExportByName (I, &Val);
+
+        /* Print unreferenced symbols only if explictly requested */
+        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
+            fputs (Count++? ",\n    { \"name\": " : "\n    { \"name\": ", F);
+            PrintJSONString (F, GetString (E->Name));
+            fprintf (F,
+                     ", \"value\": %ld, \"size\": %u, \"type\": \"%s\", "
+                     "\"addrsize\": \"%s\", \"referenced\": %s, "
+                     "\"condes\": %s, \"module\": ",
+                     Val, E->Size,
+                     SYM_IS_LABEL (E->Type)? "label" : "equate",
+                     AddrSizeToStr ((unsigned char) E->AddrSize),
+                     E->ImpCount? "true" : "false",
+                     SYM_IS_CONDES (E->Type)? "true" : "false");
+            if (E->Obj) {
+                PrintJSONString (F, GetObjFileName (E->Obj));
+            } else {
+                fputs ("null", F);
+            }
+            fputs (" }", F);
+        }
+    }
+    fputs ("\n  ]", F);
+}
+
+
+
+static void CreateJSONMapFile (FILE* F, int ShortMap)
+/* Write a map file in JSON format. If ShortMap is true, the exports are
+** not written.
+*/
+{
+    fputs ("{\n", F);
+    PrintJSONModules (F);
+    fputs (",\n", F);
+    PrintJSONSegments (F);
+    fputs (",\n", F);
+    PrintJSONMemoryAreas (F);
+    if (!ShortMap) {
+        fputs (",\n", F);
+        PrintJSONExports (F);
+    }
+    fputs ("\n}\n", F);
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -70,6 +282,15 @@ void CreateMapFile (int ShortMap)
         Error ("Cannot create map file `%s': %s", MapFileName, strerror (errno));
     }
 
+    /* JSON map files are handled separately */
+    if (MapFileFormat == MAPFILE_FORMAT_JSON) {
+        CreateJSONMapFile (F, ShortMap);
+        if (fclose (F) != 0) {
+            Error ("Error closing map file `%s': %s", MapFileName, strerror (errno));
+        }
+        return;
+    }
+
     /* Write a modules list */
     fprintf (F, "Modules list:\n"
                 "-------------\n");
@@ -108,6 +329,9 @@ void CreateMapFile (int ShortMap)
                 "-------------\n");
     PrintSegmentMap (F);
 
+    /* Write the bank usage if we have banked memory */
+    PrintBankMap (F);
+
     /* The remainder is not written for short map files */
     if (!ShortMap) {
 
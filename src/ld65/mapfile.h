@@ -50,6 +50,15 @@ enum {
     SHORT_MAPFILE
 };
 
+/* Map file formats */
+enum {
+    MAPFILE_FORMAT_TEXT,                /* Human readable text */
+    MAPFILE_FORMAT_JSON                 /* JSON for size tracking tools */
+};
+
+/* Format of the map file */
+extern unsigned char    MapFileFormat;
+
 
 
 /*****************************************************************************/
@@ -34,6 +34,7 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 #include <errno.h>
@@ -136,12 +137,23 @@ struct O65Option {
     unsigned char   Data [1];           /* Data, dynamically allocated */
 };
 
-/* A o65 relocation table */
+/* One entry in a relocation table */
+typedef struct O65Reloc O65Reloc;
+struct O65Reloc {
+    unsigned long   Offs;               /* Offset into the o65 segment */
+    unsigned        Extra;              /* Import number or low bytes */
+    unsigned char   Type;               /* Relocation type and segment id */
+};
+
+/* A o65 relocation table. Entries are collected while writing the segment
+** data and converted into the o65 byte format in one pass when the table
+** is written.
+*/
 typedef struct O65RelocTab O65RelocTab;
 struct O65RelocTab {
     unsigned        Size;               /* Size of the table */
-    unsigned        Fill;               /* Amount used */
-    unsigned char*  Buf;                /* Buffer, dynamically allocated */
+    unsigned        Count;              /* Number of entries used */
+    O65Reloc*       Entries;            /* Entries, dynamically allocated */
 };
 
 /* Structure describing the format */
@@ -165,10 +177,13 @@ struct O65Desc {
     unsigned        ZPCount;            /* Number of segments assigned to .zp */
     SegDesc**       ZPSeg;              /* Array of zp segments */
 
+    /* Segment descriptors indexed by segment id, for fast lookup */
+    unsigned        SegMapSize;         /* Number of entries in SegMap */
+    const SegDesc** SegMap;             /* Segment descriptors by id */
+
     /* Temporary data for writing segments */
     unsigned long   SegSize;
     O65RelocTab*    CurReloc;
-    long            LastOffs;
 };
 
 /* Structure for parsing expression trees */
@@ -289,46 +304,13 @@ static void CvtMemoryToSegment (ExprDesc* ED)
 
 
 
-static const SegDesc* FindSeg (SegDesc** const List, unsigned Count, const Segment* S)
-/* Search for a segment in the given list of segment descriptors and return
-** the descriptor for a segment if we found it, and NULL if not.
-*/
-{
-    unsigned I;
-
-    for (I = 0; I < Count; ++I) {
-        if (List[I]->Seg == S) {
-            /* Found */
-            return List[I];
-        }
-    }
-
-    /* Not found */
-    return 0;
-}
-
-
-
 static const SegDesc* O65FindSeg (const O65Desc* D, const Segment* S)
-/* Search for a segment in the segment lists and return it's segment descriptor */
+/* Search for a segment in the segment lists and return it's segment
+** descriptor. Return NULL if the segment is not part of the o65 file.
+*/
 {
-    const SegDesc* SD;
-
-    if ((SD = FindSeg (D->TextSeg, D->TextCount, S)) != 0) {
-        return SD;
-    }
-    if ((SD = FindSeg (D->DataSeg, D->DataCount, S)) != 0) {
-        return SD;
-    }
-    if ((SD = FindSeg (D->BssSeg, D->BssCount, S)) != 0) {
-        return SD;
-    }
-    if ((SD = FindSeg (D->ZPSeg, D->ZPCount, S)) != 0) {
-        return SD;
-    }
-
-    /* Not found */
-    return 0;
+    /* Segment ids are unique and dense, so they are used as table index */
+    return (S->Id < D->SegMapSize)? D->SegMap[S->Id] : 0;
 }
 
 
@@ -451,9 +433,9 @@ static O65RelocTab* NewO65RelocTab (void)
     O65RelocTab* R = xmalloc (sizeof (O65RelocTab));
 
     /* Initialize the data */
-    R->Size = 0;
-    R->Fill = 0;
-    R->Buf  = 0;
+    R->Size    = 0;
+    R->Count   = 0;
+    R->Entries = 0;
 
     /* Return the created struct */
     return R;
@@ -464,45 +446,129 @@ static O65RelocTab* NewO65RelocTab (void)
 static void FreeO65RelocTab (O65RelocTab* R)
 /* Free a relocation table */
 {
-    xfree (R->Buf);
+    xfree (R->Entries);
     xfree (R);
 }
 
 
 
-static void O65RelocPutByte (O65RelocTab* R, unsigned B)
-/* Put the byte into the relocation table */
+static void O65AddReloc (O65RelocTab* R, unsigned long Offs, unsigned Type,
+                         unsigned Extra)
+/* Add an entry to the relocation table */
 {
+    O65Reloc* E;
+
     /* Do we have enough space in the buffer? */
-    if (R->Fill == R->Size) {
+    if (R->Count == R->Size) {
         /* We need to grow the buffer */
         if (R->Size) {
             R->Size *= 2;
         } else {
-            R->Size = 1024;     /* Initial size */
+            R->Size = 256;      /* Initial size */
         }
-        R->Buf = xrealloc (R->Buf, R->Size);
+        R->Entries = xrealloc (R->Entries, R->Size * sizeof (O65Reloc));
     }
 
-    /* Put the byte into the buffer */
-    R->Buf [R->Fill++] = (unsigned char) B;
+    /* Fill in the new entry */
+    E = R->Entries + R->Count++;
+    E->Offs  = Offs;
+    E->Extra = Extra;
+    E->Type  = (unsigned char) Type;
 }
 
 
 
-static void O65RelocPutWord (O65RelocTab* R, unsigned W)
-/* Put a word into the relocation table */
+static int CmpReloc (const void* Left, const void* Right)
+/* Compare function for qsort */
 {
-    O65RelocPutByte (R, W);
-    O65RelocPutByte (R, W >> 8);
+    unsigned long L = ((const O65Reloc*) Left)->Offs;
+    unsigned long R = ((const O65Reloc*) Right)->Offs;
+    return (L < R)? -1 : (L > R);
 }
 
 
 
 static void O65WriteReloc (O65RelocTab* R, FILE* F)
-/* Write the relocation table to the given file */
+/* Sort the relocation table by offset and write it in o65 format to the
+** given file.
+*/
 {
-    WriteData (F, R->Buf, R->Fill);
+    unsigned        I;
+    unsigned long   Len;
+    long            LastOffs;
+    unsigned char*  Buf;
+    unsigned char*  P;
+
+    /* Segment data is written in address order, so the table is usually
+    ** sorted already.
+    */
+    for (I = 1; I < R->Count; ++I) {
+        if (R->Entries[I].Offs < R->Entries[I-1].Offs) {
+            qsort (R->Entries, R->Count, sizeof (O65Reloc), CmpReloc);
+            break;
+        }
+    }
+
+    /* Calculate the size of the table in the file. Each entry needs one or
+    ** more offset bytes, the type byte and the extra data for the type.
+    */
+    Len      = 1;               /* Terminator */
+    LastOffs = -1;
+    for (I = 0; I < R->Count; ++I) {
+        const O65Reloc* E = R->Entries + I;
+        Len += ((long) E->Offs - LastOffs - 1) / 0xFE + 2;
+        if ((E->Type & ~O65RELOC_MASK) == O65SEG_UNDEF) {
+            Len += 2;
+        } else if ((E->Type & O65RELOC_MASK) == O65RELOC_HIGH) {
+            Len += 1;
+        } else if ((E->Type & O65RELOC_MASK) == O65RELOC_SEG) {
+            Len += 2;
+        }
+        LastOffs = E->Offs;
+    }
+
+    /* Convert the entries */
+    P = Buf  = xmalloc (Len);
+    LastOffs = -1;
+    for (I = 0; I < R->Count; ++I) {
+
+        const O65Reloc* E = R->Entries + I;
+
+        /* Offset bytes. 0xFF skips 0xFE bytes without a relocation */
+        long Diff = (long) E->Offs - LastOffs;
+        while (Diff > 0xFE) {
+            *P++ = 0xFF;
+            Diff -= 0xFE;
+        }
+        *P++ = (unsigned char) Diff;
+        LastOffs = E->Offs;
+
+        /* Type byte */
+        *P++ = E->Type;
+
+        /* Import number for external references */
+        if ((E->Type & ~O65RELOC_MASK) == O65SEG_UNDEF) {
+            *P++ = (unsigned char) E->Extra;
+            *P++ = (unsigned char) (E->Extra >> 8);
+        } else {
+            /* Additional data if needed */
+            switch (E->Type & O65RELOC_MASK) {
+                case O65RELOC_HIGH:
+                    *P++ = (unsigned char) E->Extra;
+                    break;
+                case O65RELOC_SEG:
+                    *P++ = (unsigned char) E->Extra;
+                    *P++ = (unsigned char) (E->Extra >> 8);
+                    break;
+            }
+        }
+    }
+    *P++ = 0;
+    CHECK ((unsigned long) (P - Buf) == Len);
+
+    /* Write the table in one chunk */
+    WriteData (F, Buf, Len);
+    xfree (Buf);
 }
 
 
@@ -597,7 +663,6 @@ static unsigned O65WriteExpr (ExprNode* E, int Signed, unsigned Size,
 ** table.
 */
 {
-    long          Diff;
     unsigned      RefCount;
     long          BinVal;
     ExprNode*     Expr;
@@ -614,19 +679,9 @@ static unsigned O65WriteExpr (ExprNode* E, int Signed, unsigned Size,
     }
 
     /* We have a relocatable expression that needs a relocation table entry.
-    ** Calculate the number of bytes between this entry and the last one, and
-    ** setup all necessary intermediate bytes in the relocation table.
+    ** Calculate the offset relative to the start of the o65 segment.
     */
-    Offs += D->SegSize;         /* Calulate full offset */
-    Diff = ((long) Offs) - D->LastOffs;
-    while (Diff > 0xFE) {
-        O65RelocPutByte (D->CurReloc, 0xFF);
-        Diff -= 0xFE;
-    }
-    O65RelocPutByte (D->CurReloc, (unsigned char) Diff);
-
-    /* Remember this offset for the next time */
-    D->LastOffs = Offs;
+    Offs += D->SegSize;
 
     /* Determine the expression to relocate */
     Expr = E;
@@ -735,24 +790,16 @@ static unsigned O65WriteExpr (ExprNode* E, int Signed, unsigned Size,
             return SEG_EXPR_INVALID;
         }
         RelocType |= O65SegType (Seg);
-        O65RelocPutByte (D->CurReloc, RelocType);
 
-        /* Output additional data if needed */
-        switch (RelocType & O65RELOC_MASK) {
-            case O65RELOC_HIGH:
-                O65RelocPutByte (D->CurReloc, ED.Val & 0xFF);
-                break;
-            case O65RELOC_SEG:
-                O65RelocPutWord (D->CurReloc, ED.Val & 0xFFFF);
-                break;
-        }
+        /* The low bytes of the value are needed for high byte and segment
+        ** relocations.
+        */
+        O65AddReloc (D->CurReloc, Offs, RelocType, ED.Val & 0xFFFF);
 
     } else if (ED.ExtRef) {
-        /* Imported symbol */
+        /* Imported symbol. Remember the number of the imported symbol */
         RelocType |= O65SEG_UNDEF;
-        O65RelocPutByte (D->CurReloc, RelocType);
-        /* Put the number of the imported symbol into the table */
-        O65RelocPutWord (D->CurReloc, ExtSymNum (ED.ExtRef));
+        O65AddReloc (D->CurReloc, Offs, RelocType, ExtSymNum (ED.ExtRef));
 
     } else {
 
@@ -775,7 +822,6 @@ static void O65WriteSeg (O65Desc* D, SegDesc** Seg, unsigned Count, int DoWrite)
 
     /* Initialize variables */
     D->SegSize  = 0;
-    D->LastOffs = -1;
 
     /* Write out all segments */
     for (I = 0; I < Count; ++I) {
@@ -798,11 +844,6 @@ static void O65WriteSeg (O65Desc* D, SegDesc** Seg, unsigned Count, int DoWrite)
         D->SegSize += S->Seg->Size;
     }
 
-    /* Terminate the relocation table for this segment */
-    if (D->CurReloc) {
-        O65RelocPutByte (D->CurReloc, 0);
-    }
-
     /* Check the size of the segment for overflow */
     if ((D->Header.Mode & MF_SIZE_MASK) == MF_SIZE_16BIT && D->SegSize > 0xFFFF) {
         Error ("Segment overflow in file `%s'", D->Filename);
@@ -1044,6 +1085,8 @@ O65Desc* NewO65Desc (void)
     D->BssSeg           = 0;
     D->ZPCount          = 0;
     D->ZPSeg            = 0;
+    D->SegMapSize       = 0;
+    D->SegMap           = 0;
 
     /* Return the created struct */
     return D;
@@ -1055,6 +1098,7 @@ void FreeO65Desc (O65Desc* D)
 /* Delete the descriptor struct with cleanup */
 {
     /* Free the segment arrays */
+    xfree (D->SegMap);
     xfree (D->ZPSeg);
     xfree (D->BssSeg);
     xfree (D->DataSeg);
@@ -1257,6 +1301,13 @@ static void O65SetupSegments (O65Desc* D, File* F)
     D->BssSeg  = xmalloc (D->BssCount  * sizeof (SegDesc*));
     D->ZPSeg   = xmalloc (D->ZPCount   * sizeof (SegDesc*));
 
+    /* Allocate the lookup table for the segment descriptors */
+    D->SegMapSize = SegmentCount ();
+    D->SegMap     = xmalloc (D->SegMapSize * sizeof (SegDesc*));
+    for (I = 0; I < D->SegMapSize; ++I) {
+        D->SegMap[I] = 0;
+    }
+
     /* Walk again through the list and setup the segment arrays */
     TextIdx = DataIdx = BssIdx = ZPIdx = 0;
     for (I = 0; I < CollCount (&F->MemoryAreas); ++I) {
@@ -1270,6 +1321,9 @@ static void O65SetupSegments (O65Desc* D, File* F)
             /* Get the segment */
             SegDesc* S = CollAtUnchecked (&M->SegList, J);
 
+            /* Remember the descriptor for the segment */
+            D->SegMap[S->Seg->Id] = S;
+
             /* Check the segment type. */
             switch (O65SegType (S)) {
                 case O65SEG_TEXT:   D->TextSeg [TextIdx++] = S; break;
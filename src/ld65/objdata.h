@@ -61,6 +61,8 @@ struct StrBuf;
 
 /* Values for the Flags field */
 #define OBJ_REF         0x0001          /* We have a reference to this file */
+#define OBJ_BASICDATA   0x0002          /* Basic data was read from library */
+#define OBJ_CANDIDATE   0x0004          /* May resolve an unresolved import */
 
 /* Internal structure holding object file data */
 typedef struct ObjData ObjData;
@@ -167,7 +169,7 @@ struct Scope* GetObjScope (const ObjData* Obj, unsigned Id);
 unsigned ObjDataCount (void);
 /* Return the total number of modules */
 
-void PrintDbgModules (FILE* F);
+void PrintDbgModules (void);
 /* Output the modules to a debug info file */
 
 
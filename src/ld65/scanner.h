@@ -123,6 +123,7 @@ typedef enum {
 
     CFGTOK_CONDES,
     CFGTOK_STARTADDRESS,
+    CFGTOK_TRAMPOLINES,
 
     CFGTOK_ADDRSIZE,
     CFGTOK_VALUE,
@@ -135,6 +136,7 @@ typedef enum {
 
     CFGTOK_SEGMENT,
     CFGTOK_LABEL,
+    CFGTOK_CALL,
     CFGTOK_COUNT,
     CFGTOK_ORDER,
 
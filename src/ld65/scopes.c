@@ -37,6 +37,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "fileio.h"
 #include "scopes.h"
@@ -115,7 +116,7 @@ unsigned ScopeCount (void)
 
 
 
-void PrintDbgScopes (FILE* F)
+void PrintDbgScopes (void)
 /* Output the scopes to a debug info file */
 {
     unsigned I, J;
@@ -131,20 +132,19 @@ void PrintDbgScopes (FILE* F)
             const Scope* S = CollConstAt (&O->Scopes, J);
 
             /* Output the first chunk of data */
-            fprintf (F,
-                     "scope\tid=%u,name=\"%s\",mod=%u",
-                     O->ScopeBaseId + S->Id,
-                     GetString (S->Name),
-                     I);
+            DbgRecStart ("scope");
+            DbgAttrNum ("id", O->ScopeBaseId + S->Id);
+            DbgAttrStr ("name", GetString (S->Name));
+            DbgAttrNum ("mod", I);
 
             /* Print the type if not module */
             switch (S->Type) {
 
-                case SCOPE_GLOBAL:      fputs (",type=global", F);      break;
-                case SCOPE_FILE:        /* default */                   break;
-                case SCOPE_SCOPE:       fputs (",type=scope", F);       break;
-                case SCOPE_STRUCT:      fputs (",type=struct", F);      break;
-                case SCOPE_ENUM:        fputs (",type=enum", F);        break;
+                case SCOPE_GLOBAL:  DbgAttrKeyword ("type", "global");  break;
+                case SCOPE_FILE:    /* default */                       break;
+                case SCOPE_SCOPE:   DbgAttrKeyword ("type", "scope");   break;
+                case SCOPE_STRUCT:  DbgAttrKeyword ("type", "struct");  break;
+                case SCOPE_ENUM:    DbgAttrKeyword ("type", "enum");    break;
 
                 default:
                     Error ("Module `%s': Unknown scope type %u",
@@ -153,21 +153,21 @@ void PrintDbgScopes (FILE* F)
 
             /* Print the size if available */
             if (S->Size != 0) {
-                fprintf (F, ",size=%lu", S->Size);
+                DbgAttrNum ("size", S->Size);
             }
             /* Print parent if available */
             if (S->Id != S->ParentId) {
-                fprintf (F, ",parent=%u", O->ScopeBaseId + S->ParentId);
+                DbgAttrNum ("parent", O->ScopeBaseId + S->ParentId);
             }
             /* Print the label id if the scope is labeled */
             if (SCOPE_HAS_LABEL (S->Flags)) {
-                fprintf (F, ",sym=%u", O->SymBaseId + S->LabelId);
+                DbgAttrNum ("sym", O->SymBaseId + S->LabelId);
             }
             /* Print the list of spans for this scope */
-            PrintDbgSpanList (F, O, S->Spans);
+            PrintDbgSpanList (O, S->Spans);
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgRecEnd ();
         }
     }
 }
@@ -84,7 +84,7 @@ Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id);
 unsigned ScopeCount (void);
 /* Return the total number of scopes */
 
-void PrintDbgScopes (FILE* F);
+void PrintDbgScopes (void);
 /* Output the scopes to a debug info file */
 
 
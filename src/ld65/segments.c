@@ -50,6 +50,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "expr.h"
 #include "fileio.h"
@@ -246,8 +247,9 @@ Section* ReadSection (FILE* F, ObjData* O)
         /* Read the fragment type */
         unsigned char Type = Read8 (F);
 
-        /* Extract the check mask from the type */
+        /* Extract the check mask and the flags from the type */
         unsigned char Bytes = Type & FRAG_BYTEMASK;
+        unsigned char Flags = Type & FRAG_FLAGMASK;
         Type &= FRAG_TYPEMASK;
 
         /* Handle the different fragment types */
@@ -276,6 +278,9 @@ Section* ReadSection (FILE* F, ObjData* O)
                 return 0;
         }
 
+        /* Remember the flags */
+        Frag->Flags = Flags;
+
         /* Read the line infos into the list of the fragment */
         ReadLineInfoList (F, O, &Frag->LineInfos);
 
@@ -553,6 +558,14 @@ unsigned SegmentCount (void)
 
 
 
+const Segment* GetSegmentById (unsigned Id)
+/* Return the segment with the given id */
+{
+    return CollConstAt (&SegmentList, Id);
+}
+
+
+
 static int CmpSegStart (const void* K1, const void* K2)
 /* Compare function for qsort */
 {
@@ -618,7 +631,7 @@ void PrintSegmentMap (FILE* F)
 
 
 
-void PrintDbgSegments (FILE* F)
+void PrintDbgSegments (void)
 /* Output the segments to the debug file */
 {
     /* Walk over all segments */
@@ -629,16 +642,18 @@ void PrintDbgSegments (FILE* F)
         const Segment* S = CollAtUnchecked (&SegmentList, I);
 
         /* Print the segment data */
-        fprintf (F,
-                 "seg\tid=%u,name=\"%s\",start=0x%06lX,size=0x%04lX,addrsize=%s,type=%s",
-                 S->Id, GetString (S->Name), S->PC, S->Size,
-                 AddrSizeToStr (S->AddrSize),
-                 S->ReadOnly? "ro" : "rw");
+        DbgRecStart ("seg");
+        DbgAttrNum ("id", S->Id);
+        DbgAttrStr ("name", GetString (S->Name));
+        DbgAttrHex ("start", S->PC, 6);
+        DbgAttrHex ("size", S->Size, 4);
+        DbgAttrKeyword ("addrsize", AddrSizeToStr (S->AddrSize));
+        DbgAttrKeyword ("type", S->ReadOnly? "ro" : "rw");
         if (S->OutputName) {
-            fprintf (F, ",oname=\"%s\",ooffs=%lu",
-                     S->OutputName, S->OutputOffs);
+            DbgAttrStr ("oname", S->OutputName);
+            DbgAttrNum ("ooffs", S->OutputOffs);
         }
-        fputc ('\n', F);
+        DbgRecEnd ();
     }
 }
 
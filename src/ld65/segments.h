@@ -152,10 +152,13 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
 unsigned SegmentCount (void);
 /* Return the total number of segments */
 
+const Segment* GetSegmentById (unsigned Id);
+/* Return the segment with the given id */
+
 void PrintSegmentMap (FILE* F);
 /* Print a segment map to the given file */
 
-void PrintDbgSegments (FILE* F);
+void PrintDbgSegments (void);
 /* Output the segments to the debug file */
 
 void CheckSegments (void);
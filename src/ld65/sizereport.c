@@ -0,0 +1,513 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                sizereport.c                               */
+/*                                                                           */
+/*                      Size reports for the ld65 linker                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "coll.h"
+#include "fname.h"
+#include "scopedefs.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "config.h"
+#include "error.h"
+#include "global.h"
+#include "library.h"
+#include "memarea.h"
+#include "objdata.h"
+#include "scopes.h"
+#include "segments.h"
+#include "sizereport.h"
+#include "spool.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* One line of a size report. The key consists of the kind, name and area
+** fields separated by tabs, so lines of two reports can be matched by a
+** simple string compare.
+*/
+typedef struct SizeRow SizeRow;
+struct SizeRow {
+    unsigned long       Size;           /* Size in bytes */
+    int                 Gone;           /* Only in the baseline */
+    char                Key[1];         /* Key, dynamically allocated */
+};
+
+
+
+/*****************************************************************************/
+/*                              struct SizeRow                               */
+/*****************************************************************************/
+
+
+
+static SizeRow* NewSizeRow (const char* Key, unsigned Len, unsigned long Size)
+/* Create a new size row */
+{
+    /* Allocate memory */
+    SizeRow* R = xmalloc (sizeof (SizeRow) + Len);
+
+    /* Initialize the fields */
+    R->Size    = Size;
+    R->Gone    = 0;
+    memcpy (R->Key, Key, Len);
+    R->Key[Len] = '\0';
+
+    /* Return the new row */
+    return R;
+}
+
+
+
+static void AddRow (Collection* Rows, const char* Kind, const char* Name,
+                    const char* Area, unsigned long Size)
+/* Add a row to a report */
+{
+    StrBuf Key = STATIC_STRBUF_INITIALIZER;
+
+    SB_AppendStr (&Key, Kind);
+    SB_AppendChar (&Key, '\t');
+    SB_AppendStr (&Key, Name);
+    SB_AppendChar (&Key, '\t');
+    SB_AppendStr (&Key, Area);
+
+    CollAppend (Rows, NewSizeRow (SB_GetConstBuf (&Key), SB_GetLen (&Key), Size));
+
+    SB_Done (&Key);
+}
+
+
+
+static int CmpRows (void* Data attribute ((unused)),
+                    const void* Left, const void* Right)
+/* Compare function for CollSort */
+{
+    return strcmp (((const SizeRow*) Left)->Key, ((const SizeRow*) Right)->Key);
+}
+
+
+
+static void SortRows (Collection* Rows)
+/* Sort the rows by key and merge rows with identical keys */
+{
+    unsigned I, J;
+
+    CollSort (Rows, CmpRows, 0);
+
+    /* Rows with the same key are now adjacent */
+    J = 0;
+    for (I = 0; I < CollCount (Rows); ++I) {
+        SizeRow* R = CollAtUnchecked (Rows, I);
+        if (J > 0) {
+            SizeRow* Last = CollAtUnchecked (Rows, J - 1);
+            if (strcmp (Last->Key, R->Key) == 0) {
+                Last->Size += R->Size;
+                xfree (R);
+                continue;
+            }
+        }
+        CollReplace (Rows, R, J++);
+    }
+    while (CollCount (Rows) > J) {
+        CollDelete (Rows, CollCount (Rows) - 1);
+    }
+}
+
+
+
+static SizeRow* FindRow (Collection* Rows, const char* Key)
+/* Search for a row with the given key in a sorted collection. Return NULL if
+** no such row was found.
+*/
+{
+    int Lo = 0;
+    int Hi = (int) CollCount (Rows) - 1;
+    while (Lo <= Hi) {
+        int Cur = (Lo + Hi) / 2;
+        SizeRow* R = CollAtUnchecked (Rows, Cur);
+        int Res = strcmp (R->Key, Key);
+        if (Res < 0) {
+            Lo = Cur + 1;
+        } else if (Res > 0) {
+            Hi = Cur - 1;
+        } else {
+            return R;
+        }
+    }
+    return 0;
+}
+
+
+
+static void FreeRows (Collection* Rows)
+/* Free all rows in a collection */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Rows); ++I) {
+        xfree (CollAtUnchecked (Rows, I));
+    }
+    DoneCollection (Rows);
+}
+
+
+
+/*****************************************************************************/
+/*                             Collecting sizes                              */
+/*****************************************************************************/
+
+
+
+static void CollectMemoryAreas (Collection* Rows)
+/* Add memory area and segment sizes to the report */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CfgMemoryAreaCount (); ++I) {
+
+        const MemoryArea* M = CfgGetMemoryArea (I);
+        const char* Name = GetString (M->Name);
+        unsigned long Free = (M->FillLevel < M->Size)? M->Size - M->FillLevel : 0;
+
+        AddRow (Rows, "memory", Name, "used", M->FillLevel);
+        AddRow (Rows, "memory", Name, "free", Free);
+
+        /* Segments are listed with the area they run in */
+        for (J = 0; J < CollCount (&M->SegList); ++J) {
+            const SegDesc* S = CollConstAt (&M->SegList, J);
+            if (S->Run == M) {
+                AddRow (Rows, "segment", GetString (S->Seg->Name), Name,
+                        S->Seg->Size);
+            }
+        }
+    }
+}
+
+
+
+static void CollectModules (Collection* Rows)
+/* Add module, library and function sizes to the report */
+{
+    unsigned I, J;
+    StrBuf LibName = STATIC_STRBUF_INITIALIZER;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        const ObjData* O = CollConstAt (&ObjDataList, I);
+        const char* ObjName = GetObjFileName (O);
+        const char* Lib = 0;
+        unsigned long Total = 0;
+
+        /* Modules from libraries are listed as "lib(module)". Libraries are
+        ** found in the search paths, so just the file name is used to make
+        ** the report independent of the place of the installation.
+        */
+        if (O->Lib) {
+            Lib = FindName (GetLibFileName (O->Lib));
+            SB_Printf (&LibName, "%s(%s)", Lib, ObjName);
+            ObjName = SB_GetConstBuf (&LibName);
+        }
+
+        /* Sizes of the module per segment */
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            const Section* S = CollConstAt (&O->Sections, J);
+            const char* SegName = GetString (S->Seg->Name);
+            if (S->Size == 0) {
+                continue;
+            }
+            AddRow (Rows, "module", ObjName, SegName, S->Size);
+            if (Lib) {
+                AddRow (Rows, "library", Lib, SegName, S->Size);
+            }
+            Total += S->Size;
+        }
+        AddRow (Rows, "module", ObjName, "*", Total);
+        if (Lib) {
+            AddRow (Rows, "library", Lib, "*", Total);
+        }
+
+        /* Labeled scopes with a size are functions (.PROC or C functions
+        ** compiled with debug info).
+        */
+        for (J = 0; J < CollCount (&O->Scopes); ++J) {
+            const Scope* S = CollConstAt (&O->Scopes, J);
+            if (S->Type == SCOPE_SCOPE && SCOPE_HAS_LABEL (S->Flags) && S->Size > 0) {
+                AddRow (Rows, "function", GetString (S->Name), ObjName, S->Size);
+            }
+        }
+    }
+
+    SB_Done (&LibName);
+}
+
+
+
+/*****************************************************************************/
+/*                              Baseline input                               */
+/*****************************************************************************/
+
+
+
+static int ReadLine (FILE* F, StrBuf* Line)
+/* Read one line from F into Line. Return false at end of file. */
+{
+    int C;
+
+    SB_Clear (Line);
+    while ((C = getc (F)) != EOF && C != '\n') {
+        if (C != '\r') {
+            SB_AppendChar (Line, C);
+        }
+    }
+    SB_Terminate (Line);
+    return (C != EOF || SB_GetLen (Line) > 0);
+}
+
+
+
+static void ReadBaseline (Collection* Rows)
+/* Read the baseline report into Rows and sort it */
+{
+    StrBuf Line = STATIC_STRBUF_INITIALIZER;
+    unsigned LineNum = 0;
+
+    /* Open the file */
+    FILE* F = fopen (SizeBaselineName, "r");
+    if (F == 0) {
+        Error ("Cannot open size report `%s': %s", SizeBaselineName, strerror (errno));
+    }
+
+    /* Each line has the fields kind, name, area, size and delta */
+    while (ReadLine (F, &Line)) {
+
+        const char* L = SB_GetConstBuf (&Line);
+        const char* P;
+        unsigned Tabs = 0;
+        char* End;
+        unsigned long Size;
+
+        ++LineNum;
+        if (*L == '#' || *L == '\0') {
+            continue;
+        }
+
+        /* Find the size field */
+        for (P = L; *P; ++P) {
+            if (*P == '\t' && ++Tabs == 3) {
+                break;
+            }
+        }
+        if (Tabs != 3) {
+            Error ("%s:%u: Invalid size report line", SizeBaselineName, LineNum);
+        }
+        Size = strtoul (P + 1, &End, 10);
+        if (End == P + 1 || (*End != '\t' && *End != '\0')) {
+            Error ("%s:%u: Invalid size in size report", SizeBaselineName, LineNum);
+        }
+
+        CollAppend (Rows, NewSizeRow (L, (unsigned) (P - L), Size));
+    }
+
+    /* Close the file */
+    if (fclose (F) != 0) {
+        Error ("Error closing size report `%s': %s", SizeBaselineName, strerror (errno));
+    }
+    SB_Done (&Line);
+
+    SortRows (Rows);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void PrintRow (FILE* F, const SizeRow* R, const SizeRow* Old,
+                      int HaveBaseline)
+/* Print one report line including the delta against the baseline row */
+{
+    fprintf (F, "%s\t%lu\t", R->Key, R->Size);
+    if (!HaveBaseline) {
+        fputs ("-\n", F);
+    } else if (R->Gone) {
+        fputs ("gone\n", F);
+    } else if (Old == 0) {
+        fputs ("new\n", F);
+    } else if (R->Size > Old->Size) {
+        fprintf (F, "+%lu\n", R->Size - Old->Size);
+    } else if (R->Size < Old->Size) {
+        fprintf (F, "-%lu\n", Old->Size - R->Size);
+    } else {
+        fputs ("0\n", F);
+    }
+}
+
+
+
+static unsigned long RowGrowth (const SizeRow* R, const SizeRow* Old)
+/* Return the number of bytes an item grew against the baseline row Old.
+** Items that are new grew by their size. Free space in memory areas is not
+** an item that can grow, so it's ignored.
+*/
+{
+    if (R->Gone ||
+        (strncmp (R->Key, "memory\t", 7) == 0 &&
+         strcmp (strrchr (R->Key, '\t'), "\tfree") == 0)) {
+        return 0;
+    } else if (Old == 0) {
+        return R->Size;
+    } else {
+        return (R->Size > Old->Size)? R->Size - Old->Size : 0;
+    }
+}
+
+
+
+void CreateSizeReport (void)
+/* Create the size report. The report lists the space used by memory areas,
+** segments, modules, libraries and functions. If a baseline report was
+** given, the size difference against this report is added to each line.
+** If a size limit was given, the link fails if an item grew by more.
+*/
+{
+    unsigned I;
+    unsigned Exceeded = 0;
+    unsigned long Used, OldUsed;
+    Collection Rows = STATIC_COLLECTION_INITIALIZER;
+    Collection Baseline = STATIC_COLLECTION_INITIALIZER;
+    Collection Gone = STATIC_COLLECTION_INITIALIZER;
+    FILE* F;
+
+    /* Gather the sizes and the sizes from the previous report */
+    CollectMemoryAreas (&Rows);
+    CollectModules (&Rows);
+    SortRows (&Rows);
+    if (SizeBaselineName) {
+        ReadBaseline (&Baseline);
+    }
+
+    /* Things that went away are listed with a size of zero, in their place
+    ** in the sorted report. Rows of the baseline that have a size of zero
+    ** went away before, so they're not listed again.
+    */
+    OldUsed = 0;
+    for (I = 0; I < CollCount (&Baseline); ++I) {
+        const SizeRow* Old = CollConstAt (&Baseline, I);
+        if (Old->Size > 0 && FindRow (&Rows, Old->Key) == 0) {
+            SizeRow* R = NewSizeRow (Old->Key, strlen (Old->Key), 0);
+            R->Gone = 1;
+            CollAppend (&Gone, R);
+        }
+        if (strncmp (Old->Key, "memory\t", 7) == 0 &&
+            strcmp (strrchr (Old->Key, '\t'), "\tused") == 0) {
+            OldUsed += Old->Size;
+        }
+    }
+    if (CollCount (&Gone) > 0) {
+        CollTransfer (&Rows, &Gone);
+        SortRows (&Rows);
+    }
+    DoneCollection (&Gone);
+
+    /* Open the report file */
+    F = fopen (SizeReportName, "w");
+    if (F == 0) {
+        Error ("Cannot create size report `%s': %s", SizeReportName, strerror (errno));
+    }
+
+    fputs ("# ld65 size report\n", F);
+    if (SizeBaselineName) {
+        fprintf (F, "# baseline: %s\n", SizeBaselineName);
+    }
+    fputs ("# kind\tname\tarea\tsize\tdelta\n", F);
+
+    /* Output all rows */
+    Used = 0;
+    for (I = 0; I < CollCount (&Rows); ++I) {
+        const SizeRow* R = CollConstAt (&Rows, I);
+        const SizeRow* Old = FindRow (&Baseline, R->Key);
+        if (strncmp (R->Key, "memory\t", 7) == 0 &&
+            strcmp (strrchr (R->Key, '\t'), "\tused") == 0) {
+            Used += R->Size;
+        }
+        PrintRow (F, R, Old, SizeBaselineName != 0);
+        if (HaveSizeLimit && RowGrowth (R, Old) > SizeLimit) {
+            /* Print the key with blanks instead of tabs */
+            char* Item = xstrdup (R->Key);
+            char* P;
+            for (P = Item; *P; ++P) {
+                if (*P == '\t') {
+                    *P = ' ';
+                }
+            }
+            Warning ("Size report item `%s' grew by %lu bytes",
+                     Item, RowGrowth (R, Old));
+            xfree (Item);
+            ++Exceeded;
+        }
+    }
+
+    /* Print the total */
+    fprintf (F, "# total used: %lu", Used);
+    if (SizeBaselineName) {
+        fprintf (F, " (%s%ld)", (Used >= OldUsed)? "+" : "", (long) (Used - OldUsed));
+    }
+    fputc ('\n', F);
+
+    /* Close the file */
+    if (fclose (F) != 0) {
+        Error ("Error closing size report `%s': %s", SizeReportName, strerror (errno));
+    }
+
+    /* Free the rows */
+    FreeRows (&Rows);
+    FreeRows (&Baseline);
+
+    /* Fail if items grew too much */
+    if (Exceeded > 0) {
+        Error ("%u item%s of the size report grew by more than %lu bytes",
+               Exceeded, (Exceeded > 1)? "s" : "", SizeLimit);
+    }
+}
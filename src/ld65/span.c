@@ -38,6 +38,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "fileio.h"
 #include "objdata.h"
 #include "segments.h"
@@ -185,7 +186,7 @@ unsigned SpanCount (void)
 
 
 
-void PrintDbgSpanList (FILE* F, const ObjData* O, const unsigned* List)
+void PrintDbgSpanList (const ObjData* O, const unsigned* List)
 /* Output a string ",span=x[+y...]" for the given list. If the list is empty
 ** or NULL, output nothing. This is a helper function for other modules to
 ** print a list of spans read by ReadSpanList to the debug info file.
@@ -193,17 +194,16 @@ void PrintDbgSpanList (FILE* F, const ObjData* O, const unsigned* List)
 {
     if (List && *List) {
         unsigned I;
-        const char* Format = ",span=%u";
+        DbgAttrListStart ("span");
         for (I = 0; I < *List; ++I) {
-            fprintf (F, Format, O->SpanBaseId + List[I+1]);
-            Format = "+%u";
+            DbgAttrListItem (O->SpanBaseId + List[I+1]);
         }
     }
 }
 
 
 
-void PrintDbgSpans (FILE* F)
+void PrintDbgSpans (void)
 /* Output the spans to a debug info file */
 {
     unsigned I, J;
@@ -226,19 +226,19 @@ void PrintDbgSpans (FILE* F)
             const Section* Sec = GetObjSection (O, S->Sec);
 
             /* Output the data */
-            fprintf (F, "span\tid=%u,seg=%u,start=%lu,size=%lu",
-                     O->SpanBaseId + S->Id,
-                     Sec->Seg->Id,
-                     Sec->Offs + S->Offs,
-                     S->Size);
+            DbgRecStart ("span");
+            DbgAttrNum ("id", O->SpanBaseId + S->Id);
+            DbgAttrNum ("seg", Sec->Seg->Id);
+            DbgAttrNum ("start", Sec->Offs + S->Offs);
+            DbgAttrNum ("size", S->Size);
 
             /* If we have a type, add it */
             if (S->Type != INVALID_TYPE_ID) {
-                fprintf (F, ",type=%u", S->Type);
+                DbgAttrNum ("type", S->Type);
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgRecEnd ();
         }
     }
 
@@ -91,13 +91,13 @@ void FreeSpan (Span* S);
 unsigned SpanCount (void);
 /* Return the total number of spans */
 
-void PrintDbgSpanList (FILE* F, const struct ObjData* O, const unsigned* List);
+void PrintDbgSpanList (const struct ObjData* O, const unsigned* List);
 /* Output a string ",span=x[+y...]" for the given list. If the list is empty
 ** or NULL, output nothing. This is a helper function for other modules to
 ** print a list of spans read by ReadSpanList to the debug info file.
 */
 
-void PrintDbgSpans (FILE* F);
+void PrintDbgSpans (void);
 /* Output the spans to a debug info file */
 
 
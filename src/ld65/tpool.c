@@ -37,6 +37,7 @@
 #include "gentype.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "tpool.h"
 
 
@@ -58,7 +59,7 @@ StringPool* TypePool = 0;
 
 
 
-void PrintDbgTypes (FILE* F)
+void PrintDbgTypes (void)
 /* Output the types to a debug info file */
 {
     StrBuf Type = STATIC_STRBUF_INITIALIZER;
@@ -71,8 +72,10 @@ void PrintDbgTypes (FILE* F)
     for (Id = 0; Id < Count; ++Id) {
 
         /* Output it */
-        fprintf (F, "type\tid=%u,val=\"%s\"\n", Id,
-                 GT_AsString (SP_Get (TypePool, Id), &Type));
+        DbgRecStart ("type");
+        DbgAttrNum ("id", Id);
+        DbgAttrStr ("val", GT_AsString (SP_Get (TypePool, Id), &Type));
+        DbgRecEnd ();
 
     }
 
@@ -95,7 +95,7 @@ INLINE unsigned TypeCount (void)
 #  define TypeCount()   SP_GetCount (TypePool)
 #endif
 
-void PrintDbgTypes (FILE* F);
+void PrintDbgTypes (void);
 /* Output the types to a debug info file */
 
 void InitTypePool (void);
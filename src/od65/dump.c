@@ -42,6 +42,7 @@
 #include "coll.h"
 #include "exprdefs.h"
 #include "filepos.h"
+#include "fragdefs.h"
 #include "lidefs.h"
 #include "objdefs.h"
 #include "optdefs.h"
@@ -52,26 +53,57 @@
 /* od65 */
 #include "error.h"
 #include "fileio.h"
+#include "global.h"
 #include "dump.h"
 
 
 
 /*****************************************************************************/
-/*                                   Code                                    */
+/*                                   Data                                    */
 /*****************************************************************************/
 
 
 
-static void DestroyStrPool (Collection* C)
-/* Free all strings in the given pool plus the item pointers. Note: The
-** collection may not be reused later.
+/* The string pool of the object file dumped last. Since most sections need
+** it, it is read only once for each object file.
 */
+static Collection       ObjStrPool  = STATIC_COLLECTION_INITIALIZER;
+static FILE*            StrPoolFile = 0;
+static unsigned long    StrPoolOffs = 0;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void FreeStrPool (void)
+/* Free all strings in the cached string pool */
 {
     unsigned I;
-    for (I = 0; I < CollCount (C); ++I) {
-        xfree (CollAtUnchecked (C, I));
+    for (I = 0; I < CollCount (&ObjStrPool); ++I) {
+        xfree (CollAtUnchecked (&ObjStrPool, I));
     }
-    DoneCollection (C);
+    CollDeleteAll (&ObjStrPool);
+    StrPoolFile = 0;
+}
+
+
+
+static const Collection* GetStrPool (FILE* F, unsigned long Offset,
+                                     const ObjHeader* H)
+/* Return the string pool of the object file at the given offset in F */
+{
+    if (F != StrPoolFile || Offset != StrPoolOffs) {
+        FreeStrPool ();
+        FileSetPos (F, Offset + H->StrPoolOffs);
+        ReadStrPool (F, &ObjStrPool);
+        StrPoolFile = F;
+        StrPoolOffs = Offset;
+    }
+    return &ObjStrPool;
 }
 
 
@@ -90,6 +122,134 @@ static const char* GetString (const Collection* C, unsigned Index)
 
 
 
+static void PrintCSVString (const char* S)
+/* Print a string as quoted CSV field */
+{
+    putchar ('"');
+    while (*S) {
+        if (*S == '"') {
+            putchar ('"');
+        }
+        putchar (*S++);
+    }
+    putchar ('"');
+}
+
+
+
+static void PrintJSONString (const char* S)
+/* Print a string as JSON string constant including the quotes */
+{
+    putchar ('"');
+    while (*S) {
+        unsigned char C = (unsigned char) *S++;
+        if (C == '"' || C == '\\') {
+            putchar ('\\');
+            putchar (C);
+        } else if (C < 0x20) {
+            printf ("\\u%04X", C);
+        } else {
+            putchar (C);
+        }
+    }
+    putchar ('"');
+}
+
+
+
+static void RecField (const char* Field)
+/* Start the next field of a record. JSON fields have a name. */
+{
+    if (Format == F_JSON) {
+        printf (", \"%s\": ", Field);
+    } else {
+        putchar (',');
+    }
+}
+
+
+
+static void RecStart (const char* Type)
+/* Start a record for CSV or JSON output. All records start with the type
+** and the name of the input file. CSV records are lines, JSON records are
+** objects on one line.
+*/
+{
+    if (Format == F_JSON) {
+        printf ("{\"record\": \"%s\", \"file\": ", Type);
+        PrintJSONString (InputName);
+    } else {
+        fputs (Type, stdout);
+        putchar (',');
+        PrintCSVString (InputName);
+    }
+}
+
+
+
+static void RecStr (const char* Field, const char* S)
+/* Output a string field of a record */
+{
+    RecField (Field);
+    if (Format == F_JSON) {
+        PrintJSONString (S);
+    } else {
+        PrintCSVString (S);
+    }
+}
+
+
+
+static void RecSym (const char* Field, const char* S)
+/* Output a field that is one of a few names. These are not quoted in CSV
+** output.
+*/
+{
+    RecField (Field);
+    if (Format == F_JSON) {
+        PrintJSONString (S);
+    } else {
+        fputs (S, stdout);
+    }
+}
+
+
+
+static void RecNum (const char* Field, unsigned long Val)
+/* Output a number field of a record */
+{
+    RecField (Field);
+    printf ("%lu", Val);
+}
+
+
+
+static void RecOptNum (const char* Field, int Have, unsigned long Val)
+/* Output a number field that may be missing. It's empty in CSV output, and
+** null in JSON output.
+*/
+{
+    RecField (Field);
+    if (Have) {
+        printf ("%lu", Val);
+    } else if (Format == F_JSON) {
+        fputs ("null", stdout);
+    }
+}
+
+
+
+static void RecEnd (void)
+/* End a record */
+{
+    if (Format == F_JSON) {
+        putchar ('}');
+    }
+    putchar ('\n');
+}
+
+
+
 static void DumpObjHeaderSection (const char* Name,
                                   unsigned long Offset,
                                   unsigned long Size)
@@ -330,7 +490,7 @@ void DumpObjOptions (FILE* F, unsigned long Offset)
 /* Dump the file options */
 {
     ObjHeader  H;
-    Collection StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned   Count;
     unsigned   I;
 
@@ -338,9 +498,8 @@ void DumpObjOptions (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the options */
     FileSetPos (F, Offset + H.OptionOffs);
@@ -385,7 +544,7 @@ void DumpObjOptions (FILE* F, unsigned long Offset)
         switch (ArgType) {
 
             case OPT_ARGSTR:
-                ArgStr = GetString (&StrPool, Val);
+                ArgStr = GetString (StrPool, Val);
                 ArgLen = strlen (ArgStr);
                 printf ("      Data:%*s\"%s\"\n", (int)(24-ArgLen), "", ArgStr);
                 break;
@@ -407,9 +566,6 @@ void DumpObjOptions (FILE* F, unsigned long Offset)
                 break;
         }
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -418,7 +574,7 @@ void DumpObjFiles (FILE* F, unsigned long Offset)
 /* Dump the source files */
 {
     ObjHeader  H;
-    Collection StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned   Count;
     unsigned   I;
 
@@ -426,9 +582,8 @@ void DumpObjFiles (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the source files */
     FileSetPos (F, Offset + H.FileOffs);
@@ -444,7 +599,7 @@ void DumpObjFiles (FILE* F, unsigned long Offset)
     for (I = 0; I < Count; ++I) {
 
         /* Read the data for one file */
-        const char*   Name  = GetString (&StrPool, ReadVar (F));
+        const char*   Name  = GetString (StrPool, ReadVar (F));
         unsigned long MTime = Read32 (F);
         unsigned long Size  = ReadVar (F);
         unsigned      Len   = strlen (Name);
@@ -457,9 +612,6 @@ void DumpObjFiles (FILE* F, unsigned long Offset)
         printf ("      Size:%26lu\n", Size);
         printf ("      Modification time:%13lu  (%s)\n", MTime, TimeToStr (MTime));
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -468,7 +620,7 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
 /* Dump the segments in the object file */
 {
     ObjHeader  H;
-    Collection StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned   Count;
     unsigned   I;
 
@@ -476,19 +628,18 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the segments */
     FileSetPos (F, Offset + H.SegOffs);
 
-    /* Output a header */
-    printf ("  Segments:\n");
-
     /* Read the number of segments and print it */
     Count = ReadVar (F);
-    printf ("    Count:%27u\n", Count);
+    if (Format == F_TEXT) {
+        printf ("  Segments:\n");
+        printf ("    Count:%27u\n", Count);
+    }
 
     /* Read and print all segments */
     for (I = 0; I < Count; ++I) {
@@ -496,7 +647,7 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
         /* Read the data for one segments */
         unsigned long DataSize  = Read32 (F);
         unsigned long NextSeg   = ftell (F) + DataSize;
-        const char*   Name      = GetString (&StrPool, ReadVar (F));
+        const char*   Name      = GetString (StrPool, ReadVar (F));
         unsigned      Len       = strlen (Name);
         unsigned      Flags     = ReadVar (F);
         unsigned long Size      = ReadVar (F);
@@ -504,24 +655,37 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
         unsigned char AddrSize  = Read8 (F);
         unsigned long FragCount = ReadVar (F);
 
-        /* Print the header */
-        printf ("    Index:%27u\n", I);
+        if (Format != F_TEXT) {
 
-        /* Print the data */
-        printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
-        printf ("      Flags:%25u\n", Flags);
-        printf ("      Size:%26lu\n", Size);
-        printf ("      Alignment:%21lu\n", Align);
-        printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
-                AddrSizeToStr (AddrSize));
-        printf ("      Fragment count:%16lu\n", FragCount);
+            /* segment,file,index,name,flags,size,alignment,addrsize,fragments */
+            RecStart ("segment");
+            RecNum ("index", I);
+            RecStr ("name", Name);
+            RecNum ("flags", Flags);
+            RecNum ("size", Size);
+            RecNum ("alignment", Align);
+            RecSym ("addrsize", AddrSizeToStr (AddrSize));
+            RecNum ("fragments", FragCount);
+            RecEnd ();
+
+        } else {
+
+            /* Print the header */
+            printf ("    Index:%27u\n", I);
+
+            /* Print the data */
+            printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
+            printf ("      Flags:%25u\n", Flags);
+            printf ("      Size:%26lu\n", Size);
+            printf ("      Alignment:%21lu\n", Align);
+            printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
+                    AddrSizeToStr (AddrSize));
+            printf ("      Fragment count:%16lu\n", FragCount);
+        }
 
         /* Seek to the end of the segment data (start of next) */
         FileSetPos (F, NextSeg);
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -530,7 +694,7 @@ void DumpObjImports (FILE* F, unsigned long Offset)
 /* Dump the imports in the object file */
 {
     ObjHeader  H;
-    Collection StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned   Count;
     unsigned   I;
 
@@ -538,43 +702,51 @@ void DumpObjImports (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the imports */
     FileSetPos (F, Offset + H.ImportOffs);
 
-    /* Output a header */
-    printf ("  Imports:\n");
-
     /* Read the number of imports and print it */
     Count = ReadVar (F);
-    printf ("    Count:%27u\n", Count);
+    if (Format == F_TEXT) {
+        printf ("  Imports:\n");
+        printf ("    Count:%27u\n", Count);
+    }
 
     /* Read and print all imports */
     for (I = 0; I < Count; ++I) {
 
         /* Read the data for one import */
         unsigned char AddrSize = Read8 (F);
-        const char*   Name     = GetString (&StrPool, ReadVar (F));
+        const char*   Name     = GetString (StrPool, ReadVar (F));
         unsigned      Len      = strlen (Name);
 
         /* Skip both line info lists */
         SkipLineInfoList (F);
         SkipLineInfoList (F);
 
-        /* Print the header */
-        printf ("    Index:%27u\n", I);
+        if (Format != F_TEXT) {
 
-        /* Print the data */
-        printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
-                AddrSizeToStr (AddrSize));
-        printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
-    }
+            /* import,file,index,name,addrsize */
+            RecStart ("import");
+            RecNum ("index", I);
+            RecStr ("name", Name);
+            RecSym ("addrsize", AddrSizeToStr (AddrSize));
+            RecEnd ();
+
+        } else {
+
+            /* Print the header */
+            printf ("    Index:%27u\n", I);
 
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
+            /* Print the data */
+            printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
+                    AddrSizeToStr (AddrSize));
+            printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
+        }
+    }
 }
 
 
@@ -583,7 +755,7 @@ void DumpObjExports (FILE* F, unsigned long Offset)
 /* Dump the exports in the object file */
 {
     ObjHeader   H;
-    Collection  StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned    Count;
     unsigned    I;
 
@@ -591,19 +763,18 @@ void DumpObjExports (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the exports */
     FileSetPos (F, Offset + H.ExportOffs);
 
-    /* Output a header */
-    printf ("  Exports:\n");
-
     /* Read the number of exports and print it */
     Count = ReadVar (F);
-    printf ("    Count:%27u\n", Count);
+    if (Format == F_TEXT) {
+        printf ("  Exports:\n");
+        printf ("    Count:%27u\n", Count);
+    }
 
     /* Read and print all exports */
     for (I = 0; I < Count; ++I) {
@@ -619,7 +790,7 @@ void DumpObjExports (FILE* F, unsigned long Offset)
         unsigned Type          = ReadVar (F);
         unsigned char AddrSize = Read8 (F);
         ReadData (F, ConDes, SYM_GET_CONDES_COUNT (Type));
-        Name  = GetString (&StrPool, ReadVar (F));
+        Name  = GetString (StrPool, ReadVar (F));
         Len   = strlen (Name);
         if (SYM_IS_CONST (Type)) {
             Value = Read32 (F);
@@ -634,24 +805,39 @@ void DumpObjExports (FILE* F, unsigned long Offset)
         SkipLineInfoList (F);
         SkipLineInfoList (F);
 
-        /* Print the header */
-        printf ("    Index:%27u\n", I);
+        if (Format != F_TEXT) {
+
+            /* export,file,index,name,type,addrsize,value,size. Value and
+            ** size are missing if the export doesn't have them.
+            */
+            RecStart ("export");
+            RecNum ("index", I);
+            RecStr ("name", Name);
+            RecField ("type");
+            printf ((Format == F_JSON)? "%u" : "0x%02X", Type);
+            RecSym ("addrsize", AddrSizeToStr (AddrSize));
+            RecOptNum ("value", SYM_IS_CONST (Type), Value);
+            RecOptNum ("size", SYM_HAS_SIZE (Type), Size);
+            RecEnd ();
 
-        /* Print the data */
-        printf ("      Type:%22s0x%02X  (%s)\n", "", Type, GetExportFlags (Type, ConDes));
-        printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
-                AddrSizeToStr (AddrSize));
-        printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
-        if (SYM_IS_CONST (Type)) {
-            printf ("      Value:%15s0x%08lX  (%lu)\n", "", Value, Value);
-        }
-        if (SYM_HAS_SIZE (Type)) {
-            printf ("      Size:%16s0x%04lX  (%lu)\n", "", Size, Size);
+        } else {
+
+            /* Print the header */
+            printf ("    Index:%27u\n", I);
+
+            /* Print the data */
+            printf ("      Type:%22s0x%02X  (%s)\n", "", Type, GetExportFlags (Type, ConDes));
+            printf ("      Address size:%14s0x%02X  (%s)\n", "", AddrSize,
+                    AddrSizeToStr (AddrSize));
+            printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
+            if (SYM_IS_CONST (Type)) {
+                printf ("      Value:%15s0x%08lX  (%lu)\n", "", Value, Value);
+            }
+            if (SYM_HAS_SIZE (Type)) {
+                printf ("      Size:%16s0x%04lX  (%lu)\n", "", Size, Size);
+            }
         }
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -660,7 +846,7 @@ void DumpObjDbgSyms (FILE* F, unsigned long Offset)
 /* Dump the debug symbols from an object file */
 {
     ObjHeader   H;
-    Collection  StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned    Count;
     unsigned    I;
 
@@ -668,9 +854,8 @@ void DumpObjDbgSyms (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the debug syms */
     FileSetPos (F, Offset + H.DbgSymOffs);
@@ -701,7 +886,7 @@ void DumpObjDbgSyms (FILE* F, unsigned long Offset)
         unsigned Type          = ReadVar (F);
         unsigned char AddrSize = Read8 (F);
         unsigned long Owner    = ReadVar (F);
-        const char*   Name     = GetString (&StrPool, ReadVar (F));
+        const char*   Name     = GetString (StrPool, ReadVar (F));
         unsigned      Len      = strlen (Name);
         if (SYM_IS_CONST (Type)) {
             Value = Read32 (F);
@@ -744,9 +929,6 @@ void DumpObjDbgSyms (FILE* F, unsigned long Offset)
             printf ("      Export:%24u\n", ExportId);
         }
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -755,7 +937,6 @@ void DumpObjLineInfo (FILE* F, unsigned long Offset)
 /* Dump the line info from an object file */
 {
     ObjHeader   H;
-    Collection  StrPool = AUTO_COLLECTION_INITIALIZER;
     unsigned    Count;
     unsigned    I;
 
@@ -763,10 +944,6 @@ void DumpObjLineInfo (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
-
     /* Seek to the start of line infos */
     FileSetPos (F, Offset + H.LineInfoOffs);
 
@@ -809,9 +986,6 @@ void DumpObjLineInfo (FILE* F, unsigned long Offset)
         printf ("      Col:%27u\n", Pos.Col);
         printf ("      Name:%26u\n", Pos.Name);
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -820,7 +994,7 @@ void DumpObjScopes (FILE* F, unsigned long Offset)
 /* Dump the scopes from an object file */
 {
     ObjHeader   H;
-    Collection  StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned    Count;
     unsigned    I;
 
@@ -828,9 +1002,8 @@ void DumpObjScopes (FILE* F, unsigned long Offset)
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of scopes */
     FileSetPos (F, Offset + H.ScopeOffs);
@@ -871,7 +1044,7 @@ void DumpObjScopes (FILE* F, unsigned long Offset)
         printf ("      Type:%26s\n",            ScopeType);
 
         /* Resolve and print the name */
-        Name = GetString (&StrPool, ReadVar (F));
+        Name = GetString (StrPool, ReadVar (F));
         Len  = strlen (Name);
         printf ("      Name:%*s\"%s\"\n", (int)(24-Len), "", Name);
 
@@ -890,9 +1063,6 @@ void DumpObjScopes (FILE* F, unsigned long Offset)
         /* Skip the spans */
         SkipSpanList (F);
     }
-
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
 }
 
 
@@ -901,22 +1071,23 @@ void DumpObjSegSize (FILE* F, unsigned long Offset)
 /* Dump the sizes of the segment in the object file */
 {
     ObjHeader   H;
-    Collection  StrPool = AUTO_COLLECTION_INITIALIZER;
+    const Collection* StrPool;
     unsigned    Count;
 
     /* Seek to the header position and read the header */
     FileSetPos (F, Offset);
     ReadObjHeader (F, &H);
 
-    /* Seek to the start of the string pool and read it */
-    FileSetPos (F, Offset + H.StrPoolOffs);
-    ReadStrPool (F, &StrPool);
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
 
     /* Seek to the start of the segments */
     FileSetPos (F, Offset + H.SegOffs);
 
     /* Output a header */
-    printf ("  Segment sizes:\n");
+    if (Format == F_TEXT) {
+        printf ("  Segment sizes:\n");
+    }
 
     /* Read the number of segments */
     Count = ReadVar (F);
@@ -929,7 +1100,7 @@ void DumpObjSegSize (FILE* F, unsigned long Offset)
         /* Read the data for one segment */
         unsigned long DataSize = Read32 (F);
         unsigned long NextSeg  = ftell (F) + DataSize;
-        const char*   Name     = GetString (&StrPool, ReadVar (F));
+        const char*   Name     = GetString (StrPool, ReadVar (F));
         unsigned      Len      = strlen (Name);
 
         /* Skip segment flags, read size */
@@ -942,12 +1113,211 @@ void DumpObjSegSize (FILE* F, unsigned long Offset)
         (void) ReadVar (F);
 
         /* Print the size for this segment */
-        printf ("    %s:%*s%6lu\n", Name, (int)(24-Len), "", Size);
+        if (Format != F_TEXT) {
+            /* segsize,file,name,size */
+            RecStart ("segsize");
+            RecStr ("name", Name);
+            RecNum ("size", Size);
+            RecEnd ();
+        } else {
+            printf ("    %s:%*s%6lu\n", Name, (int)(24-Len), "", Size);
+        }
 
         /* Seek to the end of the segment data (start of next) */
         FileSetPos (F, NextSeg);
     }
+}
+
+
+
+static const char* GetFragType (unsigned Type)
+/* Get the name of a fragment type */
+{
+    switch (Type) {
+        case FRAG_LITERAL:      return "literal";
+        case FRAG_EXPR:         return "expr";
+        case FRAG_SEXPR:        return "sexpr";
+        case FRAG_FILL:         return "fill";
+        default:                return "unknown";
+    }
+}
+
+
+
+void DumpObjFragments (FILE* F, unsigned long Offset)
+/* Dump the fragments of all segments in the object file */
+{
+    ObjHeader   H;
+    const Collection* StrPool;
+    unsigned    Count;
+    unsigned    I;
+
+    /* Seek to the header position and read the header */
+    FileSetPos (F, Offset);
+    ReadObjHeader (F, &H);
+
+    /* Get the string pool */
+    StrPool = GetStrPool (F, Offset, &H);
+
+    /* Seek to the start of the segments */
+    FileSetPos (F, Offset + H.SegOffs);
+
+    /* Output a header */
+    if (Format == F_TEXT) {
+        printf ("  Fragments:\n");
+    }
+
+    /* Read the number of segments */
+    Count = ReadVar (F);
+
+    /* Walk over all segments */
+    for (I = 0; I < Count; ++I) {
 
-    /* Destroy the string pool */
-    DestroyStrPool (&StrPool);
+        unsigned long J;
+
+        /* Read the segment header */
+        unsigned long DataSize  = Read32 (F);
+        unsigned long NextSeg   = ftell (F) + DataSize;
+        const char*   Name      = GetString (StrPool, ReadVar (F));
+        unsigned long FragCount;
+
+        /* Skip flags, size, alignment and address size */
+        (void) ReadVar (F);
+        (void) ReadVar (F);
+        (void) ReadVar (F);
+        (void) Read8 (F);
+        FragCount = ReadVar (F);
+
+        if (Format == F_TEXT) {
+            printf ("    Segment:%*s\"%s\"\n", (int)(23-strlen (Name)), "", Name);
+            printf ("      Count:%25lu\n", FragCount);
+        }
+
+        /* Read the fragments */
+        for (J = 0; J < FragCount; ++J) {
+
+            unsigned long Size;
+
+            /* Read the fragment type */
+            unsigned char Type  = Read8 (F);
+            unsigned char Bytes = Type & FRAG_BYTEMASK;
+            Type &= FRAG_TYPEMASK;
+
+            /* Get the size and skip the fragment data */
+            switch (Type) {
+
+                case FRAG_LITERAL:
+                    Size = ReadVar (F);
+                    FileSetPos (F, ftell (F) + Size);
+                    break;
+
+                case FRAG_EXPR:
+                case FRAG_SEXPR:
+                    Size = Bytes;
+                    SkipExpr (F);
+                    break;
+
+                case FRAG_FILL:
+                    Size = ReadVar (F);
+                    break;
+
+                default:
+                    Error ("Unknown fragment type in segment `%s': %02X",
+                           Name, Type);
+                    /* NOTREACHED */
+                    return;
+            }
+
+            /* Skip the line infos */
+            SkipLineInfoList (F);
+
+            if (Format != F_TEXT) {
+                /* fragment,file,segment,index,type,size */
+                RecStart ("fragment");
+                RecNum ("segment", I);
+                RecNum ("index", J);
+                RecSym ("type", GetFragType (Type));
+                RecNum ("size", Size);
+                RecEnd ();
+            } else {
+                printf ("      %-8s%22lu\n", GetFragType (Type), Size);
+            }
+        }
+
+        /* Seek to the end of the segment data (start of next) */
+        FileSetPos (F, NextSeg);
+    }
+}
+
+
+
+static void DumpObjStatsSection (FILE* F, unsigned long Offset,
+                                 const char* Name, unsigned long SecOffs,
+                                 unsigned long SecSize)
+/* Print the statistics line for one section of an object file */
+{
+    /* Sections start with the number of items if they're not empty */
+    unsigned long Count = 0;
+    if (SecSize > 0) {
+        FileSetPos (F, Offset + SecOffs);
+        Count = ReadVar (F);
+    }
+
+    if (Format != F_TEXT) {
+        /* stats,file,section,count,size */
+        RecStart ("stats");
+        RecStr ("section", Name);
+        RecNum ("count", Count);
+        RecNum ("size", SecSize);
+        RecEnd ();
+    } else {
+        printf ("    %-20s%10lu%12lu\n", Name, Count, SecSize);
+    }
+}
+
+
+
+void DumpObjStats (FILE* F, unsigned long Offset)
+/* Dump the number of items and the size of all sections in the object file */
+{
+    ObjHeader H;
+
+    /* Seek to the header position and read the header */
+    FileSetPos (F, Offset);
+    ReadObjHeader (F, &H);
+
+    /* Output a header */
+    if (Format == F_TEXT) {
+        printf ("  Statistics:\n");
+        printf ("    %-20s%10s%12s\n", "Section", "Count", "Size");
+    }
+
+    /* Output one line per section */
+    DumpObjStatsSection (F, Offset, "Options", H.OptionOffs, H.OptionSize);
+    DumpObjStatsSection (F, Offset, "Files", H.FileOffs, H.FileSize);
+    DumpObjStatsSection (F, Offset, "Segments", H.SegOffs, H.SegSize);
+    DumpObjStatsSection (F, Offset, "Imports", H.ImportOffs, H.ImportSize);
+    DumpObjStatsSection (F, Offset, "Exports", H.ExportOffs, H.ExportSize);
+    DumpObjStatsSection (F, Offset, "Debug symbols", H.DbgSymOffs, H.DbgSymSize);
+    DumpObjStatsSection (F, Offset, "Line infos", H.LineInfoOffs, H.LineInfoSize);
+    DumpObjStatsSection (F, Offset, "String pool", H.StrPoolOffs, H.StrPoolSize);
+    DumpObjStatsSection (F, Offset, "Assertions", H.AssertOffs, H.AssertSize);
+    DumpObjStatsSection (F, Offset, "Scopes", H.ScopeOffs, H.ScopeSize);
+    DumpObjStatsSection (F, Offset, "Spans", H.SpanOffs, H.SpanSize);
+
+    /* Total file size */
+    if (Format == F_TEXT) {
+        fseek (F, 0, SEEK_END);
+        printf ("    %-20s%10s%12lu\n", "Total", "", ftell (F) - Offset);
+    }
+}
+
+
+
+void DumpObjDone (void)
+/* Release data kept between the dumps of one object file. Must be called
+** before the file is closed.
+*/
+{
+    FreeStrPool ();
 }
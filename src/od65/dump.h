@@ -78,6 +78,17 @@ void DumpObjScopes (FILE* F, unsigned long Offset);
 void DumpObjSegSize (FILE* F, unsigned long Offset);
 /* Dump the sizes of the segment in the object file */
 
+void DumpObjFragments (FILE* F, unsigned long Offset);
+/* Dump the fragments of all segments in the object file */
+
+void DumpObjStats (FILE* F, unsigned long Offset);
+/* Dump the number of items and the size of all sections in the object file */
+
+void DumpObjDone (void);
+/* Release data kept between the dumps of one object file. Must be called
+** before the file is closed.
+*/
+
 
 
 /* End of dump.h */
@@ -43,4 +43,6 @@
 
 
 
-unsigned What   = 0;            /* What should get dumped? */
+unsigned        What      = 0;          /* What should get dumped? */
+unsigned        Format    = F_TEXT;     /* Output format */
+const char*     InputName = 0;          /* Name of the file dumped */
@@ -54,11 +54,24 @@
 #define D_LINEINFO      0x0080U         /* Dump line infos */
 #define D_SCOPES        0x0100U         /* Dump scopes */
 #define D_SEGSIZE       0x0200U         /* Dump segment sizes */
-#define D_ALL           0xFFFFU         /* Dump anything */
+#define D_RELOC         0x0400U         /* Dump o65 relocation tables */
+#define D_FRAGMENTS     0x0800U         /* Dump fragments */
+#define D_STATS         0x1000U         /* Dump section statistics */
+#define D_ALL           0x07FFU         /* Dump anything but fragments/stats */
+
+/* Sections that may be output as CSV or JSON */
+#define D_CSV           (D_SEGMENTS | D_IMPORTS | D_EXPORTS | D_SEGSIZE | \
+                         D_FRAGMENTS | D_STATS)
+
+#define F_TEXT          0U              /* Human readable output */
+#define F_CSV           1U              /* Comma separated values */
+#define F_JSON          2U              /* One JSON object per line */
 
 
 
 extern unsigned         What;           /* What should get dumped? */
+extern unsigned         Format;         /* Output format */
+extern const char*      InputName;      /* Name of the file dumped */
 
 
 
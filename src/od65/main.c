@@ -48,6 +48,7 @@
 #include "error.h"
 #include "fileio.h"
 #include "global.h"
+#include "o65.h"
 
 
 
@@ -78,23 +79,46 @@ static void Usage (void)
             "  -V\t\t\tPrint the version number and exit\n"
             "\n"
             "Long options:\n"
+            "  --csv\t\t\tOutput comma separated values\n"
             "  --dump-all\t\tDump all object file information\n"
             "  --dump-dbgsyms\tDump debug symbols\n"
             "  --dump-exports\tDump exported symbols\n"
             "  --dump-files\t\tDump the source files\n"
+            "  --dump-fragments\tDump the fragments of all segments\n"
             "  --dump-header\t\tDump the object file header\n"
             "  --dump-imports\tDump imported symbols\n"
             "  --dump-lineinfo\tDump line information\n"
             "  --dump-options\tDump object file options\n"
+            "  --dump-reloc\t\tDump o65 relocation tables\n"
             "  --dump-segments\tDump the segments in the file\n"
             "  --dump-segsize\tDump segments sizes\n"
             "  --help\t\tHelp (this text)\n"
+            "  --json\t\tOutput JSON objects\n"
+            "  --stats\t\tDump section statistics\n"
             "  --version\t\tPrint the version number and exit\n",
             ProgName);
 }
 
 
 
+static void OptCSV (const char* Opt attribute ((unused)),
+                    const char* Arg attribute ((unused)))
+/* Output comma separated values */
+{
+    Format = F_CSV;
+}
+
+
+
+static void OptJSON (const char* Opt attribute ((unused)),
+                     const char* Arg attribute ((unused)))
+/* Output JSON objects */
+{
+    Format = F_JSON;
+}
+
+
+
 static void OptDumpAll (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Dump all object file information */
@@ -131,6 +155,15 @@ static void OptDumpFiles (const char* Opt attribute ((unused)),
 
 
 
+static void OptDumpFragments (const char* Opt attribute ((unused)),
+                              const char* Arg attribute ((unused)))
+/* Dump the fragments of all segments */
+{
+    What |= D_FRAGMENTS;
+}
+
+
+
 static void OptDumpHeader (const char* Opt attribute ((unused)),
                            const char* Arg attribute ((unused)))
 /* Dump the object file header */
@@ -167,6 +200,15 @@ static void OptDumpOptions (const char* Opt attribute ((unused)),
 
 
 
+static void OptDumpReloc (const char* Opt attribute ((unused)),
+                          const char* Arg attribute ((unused)))
+/* Dump the relocation tables of o65 files */
+{
+    What |= D_RELOC;
+}
+
+
+
 static void OptDumpScopes (const char* Opt attribute ((unused)),
                            const char* Arg attribute ((unused)))
 /* Dump the scopes in the object file */
@@ -204,6 +246,15 @@ static void OptHelp (const char* Opt attribute ((unused)),
 
 
 
+static void OptStats (const char* Opt attribute ((unused)),
+                      const char* Arg attribute ((unused)))
+/* Dump section statistics */
+{
+    What |= D_STATS;
+}
+
+
+
 static void OptVersion (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Print the assembler version */
@@ -225,11 +276,17 @@ static void DumpFile (const char* Name)
         Error ("Cannot open `%s': %s", Name, strerror (errno));
     }
 
+    /* Use a large buffer, the dump functions read the file in small pieces */
+    setvbuf (F, 0, _IOFBF, 0x10000);
+
+    /* Remember the name for CSV and JSON output */
+    InputName = Name;
+
     /* Read the magic word */
     Magic = Read32 (F);
 
     /* Do we know this type of file? */
-    if (Magic != OBJ_MAGIC) {
+    if (Magic != OBJ_MAGIC && Magic != O65_MAGIC) {
 
         /* Unknown format */
         printf ("%s: (no xo65 object file)\n", Name);
@@ -239,42 +296,70 @@ static void DumpFile (const char* Name)
         /* Special handling if no info was requested */
         printf ("%s: (no information requested)\n", Name);
 
+    } else if (Magic == O65_MAGIC) {
+
+        /* o65 files have their own layout */
+        printf ("%s:\n", Name);
+        DumpO65 (F, 0);
+
     } else {
 
+        /* What to dump from this file. Only some of the sections may be
+        ** output as CSV or JSON.
+        */
+        unsigned Dump = What;
+
         /* Print the filename */
-        printf ("%s:\n", Name);
+        if (Format == F_TEXT) {
+            printf ("%s:\n", Name);
+        } else {
+            if (Dump & ~D_CSV & D_ALL) {
+                Warning ("Some of the requested information is not available "
+                         "as %s", (Format == F_JSON)? "JSON" : "CSV");
+            }
+            Dump &= D_CSV;
+        }
 
         /* Check what to dump */
-        if (What & D_HEADER) {
+        if (Dump & D_HEADER) {
             DumpObjHeader (F, 0);
         }
-        if (What & D_OPTIONS) {
+        if (Dump & D_OPTIONS) {
             DumpObjOptions (F, 0);
         }
-        if (What & D_FILES) {
+        if (Dump & D_FILES) {
             DumpObjFiles (F, 0);
         }
-        if (What & D_SEGMENTS) {
+        if (Dump & D_SEGMENTS) {
             DumpObjSegments (F, 0);
         }
-        if (What & D_IMPORTS) {
+        if (Dump & D_IMPORTS) {
             DumpObjImports (F, 0);
         }
-        if (What & D_EXPORTS) {
+        if (Dump & D_EXPORTS) {
             DumpObjExports (F, 0);
         }
-        if (What & D_DBGSYMS) {
+        if (Dump & D_DBGSYMS) {
             DumpObjDbgSyms (F, 0);
         }
-        if (What & D_LINEINFO) {
+        if (Dump & D_LINEINFO) {
             DumpObjLineInfo (F, 0);
         }
-        if (What & D_SCOPES) {
+        if (Dump & D_SCOPES) {
             DumpObjScopes (F, 0);
         }
-        if (What & D_SEGSIZE) {
+        if (Dump & D_SEGSIZE) {
             DumpObjSegSize (F, 0);
         }
+        if (Dump & D_FRAGMENTS) {
+            DumpObjFragments (F, 0);
+        }
+        if (Dump & D_STATS) {
+            DumpObjStats (F, 0);
+        }
+
+        /* Release data cached while dumping */
+        DumpObjDone ();
     }
 
     /* Close the file */
@@ -288,18 +373,23 @@ int main (int argc, char* argv [])
 {
     /* Program long options */
     static const LongOpt OptTab[] = {
+        { "--csv",              0,      OptCSV                  },
         { "--dump-all",         0,      OptDumpAll              },
         { "--dump-dbgsyms",     0,      OptDumpDbgSyms          },
         { "--dump-exports",     0,      OptDumpExports          },
         { "--dump-files",       0,      OptDumpFiles            },
+        { "--dump-fragments",   0,      OptDumpFragments        },
         { "--dump-header",      0,      OptDumpHeader           },
         { "--dump-imports",     0,      OptDumpImports          },
         { "--dump-lineinfo",    0,      OptDumpLineInfo         },
         { "--dump-options",     0,      OptDumpOptions          },
+        { "--dump-reloc",       0,      OptDumpReloc            },
         { "--dump-scopes",      0,      OptDumpScopes           },
         { "--dump-segments",    0,      OptDumpSegments         },
         { "--dump-segsize",     0,      OptDumpSegSize          },
         { "--help",             0,      OptHelp                 },
+        { "--json",             0,      OptJSON                 },
+        { "--stats",            0,      OptStats                },
         { "--version",          0,      OptVersion              },
     };
 
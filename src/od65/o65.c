@@ -0,0 +1,415 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   o65.c                                   */
+/*                                                                           */
+/*                               Dump o65 files                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "coll.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
+/* od65 */
+#include "error.h"
+#include "fileio.h"
+#include "global.h"
+#include "o65.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Header mode bits */
+#define MF_CPU_65816    0x8000          /* Executable is for 65816 */
+#define MF_RELOC_PAGE   0x4000          /* Page wise relocation */
+#define MF_SIZE_32BIT   0x2000          /* All size words are 32bit */
+#define MF_FTYPE_OBJ    0x1000          /* Object file */
+#define MF_ADDR_SIMPLE  0x0800          /* Simple addressing */
+#define MF_CHAIN        0x0400          /* Another file follows */
+#define MF_BSSZERO      0x0200          /* Clear the bss segment */
+#define MF_ALIGN_MASK   0x0003          /* Mask to extract alignment */
+
+/* Segment ids */
+#define O65SEG_UNDEF    0x00
+#define O65SEG_ABS      0x01
+#define O65SEG_TEXT     0x02
+#define O65SEG_DATA     0x03
+#define O65SEG_BSS      0x04
+#define O65SEG_ZP       0x05
+
+/* Relocation types */
+#define O65RELOC_WORD   0x80
+#define O65RELOC_HIGH   0x40
+#define O65RELOC_LOW    0x20
+#define O65RELOC_SEGADR 0xC0
+#define O65RELOC_SEG    0xA0
+#define O65RELOC_MASK   0xE0
+
+/* Header options */
+#define O65OPT_FILENAME         0
+#define O65OPT_OS               1
+#define O65OPT_ASM              2
+#define O65OPT_AUTHOR           3
+#define O65OPT_TIMESTAMP        4
+
+/* The o65 file header */
+typedef struct O65Header O65Header;
+struct O65Header {
+    unsigned        Version;            /* Version number for o65 format */
+    unsigned        Mode;               /* Mode word */
+    unsigned long   TextBase;           /* Base address of text segment */
+    unsigned long   TextSize;           /* Size of text segment */
+    unsigned long   DataBase;           /* Base of data segment */
+    unsigned long   DataSize;           /* Size of data segment */
+    unsigned long   BssBase;            /* Base of bss segment */
+    unsigned long   BssSize;            /* Size of bss segment */
+    unsigned long   ZPBase;             /* Base of zeropage segment */
+    unsigned long   ZPSize;             /* Size of zeropage segment */
+    unsigned long   StackSize;          /* Requested stack size */
+};
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static unsigned long ReadSize (FILE* F, const O65Header* H)
+/* Read a "size" word from the file */
+{
+    return (H->Mode & MF_SIZE_32BIT)? Read32 (F) : Read16 (F);
+}
+
+
+
+static char* ReadCStr (FILE* F)
+/* Read a zero terminated string from the file into a malloced area */
+{
+    char* Str;
+    StrBuf S = STATIC_STRBUF_INITIALIZER;
+    unsigned C;
+    while ((C = Read8 (F)) != 0) {
+        SB_AppendChar (&S, C);
+    }
+    SB_Terminate (&S);
+    Str = xstrdup (SB_GetConstBuf (&S));
+    SB_Done (&S);
+    return Str;
+}
+
+
+
+static const char* GetSegName (unsigned Id)
+/* Return the name of an o65 segment id */
+{
+    switch (Id) {
+        case O65SEG_UNDEF:      return "undef";
+        case O65SEG_ABS:        return "abs";
+        case O65SEG_TEXT:       return "text";
+        case O65SEG_DATA:       return "data";
+        case O65SEG_BSS:        return "bss";
+        case O65SEG_ZP:         return "zp";
+        default:                return "unknown";
+    }
+}
+
+
+
+static const char* GetRelocType (unsigned Type)
+/* Return the name of an o65 relocation type */
+{
+    switch (Type & O65RELOC_MASK) {
+        case O65RELOC_WORD:     return "WORD";
+        case O65RELOC_HIGH:     return "HIGH";
+        case O65RELOC_LOW:      return "LOW";
+        case O65RELOC_SEGADR:   return "SEGADR";
+        case O65RELOC_SEG:      return "SEG";
+        default:                return "UNKNOWN";
+    }
+}
+
+
+
+static void DumpSegment (const char* Name, unsigned long Base, unsigned long Size)
+/* Dump base and size of one o65 segment */
+{
+    printf ("    %s:\n", Name);
+    printf ("      Base:%*s0x%04lX\n", 20, "", Base);
+    printf ("      Size:  %24lu\n", Size);
+}
+
+
+
+static void DumpOptions (FILE* F)
+/* Dump the header options. The file is positioned at the first option. */
+{
+    unsigned Len;
+    unsigned Count = 0;
+
+    if (What & D_OPTIONS) {
+        printf ("  Options:\n");
+    }
+
+    /* Options are terminated by a zero length byte */
+    while ((Len = Read8 (F)) != 0) {
+
+        unsigned char Data[256];
+        unsigned      Type;
+        unsigned      I;
+
+        if (Len < 2) {
+            Error ("Invalid o65 option length: %u", Len);
+        }
+        Type = Read8 (F);
+        Len -= 2;
+        ReadData (F, Data, Len);
+        Data[Len] = '\0';
+
+        if ((What & D_OPTIONS) == 0) {
+            continue;
+        }
+
+        printf ("    Index:%27u\n", Count++);
+        switch (Type) {
+
+            case O65OPT_FILENAME:
+            case O65OPT_ASM:
+            case O65OPT_AUTHOR:
+            case O65OPT_TIMESTAMP:
+                printf ("      Type:%22s0x%02X  (%s)\n", "", Type,
+                        (Type == O65OPT_FILENAME)? "O65OPT_FILENAME" :
+                        (Type == O65OPT_ASM)?      "O65OPT_ASM"      :
+                        (Type == O65OPT_AUTHOR)?   "O65OPT_AUTHOR"   :
+                                                   "O65OPT_TIMESTAMP");
+                /* Strings are zero terminated */
+                printf ("      Data:%*s\"%s\"\n",
+                        (int) (24 - strlen ((const char*) Data)), "",
+                        (const char*) Data);
+                break;
+
+            default:
+                printf ("      Type:%22s0x%02X  (%s)\n", "", Type,
+                        (Type == O65OPT_OS)? "O65OPT_OS" : "O65OPT_UNKNOWN");
+                printf ("      Data:%*s", 24 - (int) (Len * 3), "");
+                for (I = 0; I < Len; ++I) {
+                    printf (" %02X", Data[I]);
+                }
+                printf ("\n");
+                break;
+        }
+    }
+}
+
+
+
+static void DumpReloc (FILE* F, const O65Header* H, const Collection* Imports,
+                       const char* Name, unsigned long Base)
+/* Dump one relocation table. The file is positioned at its start. */
+{
+    unsigned      Count = 0;
+    long          Offs  = -1;
+    unsigned      B;
+
+    if (What & D_RELOC) {
+        printf ("  %s:\n", Name);
+    }
+
+    /* The table is terminated by a zero offset byte */
+    while ((B = Read8 (F)) != 0) {
+
+        unsigned      Type;
+        unsigned      SegId;
+        unsigned long Extra = 0;
+        int           HaveExtra = 0;
+
+        /* 0xFF skips 0xFE bytes */
+        if (B == 0xFF) {
+            Offs += 0xFE;
+            continue;
+        }
+        Offs += B;
+
+        /* Read the type byte and any additional data */
+        Type  = Read8 (F);
+        SegId = Type & ~O65RELOC_MASK;
+        if (SegId == O65SEG_UNDEF) {
+            Extra = ReadSize (F, H);
+        } else if ((Type & O65RELOC_MASK) == O65RELOC_HIGH) {
+            if ((H->Mode & MF_RELOC_PAGE) == 0) {
+                Extra = Read8 (F);
+                HaveExtra = 1;
+            }
+        } else if ((Type & O65RELOC_MASK) == O65RELOC_SEG) {
+            Extra = Read16 (F);
+            HaveExtra = 1;
+        }
+
+        if ((What & D_RELOC) == 0) {
+            ++Count;
+            continue;
+        }
+
+        /* Print the entry */
+        printf ("    0x%04lX  0x%04lX  %-6s  %s", (unsigned long) Offs,
+                Base + Offs, GetRelocType (Type), GetSegName (SegId));
+        if (SegId == O65SEG_UNDEF) {
+            if (Extra < CollCount (Imports)) {
+                printf ("  \"%s\"", (const char*) CollConstAt (Imports, Extra));
+            } else {
+                printf ("  #%lu", Extra);
+            }
+        } else if (HaveExtra) {
+            printf ("  0x%02lX", Extra);
+        }
+        printf ("\n");
+        ++Count;
+    }
+
+    if (What & D_RELOC) {
+        printf ("    Count:%27u\n", Count);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void DumpO65 (FILE* F, unsigned long Offset)
+/* Dump the parts of an o65 file selected by What. Offset is the position of
+** the o65 marker in the file.
+*/
+{
+    O65Header     H;
+    Collection    Imports = AUTO_COLLECTION_INITIALIZER;
+    unsigned long Count;
+    unsigned long I;
+
+    /* Read the header. The file format is strictly sequential, so all
+    ** parts must be read even if they are not dumped.
+    */
+    FileSetPos (F, Offset + 4);
+    if (Read8 (F) != '5') {
+        Error ("Invalid o65 marker");
+    }
+    H.Version   = Read8 (F);
+    H.Mode      = Read16 (F);
+    H.TextBase  = ReadSize (F, &H);
+    H.TextSize  = ReadSize (F, &H);
+    H.DataBase  = ReadSize (F, &H);
+    H.DataSize  = ReadSize (F, &H);
+    H.BssBase   = ReadSize (F, &H);
+    H.BssSize   = ReadSize (F, &H);
+    H.ZPBase    = ReadSize (F, &H);
+    H.ZPSize    = ReadSize (F, &H);
+    H.StackSize = ReadSize (F, &H);
+
+    if (What & D_HEADER) {
+        printf ("  Header:\n");
+        printf ("    Version:%25u\n", H.Version);
+        printf ("    Mode:%24s0x%04X  (", "", H.Mode);
+        printf ("%s", (H.Mode & MF_CPU_65816)? "65816" : "6502");
+        printf ("%s", (H.Mode & MF_RELOC_PAGE)? ", page reloc" : "");
+        printf ("%s", (H.Mode & MF_SIZE_32BIT)? ", 32 bit" : ", 16 bit");
+        printf ("%s", (H.Mode & MF_FTYPE_OBJ)? ", object" : ", executable");
+        printf ("%s", (H.Mode & MF_ADDR_SIMPLE)? ", simple" : "");
+        printf ("%s", (H.Mode & MF_CHAIN)? ", chain" : "");
+        printf ("%s", (H.Mode & MF_BSSZERO)? ", bsszero" : "");
+        printf (", align %u)\n", 1U << ((H.Mode & MF_ALIGN_MASK) == 3? 8 : (H.Mode & MF_ALIGN_MASK)));
+        printf ("    Stack size:%22lu\n", H.StackSize);
+    }
+    if (What & (D_HEADER | D_SEGMENTS | D_SEGSIZE)) {
+        printf ("  Segments:\n");
+        DumpSegment ("text", H.TextBase, H.TextSize);
+        DumpSegment ("data", H.DataBase, H.DataSize);
+        DumpSegment ("bss",  H.BssBase,  H.BssSize);
+        DumpSegment ("zp",   H.ZPBase,   H.ZPSize);
+    }
+
+    /* Options */
+    DumpOptions (F);
+
+    /* Skip the text and data segments */
+    FileSetPos (F, FileGetPos (F) + H.TextSize + H.DataSize);
+
+    /* Imports. Keep the names for the relocation tables. */
+    Count = ReadSize (F, &H);
+    for (I = 0; I < Count; ++I) {
+        CollAppend (&Imports, ReadCStr (F));
+    }
+    if (What & D_IMPORTS) {
+        printf ("  Imports:\n");
+        printf ("    Count:%27lu\n", Count);
+        for (I = 0; I < Count; ++I) {
+            const char* Name = CollConstAt (&Imports, I);
+            printf ("    Index:%27lu\n", I);
+            printf ("      Name:%*s\"%s\"\n", (int) (24 - strlen (Name)), "", Name);
+        }
+    }
+
+    /* Relocation tables */
+    DumpReloc (F, &H, &Imports, "Text relocation", H.TextBase);
+    DumpReloc (F, &H, &Imports, "Data relocation", H.DataBase);
+
+    /* Exports */
+    Count = ReadSize (F, &H);
+    if (What & D_EXPORTS) {
+        printf ("  Exports:\n");
+        printf ("    Count:%27lu\n", Count);
+    }
+    for (I = 0; I < Count; ++I) {
+        char*         Name  = ReadCStr (F);
+        unsigned      SegId = Read8 (F);
+        unsigned long Val   = ReadSize (F, &H);
+        if (What & D_EXPORTS) {
+            printf ("    Index:%27lu\n", I);
+            printf ("      Name:%*s\"%s\"\n", (int) (24 - strlen (Name)), "", Name);
+            printf ("      Segment:%19s0x%02X  (%s)\n", "", SegId, GetSegName (SegId));
+            printf ("      Value:%15s0x%08lX  (%lu)\n", "", Val, Val);
+        }
+        xfree (Name);
+    }
+
+    /* Free the import names */
+    for (I = 0; I < CollCount (&Imports); ++I) {
+        xfree (CollAtUnchecked (&Imports, I));
+    }
+    DoneCollection (&Imports);
+}
@@ -0,0 +1,70 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   o65.h                                   */
+/*                                                                           */
+/*                               Dump o65 files                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef O65_H
+#define O65_H
+
+
+
+#include <stdio.h>
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The first four bytes of an o65 file read as a 32 bit little endian word.
+** The marker is followed by a '5' and the version.
+*/
+#define O65_MAGIC       0x366F0001UL
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void DumpO65 (FILE* F, unsigned long Offset);
+/* Dump the parts of an o65 file selected by What. Offset is the position of
+** the o65 marker in the file.
+*/
+
+
+
+/* End of o65.h */
+
+#endif
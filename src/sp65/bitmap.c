@@ -33,6 +33,8 @@
 
 
 
+#include <string.h>
+
 /* common */
 #include "check.h"
 #include "xmalloc.h"
@@ -49,8 +51,49 @@
 
 
 
+static Bitmap* NewBitmapHeader (unsigned Width, unsigned Height)
+/* Create a new bitmap without pixel data */
+{
+    /* Allocate memory */
+    Bitmap* B = xmalloc (sizeof (*B));
+
+    /* Initialize the data */
+    B->Name     = EmptyStrBuf;
+    B->Width    = Width;
+    B->Height   = Height;
+    B->Pal      = 0;
+    B->Index    = 0;
+    B->Colors   = 0;
+    B->Pitch    = Width;
+    B->Base     = 0;
+    B->RefCount = 1;
+
+    /* Return the bitmap */
+    return B;
+}
+
+
+
+static void ReleaseBitmap (Bitmap* B)
+/* Drop one reference to a bitmap. If it was the last one, free the bitmap
+** and drop the reference to the owner of the pixel data.
+*/
+{
+    if (--B->RefCount == 0) {
+        if (B->Base) {
+            ReleaseBitmap (B->Base);
+        } else {
+            xfree (B->Index);
+            xfree (B->Colors);
+        }
+        xfree (B);
+    }
+}
+
+
+
 Bitmap* NewBitmap (unsigned Width, unsigned Height)
-/* Create a new bitmap. The type is set to unknown and the palette to NULL */
+/* Create a new bitmap with one color per pixel. The palette is set to NULL */
 {
     Bitmap* B;
 
@@ -60,14 +103,32 @@ Bitmap* NewBitmap (unsigned Width, unsigned Height)
     /* Some safety checks */
     PRECONDITION (Size > 0 && Size <= BM_MAX_SIZE);
 
-    /* Allocate memory */
-    B = xmalloc (sizeof (*B) + (Size - 1) * sizeof (B->Data[0]));
+    /* Create the bitmap and allocate the pixel data */
+    B = NewBitmapHeader (Width, Height);
+    B->Colors = xmalloc (Size * sizeof (B->Colors[0]));
 
-    /* Initialize the data */
-    B->Name     = EmptyStrBuf;
-    B->Width    = Width;
-    B->Height   = Height;
-    B->Pal      = 0;
+    /* Return the bitmap */
+    return B;
+}
+
+
+
+Bitmap* NewIndexedBitmap (unsigned Width, unsigned Height)
+/* Create a new bitmap with one palette index per pixel. The palette is set
+** to NULL and must be set by the caller.
+*/
+{
+    Bitmap* B;
+
+    /* Calculate the size of the bitmap in pixels */
+    unsigned long Size = (unsigned long) Width * Height;
+
+    /* Some safety checks */
+    PRECONDITION (Size > 0 && Size <= BM_MAX_SIZE);
+
+    /* Create the bitmap and allocate the pixel data */
+    B = NewBitmapHeader (Width, Height);
+    B->Index = xmalloc (Size);
 
     /* Return the bitmap */
     return B;
@@ -80,10 +141,13 @@ void FreeBitmap (Bitmap* B)
 {
     /* Alloc NULL pointers */
     if (B != 0) {
-        /* Free name, palette and then the bitmap */
+        /* Free name and palette. The pixel data is freed together with the
+        ** bitmap when there are no more slices using it.
+        */
         SB_Done (&B->Name);
-        xfree (B->Pal);
-        xfree(B);
+        FreePalette (B->Pal);
+        B->Pal = 0;
+        ReleaseBitmap (B);
     }
 }
 
@@ -108,15 +172,16 @@ Bitmap* SliceBitmap (const Bitmap* O, unsigned OrigX, unsigned OrigY,
 ** upper left corner.
 */
 {
-    Bitmap*  B;
-    unsigned Y;
+    Bitmap*       B;
+    unsigned long Offs;
 
 
     /* Check the coordinates and size */
     PRECONDITION (OrigX + Width <= O->Width && OrigY + Height <= O->Height);
+    PRECONDITION (ValidBitmapSize (Width, Height));
 
     /* Create a new bitmap with the given size */
-    B = NewBitmap (Width, Height);
+    B = NewBitmapHeader (Width, Height);
 
     /* Copy fields from the original */
     if (SB_GetLen (&O->Name) > 0) {
@@ -125,12 +190,18 @@ Bitmap* SliceBitmap (const Bitmap* O, unsigned OrigX, unsigned OrigY,
     }
     B->Pal = DupPalette (O->Pal);
 
-    /* Copy the pixel data */
-    for (Y = 0; Y < Height; ++Y) {
-        memcpy (B->Data + Y * B->Width,
-                O->Data + (OrigY + Y) * O->Width + OrigX,
-                Width * sizeof (O->Data[0]));
+    /* Use the pixel data of the original */
+    Offs = (unsigned long) OrigY * O->Pitch + OrigX;
+    if (O->Index) {
+        B->Index = O->Index + Offs;
+    } else {
+        B->Colors = O->Colors + Offs;
     }
+    B->Pitch = O->Pitch;
+
+    /* Reference the owner of the pixel data */
+    B->Base = O->Base? O->Base : (Bitmap*) O;
+    ++B->Base->RefCount;
 
     /* Return the slice */
     return B;
@@ -138,6 +209,114 @@ Bitmap* SliceBitmap (const Bitmap* O, unsigned OrigX, unsigned OrigY,
 
 
 
+static unsigned NearestColor (const Palette* P, Color C, int Trans)
+/* Return the index of the palette entry closest to C. Trans is the index of
+** the transparent entry or -1. Transparent colors map to this entry, all
+** others never do.
+*/
+{
+    unsigned I;
+    unsigned Best = 0;
+    unsigned long BestDist = ~0UL;
+
+    if (Trans >= 0 && C.A >= 128) {
+        return (unsigned) Trans;
+    }
+    for (I = 0; I < P->Count; ++I) {
+        const Color* E = &P->Entries[I];
+        long DR = (long) E->R - C.R;
+        long DG = (long) E->G - C.G;
+        long DB = (long) E->B - C.B;
+        unsigned long Dist = DR * DR + DG * DG + DB * DB;
+        if (Dist < BestDist && (int) I != Trans) {
+            Best     = I;
+            BestDist = Dist;
+        }
+    }
+    return Best;
+}
+
+
+
+Bitmap* MapBitmapToPalette (const Bitmap* O, const Palette* P)
+/* Create an indexed bitmap with a copy of the palette P from the bitmap O.
+** Each pixel is replaced by the index of the closest color in P. If P has
+** a transparent entry (A == 255), mostly transparent pixels map to this
+** entry, and all others never do.
+*/
+{
+    Bitmap*        B;
+    unsigned char* Px;
+    int            Trans = -1;
+    unsigned       X, Y;
+    unsigned       I;
+
+    /* Find the transparent color */
+    for (I = 0; I < P->Count; ++I) {
+        if (P->Entries[I].A == 255) {
+            Trans = I;
+            break;
+        }
+    }
+
+    /* Create the new bitmap */
+    B = NewIndexedBitmap (O->Width, O->Height);
+    SB_Copy (&B->Name, &O->Name);
+    B->Pal = DupPalette (P);
+
+    Px = B->Index;
+    if (O->Index) {
+
+        /* Map the entries of the old palette, then the pixels */
+        unsigned char Map[BM_MAX_INDEX];
+        for (I = 0; I < O->Pal->Count; ++I) {
+            Map[I] = (unsigned char) NearestColor (P, O->Pal->Entries[I], Trans);
+        }
+        for (Y = 0; Y < O->Height; ++Y) {
+            const unsigned char* L = GetBitmapIndexLine (O, Y);
+            for (X = 0; X < O->Width; ++X) {
+                *Px++ = Map[L[X]];
+            }
+        }
+
+    } else {
+
+        /* Images usually have a lot of pixels with the same color, so cache
+        ** the results.
+        */
+        unsigned long* Key = xmalloc (4096 * sizeof (Key[0]));
+        unsigned char* Val = xmalloc (4096);
+        memset (Key, 0, 4096 * sizeof (Key[0]));
+
+        for (Y = 0; Y < O->Height; ++Y) {
+            const Color* L = O->Colors + (unsigned long) Y * O->Pitch;
+            for (X = 0; X < O->Width; ++X) {
+                Color         C = L[X];
+                unsigned long K = ((unsigned long) C.R << 16) | (C.G << 8) | C.B;
+                unsigned      H;
+                if (Trans >= 0 && C.A >= 128) {
+                    K = 0x1000000UL;
+                }
+                ++K;                    /* Zero is an empty slot */
+                H = (unsigned) ((K ^ (K >> 12)) * 2654435761UL >> 20) & 0xFFF;
+                if (Key[H] != K) {
+                    Key[H] = K;
+                    Val[H] = (unsigned char) NearestColor (P, C, Trans);
+                }
+                *Px++ = Val[H];
+            }
+        }
+
+        xfree (Key);
+        xfree (Val);
+    }
+
+    /* Return the new bitmap */
+    return B;
+}
+
+
+
 Color GetPixelColor (const Bitmap* B, unsigned X, unsigned Y)
 /* Get the color for a given pixel. For indexed bitmaps, the palette entry
 ** is returned.
@@ -169,9 +348,16 @@ Pixel GetPixel (const Bitmap* B, unsigned X, unsigned Y)
 ** or a palette index, depending on the type of the bitmap.
 */
 {
+    Pixel P;
+
     /* Check the coordinates */
     PRECONDITION (X < B->Width && Y < B->Height);
 
     /* Return the pixel */
-    return B->Data[Y * B->Width + X];
+    if (B->Index) {
+        P.Index = B->Index[Y * B->Pitch + X];
+    } else {
+        P.C = B->Colors[Y * B->Pitch + X];
+    }
+    return P;
 }
@@ -60,6 +60,9 @@
 /* Safety limit for the size of the bitmap in pixels */
 #define BM_MAX_SIZE     4194304UL
 
+/* Maximum number of colors in an indexed bitmap */
+#define BM_MAX_INDEX    256U
+
 /* Bitmap structure */
 typedef struct Bitmap Bitmap;
 struct Bitmap {
@@ -78,8 +81,20 @@ struct Bitmap {
     /* Palette for indexed bitmap types, otherwise NULL */
     Palette*    Pal;
 
-    /* Pixel data, dynamically allocated */
-    Pixel       Data[1];
+    /* Pixel data. Indexed bitmaps have one byte per pixel in Index, all
+    ** others one color per pixel in Colors, the other pointer is NULL.
+    ** Slices use the pixel data of the bitmap they were created from. Pitch
+    ** is the distance between two lines in pixels.
+    */
+    unsigned char*      Index;
+    Color*              Colors;
+    unsigned            Pitch;
+
+    /* The bitmap that owns the pixel data, NULL if this one does, and the
+    ** number of references to this bitmap including slices of it.
+    */
+    Bitmap*     Base;
+    unsigned    RefCount;
 };
 
 
@@ -91,7 +106,12 @@ struct Bitmap {
 
 
 Bitmap* NewBitmap (unsigned Width, unsigned Height);
-/* Create a new bitmap. The type is set to unknown and the palette to NULL */
+/* Create a new bitmap with one color per pixel. The palette is set to NULL */
+
+Bitmap* NewIndexedBitmap (unsigned Width, unsigned Height);
+/* Create a new bitmap with one palette index per pixel. The palette is set
+** to NULL and must be set by the caller.
+*/
 
 void FreeBitmap (Bitmap* B);
 /* Free a dynamically allocated bitmap */
@@ -104,7 +124,15 @@ Bitmap* SliceBitmap (const Bitmap* Original,
                      unsigned Width, unsigned Height);
 /* Create a slice of the given bitmap. The slice starts at position X/Y of
 ** the original and has the given width and height. Location 0/0 is at the
-** upper left corner.
+** upper left corner. The slice shares the pixel data with the original, so
+** this is cheap. The original may be freed before the slice.
+*/
+
+Bitmap* MapBitmapToPalette (const Bitmap* O, const Palette* P);
+/* Create an indexed bitmap with a copy of the palette P from the bitmap O.
+** Each pixel is replaced by the index of the closest color in P. If P has
+** a transparent entry (A == 255), mostly transparent pixels map to this
+** entry, and all others never do.
 */
 
 Color GetPixelColor (const Bitmap* B, unsigned X, unsigned Y);
@@ -117,6 +145,18 @@ Pixel GetPixel (const Bitmap* B, unsigned X, unsigned Y);
 ** or a palette index, depending on the type of the bitmap.
 */
 
+#if defined(HAVE_INLINE)
+INLINE const unsigned char* GetBitmapIndexLine (const Bitmap* B, unsigned Y)
+/* Return the palette indices of line Y of an indexed bitmap. This is faster
+** than calling GetPixel for each pixel.
+*/
+{
+    return B->Index + Y * B->Pitch;
+}
+#else
+#  define GetBitmapIndexLine(B, Y)      ((B)->Index + (Y) * (B)->Pitch)
+#endif
+
 #if defined(HAVE_INLINE)
 INLINE int BitmapIsIndexed (const Bitmap* B)
 /* Return true if this is an indexed bitmap */
@@ -37,16 +37,42 @@
 #include <stdlib.h>
 #include <stdarg.h>
 
+/* common */
+#include "xsprintf.h"
+
+/* sp65 */
 #include "error.h"
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The error trap of the current thread, NULL if there is none */
+THREAD_LOCAL ErrorTrap* Trap = 0;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
+static void TrapError (const char* Prefix, const char* Format, va_list ap)
+/* Store the message in the error trap of the current thread */
+{
+    unsigned Len = xsprintf (Trap->Message, sizeof (Trap->Message),
+                             "%s", Prefix);
+    xvsnprintf (Trap->Message + Len, sizeof (Trap->Message) - Len,
+                Format, ap);
+}
+
+
+
 void Warning (const char* Format, ...)
 /* Print a warning message */
 {
@@ -61,10 +87,17 @@ void Warning (const char* Format, ...)
 
 
 void Error (const char* Format, ...)
-/* Print an error message and die */
+/* Print an error message and die, or store it in the error trap of the
+** current thread.
+*/
 {
     va_list ap;
     va_start (ap, Format);
+    if (Trap) {
+        TrapError ("Error: ", Format, ap);
+        va_end (ap);
+        longjmp (Trap->Jump, 1);
+    }
     fprintf (stderr, "Error: ");
     vfprintf (stderr, Format, ap);
     putc ('\n', stderr);
@@ -75,10 +108,17 @@ void Error (const char* Format, ...)
 
 
 void Internal (const char* Format, ...)
-/* Print an internal error message and die */
+/* Print an internal error message and die, or store it in the error trap
+** of the current thread.
+*/
 {
     va_list ap;
     va_start (ap, Format);
+    if (Trap) {
+        TrapError ("Internal error: ", Format, ap);
+        va_end (ap);
+        longjmp (Trap->Jump, 1);
+    }
     fprintf (stderr, "Internal error: ");
     vfprintf (stderr, Format, ap);
     putc ('\n', stderr);
@@ -38,8 +38,32 @@
 
 
 
+#include <setjmp.h>
+
 /* common */
 #include "attrib.h"
+#include "tasks.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* An error trap is used by worker threads. If the thread has one, Error and
+** Internal store the message there and jump back instead of ending the
+** program.
+*/
+typedef struct ErrorTrap ErrorTrap;
+struct ErrorTrap {
+    jmp_buf     Jump;
+    char        Message[256];
+};
+
+/* The error trap of the current thread, NULL if there is none */
+extern THREAD_LOCAL ErrorTrap* Trap;
 
 
 
@@ -53,10 +77,14 @@ void Warning (const char* Format, ...) attribute((format(printf,1,2)));
 /* Print a warning message */
 
 void Error (const char* Format, ...) attribute((noreturn, format(printf,1,2)));
-/* Print an error message and die */
+/* Print an error message and die, or store it in the error trap of the
+** current thread.
+*/
 
 void Internal (const char* Format, ...) attribute((noreturn, format(printf,1,2)));
-/* Print an internal error message and die */
+/* Print an internal error message and die, or store it in the error trap
+** of the current thread.
+*/
 
 
 
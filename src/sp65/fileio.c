@@ -36,6 +36,9 @@
 #include <string.h>
 #include <errno.h>
 
+/* common */
+#include "xmalloc.h"
+
 /* od65 */
 #include "error.h"
 #include "fileio.h"
@@ -123,3 +126,29 @@ void* ReadData (FILE* F, void* Data, unsigned Size)
     }
     return Data;
 }
+
+
+
+void* ReadFileData (FILE* F, unsigned long* Size)
+/* Read the rest of the file into a newly allocated buffer and return it. The
+** number of bytes read is returned in Size. The buffer must be freed with
+** xfree.
+*/
+{
+    unsigned long Pos = FileGetPos (F);
+    unsigned long End;
+    void*         Data;
+
+    /* Determine the size */
+    (void) fseek (F, 0, SEEK_END);
+    End = FileGetPos (F);
+    FileSetPos (F, Pos);
+
+    /* Read the data */
+    *Size = End - Pos;
+    Data = xmalloc (*Size + 1);
+    if (fread (Data, 1, *Size, F) != *Size) {
+        Error ("Read error (file corrupt?)");
+    }
+    return Data;
+}
@@ -67,6 +67,12 @@ unsigned long Read32 (FILE* F);
 void* ReadData (FILE* F, void* Data, unsigned Size);
 /* Read data from the file */
 
+void* ReadFileData (FILE* F, unsigned long* Size);
+/* Read the rest of the file into a newly allocated buffer and return it. The
+** number of bytes read is returned in Size. The buffer must be freed with
+** xfree.
+*/
+
 
 
 /* End of fileio.h */
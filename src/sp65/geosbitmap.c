@@ -174,6 +174,7 @@ StrBuf* GenGeosBitmap (const Bitmap* B, const Collection* A attribute ((unused))
     /* Convert the bitmap into a raw image */
     BP = Buf;
     for (Y = 0; Y < GetBitmapHeight (B); ++Y) {
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
         for (X = 0; X < GetBitmapWidth (B); ) {
             unsigned char V = 0;
             int Bits = 8;
@@ -181,7 +182,7 @@ StrBuf* GenGeosBitmap (const Bitmap* B, const Collection* A attribute ((unused))
                 Bits = (GetBitmapWidth (B) - X);
             }
             while (--Bits >= 0) {
-                V |= (GetPixel (B, X++, Y).Index & 0x01) << Bits;
+                V |= (L[X++] & 0x01) << Bits;
             }
             *BP++ = V;
         }
@@ -91,11 +91,12 @@ StrBuf* GenGeosIcon (const Bitmap* B, const Collection* A attribute ((unused)))
 
     /* Convert the image */
     for (Y = 0; Y < HEIGHT; ++Y) {
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
         unsigned char V = 0;
         for (X = 0; X < WIDTH; ++X) {
 
             /* Fetch next bit into byte buffer */
-            V = (V << 1) | (GetPixel (B, X, Y).Index & 0x01);
+            V = (V << 1) | (L[X] & 0x01);
 
             /* Store full bytes into the output buffer */
             if ((X & 0x07) == 0x07) {
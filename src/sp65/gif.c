@@ -0,0 +1,453 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   gif.c                                   */
+/*                                                                           */
+/*                               Read GIF files                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/* common */
+#include "print.h"
+#include "xmalloc.h"
+
+/* sp65 */
+#include "attr.h"
+#include "error.h"
+#include "fileio.h"
+#include "gif.h"
+
+
+
+/*****************************************************************************/
+/*                                  Macros                                   */
+/*****************************************************************************/
+
+
+
+/* Block introducers */
+#define GIF_EXTENSION           0x21
+#define GIF_IMAGE               0x2C
+#define GIF_TRAILER             0x3B
+
+/* Graphic control extension */
+#define GIF_GRAPHIC_CONTROL     0xF9
+
+/* Maximum number of LZW codes */
+#define LZW_MAX_CODES           4096
+
+/* Read a little endian word from a byte array */
+#define WORD(P)                 ((P)[0] | ((P)[1] << 8))
+
+/* LZW string table. Each string is its prefix string plus one character. */
+typedef struct LZWTable LZWTable;
+struct LZWTable {
+    unsigned short      Prefix[LZW_MAX_CODES];
+    unsigned short      Length[LZW_MAX_CODES];
+    unsigned char       Suffix[LZW_MAX_CODES];
+    unsigned char       First[LZW_MAX_CODES];
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static const unsigned char* SkipSubBlocks (const unsigned char* P,
+                                           const unsigned char* End,
+                                           const char* Name)
+/* Skip a sequence of data sub-blocks and return a pointer behind it */
+{
+    while (P < End && *P != 0) {
+        P += *P + 1;
+    }
+    if (P >= End) {
+        Error ("GIF file `%s' is truncated", Name);
+    }
+    return P + 1;
+}
+
+
+
+static unsigned char* JoinSubBlocks (const unsigned char** P,
+                                     const unsigned char* End,
+                                     unsigned long* Size,
+                                     const char* Name)
+/* Join a sequence of data sub-blocks into one buffer and return it. *P is
+** advanced behind the sequence.
+*/
+{
+    const unsigned char* Start = *P;
+    const unsigned char* Q;
+    unsigned char*       Buf;
+
+    /* Determine the size */
+    *Size = 0;
+    for (Q = Start; Q < End && *Q != 0; Q += *Q + 1) {
+        *Size += *Q;
+    }
+    *P = SkipSubBlocks (Start, End, Name);
+
+    /* Copy the data */
+    Buf = xmalloc (*Size + 1);
+    *Size = 0;
+    for (Q = Start; *Q != 0; Q += *Q + 1) {
+        memcpy (Buf + *Size, Q + 1, *Q);
+        *Size += *Q;
+    }
+    return Buf;
+}
+
+
+
+static const char* DecodeLZW (unsigned char* Out, unsigned long OutSize,
+                              const unsigned char* In, unsigned long InSize,
+                              unsigned MinCodeSize)
+/* Decode the LZW compressed image data. Returns NULL on success or an error
+** message. Extra data is ignored.
+*/
+{
+    LZWTable*      T;
+    unsigned long  Bits = 0;
+    unsigned       BitCount = 0;
+    unsigned       Clear;
+    unsigned       CodeSize;
+    unsigned       Next;
+    unsigned       Prev = LZW_MAX_CODES;        /* None */
+    unsigned char* OutPos = Out;
+    unsigned char* OutEnd = Out + OutSize;
+    const unsigned char* InEnd = In + InSize;
+    const char*    Msg = 0;
+    unsigned       I;
+
+    if (MinCodeSize < 2 || MinCodeSize > 8) {
+        return "Invalid LZW code size";
+    }
+    Clear    = 1U << MinCodeSize;
+    CodeSize = MinCodeSize + 1;
+    Next     = Clear + 2;
+
+    /* Initialize the single character strings */
+    T = xmalloc (sizeof (*T));
+    for (I = 0; I < Clear; ++I) {
+        T->Length[I] = 1;
+        T->Suffix[I] = (unsigned char) I;
+        T->First[I]  = (unsigned char) I;
+    }
+
+    while (OutPos < OutEnd) {
+
+        unsigned Code;
+        unsigned Cur;
+        unsigned Len;
+        unsigned char* P;
+
+        /* Read the next code */
+        while (BitCount < CodeSize) {
+            if (In >= InEnd) {
+                Msg = "Unexpected end of image data";
+                goto Done;
+            }
+            Bits |= (unsigned long) *In++ << BitCount;
+            BitCount += 8;
+        }
+        Code = (unsigned) (Bits & ((1UL << CodeSize) - 1));
+        Bits >>= CodeSize;
+        BitCount -= CodeSize;
+
+        if (Code == Clear) {
+            CodeSize = MinCodeSize + 1;
+            Next     = Clear + 2;
+            Prev     = LZW_MAX_CODES;
+            continue;
+        }
+        if (Code == Clear + 1) {
+            /* End of information */
+            break;
+        }
+
+        if (Prev == LZW_MAX_CODES) {
+            /* First code after a clear */
+            if (Code >= Clear) {
+                Msg = "Invalid LZW code";
+                goto Done;
+            }
+        } else if (Code <= Next) {
+            /* Add the previous string plus the first character of this one.
+            ** If the code is the one just being defined, that character is
+            ** the first one of the previous string.
+            */
+            if (Next < LZW_MAX_CODES) {
+                T->Prefix[Next] = (unsigned short) Prev;
+                T->Length[Next] = T->Length[Prev] + 1;
+                T->First[Next]  = T->First[Prev];
+                T->Suffix[Next] = (Code == Next)? T->First[Prev] : T->First[Code];
+                ++Next;
+                if (Next == (1U << CodeSize) && CodeSize < 12) {
+                    ++CodeSize;
+                }
+            }
+        } else {
+            Msg = "Invalid LZW code";
+            goto Done;
+        }
+
+        /* Output the string for the code back to front, clipped to the
+        ** output buffer.
+        */
+        Cur = Code;
+        Len = T->Length[Code];
+        if (Len > (unsigned long) (OutEnd - OutPos)) {
+            unsigned Skip = Len - (unsigned) (OutEnd - OutPos);
+            while (Skip--) {
+                Code = T->Prefix[Code];
+            }
+            Len = (unsigned) (OutEnd - OutPos);
+        }
+        P = OutPos + Len;
+        while (P > OutPos) {
+            *--P = T->Suffix[Code];
+            Code = T->Prefix[Code];
+        }
+        OutPos += Len;
+
+        Prev = Cur;
+    }
+
+    if (OutPos < OutEnd) {
+        Msg = "Not enough image data";
+    }
+
+Done:
+    xfree (T);
+    return Msg;
+}
+
+
+
+static void DumpGIFInfo (const unsigned char* Data, unsigned X, unsigned Y,
+                         unsigned Width, unsigned Height, unsigned Colors,
+                         int Interlaced, const char* Name)
+/* Dump information about the GIF file in readable form to stdout */
+{
+    printf ("File name:       %s\n", Name);
+    printf ("GIF Version:     %.3s\n", (const char*) Data + 3);
+    printf ("Screen size:     %ux%u\n", WORD (Data + 6), WORD (Data + 8));
+    printf ("Image:           %ux%u at %u/%u\n", Width, Height, X, Y);
+    printf ("Colors:          %u\n", Colors);
+    printf ("Interlaced:      %s\n", Interlaced? "yes" : "no");
+}
+
+
+
+Bitmap* ReadGIFFile (const Collection* A)
+/* Read a bitmap from a GIF file. Only the first image is read. */
+{
+    Bitmap*              B;
+    FILE*                F;
+    unsigned char*       Data;
+    unsigned long        Size;
+    const unsigned char* P;
+    const unsigned char* End;
+    const unsigned char* Table = 0;
+    unsigned             TableCount = 0;
+    int                  Trans = -1;
+    unsigned             ScreenWidth;
+    unsigned             ScreenHeight;
+    unsigned             X, Y, W, H;
+    int                  Interlaced;
+    unsigned char*       Z;
+    unsigned long        ZSize;
+    unsigned char*       Pixels;
+    unsigned             MinCodeSize;
+    unsigned             MaxIdx;
+    unsigned             Row;
+    unsigned             I;
+    const char*          Msg;
+
+
+    /* Get the file name */
+    const char* Name = NeedAttrVal (A, "name", "read gif file");
+
+    /* Open the file and read it into memory */
+    F = fopen (Name, "rb");
+    if (F == 0) {
+        Error ("Cannot open GIF file `%s': %s", Name, strerror (errno));
+    }
+    Data = ReadFileData (F, &Size);
+    fclose (F);
+    End = Data + Size;
+
+    /* Check the header and read the logical screen descriptor */
+    if (Size < 13 || (memcmp (Data, "GIF87a", 6) != 0 &&
+                      memcmp (Data, "GIF89a", 6) != 0)) {
+        Error ("`%s' is not a GIF file", Name);
+    }
+    ScreenWidth  = WORD (Data + 6);
+    ScreenHeight = WORD (Data + 8);
+    P = Data + 13;
+
+    /* Global color table */
+    if (Data[10] & 0x80) {
+        Table      = P;
+        TableCount = 2U << (Data[10] & 0x07);
+        P += TableCount * 3;
+    }
+
+    /* Skip extensions up to the first image, remember the transparent color */
+    while (1) {
+        if (P >= End) {
+            Error ("GIF file `%s' is truncated", Name);
+        }
+        if (*P == GIF_IMAGE) {
+            break;
+        } else if (*P == GIF_EXTENSION && P + 2 < End) {
+            if (P[1] == GIF_GRAPHIC_CONTROL && P[2] == 4 && P + 6 < End &&
+                (P[3] & 0x01) != 0) {
+                Trans = P[6];
+            }
+            P = SkipSubBlocks (P + 2, End, Name);
+        } else if (*P == GIF_TRAILER) {
+            Error ("GIF file `%s' doesn't contain an image", Name);
+        } else {
+            Error ("Invalid block in GIF file `%s'", Name);
+        }
+    }
+
+    /* Read the image descriptor */
+    if (End - P < 11) {
+        Error ("GIF file `%s' is truncated", Name);
+    }
+    X          = WORD (P + 1);
+    Y          = WORD (P + 3);
+    W          = WORD (P + 5);
+    H          = WORD (P + 7);
+    Interlaced = (P[9] & 0x40) != 0;
+    if (P[9] & 0x80) {
+        /* Local color table */
+        Table      = P + 10;
+        TableCount = 2U << (P[9] & 0x07);
+        P += TableCount * 3;
+    }
+    P += 10;
+    if (Table == 0) {
+        Error ("GIF file `%s' has no color table", Name);
+    }
+    if (P >= End) {
+        Error ("GIF file `%s' is truncated", Name);
+    }
+
+    /* The bitmap has the size of the logical screen if there is one */
+    if (ScreenWidth == 0 || ScreenHeight == 0) {
+        ScreenWidth  = X + W;
+        ScreenHeight = Y + H;
+    }
+    if (!ValidBitmapSize (ScreenWidth, ScreenHeight) ||
+        !ValidBitmapSize (W, H)) {
+        Error ("GIF file `%s' has an unsupported size (w=%u, h=%u)",
+               Name, ScreenWidth, ScreenHeight);
+    }
+
+    /* Dump information if requested */
+    if (Verbosity > 0) {
+        DumpGIFInfo (Data, X, Y, W, H, TableCount, Interlaced, Name);
+    }
+
+    /* Decode the image data */
+    MinCodeSize = *P++;
+    Z = JoinSubBlocks (&P, End, &ZSize, Name);
+    Pixels = xmalloc ((unsigned long) W * H);
+    Msg = DecodeLZW (Pixels, (unsigned long) W * H, Z, ZSize, MinCodeSize);
+    if (Msg) {
+        Error ("Error in GIF file `%s': %s", Name, Msg);
+    }
+
+    /* Create the bitmap and fill it with the transparent or background
+    ** color.
+    */
+    B = NewIndexedBitmap (ScreenWidth, ScreenHeight);
+    SB_CopyStr (&B->Name, Name);
+    memset (B->Index, (Trans >= 0)? Trans : Data[11],
+            (unsigned long) ScreenWidth * ScreenHeight);
+
+    /* Move the image into the bitmap. Interlaced images contain every 8th
+    ** row starting with row 0, then every 8th starting with 4, every 4th
+    ** starting with 2 and finally every 2nd starting with 1.
+    */
+    for (Row = 0; Row < H; ++Row) {
+        unsigned DY;
+        if (!Interlaced) {
+            DY = Row;
+        } else if (Row < (H + 7) / 8) {
+            DY = Row * 8;
+        } else if (Row < (H + 3) / 4) {
+            DY = (Row - (H + 7) / 8) * 8 + 4;
+        } else if (Row < (H + 1) / 2) {
+            DY = (Row - (H + 3) / 4) * 4 + 2;
+        } else {
+            DY = (Row - (H + 1) / 2) * 2 + 1;
+        }
+        if (Y + DY < ScreenHeight && X < ScreenWidth) {
+            memcpy (B->Index + (unsigned long) (Y + DY) * B->Pitch + X,
+                    Pixels + (unsigned long) Row * W,
+                    (X + W <= ScreenWidth)? W : ScreenWidth - X);
+        }
+    }
+
+    /* Create the palette. Like for PCX files, it contains just the colors up
+    ** to the highest one used.
+    */
+    MaxIdx = 0;
+    for (I = 0; I < ScreenWidth * ScreenHeight; ++I) {
+        if (B->Index[I] > MaxIdx) {
+            MaxIdx = B->Index[I];
+        }
+    }
+    if (MaxIdx >= TableCount) {
+        Error ("GIF file `%s' uses color %u which is not in the palette",
+               Name, MaxIdx);
+    }
+    B->Pal = NewPalette (MaxIdx + 1);
+    for (I = 0; I <= MaxIdx; ++I) {
+        B->Pal->Entries[I] = RGBA (Table[I * 3], Table[I * 3 + 1], Table[I * 3 + 2],
+                                   (unsigned char) ((int) I == Trans? 255 : 0));
+    }
+
+    /* Free the buffers */
+    xfree (Pixels);
+    xfree (Z);
+    xfree (Data);
+
+    /* Return the bitmap */
+    return B;
+}
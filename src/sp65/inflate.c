@@ -0,0 +1,524 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 inflate.c                                 */
+/*                                                                           */
+/*                       Decompression of zlib streams                       */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* sp65 */
+#include "inflate.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Codes up to this length are decoded with one table lookup */
+#define FAST_BITS       9
+#define FAST_MASK       ((1U << FAST_BITS) - 1)
+
+/* Maximum code length and number of codes */
+#define MAX_BITS        15
+#define MAX_LITLEN      288
+#define MAX_DIST        30
+
+/* A Huffman decoding table. Fast contains symbol | length << 9 for codes
+** up to FAST_BITS indexed by the bit reversed code, or zero for longer
+** codes. Count and Symbol hold the canonical code for the slow path.
+*/
+typedef struct Huffman Huffman;
+struct Huffman {
+    unsigned short      Fast[1U << FAST_BITS];
+    unsigned short      Count[MAX_BITS + 1];
+    unsigned short      Symbol[MAX_LITLEN];
+};
+
+/* Decoder state */
+typedef struct InflateState InflateState;
+struct InflateState {
+    const unsigned char*        In;
+    const unsigned char*        InEnd;
+    unsigned long               Bits;           /* Bit buffer, LSB first */
+    unsigned                    BitCount;       /* Valid bits in Bits */
+    unsigned                    Padding;        /* Zero bytes read past InEnd */
+    unsigned char*              Out;
+    unsigned char*              OutPos;
+    unsigned char*              OutEnd;
+};
+
+/* Base values and extra bits for length and distance codes */
+static const unsigned short LenBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const unsigned char LenExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const unsigned short DistBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+static const unsigned char DistExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/* Order of the code length code lengths in a dynamic block header */
+static const unsigned char CodeLenOrder[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* The tables for fixed Huffman blocks are built on first use */
+static Huffman  FixedLitLen;
+static Huffman  FixedDist;
+static int      FixedDone = 0;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void NeedBits (InflateState* S, unsigned N)
+/* Make sure there are at least N bits in the bit buffer. Past the end of the
+** input, zero bytes are added, and Padding is incremented, so reading too
+** much can be detected later.
+*/
+{
+    while (S->BitCount < N) {
+        unsigned long B;
+        if (S->In < S->InEnd) {
+            B = *S->In++;
+        } else {
+            B = 0;
+            ++S->Padding;
+        }
+        S->Bits |= B << S->BitCount;
+        S->BitCount += 8;
+    }
+}
+
+
+
+static unsigned GetBits (InflateState* S, unsigned N)
+/* Read N bits (N <= 16) from the input */
+{
+    unsigned V;
+    NeedBits (S, N);
+    V = (unsigned) (S->Bits & ((1UL << N) - 1));
+    S->Bits >>= N;
+    S->BitCount -= N;
+    return V;
+}
+
+
+
+static int BuildHuffman (Huffman* H, const unsigned char* Lengths, unsigned N)
+/* Build a decoding table from the code lengths of N symbols. Returns false if
+** the lengths don't describe a valid code. Incomplete codes are accepted,
+** since a deflate stream may contain them for distance codes.
+*/
+{
+    unsigned short Offs[MAX_BITS + 2];
+    unsigned short Next[MAX_BITS + 1];
+    unsigned       Code;
+    unsigned       Len;
+    unsigned       I;
+    long           Left;
+
+    /* Count the codes of each length */
+    memset (H->Count, 0, sizeof (H->Count));
+    for (I = 0; I < N; ++I) {
+        ++H->Count[Lengths[I]];
+    }
+
+    /* Check for an over-subscribed code */
+    Left = 1;
+    for (Len = 1; Len <= MAX_BITS; ++Len) {
+        Left = (Left << 1) - H->Count[Len];
+        if (Left < 0) {
+            return 0;
+        }
+    }
+
+    /* Sort the symbols by code length for the slow path, and assign the
+    ** canonical codes
+    */
+    Offs[1] = 0;
+    Code = 0;
+    H->Count[0] = 0;
+    for (Len = 1; Len <= MAX_BITS; ++Len) {
+        Offs[Len + 1] = Offs[Len] + H->Count[Len];
+        Code = (Code + H->Count[Len - 1]) << 1;
+        Next[Len] = Code;
+    }
+    memset (H->Fast, 0, sizeof (H->Fast));
+    for (I = 0; I < N; ++I) {
+        Len = Lengths[I];
+        if (Len == 0) {
+            continue;
+        }
+        H->Symbol[Offs[Len]++] = I;
+        if (Len <= FAST_BITS) {
+            /* Reverse the code, since the stream is read LSB first, and
+            ** enter it for all values of the bits following it.
+            */
+            unsigned Rev = 0;
+            unsigned C   = Next[Len];
+            unsigned J;
+            for (J = 0; J < Len; ++J) {
+                Rev = (Rev << 1) | (C & 1);
+                C >>= 1;
+            }
+            for (J = Rev; J <= FAST_MASK; J += (1U << Len)) {
+                H->Fast[J] = (unsigned short) (I | (Len << 9));
+            }
+        }
+        ++Next[Len];
+    }
+
+    /* Success */
+    return 1;
+}
+
+
+
+static int Decode (InflateState* S, const Huffman* H)
+/* Decode one symbol. Returns -1 for an invalid code. */
+{
+    unsigned E;
+    unsigned Code;
+    unsigned First;
+    unsigned Index;
+    unsigned Len;
+
+    NeedBits (S, MAX_BITS);
+
+    /* Short codes need a single lookup */
+    E = H->Fast[S->Bits & FAST_MASK];
+    if (E) {
+        Len = E >> 9;
+        S->Bits >>= Len;
+        S->BitCount -= Len;
+        return E & 0x1FF;
+    }
+
+    /* Longer codes are decoded bit by bit */
+    Code = First = Index = 0;
+    for (Len = 1; Len <= MAX_BITS; ++Len) {
+        unsigned Count = H->Count[Len];
+        Code |= (unsigned) (S->Bits & 1);
+        S->Bits >>= 1;
+        --S->BitCount;
+        if (Code < First + Count) {
+            return H->Symbol[Index + (Code - First)];
+        }
+        Index += Count;
+        First = (First + Count) << 1;
+        Code <<= 1;
+    }
+    return -1;
+}
+
+
+
+static void BuildFixed (void)
+/* Build the tables for fixed Huffman blocks */
+{
+    unsigned char Lengths[MAX_LITLEN];
+    unsigned I;
+
+    for (I = 0; I < 144; ++I) {
+        Lengths[I] = 8;
+    }
+    for (; I < 256; ++I) {
+        Lengths[I] = 9;
+    }
+    for (; I < 280; ++I) {
+        Lengths[I] = 7;
+    }
+    for (; I < MAX_LITLEN; ++I) {
+        Lengths[I] = 8;
+    }
+    BuildHuffman (&FixedLitLen, Lengths, MAX_LITLEN);
+    for (I = 0; I < MAX_DIST; ++I) {
+        Lengths[I] = 5;
+    }
+    BuildHuffman (&FixedDist, Lengths, MAX_DIST);
+    FixedDone = 1;
+}
+
+
+
+static const char* InflateStored (InflateState* S)
+/* Copy a stored block */
+{
+    unsigned Len;
+    unsigned NLen;
+
+    /* Drop the bits up to the next byte boundary. Bytes that are still in
+    ** the bit buffer are part of the block header or the data.
+    */
+    S->Bits >>= S->BitCount & 7;
+    S->BitCount &= ~7U;
+    Len  = GetBits (S, 16);
+    NLen = GetBits (S, 16);
+    if (Len != (~NLen & 0xFFFF)) {
+        return "Invalid stored block length";
+    }
+    if (Len > (unsigned long) (S->OutEnd - S->OutPos)) {
+        return "Too much data";
+    }
+
+    /* Empty the bit buffer first, then copy the rest directly */
+    while (Len > 0 && S->BitCount > 0) {
+        *S->OutPos++ = (unsigned char) GetBits (S, 8);
+        --Len;
+    }
+    if (Len > (unsigned long) (S->InEnd - S->In)) {
+        return "Unexpected end of data";
+    }
+    memcpy (S->OutPos, S->In, Len);
+    S->OutPos += Len;
+    S->In += Len;
+    return 0;
+}
+
+
+
+static const char* InflateCodes (InflateState* S, const Huffman* LitLen,
+                                 const Huffman* Dist)
+/* Decode a block with the given Huffman tables */
+{
+    while (1) {
+
+        int Sym = Decode (S, LitLen);
+        if (Sym < 0) {
+            return "Invalid literal/length code";
+        }
+
+        if (Sym < 256) {
+
+            /* Literal byte */
+            if (S->OutPos >= S->OutEnd) {
+                return "Too much data";
+            }
+            *S->OutPos++ = (unsigned char) Sym;
+
+        } else if (Sym == 256) {
+
+            /* End of block */
+            return 0;
+
+        } else {
+
+            /* Match */
+            unsigned       Len;
+            unsigned       D;
+            unsigned char* Src;
+
+            Sym -= 257;
+            if (Sym >= 29) {
+                return "Invalid length code";
+            }
+            Len = LenBase[Sym] + GetBits (S, LenExtra[Sym]);
+
+            Sym = Decode (S, Dist);
+            if (Sym < 0 || Sym >= MAX_DIST) {
+                return "Invalid distance code";
+            }
+            D = DistBase[Sym] + GetBits (S, DistExtra[Sym]);
+
+            if (D > (unsigned long) (S->OutPos - S->Out)) {
+                return "Distance too far back";
+            }
+            if (Len > (unsigned long) (S->OutEnd - S->OutPos)) {
+                return "Too much data";
+            }
+
+            /* The source may overlap the destination */
+            Src = S->OutPos - D;
+            if (D == 1) {
+                memset (S->OutPos, *Src, Len);
+                S->OutPos += Len;
+            } else {
+                while (Len--) {
+                    *S->OutPos++ = *Src++;
+                }
+            }
+        }
+    }
+}
+
+
+
+static const char* InflateDynamic (InflateState* S)
+/* Read the Huffman tables of a dynamic block, then decode it */
+{
+    Huffman       LitLen;
+    Huffman       Dist;
+    unsigned char Lengths[MAX_LITLEN + MAX_DIST];
+    unsigned      NLen;
+    unsigned      NDist;
+    unsigned      NCode;
+    unsigned      I;
+
+    NLen  = GetBits (S, 5) + 257;
+    NDist = GetBits (S, 5) + 1;
+    NCode = GetBits (S, 4) + 4;
+    if (NLen > MAX_LITLEN || NDist > MAX_DIST) {
+        return "Invalid dynamic block header";
+    }
+
+    /* Read the code length code */
+    memset (Lengths, 0, 19);
+    for (I = 0; I < NCode; ++I) {
+        Lengths[CodeLenOrder[I]] = (unsigned char) GetBits (S, 3);
+    }
+    if (!BuildHuffman (&LitLen, Lengths, 19)) {
+        return "Invalid code length code";
+    }
+
+    /* Read the code lengths for both tables */
+    I = 0;
+    while (I < NLen + NDist) {
+        unsigned Rep;
+        unsigned Val;
+        int Sym = Decode (S, &LitLen);
+        if (Sym < 0) {
+            return "Invalid code length code";
+        }
+        if (Sym < 16) {
+            Lengths[I++] = (unsigned char) Sym;
+            continue;
+        }
+        if (Sym == 16) {
+            if (I == 0) {
+                return "Repeat without a previous code length";
+            }
+            Val = Lengths[I - 1];
+            Rep = 3 + GetBits (S, 2);
+        } else if (Sym == 17) {
+            Val = 0;
+            Rep = 3 + GetBits (S, 3);
+        } else {
+            Val = 0;
+            Rep = 11 + GetBits (S, 7);
+        }
+        if (I + Rep > NLen + NDist) {
+            return "Too many code lengths";
+        }
+        while (Rep--) {
+            Lengths[I++] = (unsigned char) Val;
+        }
+    }
+    if (Lengths[256] == 0) {
+        return "Missing end of block code";
+    }
+
+    /* Build the tables and decode the data */
+    if (!BuildHuffman (&LitLen, Lengths, NLen) ||
+        !BuildHuffman (&Dist, Lengths + NLen, NDist)) {
+        return "Invalid Huffman code";
+    }
+    return InflateCodes (S, &LitLen, &Dist);
+}
+
+
+
+const char* Inflate (unsigned char* Out, unsigned long OutSize,
+                     const unsigned char* In, unsigned long InSize)
+/* Decompress the zlib stream In of size InSize into Out. The decompressed
+** data must have exactly OutSize bytes. The function returns NULL on success
+** and an error message otherwise. The checksum of the stream is not checked.
+*/
+{
+    InflateState S;
+    unsigned     Final;
+    const char*  Msg;
+
+    /* Check the zlib header */
+    if (InSize < 2 || (In[0] & 0x0F) != 8 || (In[0] >> 4) > 7 ||
+        ((In[0] << 8) | In[1]) % 31 != 0) {
+        return "Invalid zlib header";
+    }
+    if (In[1] & 0x20) {
+        return "Preset dictionaries are not supported";
+    }
+
+    S.In       = In + 2;
+    S.InEnd    = In + InSize;
+    S.Bits     = 0;
+    S.BitCount = 0;
+    S.Padding  = 0;
+    S.Out      = Out;
+    S.OutPos   = Out;
+    S.OutEnd   = Out + OutSize;
+
+    /* Decode blocks until the last one */
+    do {
+        Final = GetBits (&S, 1);
+        switch (GetBits (&S, 2)) {
+            case 0:
+                Msg = InflateStored (&S);
+                break;
+            case 1:
+                if (!FixedDone) {
+                    BuildFixed ();
+                }
+                Msg = InflateCodes (&S, &FixedLitLen, &FixedDist);
+                break;
+            case 2:
+                Msg = InflateDynamic (&S);
+                break;
+            default:
+                Msg = "Invalid block type";
+                break;
+        }
+        if (Msg) {
+            return Msg;
+        }
+        if (S.Padding * 8 > S.BitCount) {
+            return "Unexpected end of data";
+        }
+    } while (!Final);
+
+    if (S.OutPos != S.OutEnd) {
+        return "Not enough data";
+    }
+    return 0;
+}
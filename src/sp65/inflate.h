@@ -0,0 +1,55 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 inflate.h                                 */
+/*                                                                           */
+/*                       Decompression of zlib streams                       */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef INFLATE_H
+#define INFLATE_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+const char* Inflate (unsigned char* Out, unsigned long OutSize,
+                     const unsigned char* In, unsigned long InSize);
+/* Decompress the zlib stream In of size InSize into Out. The decompressed
+** data must have exactly OutSize bytes. The function returns NULL on success
+** and an error message otherwise. The checksum of the stream is not checked.
+*/
+
+
+
+/* End of inflate.h */
+
+#endif
@@ -36,13 +36,16 @@
 #include <stdlib.h>
 
 /* common */
+#include "coll.h"
 #include "fileid.h"
 
 /* sp65 */
 #include "attr.h"
 #include "error.h"
+#include "gif.h"
 #include "input.h"
 #include "pcx.h"
+#include "png.h"
 
 
 
@@ -54,7 +57,9 @@
 
 /* Possible input formats */
 enum InputFormat {
+    ifGIF,                      /* GIF */
     ifPCX,                      /* PCX */
+    ifPNG,                      /* PNG */
     ifCount                     /* Number of actual input formats w/o ifAuto*/
 };
 
@@ -66,15 +71,21 @@ struct InputFormatDesc {
 
 /* Table with input formats indexed by InputFormat */
 static InputFormatDesc InputFormatTable[ifCount] = {
+    {   ReadGIFFile     },
     {   ReadPCXFile     },
+    {   ReadPNGFile     },
 };
 
 /* Table that maps extensions to input formats. Must be sorted alphabetically */
 static const FileId FormatTable[] = {
     /* Upper case stuff for obsolete operating systems */
+    {   "GIF",  ifGIF           },
     {   "PCX",  ifPCX           },
+    {   "PNG",  ifPNG           },
 
+    {   "gif",  ifGIF           },
     {   "pcx",  ifPCX           },
+    {   "png",  ifPNG           },
 };
 
 
@@ -85,13 +96,43 @@ static const FileId FormatTable[] = {
 
 
 
+static Bitmap* MapToPaletteFile (Bitmap* B, const char* Name)
+/* Map the colors of B to the palette of the image in the file with the given
+** name. B is freed, and the new bitmap is returned.
+*/
+{
+    Bitmap* P;
+    Bitmap* N;
+
+    /* Read the file with the palette */
+    Collection* A = NewCollection ();
+    AddAttr (A, "name", Name);
+    P = ReadInputFile (A);
+    FreeAttrList (A);
+    if (!BitmapIsIndexed (P)) {
+        Error ("`%s' doesn't have a palette", Name);
+    }
+
+    /* Map the colors */
+    N = MapBitmapToPalette (B, P->Pal);
+    FreeBitmap (P);
+    FreeBitmap (B);
+    return N;
+}
+
+
+
 Bitmap* ReadInputFile (const Collection* A)
 /* Read a bitmap from a file and return it. Format, file name etc. must be
 ** given as attributes in A. If no format is given, the function tries to
-** autodetect it by using the extension of the file name.
+** autodetect it by using the extension of the file name. If there is a
+** "palette" attribute, the colors of the bitmap are mapped to the palette
+** of the image in the file with that name.
 */
 {
     const FileId* F;
+    Bitmap*       B;
+    const char*   Palette;
 
     /* Get the file format from the command line */
     const char* Format = GetAttrVal (A, "format");
@@ -117,5 +158,14 @@ Bitmap* ReadInputFile (const Collection* A)
     }
 
     /* Call the format specific read */
-    return InputFormatTable[F->Id].Read (A);
+    B = InputFormatTable[F->Id].Read (A);
+
+    /* Map the colors to a palette if requested */
+    Palette = GetAttrVal (A, "palette");
+    if (Palette) {
+        B = MapToPaletteFile (B, Palette);
+    }
+
+    /* Return the bitmap */
+    return B;
 }
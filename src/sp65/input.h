@@ -55,7 +55,9 @@
 Bitmap* ReadInputFile (const Collection* A);
 /* Read a bitmap from a file and return it. Format, file name etc. must be
 ** given as attributes in A. If no format is given, the function tries to
-** autodetect it by using the extension of the file name.
+** autodetect it by using the extension of the file name. If there is a
+** "palette" attribute, the colors of the bitmap are mapped to the palette
+** of the image in the file with that name.
 */
 
 
@@ -82,8 +82,9 @@ StrBuf* GenKoala (const Bitmap* B, const Collection* A attribute ((unused)))
 
     /* Read the image into Screen */
     for (Y = 0; Y < HEIGHT; ++Y) {
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
         for (X = 0; X < WIDTH; ++X) {
-            Screen[X][Y] = (unsigned char) GetPixel (B, X, Y).Index;
+            Screen[X][Y] = L[X];
         }
     }
 
@@ -33,7 +33,9 @@
 
 
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* common */
 #include "attrib.h"
@@ -60,6 +62,23 @@ enum Mode {
     smShaped
 };
 
+/* How to split scanlines into packets */
+enum Packing {
+    pkOptimal,
+    pkGreedy
+};
+
+/* Bit stream of the scanline that is currently encoded. Each conversion has
+** its own, so sprites may be converted by several threads at the same time.
+*/
+typedef struct LineOutput LineOutput;
+struct LineOutput {
+    char                Buffer[512];    /* The maximum size is 508 pixels */
+    unsigned char       Index;          /* Number of bytes in Buffer */
+    char                BitCounter;     /* Bits left in Byte */
+    char                Byte;           /* Byte that is assembled */
+};
+
 
 /*****************************************************************************/
 /*                                   Code                                    */
@@ -88,6 +107,102 @@ static enum Mode GetMode (const Collection* A)
 }
 
 
+static enum Packing GetPacking (const Collection* A)
+/* Return the packing method from the attribute collection A */
+{
+    /* Check for a pack attribute */
+    const char* Packing = GetAttrVal (A, "pack");
+    if (Packing) {
+        if (strcmp (Packing, "optimal") == 0) {
+            return pkOptimal;
+        } else if (strcmp (Packing, "greedy") == 0) {
+            return pkGreedy;
+        } else {
+            Error ("Invalid value for attribute `pack'");
+        }
+    }
+
+    return pkOptimal;
+}
+
+
+static unsigned GetMaxIndex (const Bitmap* B)
+/* Return the highest color index used in the bitmap B */
+{
+    unsigned Max = 0;
+    unsigned X, Y;
+
+    for (Y = 0; Y < GetBitmapHeight (B); ++Y) {
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
+        for (X = 0; X < GetBitmapWidth (B); ++X) {
+            if (L[X] > Max) {
+                Max = L[X];
+            }
+        }
+    }
+    return Max;
+}
+
+
+static char GetColorBits (const Bitmap* B, const Collection* A)
+/* Return the number of bits per pixel from the attribute collection A. If
+** there is no such attribute, it is determined by the size of the palette.
+** "auto" uses the smallest number of bits that can hold all color indices
+** actually used in the bitmap.
+*/
+{
+    unsigned Bits;
+    unsigned MaxIndex;
+    const char* BPP;
+
+    /* Lynx sprites need a palette */
+    if (!BitmapIsIndexed (B)) {
+        Error ("Bitmaps converted to Lynx sprites must be in indexed mode");
+    }
+
+    /* Check for a bpp attribute */
+    BPP = GetAttrVal (A, "bpp");
+    if (BPP == 0) {
+        if (GetBitmapColors (B) == 0) {
+            Error ("The palette of a Lynx sprite must not be empty");
+        }
+        if (GetBitmapColors (B) > 16) {
+            Error ("Too many colors for a Lynx sprite");
+        }
+        MaxIndex = GetBitmapColors (B) - 1;
+    } else {
+        MaxIndex = GetMaxIndex (B);
+        if (MaxIndex > 15) {
+            Error ("Color index %u is too large for a Lynx sprite", MaxIndex);
+        }
+    }
+
+    /* Get the number of bits needed for the largest index, which is at
+    ** most 15 here.
+    */
+    Bits = 1;
+    while (Bits < 4 && (1U << Bits) <= MaxIndex) {
+        ++Bits;
+    }
+
+    /* An explicit value must be large enough for all pixels */
+    if (BPP && strcmp (BPP, "auto") != 0) {
+        char     C;
+        unsigned Want;
+        if (sscanf (BPP, "%u%c", &Want, &C) != 1 || Want < 1 || Want > 4) {
+            Error ("Invalid value for attribute `bpp'");
+        }
+        if (Want < Bits) {
+            Error ("Color index %u doesn't fit into %u bits per pixel",
+                   MaxIndex, Want);
+        }
+        Bits = Want;
+    }
+
+    return (char) Bits;
+}
+
+
 static unsigned GetActionPointX (const Collection* A)
 /* Return the sprite mode from the attribute collection A */
 {
@@ -125,31 +240,26 @@ static unsigned GetEdgeIndex (const Collection* A)
     }
 }
 
-static char OutBuffer[512]; /* The maximum size is 508 pixels */
-static unsigned char OutIndex;
-
-static void AssembleByte(unsigned bits, char val)
+static void AssembleByte(LineOutput* O, unsigned bits, char val)
 {
-    static char bit_counter = 8, byte = 0;
-
     /* initialize */
     if (!bits) {
-        OutIndex = 0;
-        bit_counter = 8;
-        byte = 0;
+        O->Index = 0;
+        O->BitCounter = 8;
+        O->Byte = 0;
         return;
     }
     /* handle end of line */
     if (bits == 8) {
-        if (bit_counter != 8) {
-            byte <<= bit_counter;
-            OutBuffer[OutIndex++] = byte;
-            if (!OutIndex) {
+        if (O->BitCounter != 8) {
+            O->Byte <<= O->BitCounter;
+            O->Buffer[O->Index++] = O->Byte;
+            if (!O->Index) {
                 Error ("Sprite is too large for the Lynx");
             }
-            if (byte & 0x1) {
-                OutBuffer[OutIndex++] = byte;
-                if (!OutIndex) {
+            if (O->Byte & 0x1) {
+                O->Buffer[O->Index++] = O->Byte;
+                if (!O->Index) {
                     Error ("Sprite is too large for the Lynx");
                 }
             }
@@ -158,10 +268,10 @@ static void AssembleByte(unsigned bits, char val)
     }
     /* handle end of line for literal */
     if (bits == 7) {
-        if (bit_counter != 8) {
-            byte <<= bit_counter;
-            OutBuffer[OutIndex++] = byte;
-            if (!OutIndex) {
+        if (O->BitCounter != 8) {
+            O->Byte <<= O->BitCounter;
+            O->Buffer[O->Index++] = O->Byte;
+            if (!O->Index) {
                 Error ("Sprite is too large for the Lynx");
             }
         }
@@ -170,18 +280,18 @@ static void AssembleByte(unsigned bits, char val)
     val <<= 8 - bits;
 
     do {
-        byte <<= 1;
+        O->Byte <<= 1;
 
         if (val & 0x80)
-            ++byte;
+            ++O->Byte;
 
-        if (!(--bit_counter)) {
-            OutBuffer[OutIndex++] = byte;
-            if (!OutIndex) {
+        if (!(--O->BitCounter)) {
+            O->Buffer[O->Index++] = O->Byte;
+            if (!O->Index) {
                 Error ("Sprite is too large for the Lynx");
             }
-            byte = 0;
-            bit_counter = 8;
+            O->Byte = 0;
+            O->BitCounter = 8;
         }
 
         val <<= 1;
@@ -213,26 +323,156 @@ static unsigned char ChoosePackagingMode(signed len, signed index, char ColorBit
     return 1;
 }
 
-static void WriteOutBuffer(StrBuf *D)
+static void PackLineGreedy(LineOutput* O, char ColorBits, const char LineBuffer[512], signed len)
+/* Split a scanline into packets, deciding at each pixel whether to start a
+** run or a literal packet by looking at the next few pixels.
+*/
+{
+    unsigned char V = 0;
+    signed i;
+    signed count;
+    unsigned char differ[16];
+    unsigned char *d_ptr;
+
+    i = 0;
+    while (len) {
+        if (ChoosePackagingMode(len, i, ColorBits, (char*) LineBuffer)) {
+            /* Make runlength packet */
+            V = LineBuffer[i];
+            ++i;
+            --len;
+            count = 0;
+            do {
+                ++count;
+                ++i;
+                --len;
+            } while (V == LineBuffer[i] && len && count != 15);
+
+            AssembleByte(O, 5, count);
+            AssembleByte(O, ColorBits, V);
+
+        } else {
+            /* Make packed literal packet */
+            d_ptr = differ;
+            V = LineBuffer[i++];
+            *d_ptr++ = V;
+            --len;
+            count = 0;
+            while (ChoosePackagingMode(len, i, ColorBits, (char*) LineBuffer) == 0 && len && count != 15) {
+                V = LineBuffer[i++];
+                *d_ptr++ = V;
+                ++count;
+                --len;
+            }
+
+            AssembleByte(O, 5, count | 0x10);
+            d_ptr = differ;
+            do {
+                AssembleByte(O, ColorBits, *d_ptr++);
+            } while (--count >= 0);
+
+        }
+    }
+}
+
+static void PackLineOptimal(LineOutput* O, char ColorBits, const char LineBuffer[512], signed len)
+/* Split a scanline into the packets that need the smallest number of bits.
+** A packet has a 5 bit header and holds up to 16 pixels. A literal packet
+** is followed by all its pixels, a run of at least two equal pixels by just
+** one. Cost[i] is the minimal number of bits needed for the pixels from i
+** to the end of the line, computed from right to left, so the best packet
+** starting at i is the one that minimizes its own size plus the cost of the
+** rest. On ties, runs and longer packets win because they are faster to
+** draw.
+*/
+{
+    unsigned      Cost[513];
+    unsigned char Len[513];     /* Pixels in the best packet starting at i */
+    unsigned char Run[513];     /* True if that packet is a run */
+    unsigned char Same[513];    /* Equal pixels starting at i, at most 16 */
+    signed        i;
+
+    Cost[len] = 0;
+    for (i = len - 1; i >= 0; --i) {
+
+        unsigned Best = ~0U;
+        unsigned Max  = (len - i < 16)? len - i : 16;
+        unsigned N;
+
+        if (i + 1 < len && LineBuffer[i] == LineBuffer[i + 1]) {
+            Same[i] = (Same[i + 1] < 16)? Same[i + 1] + 1 : 16;
+        } else {
+            Same[i] = 1;
+        }
+
+        /* Runs first, so they win on ties */
+        for (N = Same[i]; N >= 2; --N) {
+            unsigned C = 5 + ColorBits + Cost[i + N];
+            if (C < Best) {
+                Best   = C;
+                Len[i] = N;
+                Run[i] = 1;
+            }
+        }
+        for (N = Max; N >= 1; --N) {
+            unsigned C = 5 + N * ColorBits + Cost[i + N];
+            if (C < Best) {
+                Best   = C;
+                Len[i] = N;
+                Run[i] = 0;
+            }
+        }
+        Cost[i] = Best;
+    }
+
+    /* Output the packets */
+    i = 0;
+    while (i < len) {
+        unsigned N = Len[i];
+        if (Run[i]) {
+            AssembleByte(O, 5, N - 1);
+            AssembleByte(O, ColorBits, LineBuffer[i]);
+        } else {
+            unsigned J;
+            AssembleByte(O, 5, (N - 1) | 0x10);
+            for (J = 0; J < N; ++J) {
+                AssembleByte(O, ColorBits, LineBuffer[i + J]);
+            }
+        }
+        i += N;
+    }
+}
+
+static void PackLine(LineOutput* O, enum Packing P, char ColorBits, const char LineBuffer[512], signed len)
+/* Split a scanline into run and literal packets */
+{
+    if (P == pkGreedy) {
+        PackLineGreedy(O, ColorBits, LineBuffer, len);
+    } else {
+        PackLineOptimal(O, ColorBits, LineBuffer, len);
+    }
+}
+
+static void WriteOutBuffer(LineOutput* O, StrBuf *D)
 {
     signed i;
 
     /* Fix bug in Lynx where the count cannot be 1 */
-    if (OutIndex == 1) {
-        OutBuffer[OutIndex++] = 0;
+    if (O->Index == 1) {
+        O->Buffer[O->Index++] = 0;
     }
     /* Write the byte count to the end of the scanline */
-    if (OutIndex == 255) {
+    if (O->Index == 255) {
         Error ("Sprite is too large for the Lynx");
     }
-    SB_AppendChar (D, OutIndex+1);
+    SB_AppendChar (D, O->Index+1);
     /* Write scanline data */
-    for (i = 0; i < OutIndex; i++) {
-        SB_AppendChar (D, OutBuffer[i]);
+    for (i = 0; i < O->Index; i++) {
+        SB_AppendChar (D, O->Buffer[i]);
     }
 }
 
-static void encodeSprite(StrBuf *D, enum Mode M, char ColorBits, char ColorMask, char LineBuffer[512],
+static void encodeSprite(LineOutput* O, StrBuf *D, enum Mode M, enum Packing P, char ColorBits, char ColorMask, char LineBuffer[512],
     int len, int LastOpaquePixel) {
 /*
 ** The data starts with a byte count. It tells the number of bytes on this
@@ -251,67 +491,25 @@ static void encodeSprite(StrBuf *D, enum Mode M, char ColorBits, char ColorMask,
 **
 ** All data is high nybble first
 */
-    unsigned char V = 0;
     signed i;
-    signed count;
-    unsigned char differ[16];
-    unsigned char *d_ptr;
 
-    AssembleByte(0, 0);
+    AssembleByte(O, 0, 0);
     switch (M) {
     case smAuto:
     case smLiteral:
         for (i = 0; i < len; i++) {
             /* Fetch next pixel index into pixel buffer */
-            AssembleByte(ColorBits, LineBuffer[i] & ColorMask);
+            AssembleByte(O, ColorBits, LineBuffer[i] & ColorMask);
         }
-        AssembleByte(7, 0);
+        AssembleByte(O, 7, 0);
         /* Write the buffer to file */
-        WriteOutBuffer(D);
+        WriteOutBuffer(O, D);
         break;
     case smPacked:
-        i = 0;
-        while (len) {
-            if (ChoosePackagingMode(len, i, ColorBits, LineBuffer)) {
-                /* Make runlength packet */
-                V = LineBuffer[i];
-                ++i;
-                --len;
-                count = 0;
-                do {
-                    ++count;
-                    ++i;
-                    --len;
-                } while (V == LineBuffer[i] && len && count != 15);
-
-                AssembleByte(5, count);
-                AssembleByte(ColorBits, V);
-
-            } else {
-                /* Make packed literal packet */
-                d_ptr = differ;
-                V = LineBuffer[i++];
-                *d_ptr++ = V;
-                --len;
-                count = 0;
-                while (ChoosePackagingMode(len, i, ColorBits, LineBuffer) == 0 && len && count != 15) {
-                    V = LineBuffer[i++];
-                    *d_ptr++ = V;
-                    ++count;
-                    --len;
-                }
-
-                AssembleByte(5, count | 0x10);
-                d_ptr = differ;
-                do {
-                    AssembleByte(ColorBits, *d_ptr++);
-                } while (--count >= 0);
-
-            }
-        }
-        AssembleByte(8, 0);
+        PackLine(O, P, ColorBits, LineBuffer, len);
+        AssembleByte(O, 8, 0);
         /* Write the buffer to file */
-        WriteOutBuffer(D);
+        WriteOutBuffer(O, D);
         break;
 
     case smShaped:
@@ -319,49 +517,11 @@ static void encodeSprite(StrBuf *D, enum Mode M, char ColorBits, char ColorMask,
             if (LastOpaquePixel < len - 1) {
                 len = LastOpaquePixel + 1;
             }
-            i = 0;
-            while (len) {
-                if (ChoosePackagingMode(len, i, ColorBits, LineBuffer)) {
-                    /* Make runlength packet */
-                    V = LineBuffer[i];
-                    ++i;
-                    --len;
-                    count = 0;
-                    do {
-                        ++count;
-                        ++i;
-                        --len;
-                    } while (V == LineBuffer[i] && len && count != 15);
-
-                    AssembleByte(5, count);
-                    AssembleByte(ColorBits, V);
-
-                } else {
-                    /* Make packed literal packet */
-                    d_ptr = differ;
-                    V = LineBuffer[i++];
-                    *d_ptr++ = V;
-                    --len;
-                    count = 0;
-                    while (ChoosePackagingMode(len, i, ColorBits, LineBuffer) == 0 && len && count != 15) {
-                        V = LineBuffer[i++];
-                        *d_ptr++ = V;
-                        ++count;
-                        --len;
-                    }
-
-                    AssembleByte(5, count | 0x10);
-                    d_ptr = differ;
-                    do {
-                        AssembleByte(ColorBits, *d_ptr++);
-                    } while (--count >= 0);
-
-                }
-            }
-            AssembleByte(5, 0);
-            AssembleByte(8, 0);
+            PackLine(O, P, ColorBits, LineBuffer, len);
+            AssembleByte(O, 5, 0);
+            AssembleByte(O, 8, 0);
             /* Write the buffer to file */
-            WriteOutBuffer(D);
+            WriteOutBuffer(O, D);
         }
         break;
     }
@@ -382,6 +542,8 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
 */
 {
     enum Mode M;
+    enum Packing P;
+    LineOutput O;
     StrBuf* D;
     signed X, Y;
     unsigned OX, OY;
@@ -407,27 +569,14 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
            GetBitmapWidth (B), GetBitmapHeight (B), GetBitmapColors (B),
            BitmapIsIndexed (B)? " (indexed)" : "");
 
-    /* Get the sprite mode */
+    /* Get the sprite mode and the packing method */
     M = GetMode (A);
+    P = GetPacking (A);
 
-    /* Now check if bitmap indexes are ok */
-    if (GetBitmapColors (B) > 16) {
-        Error ("Too many colors for a Lynx sprite");
-    }
-    ColorBits = 4;
-    ColorMask = 0x0f;
-    if (GetBitmapColors (B) < 9) {
-        ColorBits = 3;
-        ColorMask = 0x07;
-    }
-    if (GetBitmapColors (B) < 5) {
-        ColorBits = 2;
-        ColorMask = 0x03;
-    }
-    if (GetBitmapColors (B) < 3) {
-        ColorBits = 1;
-        ColorMask = 0x01;
-    }
+    /* Get the number of bits per pixel */
+    ColorBits = GetColorBits (B, A);
+    ColorMask = (char) ((1U << ColorBits) - 1);
+    Print (stdout, 1, "Using %u bits per pixel\n", (unsigned) ColorBits);
 
     /* Create the output buffer and resize it to the required size. */
     D = NewStrBuf ();
@@ -438,12 +587,13 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
         signed i = 0;
         signed LastOpaquePixel = -1;
         char LineBuffer[512]; /* The maximum size is 508 pixels */
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
 
         /* Fill the LineBuffer for easier optimisation */
         for (X = OX; X < (signed)GetBitmapWidth (B); ++X) {
 
             /* Fetch next bit into byte buffer */
-            LineBuffer[i] = GetPixel (B, X, Y).Index & ColorMask;
+            LineBuffer[i] = L[X] & ColorMask;
 
             if (LineBuffer[i] != EdgeIndex) {
                 LastOpaquePixel = i;
@@ -451,7 +601,7 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
             ++i;
         }
 
-        encodeSprite(D, M, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
+        encodeSprite(&O, D, M, P, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
     }
 
     if ((OY == 0) && (OX == 0)) {
@@ -472,12 +622,13 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
         signed i = 0;
         signed LastOpaquePixel = -1;
         char LineBuffer[512]; /* The maximum size is 508 pixels */
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
 
         /* Fill the LineBuffer for easier optimisation */
         for (X = OX; X < (signed)GetBitmapWidth (B); ++X) {
 
             /* Fetch next bit into byte buffer */
-            LineBuffer[i] = GetPixel (B, X, Y).Index & ColorMask;
+            LineBuffer[i] = L[X] & ColorMask;
 
             if (LineBuffer[i] != EdgeIndex) {
                 LastOpaquePixel = i;
@@ -485,7 +636,7 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
             ++i;
         }
 
-        encodeSprite(D, M, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
+        encodeSprite(&O, D, M, P, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
     }
 
     if (OX == 0) {
@@ -506,12 +657,13 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
         signed i = 0;
         signed LastOpaquePixel = -1;
         char LineBuffer[512]; /* The maximum size is 508 pixels */
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
 
         /* Fill the LineBuffer for easier optimisation */
         for (X = OX - 1; X >= 0; --X) {
 
             /* Fetch next bit into byte buffer */
-            LineBuffer[i] = GetPixel (B, X, Y).Index & ColorMask;
+            LineBuffer[i] = L[X] & ColorMask;
 
             if (LineBuffer[i] != EdgeIndex) {
                 LastOpaquePixel = i;
@@ -519,7 +671,7 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
             ++i;
         }
 
-        encodeSprite(D, M, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
+        encodeSprite(&O, D, M, P, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
     }
 
     /* Next quadrant */
@@ -530,12 +682,13 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
         signed i = 0;
         signed LastOpaquePixel = -1;
         char LineBuffer[512]; /* The maximum size is 508 pixels */
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
 
         /* Fill the LineBuffer for easier optimisation */
         for (X = OX - 1; X >= 0; --X) {
 
             /* Fetch next bit into byte buffer */
-            LineBuffer[i] = GetPixel (B, X, Y).Index & ColorMask;
+            LineBuffer[i] = L[X] & ColorMask;
 
             if (LineBuffer[i] != EdgeIndex) {
                 LastOpaquePixel = i;
@@ -543,7 +696,7 @@ StrBuf* GenLynxSprite (const Bitmap* B, const Collection* A)
             ++i;
         }
 
-        encodeSprite(D, M, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
+        encodeSprite(&O, D, M, P, ColorBits, ColorMask, LineBuffer, i, LastOpaquePixel);
     }
 
     /* End sprite */
@@ -37,12 +37,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <setjmp.h>
 
 /* common */
 #include "abend.h"
 #include "cmdline.h"
 #include "print.h"
+#include "tasks.h"
 #include "version.h"
+#include "xmalloc.h"
 
 /* sp65 */
 #include "attr.h"
@@ -68,6 +71,21 @@ static Bitmap* C;
 /* Output data from convertion */
 static StrBuf* D;
 
+/* Size of the frames the bitmap is split into for conversion, zero if the
+** bitmap is converted as a whole.
+*/
+static unsigned FrameWidth  = 0;
+static unsigned FrameHeight = 0;
+
+/* A frame of the working bitmap that is converted by a worker thread */
+typedef struct Frame Frame;
+struct Frame {
+    Bitmap*             B;              /* Slice of the working bitmap */
+    const Collection*   A;              /* Conversion attributes */
+    StrBuf*             D;              /* Converted data */
+    ErrorTrap           Trap;           /* Error during the conversion */
+};
+
 
 
 /*****************************************************************************/
@@ -93,6 +111,7 @@ static void Usage (void)
             "Long options:\n"
             "  --convert-to fmt[,attrlist]\tConvert into target format\n"
             "  --dump-palette\t\tDump palette as table\n"
+            "  --frames w,h\t\t\tConvert the bitmap in frames of size w*h\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --list-conversions\t\tList all possible conversions\n"
             "  --pop\t\t\t\tRestore the original loaded image\n"
@@ -138,6 +157,89 @@ static void SetOutputData (StrBuf* N)
 
 
 
+static void ConvertFrameTask (void* Data, unsigned Index)
+/* Convert one of the frames in the array Data. This is called by the worker
+** threads. Errors are stored in the frame.
+*/
+{
+    Frame* F = (Frame*) Data + Index;
+    F->Trap.Message[0] = '\0';
+    Trap = &F->Trap;
+    if (setjmp (F->Trap.Jump) == 0) {
+        F->D = ConvertTo (F->B, F->A);
+    }
+    Trap = 0;
+}
+
+
+
+static StrBuf* ConvertFrames (const Collection* A)
+/* Split the working bitmap into frames, convert each one and return the
+** results one after the other. The frames are taken from left to right and
+** from top to bottom.
+*/
+{
+    StrBuf*       Data;
+    Frame*        Frames;
+    unsigned      X, Y, I;
+    unsigned      Count;
+    unsigned char OldVerbosity;
+
+    /* The bitmap must consist of complete frames */
+    if (GetBitmapWidth (C) % FrameWidth != 0 ||
+        GetBitmapHeight (C) % FrameHeight != 0) {
+        Error ("Bitmap size %ux%u is not a multiple of the frame size %ux%u",
+               GetBitmapWidth (C), GetBitmapHeight (C),
+               FrameWidth, FrameHeight);
+    }
+
+    /* Create the frames. Slices don't copy the pixel data, so this is
+    ** cheap.
+    */
+    Count  = (GetBitmapWidth (C) / FrameWidth) *
+             (GetBitmapHeight (C) / FrameHeight);
+    Frames = xmalloc (Count * sizeof (Frame));
+    I = 0;
+    for (Y = 0; Y < GetBitmapHeight (C); Y += FrameHeight) {
+        for (X = 0; X < GetBitmapWidth (C); X += FrameWidth) {
+            Frames[I].B = SliceBitmap (C, X, Y, FrameWidth, FrameHeight);
+            Frames[I].A = A;
+            Frames[I].D = 0;
+            ++I;
+        }
+    }
+
+    /* Convert the first frame here, so that errors in the attributes end the
+    ** program as usual, and messages are output once. The other frames have
+    ** the same size and palette, so they're converted by the worker threads
+    ** without messages.
+    */
+    Frames[0].D = ConvertTo (Frames[0].B, A);
+    OldVerbosity = Verbosity;
+    Verbosity = 0;
+    RunTasks (ConvertFrameTask, Frames + 1, Count - 1);
+    Verbosity = OldVerbosity;
+
+    /* Join the data of all frames in order. Report the first error. */
+    Data = NewStrBuf ();
+    for (I = 0; I < Count; ++I) {
+        if (Frames[I].D == 0) {
+            fprintf (stderr, "%s\n", Frames[I].Trap.Message);
+            exit (EXIT_FAILURE);
+        }
+        SB_Append (Data, Frames[I].D);
+        FreeStrBuf (Frames[I].D);
+        FreeBitmap (Frames[I].B);
+    }
+    xfree (Frames);
+    Print (stdout, 1, "Converted %u frames\n", Count);
+
+    /* Return the data of all frames */
+    return Data;
+}
+
+
+
 static void OptConvertTo (const char* Opt attribute ((unused)), const char* Arg)
 /* Convert the bitmap into a target format */
 {
@@ -154,7 +256,11 @@ static void OptConvertTo (const char* Opt attribute ((unused)), const char* Arg)
     }
 
     /* Convert the bitmap */
-    SetOutputData (ConvertTo (C, A));
+    if (FrameWidth == 0) {
+        SetOutputData (ConvertTo (C, A));
+    } else {
+        SetOutputData (ConvertFrames (A));
+    }
 
     /* Delete the attribute list */
     FreeAttrList (A);
@@ -182,6 +288,27 @@ static void OptDumpPalette (const char* Opt attribute ((unused)),
 
 
 
+static void OptFrames (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the frame size for conversions */
+{
+    unsigned W, H;
+    unsigned char T;
+
+    /* The argument is W,H */
+    if (sscanf (Arg, "%u,%u%c", &W, &H, &T) != 2) {
+        Error ("Invalid argument. Frame size must be given as W,H");
+    }
+
+    /* Zero for both sizes switches frames off */
+    if ((W == 0) != (H == 0) || W > BM_MAX_WIDTH || H > BM_MAX_HEIGHT) {
+        Error ("Invalid frame size");
+    }
+    FrameWidth  = W;
+    FrameHeight = H;
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print usage information and exit */
@@ -323,6 +450,7 @@ int main (int argc, char* argv [])
     static const LongOpt OptTab[] = {
         { "--convert-to",       1,      OptConvertTo            },
         { "--dump-palette",     0,      OptDumpPalette          },
+        { "--frames",           1,      OptFrames               },
         { "--help",             0,      OptHelp                 },
         { "--list-conversions", 0,      OptListConversions      },
         { "--pop",              0,      OptPop                  },
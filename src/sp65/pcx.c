@@ -250,7 +250,6 @@ Bitmap* ReadPCXFile (const Collection* A)
     PCXHeader* P;
     Bitmap* B;
     unsigned char* L;
-    Pixel* Px;
     unsigned MaxIdx = 0;
     unsigned X, Y;
 
@@ -272,8 +271,12 @@ Bitmap* ReadPCXFile (const Collection* A)
         DumpPCXHeader (P, Name);
     }
 
-    /* Create the bitmap */
-    B = NewBitmap (P->Width, P->Height);
+    /* Create the bitmap. One plane means indexed. */
+    if (P->Planes == 1) {
+        B = NewIndexedBitmap (P->Width, P->Height);
+    } else {
+        B = NewBitmap (P->Width, P->Height);
+    }
 
     /* Copy the name */
     SB_CopyStr (&B->Name, Name);
@@ -282,13 +285,14 @@ Bitmap* ReadPCXFile (const Collection* A)
     L = xmalloc (P->Width);
 
     /* Read the pixel data */
-    Px = B->Data;
     if (P->Planes == 1) {
 
+        unsigned char* Px;
+
         /* This is either monochrome or indexed */
         if (P->BPP == 1) {
             /* Monochrome */
-            for (Y = 0, Px = B->Data; Y < P->Height; ++Y) {
+            for (Y = 0, Px = B->Index; Y < P->Height; ++Y) {
 
                 unsigned I;
                 unsigned char Mask;
@@ -297,8 +301,8 @@ Bitmap* ReadPCXFile (const Collection* A)
                 ReadPlane (F, P, L);
 
                 /* Create pixels */
-                for (X = 0, I = 0, Mask = 0x01; X < P->Width; ++Px) {
-                    Px->Index = (L[I] & Mask) != 0;
+                for (X = 0, I = 0, Mask = 0x01; X < P->Width; ++X, ++Px) {
+                    *Px = (L[I] & Mask) != 0;
                     if (Mask == 0x80) {
                         Mask = 0x01;
                         ++I;
@@ -310,18 +314,19 @@ Bitmap* ReadPCXFile (const Collection* A)
             }
         } else {
             /* One plane with 8bpp is indexed */
-            for (Y = 0, Px = B->Data; Y < P->Height; ++Y) {
+            for (Y = 0, Px = B->Index; Y < P->Height; ++Y) {
 
                 /* Read the plane */
                 ReadPlane (F, P, L);
 
                 /* Create pixels */
-                for (X = 0; X < P->Width; ++X, ++Px) {
+                for (X = 0; X < P->Width; ++X) {
                     if (L[X] > MaxIdx) {
                         MaxIdx = L[X];
                     }
-                    Px->Index = L[X];
                 }
+                memcpy (Px, L, P->Width);
+                Px += P->Width;
             }
         }
 
@@ -394,35 +399,36 @@ Bitmap* ReadPCXFile (const Collection* A)
     } else {
 
         /* 3 or 4 planes are RGB or RGBA (don't know if this exists) */
-        for (Y = 0, Px = B->Data; Y < P->Height; ++Y) {
+        Color* Px;
+        for (Y = 0, Px = B->Colors; Y < P->Height; ++Y, Px += P->Width) {
 
             /* Read the R plane and move the data */
             ReadPlane (F, P, L);
-            for (X = 0; X < P->Width; ++X, ++Px) {
-                Px->C.R = L[X];
+            for (X = 0; X < P->Width; ++X) {
+                Px[X].R = L[X];
             }
 
             /* Read the G plane and move the data */
             ReadPlane (F, P, L);
-            for (X = 0; X < P->Width; ++X, ++Px) {
-                Px->C.G = L[X];
+            for (X = 0; X < P->Width; ++X) {
+                Px[X].G = L[X];
             }
 
             /* Read the B plane and move the data */
             ReadPlane (F, P, L);
-            for (X = 0; X < P->Width; ++X, ++Px) {
-                Px->C.B = L[X];
+            for (X = 0; X < P->Width; ++X) {
+                Px[X].B = L[X];
             }
 
             /* Either read the A plane or clear it */
             if (P->Planes == 4) {
                 ReadPlane (F, P, L);
-                for (X = 0; X < P->Width; ++X, ++Px) {
-                    Px->C.A = L[X];
+                for (X = 0; X < P->Width; ++X) {
+                    Px[X].A = L[X];
                 }
             } else {
-                for (X = 0; X < P->Width; ++X, ++Px) {
-                    Px->C.A = 0;
+                for (X = 0; X < P->Width; ++X) {
+                    Px[X].A = 0;
                 }
             }
         }
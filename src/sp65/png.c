@@ -0,0 +1,538 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   png.c                                   */
+/*                                                                           */
+/*                               Read PNG files                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026,      The cc65 Authors                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/* common */
+#include "print.h"
+#include "xmalloc.h"
+
+/* sp65 */
+#include "attr.h"
+#include "error.h"
+#include "fileio.h"
+#include "inflate.h"
+#include "png.h"
+
+
+
+/*****************************************************************************/
+/*                                  Macros                                   */
+/*****************************************************************************/
+
+
+
+/* PNG color types */
+#define PNG_GRAY                0
+#define PNG_RGB                 2
+#define PNG_INDEXED             3
+#define PNG_GRAYALPHA           4
+#define PNG_RGBA                6
+
+/* Structured PNG header */
+typedef struct PNGHeader PNGHeader;
+struct PNGHeader {
+    unsigned        Width;
+    unsigned        Height;
+    unsigned        Depth;
+    unsigned        ColorType;
+    unsigned        Interlace;
+
+    /* Calculated data */
+    unsigned        Channels;           /* Samples per pixel */
+    unsigned        PixelBytes;         /* Bytes per pixel for filtering */
+};
+
+/* Read a big endian word or dword from a byte array */
+#define BE16(P)         (((unsigned) (P)[0] << 8) | (P)[1])
+#define BE32(P)         (((unsigned long) BE16 (P) << 16) | BE16 ((P) + 2))
+
+/* Start and step of the seven passes of an interlaced image */
+static const unsigned char Adam7[7][4] = {
+    /* X, Y, DX, DY */
+    { 0, 0, 8, 8 },
+    { 4, 0, 8, 8 },
+    { 0, 4, 4, 8 },
+    { 2, 0, 4, 4 },
+    { 0, 2, 2, 4 },
+    { 1, 0, 2, 2 },
+    { 0, 1, 1, 2 },
+};
+
+/* A non interlaced image is read as a single pass */
+static const unsigned char NoInterlace[1][4] = {
+    { 0, 0, 1, 1 }
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void ReadPNGHeader (PNGHeader* P, const unsigned char* H, unsigned long Len,
+                           const char* Name)
+/* Convert the data of the IHDR chunk into a structured header */
+{
+    if (Len != 13) {
+        Error ("Invalid header in PNG file `%s'", Name);
+    }
+    P->Width            = (unsigned) BE32 (H);
+    P->Height           = (unsigned) BE32 (H + 4);
+    P->Depth            = H[8];
+    P->ColorType        = H[9];
+    P->Interlace        = H[12];
+
+    /* Check the header data */
+    switch (P->ColorType) {
+        case PNG_GRAY:
+            P->Channels = 1;
+            break;
+        case PNG_INDEXED:
+            P->Channels = 1;
+            if (P->Depth == 16) {
+                P->Depth = 0;
+            }
+            break;
+        case PNG_GRAYALPHA:
+            P->Channels = 2;
+            break;
+        case PNG_RGB:
+            P->Channels = 3;
+            break;
+        case PNG_RGBA:
+            P->Channels = 4;
+            break;
+        default:
+            Error ("Unsupported color type (%u) in PNG file `%s'",
+                   P->ColorType, Name);
+    }
+    if (P->Depth != 1 && P->Depth != 2 && P->Depth != 4 &&
+        P->Depth != 8 && P->Depth != 16) {
+        Error ("Invalid bit depth (%u) in PNG file `%s'", H[8], Name);
+    }
+    if (P->Depth < 8 && P->Channels > 1) {
+        Error ("Invalid bit depth (%u) in PNG file `%s'", P->Depth, Name);
+    }
+    if (H[10] != 0 || H[11] != 0 || P->Interlace > 1) {
+        Error ("Unsupported compression, filter or interlace method "
+               "in PNG file `%s'", Name);
+    }
+    if (!ValidBitmapSize (P->Width, P->Height)) {
+        Error ("PNG file `%s' has an unsupported size (w=%u, h=%u)",
+               Name, P->Width, P->Height);
+    }
+
+    /* Filters work on complete pixels, but at least on bytes */
+    P->PixelBytes = (P->Channels * P->Depth + 7) / 8;
+}
+
+
+
+static void DumpPNGHeader (const PNGHeader* P, const char* Name)
+/* Dump the header of the PNG file in readable form to stdout */
+{
+    static const char* const Types[7] = {
+        "grayscale", "?", "RGB", "indexed", "grayscale with alpha", "?", "RGBA"
+    };
+    printf ("File name:       %s\n", Name);
+    printf ("Image type:      %s\n", Types[P->ColorType]);
+    printf ("Size:            %ux%u\n", P->Width, P->Height);
+    printf ("Bit depth:       %u\n", P->Depth);
+    printf ("Interlaced:      %s\n", P->Interlace? "yes" : "no");
+}
+
+
+
+static unsigned long RowBytes (const PNGHeader* P, unsigned Width)
+/* Return the number of data bytes in a row with the given number of pixels */
+{
+    return ((unsigned long) Width * P->Channels * P->Depth + 7) / 8;
+}
+
+
+
+static void Unfilter (unsigned char* Row, const unsigned char* Prev,
+                      unsigned long Len, unsigned BPP, unsigned Filter,
+                      const char* Name)
+/* Undo the filter on one row. Prev is the unfiltered previous row, or an
+** all zero row for the first one.
+*/
+{
+    unsigned long I;
+
+    switch (Filter) {
+
+        case 0:
+            /* None */
+            break;
+
+        case 1:
+            /* Sub */
+            for (I = BPP; I < Len; ++I) {
+                Row[I] += Row[I - BPP];
+            }
+            break;
+
+        case 2:
+            /* Up */
+            for (I = 0; I < Len; ++I) {
+                Row[I] += Prev[I];
+            }
+            break;
+
+        case 3:
+            /* Average */
+            for (I = 0; I < BPP && I < Len; ++I) {
+                Row[I] += Prev[I] >> 1;
+            }
+            for (; I < Len; ++I) {
+                Row[I] += (Row[I - BPP] + Prev[I]) >> 1;
+            }
+            break;
+
+        case 4:
+            /* Paeth */
+            for (I = 0; I < BPP && I < Len; ++I) {
+                Row[I] += Prev[I];
+            }
+            for (; I < Len; ++I) {
+                int A  = Row[I - BPP];
+                int B  = Prev[I];
+                int C  = Prev[I - BPP];
+                int P  = B - C;
+                int Q  = A - C;
+                int PA = P < 0? -P : P;
+                int PB = Q < 0? -Q : Q;
+                int PC = P + Q < 0? -(P + Q) : P + Q;
+                if (PA <= PB && PA <= PC) {
+                    Row[I] += A;
+                } else if (PB <= PC) {
+                    Row[I] += B;
+                } else {
+                    Row[I] += C;
+                }
+            }
+            break;
+
+        default:
+            Error ("Invalid filter type (%u) in PNG file `%s'", Filter, Name);
+    }
+}
+
+
+
+static unsigned GetSample (const unsigned char* Row, unsigned long I, unsigned Depth)
+/* Return sample I from a row. Samples with 16 bits are reduced to 8 bits. */
+{
+    unsigned long Bit;
+
+    switch (Depth) {
+        case 8:
+            return Row[I];
+        case 16:
+            return Row[I * 2];
+        default:
+            Bit = I * Depth;
+            return (Row[Bit >> 3] >> (8 - Depth - (Bit & 7))) & ((1U << Depth) - 1);
+    }
+}
+
+
+
+static void StoreRow (const PNGHeader* P, Bitmap* B, const unsigned char* Row,
+                      unsigned Width, unsigned X, unsigned DX, unsigned Y,
+                      const Color* Key)
+/* Store a row of Width pixels into the bitmap, starting at X/Y, with DX as
+** the distance between the pixels. Key is the transparent color for RGB
+** images, or NULL.
+*/
+{
+    unsigned I;
+
+    if (B->Index) {
+
+        /* Grayscale or indexed */
+        unsigned char* Px = B->Index + (unsigned long) Y * B->Pitch + X;
+        if (P->Depth == 8 && DX == 1) {
+            memcpy (Px, Row, Width);
+        } else {
+            for (I = 0; I < Width; ++I, Px += DX) {
+                *Px = (unsigned char) GetSample (Row, I, P->Depth);
+            }
+        }
+
+    } else {
+
+        Color* Px = B->Colors + (unsigned long) Y * B->Pitch + X;
+        unsigned long S = 0;
+        for (I = 0; I < Width; ++I, Px += DX) {
+            if (P->Channels <= 2) {
+                Px->R = Px->G = Px->B = (unsigned char) GetSample (Row, S++, P->Depth);
+            } else {
+                Px->R = (unsigned char) GetSample (Row, S++, P->Depth);
+                Px->G = (unsigned char) GetSample (Row, S++, P->Depth);
+                Px->B = (unsigned char) GetSample (Row, S++, P->Depth);
+            }
+
+            /* In a Color, A is the transparency, not the opacity */
+            if (P->Channels == 2 || P->Channels == 4) {
+                Px->A = (unsigned char) (255 - GetSample (Row, S++, P->Depth));
+            } else if (Key && Px->R == Key->R && Px->G == Key->G && Px->B == Key->B) {
+                Px->A = 255;
+            } else {
+                Px->A = 0;
+            }
+        }
+
+    }
+}
+
+
+
+Bitmap* ReadPNGFile (const Collection* A)
+/* Read a bitmap from a PNG file */
+{
+    PNGHeader            P;
+    Bitmap*              B;
+    FILE*                F;
+    unsigned char*       Data;
+    unsigned long        Size;
+    unsigned long        Pos;
+    unsigned char*       Z = 0;          /* Compressed image data */
+    unsigned long        ZSize = 0;
+    unsigned char*       Raw;            /* Decompressed image data */
+    unsigned long        RawSize;
+    unsigned char*       Zero;
+    const unsigned char* Plte = 0;
+    unsigned             PlteCount = 0;
+    const unsigned char* Trns = 0;
+    unsigned long        TrnsLen = 0;
+    Color                Key = RGB (0, 0, 0);
+    const Color*         KeyPtr = 0;
+    const unsigned char  (*Passes)[4];
+    unsigned             PassCount;
+    unsigned             Pass;
+    unsigned             MaxIdx;
+    const char*          Msg;
+    int                  HaveHeader = 0;
+
+
+    /* Get the file name */
+    const char* Name = NeedAttrVal (A, "name", "read png file");
+
+    /* Open the file and read it into memory */
+    F = fopen (Name, "rb");
+    if (F == 0) {
+        Error ("Cannot open PNG file `%s': %s", Name, strerror (errno));
+    }
+    Data = ReadFileData (F, &Size);
+    fclose (F);
+
+    /* Check the signature */
+    if (Size < 8 || memcmp (Data, "\x89PNG\r\n\x1A\n", 8) != 0) {
+        Error ("`%s' is not a PNG file", Name);
+    }
+
+    /* Walk over the chunks, remember the ones we need and collect the image
+    ** data.
+    */
+    memset (&P, 0, sizeof (P));
+    Pos = 8;
+    while (1) {
+
+        const unsigned char* C;
+        unsigned long Len;
+
+        if (Size - Pos < 12 || (Len = BE32 (Data + Pos)) > Size - Pos - 12) {
+            Error ("PNG file `%s' is truncated", Name);
+        }
+        C = Data + Pos + 8;
+
+        if (memcmp (C - 4, "IHDR", 4) == 0) {
+            ReadPNGHeader (&P, C, Len, Name);
+            HaveHeader = 1;
+        } else if (!HaveHeader) {
+            Error ("Missing header in PNG file `%s'", Name);
+        } else if (memcmp (C - 4, "PLTE", 4) == 0) {
+            if (Len % 3 != 0 || Len > 3 * 256) {
+                Error ("Invalid palette in PNG file `%s'", Name);
+            }
+            Plte = C;
+            PlteCount = Len / 3;
+        } else if (memcmp (C - 4, "tRNS", 4) == 0) {
+            Trns = C;
+            TrnsLen = Len;
+        } else if (memcmp (C - 4, "IDAT", 4) == 0) {
+            Z = xrealloc (Z, ZSize + Len);
+            memcpy (Z + ZSize, C, Len);
+            ZSize += Len;
+        } else if (memcmp (C - 4, "IEND", 4) == 0) {
+            break;
+        } else if ((C[-4] & 0x20) == 0) {
+            /* Unknown chunks are ok unless they're marked as critical */
+            Error ("Unsupported chunk `%.4s' in PNG file `%s'",
+                   (const char*) C - 4, Name);
+        }
+
+        /* Skip length, type, data and CRC */
+        Pos += Len + 12;
+    }
+
+    /* Dump the header if requested */
+    if (Verbosity > 0) {
+        DumpPNGHeader (&P, Name);
+    }
+
+    /* Determine the passes and the size of the decompressed data, which
+    ** contains one filter byte per row.
+    */
+    if (P.Interlace) {
+        Passes    = Adam7;
+        PassCount = 7;
+    } else {
+        Passes    = NoInterlace;
+        PassCount = 1;
+    }
+    RawSize = 0;
+    for (Pass = 0; Pass < PassCount; ++Pass) {
+        const unsigned char* S = Passes[Pass];
+        unsigned W = (P.Width  + S[2] - 1 - S[0]) / S[2];
+        unsigned H = (P.Height + S[3] - 1 - S[1]) / S[3];
+        if (W > 0 && H > 0) {
+            RawSize += H * (RowBytes (&P, W) + 1);
+        }
+    }
+
+    /* Decompress the image data */
+    Raw = xmalloc (RawSize);
+    Msg = Inflate (Raw, RawSize, Z, ZSize);
+    if (Msg) {
+        Error ("Error in PNG file `%s': %s", Name, Msg);
+    }
+
+    /* Create the bitmap. Grayscale without alpha becomes indexed. */
+    if (P.ColorType == PNG_INDEXED || P.ColorType == PNG_GRAY) {
+        B = NewIndexedBitmap (P.Width, P.Height);
+    } else {
+        B = NewBitmap (P.Width, P.Height);
+    }
+
+    /* Copy the name */
+    SB_CopyStr (&B->Name, Name);
+
+    /* The transparent color of RGB images */
+    if (P.ColorType == PNG_RGB && Trns && TrnsLen == 6) {
+        Key = RGB ((unsigned char) (P.Depth == 16? Trns[0] : Trns[1]),
+                   (unsigned char) (P.Depth == 16? Trns[2] : Trns[3]),
+                   (unsigned char) (P.Depth == 16? Trns[4] : Trns[5]));
+        KeyPtr = &Key;
+    }
+
+    /* Unfilter the rows of all passes and move them into the bitmap */
+    Zero = xmalloc (RowBytes (&P, P.Width) + 1);
+    memset (Zero, 0, RowBytes (&P, P.Width) + 1);
+    Pos = 0;
+    for (Pass = 0; Pass < PassCount; ++Pass) {
+
+        const unsigned char* S    = Passes[Pass];
+        unsigned             W    = (P.Width  + S[2] - 1 - S[0]) / S[2];
+        unsigned             H    = (P.Height + S[3] - 1 - S[1]) / S[3];
+        unsigned long        Len  = RowBytes (&P, W);
+        const unsigned char* Prev = Zero;
+        unsigned             Y;
+
+        if (W == 0 || H == 0) {
+            continue;
+        }
+        for (Y = 0; Y < H; ++Y) {
+            unsigned char* Row = Raw + Pos + 1;
+            Unfilter (Row, Prev, Len, P.PixelBytes, Raw[Pos], Name);
+            StoreRow (&P, B, Row, W, S[0], S[2], S[1] + Y * S[3], KeyPtr);
+            Prev = Row;
+            Pos += Len + 1;
+        }
+    }
+
+    /* Create the palette. Like for PCX files, it contains just the colors up
+    ** to the highest one used.
+    */
+    if (B->Index) {
+
+        unsigned long I;
+        unsigned long Count = (unsigned long) P.Width * P.Height;
+
+        MaxIdx = 0;
+        for (I = 0; I < Count; ++I) {
+            if (B->Index[I] > MaxIdx) {
+                MaxIdx = B->Index[I];
+            }
+        }
+
+        B->Pal = NewPalette (MaxIdx + 1);
+        if (P.ColorType == PNG_INDEXED) {
+            if (MaxIdx >= PlteCount) {
+                Error ("PNG file `%s' uses color %u which is not in the palette",
+                       Name, MaxIdx);
+            }
+            for (I = 0; I <= MaxIdx; ++I) {
+                B->Pal->Entries[I] = RGBA (Plte[I * 3], Plte[I * 3 + 1], Plte[I * 3 + 2],
+                                           (unsigned char) (I < TrnsLen? 255 - Trns[I] : 0));
+            }
+        } else {
+            /* Scale the gray levels to 0..255 */
+            unsigned Max = (P.Depth == 16)? 255 : (1U << P.Depth) - 1;
+            unsigned TrnsIdx = 256;
+            if (Trns && TrnsLen == 2) {
+                TrnsIdx = (P.Depth == 16)? Trns[0] : BE16 (Trns);
+            }
+            for (I = 0; I <= MaxIdx; ++I) {
+                unsigned char G = (unsigned char) (I * 255 / Max);
+                B->Pal->Entries[I] = RGBA (G, G, G,
+                                           (unsigned char) (I == TrnsIdx? 255 : 0));
+            }
+        }
+    }
+
+    /* Free the buffers */
+    xfree (Zero);
+    xfree (Raw);
+    xfree (Z);
+    xfree (Data);
+
+    /* Return the bitmap */
+    return B;
+}
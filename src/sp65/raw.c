@@ -56,7 +56,7 @@ StrBuf* GenRaw (const Bitmap* B, const Collection* A attribute ((unused)))
 */
 {
     StrBuf* D;
-    unsigned X, Y;
+    unsigned Y;
 
 
     /* Output the image properties */
@@ -73,12 +73,12 @@ StrBuf* GenRaw (const Bitmap* B, const Collection* A attribute ((unused)))
     D = NewStrBuf ();
     SB_Realloc (D, GetBitmapWidth (B) * GetBitmapHeight (B));
 
-    /* Convert the image */
+    /* Convert the image. Indexed bitmaps have one byte per pixel, so each
+    ** line can be copied as is.
+    */
     for (Y = 0; Y < GetBitmapHeight (B); ++Y) {
-        for (X = 0; X < GetBitmapWidth (B); ++X) {
-            /* Place one pixel into the buffer */
-            SB_AppendChar (D, (unsigned char) GetPixel (B, X, Y).Index);
-        }
+        SB_AppendBuf (D, (const char*) GetBitmapIndexLine (B, Y),
+                      GetBitmapWidth (B));
     }
 
     /* Return the converted bitmap */
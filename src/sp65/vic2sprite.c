@@ -146,12 +146,13 @@ StrBuf* GenVic2Sprite (const Bitmap* B, const Collection* A)
 
     /* Convert the image */
     for (Y = 0; Y < HEIGHT; ++Y) {
+        const unsigned char* L = GetBitmapIndexLine (B, Y);
         unsigned char V = 0;
         if (M == smHighRes) {
             for (X = 0; X < WIDTH_HR; ++X) {
 
                 /* Fetch next bit into byte buffer */
-                V = (V << 1) | (GetPixel (B, X, Y).Index & 0x01);
+                V = (V << 1) | (L[X] & 0x01);
 
                 /* Store full bytes into the output buffer */
                 if ((X & 0x07) == 0x07) {
@@ -163,7 +164,7 @@ StrBuf* GenVic2Sprite (const Bitmap* B, const Collection* A)
             for (X = 0; X < WIDTH_MC; ++X) {
 
                 /* Fetch next bit into byte buffer */
-                V = (V << 2) | (GetPixel (B, X, Y).Index & 0x03);
+                V = (V << 2) | (L[X] & 0x03);
 
                 /* Store full bytes into the output buffer */
                 if ((X & 0x03) == 0x03) {
@@ -0,0 +1,7 @@
+; Needs one from m1.o, which needs three from m3.o. The library also
+; contains modules that are not needed.
+
+        .import one
+
+        .byte   $00
+        .word   one
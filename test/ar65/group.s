@@ -0,0 +1,6 @@
+; Needs five from lib2.lib, which needs two from lib1.lib
+
+        .import five
+
+        .byte   $00
+        .word   five
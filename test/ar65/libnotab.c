@@ -0,0 +1,80 @@
+// copy a library without the export table that follows the index
+//
+// usage: libnotab <library> <output>
+//
+// The result is a library as written by older versions of ar65, which end
+// after the index. The index is the one the header points to, so this works
+// for libraries that were updated in place, too.
+
+#include <stdlib.h>
+#include <stdio.h>
+
+static unsigned char lib[1 << 20];
+
+static unsigned long get(size_t pos, unsigned n)
+{
+    unsigned long v = 0;
+    while (n--) {
+        v = (v << 8) | lib[pos + n];
+    }
+    return v;
+}
+
+// counts and lengths are stored with 7 bits per byte, the high bit is set
+// if another byte follows
+static unsigned long getvar(size_t *pos)
+{
+    unsigned long v = 0;
+    unsigned shift = 0;
+    unsigned char c;
+    do {
+        c = lib[(*pos)++];
+        v |= (unsigned long) (c & 0x7F) << shift;
+        shift += 7;
+    } while (c & 0x80);
+    return v;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *f;
+    size_t len, pos;
+    unsigned long count, i;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <library> <output>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if ((f = fopen(argv[1], "rb")) == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    len = fread(lib, 1, sizeof(lib), f);
+    fclose(f);
+    if (len < 12 || get(0, 4) != 0x7A55616EUL || (pos = get(8, 4)) >= len) {
+        fprintf(stderr, "%s: not a library\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    // the index is the module count followed by the name, flags, time,
+    // start and size of each module
+    count = getvar(&pos);
+    for (i = 0; i < count && pos < len; ++i) {
+        pos += getvar(&pos);
+        pos += 2 + 4 + 4 + 4;
+    }
+    if (pos > len) {
+        fprintf(stderr, "%s: bad index\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    if ((f = fopen(argv[2], "wb")) == NULL) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    if (fwrite(lib, 1, pos, f) != pos || fclose(f) != 0) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,9 @@
+; Modules for the library tests. Each module has a different byte in the
+; CODE segment, so the output of the linker shows which modules were added
+; and in which order.
+
+        .export one
+        .import three
+
+one:    .byte   $01
+        .word   three
@@ -0,0 +1,3 @@
+        .export two
+
+two:    .byte   $02
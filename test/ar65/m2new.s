@@ -0,0 +1,5 @@
+; A newer version of m2.s that replaces the module m2.o in the library
+
+        .export two
+
+two:    .byte   $22, $22
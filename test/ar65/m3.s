@@ -0,0 +1,3 @@
+        .export three
+
+three:  .byte   $03
@@ -0,0 +1,3 @@
+        .export four
+
+four:   .byte   $04
@@ -0,0 +1,8 @@
+; The only module of lib2.lib. It needs a module of lib1.lib, so the
+; libraries must be linked as a group.
+
+        .export five
+        .import two
+
+five:   .byte   $05
+        .word   two
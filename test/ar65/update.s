@@ -0,0 +1,6 @@
+; Needs two and four from the library that was updated in place
+
+        .import two, four
+
+        .byte   $00
+        .word   four, two
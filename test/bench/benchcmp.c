@@ -0,0 +1,171 @@
+
+// compare the results of the cc65 benchmarks with a baseline
+//
+// usage: benchcmp <baseline> <results> [threshold]
+//
+// Both files contain one line per program and configuration: the name of
+// the program, the optimization option, the CPU, the size of the program
+// file and the number of executed cycles. Prints the change of the size and
+// of the cycles against the baseline for every result, and fails if one of
+// them grew by more than threshold percent (default 1). Results without an
+// entry in the baseline are listed but not checked. Also fails if a line of
+// either file cannot be read, or if there is no result for an entry of the
+// baseline, since the program failed to build or run in that case.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAXENTRIES      1000
+#define MAXNAME         64
+
+typedef struct {
+    char name[MAXNAME];
+    unsigned long size;
+    unsigned long cycles;
+    int seen;
+} entry;
+
+static entry base[MAXENTRIES];
+static unsigned nbase;
+
+// read the next line of a results file into e, the name is the program,
+// the option and the CPU joined with dots. Empty lines are skipped. Returns
+// 1 for an entry, 0 at the end of the file, and -1 after reporting a line
+// that cannot be read.
+static int readentry(FILE *f, const char *file, unsigned *lineno, entry *e)
+{
+    char line[256], prog[MAXNAME], opt[MAXNAME], cpu[MAXNAME], extra[2];
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        ++*lineno;
+        if (sscanf(line, "%1s", extra) != 1) {
+            continue;
+        }
+        if (sscanf(line, "%63s %63s %63s %lu %lu %1s", prog, opt, cpu,
+                   &e->size, &e->cycles, extra) != 5 ||
+            strlen(prog) + strlen(opt) + strlen(cpu) + 3 > MAXNAME) {
+            fprintf(stderr, "%s(%u): cannot read \"%.*s\"\n", file, *lineno,
+                    (int) strcspn(line, "\r\n"), line);
+            return -1;
+        }
+        sprintf(e->name, "%s.%s.%s", prog, opt, cpu);
+        e->seen = 0;
+        return 1;
+    }
+    return 0;
+}
+
+static entry *findbase(const char *name)
+{
+    unsigned i;
+
+    for (i = 0; i < nbase; ++i) {
+        if (strcmp(base[i].name, name) == 0) {
+            return &base[i];
+        }
+    }
+    return NULL;
+}
+
+static double change(unsigned long old, unsigned long cur)
+{
+    return old ? 100.0 * ((double) cur - (double) old) / (double) old : 0.0;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *f;
+    entry e;
+    entry *b;
+    double threshold = 1.0;
+    double dsize, dcycles;
+    unsigned lineno, i;
+    int r;
+    unsigned count = 0, worse = 0, missing = 0, bad = 0;
+    unsigned long oldsize = 0, cursize = 0, oldcycles = 0, curcycles = 0;
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <baseline> <results> [threshold]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 3) {
+        threshold = atof(argv[3]);
+    }
+
+    f = fopen(argv[1], "r");
+    if (f == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    lineno = 0;
+    while ((r = readentry(f, argv[1], &lineno, &e)) != 0) {
+        if (r < 0) {
+            ++bad;
+        } else if (nbase == MAXENTRIES) {
+            fprintf(stderr, "%s(%u): too many entries\n", argv[1], lineno);
+            ++bad;
+            break;
+        } else {
+            base[nbase++] = e;
+        }
+    }
+    fclose(f);
+
+    f = fopen(argv[2], "r");
+    if (f == NULL) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    printf("%-24s %7s %8s %11s %8s\n", "program", "size", "change", "cycles", "change");
+    lineno = 0;
+    while ((r = readentry(f, argv[2], &lineno, &e)) != 0) {
+        if (r < 0) {
+            ++bad;
+            continue;
+        }
+        b = findbase(e.name);
+        if (b == NULL) {
+            printf("%-24s %7lu %8s %11lu %8s  new\n", e.name, e.size, "", e.cycles, "");
+            continue;
+        }
+        b->seen = 1;
+        dsize = change(b->size, e.size);
+        dcycles = change(b->cycles, e.cycles);
+        printf("%-24s %7lu %+7.2f%% %11lu %+7.2f%%", e.name, e.size, dsize, e.cycles, dcycles);
+        if (dsize > threshold || dcycles > threshold) {
+            printf("  <<<");
+            ++worse;
+        }
+        printf("\n");
+        oldsize += b->size;
+        cursize += e.size;
+        oldcycles += b->cycles;
+        curcycles += e.cycles;
+        ++count;
+    }
+    fclose(f);
+    for (i = 0; i < nbase; ++i) {
+        if (!base[i].seen) {
+            printf("%-24s %7s %8s %11s %8s  missing\n", base[i].name, "", "", "", "");
+            ++missing;
+        }
+    }
+
+    printf("%-24s %7lu %+7.2f%% %11lu %+7.2f%%\n", "total", cursize, change(oldsize, cursize),
+           curcycles, change(oldcycles, curcycles));
+    if (bad > 0) {
+        printf("%u lines cannot be read\n", bad);
+    }
+    if (missing > 0) {
+        printf("%u of %u baseline entries have no result\n", missing, nbase);
+    }
+    if (worse > 0) {
+        printf("%u of %u results exceed the threshold of %g%%\n", worse, count, threshold);
+    }
+    if (bad > 0 || missing > 0 || worse > 0) {
+        return EXIT_FAILURE;
+    }
+    printf("%u results within the threshold of %g%%\n", count, threshold);
+    return EXIT_SUCCESS;
+}
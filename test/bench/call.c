@@ -0,0 +1,123 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the call, stack and copy helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#define LOOPS   1000
+
+typedef struct {
+    int x, y;
+    unsigned char c;
+    long l;
+} point;
+
+static unsigned seed = 1;
+
+/* Static buffers, so -Os inlines the string and memory functions */
+static unsigned char buf[32];
+static point saved;
+static char name[16] = "kernel";
+static char copy[16];
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+static int add3 (int a, int b, int c)
+{
+    int t = a + b;
+
+    return t + c;
+}
+
+static unsigned char pick (unsigned char a, unsigned char b)
+{
+    return a > b ? a : b;
+}
+
+static int vsum (unsigned n, ...)
+{
+    va_list ap;
+    int s = 0;
+
+    va_start (ap, n);
+    while (n--) {
+        s += va_arg (ap, int);
+    }
+    va_end (ap);
+    return s;
+}
+
+static int twice (int a)
+{
+    return a + a;
+}
+
+static int negate (int a)
+{
+    return -a;
+}
+
+static void move (point* p, int dx)
+{
+    p->x += dx;
+    p->l += p->y;
+}
+
+int main (void)
+{
+    static int (*funcs[2]) (int) = { twice, negate };
+    unsigned i, a;
+    int s = 0;
+    point p = { 0, 1, 2, 3 };
+    point q;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = rnd ();
+
+        /* calls with arguments on the stack */
+        s += add3 (a, i, s);
+        s += pick (a, a >> 8);
+        s += vsum (4, a, i, s, 1);
+
+        /* calls through function pointers */
+        s += funcs[i & 1] (a);
+
+        /* struct access through pointers, and copies */
+        p.y = a;
+        q = p;
+        move (&q, i);
+        p = q;
+        saved = q;
+
+        /* string and memory functions */
+        memset (buf, a, sizeof (buf));
+        memcpy (buf + 8, &saved, sizeof (saved));
+        s += buf[i & 31];
+        name[i & 7] = 'a' + (a & 15);
+        strcpy (copy, name);
+        s += strlen (copy);
+        s += strcmp (copy, name);
+
+        /* switch statements */
+        switch (a & 7) {
+            case 0:  s += 1;  break;
+            case 1:  s -= 2;  break;
+            case 3:  s ^= 4;  break;
+            case 6:  s <<= 1; break;
+            default: s += a;  break;
+        }
+    }
+
+    printf ("%d %d %ld\n", s, p.x, p.l);
+    return 0;
+}
@@ -0,0 +1,54 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the compare helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define LOOPS   2000
+
+static unsigned seed = 1;
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+int main (void)
+{
+    unsigned i, a, b;
+    int x, y;
+    unsigned long la, lb;
+    long sa, sb;
+    unsigned n = 0;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = rnd ();
+        b = rnd ();
+        x = a;
+        y = b;
+        la = (unsigned long) a << 12 | b;
+        lb = (unsigned long) b << 12 | a;
+        sa = (long) x * 3;
+        sb = (long) y * 5;
+
+        /* unsigned and signed 16 bit */
+        n += (a < b) + (a <= b) + (a > b) + (a >= b) + (a == b) + (a != b);
+        n += (x < y) + (x <= y) + (x > y) + (x >= y);
+
+        /* compares with constants */
+        n += (x < 100) + (a >= 4000) + (x > -5);
+
+        /* unsigned and signed 32 bit */
+        n += (la < lb) + (la <= lb) + (la > lb) + (la >= lb) + (la == lb) + (la != lb);
+        n += (sa < sb) + (sa <= sb) + (sa > sb) + (sa >= sb);
+        n += !la + (sa != 0);
+    }
+
+    printf ("%u\n", n);
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the division and modulo helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define LOOPS   2000
+
+static unsigned seed = 1;
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+int main (void)
+{
+    unsigned i, a, b;
+    unsigned u = 0;
+    int s = 0;
+    unsigned long l = 0;
+    long sl = 0;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = rnd ();
+        b = (rnd () >> (i & 15)) | 1;
+
+        /* unsigned and signed 16 bit */
+        u += a / b + a % b;
+        s += (int) a / (int) b + (int) a % (int) b;
+
+        /* division by constants */
+        u += a / 10 + a % 10 + a / 7;
+
+        /* 32 bit */
+        l += ((unsigned long) a << 16 | b) / b;
+        l += ((unsigned long) b << 12 | a) % a;
+        sl += ((long) (int) a << 8) / (int) b;
+        sl += ((long) (int) b * 1000) % 77;
+    }
+
+    printf ("%u %d %lu %ld\n", u, s, l, sl);
+    return 0;
+}
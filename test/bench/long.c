@@ -0,0 +1,64 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the 32 bit arithmetic helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define LOOPS   2000
+
+static unsigned seed = 1;
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+static long sum (long* p, unsigned n)
+{
+    long s = 0;
+
+    while (n--) {
+        s += *p++;
+    }
+    return s;
+}
+
+int main (void)
+{
+    unsigned i;
+    long a, b;
+    long v[8];
+    long s = 0;
+    unsigned long x = 0;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = (long) rnd () << 8 | (i & 0xFF);
+        b = rnd ();
+
+        /* addition, subtraction and logical operations */
+        s += a + b;
+        s -= a - b;
+        x += (a & b) | (a ^ b);
+        x ^= a | b;
+
+        /* negation, complement, increment and decrement */
+        s += -a;
+        x += ~b;
+        ++s;
+        --x;
+        s += 7;
+        x -= 300;
+
+        /* indirect access through pointers */
+        v[i & 7] = a;
+        s += sum (v, 8);
+    }
+
+    printf ("%ld %lu\n", s, x);
+    return 0;
+}
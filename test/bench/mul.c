@@ -0,0 +1,52 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the multiplication helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define LOOPS   2000
+
+static unsigned seed = 1;
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+int main (void)
+{
+    unsigned i, a, b;
+    unsigned char c, d;
+    unsigned u = 0;
+    int s = 0;
+    unsigned long l = 0;
+    long sl = 0;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = rnd ();
+        b = rnd ();
+        c = a;
+        d = b;
+
+        /* 8x8, 16x16 and signed 16x16 bit */
+        u += c * d;
+        u += a * b;
+        s += (int) a * (int) b;
+
+        /* multiplication with small constants */
+        u += a * 3 + b * 5 + a * 6 + b * 7 + a * 9 + b * 10;
+
+        /* 32 bit */
+        l += (unsigned long) a * b;
+        sl += (long) (int) a * (int) b;
+        l *= 3;
+    }
+
+    printf ("%u %d %lu %ld\n", u, s, l, sl);
+    return 0;
+}
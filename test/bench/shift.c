@@ -0,0 +1,50 @@
+/*
+  !!DESCRIPTION!! benchmark kernel for the shift helpers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define LOOPS   2000
+
+static unsigned seed = 1;
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+int main (void)
+{
+    unsigned i, a, n;
+    unsigned u = 0;
+    int s = 0;
+    unsigned long l = 0;
+    long sl = 0;
+
+    for (i = 0; i < LOOPS; ++i) {
+        a = rnd ();
+        n = i & 15;
+
+        /* variable 16 bit shifts */
+        u += (a << n) ^ (a >> n);
+        s += (int) a >> n;
+
+        /* constant 16 bit shifts */
+        u += (a << 3) ^ (a >> 4);
+        s += ((int) a >> 2) + ((int) a >> 9);
+
+        /* variable and constant 32 bit shifts */
+        l += ((unsigned long) a << (n + 8)) ^ (l >> n);
+        sl += ((long) (int) a << 4) >> (n + 1);
+        l += (l << 1) ^ (l >> 3);
+        sl += (sl >> 2) - (sl << 4);
+    }
+
+    printf ("%u %d %lu %ld\n", u, s, l, sl);
+    return 0;
+}
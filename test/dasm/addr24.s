@@ -0,0 +1,20 @@
+; Code at $8000 that is disassembled at $018000 for the test of addresses
+; above $FFFF. The labels that da65 generates must have 24 bit addresses.
+
+        .setcpu "6502"
+
+        .org    $8000
+
+start:  ldx     #$00
+loop:   lda     table,x
+        sta     $0200,x
+        inx
+        cpx     #4
+        bne     loop
+        jsr     sub
+        jmp     start
+
+sub:    lda     table
+        rts
+
+table:  .byte   $01, $02, $04, $08
@@ -0,0 +1,59 @@
+; Three banks of 4K at $C000 for the test of the da65 bank support. The
+; code of each bank refers to its own bank, banks.info adds labels and a
+; table above $FFFF.
+
+        .setcpu "6502"
+
+; Bank 0
+
+        .org    $C000
+
+start0: ldx     #$00
+@loop:  lda     $C100,x
+        sta     $0200,x
+        inx
+        bne     @loop
+        jsr     sub0
+        jmp     $C000
+
+sub0:   lda     #$01
+        rts
+
+        .res    $C100 - *, $00
+        .byte   "BANK0"
+        .res    $D000 - *, $00
+
+; Bank 1
+
+        .org    $C000
+
+start1: jsr     sub1
+        bcc     @skip
+        lda     $C100
+@skip:  jmp     ($0300)
+
+sub1:   ldy     #$10
+@loop:  dey
+        bne     @loop
+        clc
+        rts
+
+        .res    $C100 - *, $00
+        .byte   "BANK1"
+        .res    $D000 - *, $00
+
+; Bank 2
+
+        .org    $C000
+
+        ldx     $C100
+        lda     $C101,x
+        jsr     sub2
+        jmp     $C000
+
+sub2:   sta     $D020
+        rts
+
+        .res    $C100 - *, $00
+        .byte   $03, $10, $20, $30
+        .res    $D000 - *, $00
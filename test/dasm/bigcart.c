@@ -0,0 +1,81 @@
+
+// generate a banked cartridge image for the da65 benchmark
+//
+// usage: bigcart <output> <banks>
+//
+// The image consists of 16K banks that are all mapped at $C000. Each bank
+// contains a stream of documented 6502 instructions with jumps and calls
+// into the same bank, followed by the hardware vectors. The code ends early
+// enough so that no branch can wrap around to the zero page.
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#define BANKSIZE        0x4000
+#define BANKADDR        0xC000
+
+static unsigned long seed = 1;
+
+static unsigned rnd(unsigned max)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (unsigned) ((seed >> 8) % max);
+}
+
+// opcode and instruction size
+static const unsigned char ops[][2] = {
+    { 0xA9, 2 }, { 0xA2, 2 }, { 0xA0, 2 }, { 0x85, 2 }, { 0xA5, 2 },
+    { 0x8D, 3 }, { 0xAD, 3 }, { 0xBD, 3 }, { 0x9D, 3 }, { 0x69, 2 },
+    { 0x29, 2 }, { 0xC9, 2 }, { 0xE8, 1 }, { 0xC8, 1 }, { 0xCA, 1 },
+    { 0x0A, 1 }, { 0x18, 1 }, { 0x38, 1 }, { 0x48, 1 }, { 0x68, 1 },
+    { 0xD0, 2 }, { 0xF0, 2 }, { 0x90, 2 }, { 0xB0, 2 }, { 0x20, 3 },
+    { 0x4C, 3 }, { 0x60, 1 }, { 0xB1, 2 }, { 0x91, 2 }, { 0xEA, 1 },
+};
+
+#define OPCOUNT (sizeof (ops) / sizeof (ops[0]))
+
+int main(int argc, char *argv[])
+{
+    FILE *f;
+    unsigned char bank[BANKSIZE];
+    unsigned long banks, b;
+    unsigned pc, i;
+
+    if (argc < 3 || (banks = strtoul(argv[2], NULL, 0)) == 0 || banks > 0x100) {
+        fprintf(stderr, "usage: %s <output> <banks (1-256)>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    f = fopen(argv[1], "wb");
+    if (f == NULL) {
+        return EXIT_FAILURE;
+    }
+    for (b = 0; b < banks; ++b) {
+        pc = 0;
+        while (pc < BANKSIZE - 6 - 0x80) {
+            const unsigned char *op = ops[rnd(OPCOUNT)];
+            bank[pc] = op[0];
+            if (op[1] == 3) {
+                // absolute operand, jumps and calls stay within the bank
+                unsigned addr = BANKADDR + rnd(BANKSIZE - 6);
+                bank[pc + 1] = (unsigned char) addr;
+                bank[pc + 2] = (unsigned char) (addr >> 8);
+            } else if (op[1] == 2) {
+                bank[pc + 1] = (unsigned char) rnd(0x100);
+            }
+            pc += op[1];
+        }
+        while (pc < BANKSIZE - 6) {
+            bank[pc++] = 0xEA;
+        }
+        // NMI, RESET and IRQ vectors
+        for (i = 0; i < 3; ++i) {
+            unsigned addr = BANKADDR + rnd(BANKSIZE - 6);
+            bank[pc++] = (unsigned char) addr;
+            bank[pc++] = (unsigned char) (addr >> 8);
+        }
+        if (fwrite(bank, 1, BANKSIZE, f) != BANKSIZE) {
+            return EXIT_FAILURE;
+        }
+    }
+    return fclose(f) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
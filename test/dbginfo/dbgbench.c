@@ -0,0 +1,272 @@
+// measure the load time of a debug info file with the dbginfo library
+//
+// usage: dbgbench [-n count] [-d dumpfile] <file>
+//
+// Loads the file count times (default 5) and prints the best and the
+// average wall clock time of a load. With -d, everything that can be
+// queried from the loaded debug info is written to dumpfile, so the results
+// of different builds of the library can be compared with cmp.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(_WIN32)
+#  include <time.h>
+#else
+#  include <sys/time.h>
+#endif
+
+#include "dbginfo.h"
+
+static unsigned errors;
+
+static void errorfunc(const cc65_parseerror *e)
+{
+    fprintf(stderr, "%s:%lu:%u: %s: %s\n", e->name, (unsigned long) e->line,
+            e->column, e->type == CC65_ERROR ? "Error" : "Warning",
+            e->errormsg);
+    if (e->type == CC65_ERROR) {
+        ++errors;
+    }
+}
+
+// wall clock time in milliseconds
+static double now(void)
+{
+#if defined(_WIN32)
+    return clock() * 1000.0 / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+static void dumpspans(FILE *f, const char *what, const cc65_spaninfo *s)
+{
+    unsigned i;
+    if (s == NULL) {
+        return;
+    }
+    for (i = 0; i < s->count; ++i) {
+        fprintf(f, "%s span %u %06lX-%06lX seg=%u lines=%u scopes=%u\n", what,
+                s->data[i].span_id, (unsigned long) s->data[i].span_start,
+                (unsigned long) s->data[i].span_end, s->data[i].segment_id,
+                s->data[i].line_count, s->data[i].scope_count);
+    }
+}
+
+static void dumpsyms(FILE *f, const char *what, const cc65_symbolinfo *s)
+{
+    unsigned i;
+    if (s == NULL) {
+        return;
+    }
+    for (i = 0; i < s->count; ++i) {
+        fprintf(f, "%s sym %u %s type=%d size=%u val=%ld exp=%u seg=%u "
+                   "scope=%u parent=%u\n", what,
+                s->data[i].symbol_id, s->data[i].symbol_name,
+                (int) s->data[i].symbol_type, (unsigned) s->data[i].symbol_size,
+                s->data[i].symbol_value, s->data[i].export_id,
+                s->data[i].segment_id, s->data[i].scope_id,
+                s->data[i].parent_id);
+    }
+}
+
+static void dumplines(FILE *f, const char *what, const cc65_lineinfo *l)
+{
+    unsigned i;
+    if (l == NULL) {
+        return;
+    }
+    for (i = 0; i < l->count; ++i) {
+        fprintf(f, "%s line %u file=%u line=%lu type=%d count=%u\n", what,
+                l->data[i].line_id, l->data[i].source_id,
+                (unsigned long) l->data[i].source_line,
+                (int) l->data[i].line_type, l->data[i].count);
+    }
+}
+
+static void dumpscopes(FILE *f, const char *what, const cc65_scopeinfo *s)
+{
+    unsigned i;
+    if (s == NULL) {
+        return;
+    }
+    for (i = 0; i < s->count; ++i) {
+        fprintf(f, "%s scope %u \"%s\" type=%d size=%u parent=%u sym=%u mod=%u\n",
+                what, s->data[i].scope_id, s->data[i].scope_name,
+                (int) s->data[i].scope_type, (unsigned) s->data[i].scope_size,
+                s->data[i].parent_id, s->data[i].symbol_id,
+                s->data[i].module_id);
+    }
+}
+
+static void dumpcsyms(FILE *f, const char *what, const cc65_csyminfo *c)
+{
+    unsigned i;
+    if (c == NULL) {
+        return;
+    }
+    for (i = 0; i < c->count; ++i) {
+        fprintf(f, "%s csym %u %s kind=%u sc=%u offs=%d type=%u sym=%u scope=%u\n",
+                what, c->data[i].csym_id, c->data[i].csym_name,
+                c->data[i].csym_kind, c->data[i].csym_sc, c->data[i].csym_offs,
+                c->data[i].type_id, c->data[i].symbol_id, c->data[i].scope_id);
+    }
+}
+
+static void dump(cc65_dbginfo h, const char *name)
+{
+    FILE *f = fopen(name, "w");
+    unsigned iter, i;
+    unsigned long addr;
+    cc65_sourcedata src;
+    cc65_moduledata mod;
+    cc65_segmentdata seg;
+    cc65_scopedata scope;
+    cc65_symboldata sym;
+    cc65_spandata span;
+    cc65_linedata line;
+    cc65_csymdata csym;
+    const cc65_segmentinfo *segs;
+    const cc65_sourceinfo *srcs;
+
+    if (f == NULL) {
+        perror(name);
+        exit(EXIT_FAILURE);
+    }
+
+    // all items by id, with the lists that hang off them
+    iter = 0;
+    while (cc65_next_source(h, &iter, &src)) {
+        fprintf(f, "source %u %s %lu %lX\n", src.source_id, src.source_name,
+                src.source_size, src.source_mtime);
+        dumplines(f, "  bysource", cc65_line_bysource(h, src.source_id));
+    }
+    iter = 0;
+    while (cc65_next_module(h, &iter, &mod)) {
+        fprintf(f, "module %u %s file=%u lib=%u scope=%u\n", mod.module_id,
+                mod.module_name, mod.source_id, mod.library_id, mod.scope_id);
+        dumpscopes(f, "  bymodule", cc65_scope_bymodule(h, mod.module_id));
+        dumpcsyms(f, "  bymodule", cc65_cfunc_bymodule(h, mod.module_id));
+    }
+    iter = 0;
+    while (cc65_next_segment(h, &iter, &seg)) {
+        fprintf(f, "segment %u %s %06lX %lu\n", seg.segment_id, seg.segment_name,
+                (unsigned long) seg.segment_start, (unsigned long) seg.segment_size);
+    }
+    iter = 0;
+    while (cc65_next_scope(h, &iter, &scope)) {
+        fprintf(f, "scope %u\n", scope.scope_id);
+        dumpsyms(f, "  byscope", cc65_symbol_byscope(h, scope.scope_id));
+        dumpcsyms(f, "  byscope", cc65_csym_byscope(h, scope.scope_id));
+        dumpspans(f, "  byscope", cc65_span_byscope(h, scope.scope_id));
+        dumpscopes(f, "  children", cc65_childscopes_byid(h, scope.scope_id));
+        dumpscopes(f, "  byname", cc65_scope_byname(h, scope.scope_name));
+    }
+    iter = 0;
+    while (cc65_next_symbol(h, &iter, &sym)) {
+        fprintf(f, "symbol %u\n", sym.symbol_id);
+        dumpsyms(f, "  byname", cc65_symbol_byname(h, sym.symbol_name));
+        dumplines(f, "  def", cc65_line_bysymdef(h, sym.symbol_id));
+        dumplines(f, "  ref", cc65_line_bysymref(h, sym.symbol_id));
+    }
+    iter = 0;
+    while (cc65_next_span(h, &iter, &span)) {
+        fprintf(f, "span %u\n", span.span_id);
+        dumplines(f, "  byspan", cc65_line_byspan(h, span.span_id));
+        dumpscopes(f, "  byspan", cc65_scope_byspan(h, span.span_id));
+    }
+    iter = 0;
+    while (cc65_next_line(h, &iter, &line)) {
+        fprintf(f, "line %u\n", line.line_id);
+        dumpspans(f, "  byline", cc65_span_byline(h, line.line_id));
+    }
+    iter = 0;
+    while (cc65_next_csym(h, &iter, &csym)) {
+        fprintf(f, "csym %u\n", csym.csym_id);
+        dumpcsyms(f, "  byname", cc65_cfunc_byname(h, csym.csym_name));
+    }
+
+    // lookups by address in all segments, and the sorted lists
+    segs = cc65_get_segmentlist(h);
+    for (i = 0; i < segs->count; ++i) {
+        unsigned long start = segs->data[i].segment_start;
+        unsigned long end = start + segs->data[i].segment_size;
+        for (addr = start; addr < end; ++addr) {
+            const cc65_spaninfo *s = cc65_span_byaddr(h, addr);
+            if (s != NULL && s->count > 0) {
+                fprintf(f, "addr %06lX\n", addr);
+                dumpspans(f, "  byaddr", s);
+            }
+            cc65_free_spaninfo(h, s);
+        }
+        dumpsyms(f, "inrange", cc65_symbol_inrange(h, start, end));
+    }
+    cc65_free_segmentinfo(h, segs);
+    srcs = cc65_get_sourcelist(h);
+    for (i = 0; i < srcs->count; ++i) {
+        fprintf(f, "sourcelist %u\n", srcs->data[i].source_id);
+    }
+    cc65_free_sourceinfo(h, srcs);
+
+    // the results of the queries aren't freed, the program ends soon
+    if (fclose(f) != 0) {
+        perror(name);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *file = NULL;
+    const char *dumpname = NULL;
+    unsigned count = 5;
+    unsigned i;
+    double best = 0.0, total = 0.0;
+    cc65_dbginfo h = NULL;
+
+    for (i = 1; i < (unsigned) argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < (unsigned) argc) {
+            count = (unsigned) strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < (unsigned) argc) {
+            dumpname = argv[++i];
+        } else if (file == NULL && argv[i][0] != '-') {
+            file = argv[i];
+        } else {
+            file = NULL;
+            break;
+        }
+    }
+    if (file == NULL || count == 0) {
+        fprintf(stderr, "usage: %s [-n count] [-d dumpfile] <file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < count; ++i) {
+        double start = now();
+        double t;
+        if (h != NULL) {
+            cc65_free_dbginfo(h);
+        }
+        h = cc65_read_dbginfo(file, errorfunc);
+        t = now() - start;
+        if (h == NULL || errors > 0) {
+            fprintf(stderr, "%s: cannot load %s\n", argv[0], file);
+            return EXIT_FAILURE;
+        }
+        if (i == 0 || t < best) {
+            best = t;
+        }
+        total += t;
+    }
+    printf("%s: best %.1f ms, average %.1f ms of %u loads\n",
+           file, best, total / count, count);
+
+    if (dumpname != NULL) {
+        dump(h, dumpname);
+    }
+    cc65_free_dbginfo(h);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+// generate a large debug info file for the dbginfo load time benchmark
+//
+// usage: dbggen <file> <modules>
+//
+// Writes a text debug info file like the one ld65 creates for a program
+// with the given number of modules. Each module has a source file, a main
+// scope and a few procedures, each with a C function, a label, a cheap
+// local, spans and lines. The records are written in the same order as
+// ld65 does, so the ids of every kind are ascending.
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#define PROCS           8       // procedures per module
+#define SPANS           6       // spans per procedure
+#define LINES           3       // lines per span
+#define SEGS            3       // CODE, DATA, BSS
+
+static const char *segname[SEGS] = { "CODE", "DATA", "BSS" };
+
+int main(int argc, char *argv[])
+{
+    FILE *f;
+    unsigned long mods, m, p, s, id;
+    unsigned long scopes, procs, syms, spans, lines;
+    unsigned long addr[SEGS];
+
+    if (argc != 3 || (mods = strtoul(argv[2], NULL, 0)) == 0) {
+        fprintf(stderr, "usage: %s <file> <modules>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    f = fopen(argv[1], "w");
+    if (f == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    procs  = mods * PROCS;
+    scopes = mods + procs;
+    syms   = procs * 2;
+    spans  = procs * SPANS;
+    lines  = spans * LINES;
+
+    fprintf(f, "version\tmajor=2,minor=0\n");
+    fprintf(f, "info\tcsym=%lu,file=%lu,lib=1,line=%lu,mod=%lu,scope=%lu,"
+               "seg=%u,span=%lu,sym=%lu,type=1\n",
+            procs, mods, lines, mods, scopes, SEGS, spans, syms);
+
+    // one C function per procedure
+    for (id = 0; id < procs; ++id) {
+        fprintf(f, "csym\tid=%lu,name=\"f%lu\",scope=%lu,type=0,sc=ext,sym=%lu\n",
+                id, id, id / PROCS + id + 1, id * 2);
+    }
+    for (m = 0; m < mods; ++m) {
+        fprintf(f, "file\tid=%lu,name=\"mod%lu.s\",size=%lu,mtime=0x5C2F1AE5,mod=%lu\n",
+                m, m, 1000 + m, m);
+    }
+    fprintf(f, "lib\tid=0,name=\"bench.lib\"\n");
+
+    // lines in the order of the files, each attached to one span
+    for (id = 0; id < lines; ++id) {
+        fprintf(f, "line\tid=%lu,file=%lu,line=%lu,span=%lu\n",
+                id, id / (PROCS * SPANS * LINES), id % (PROCS * SPANS * LINES) + 1,
+                id / LINES);
+    }
+    for (m = 0; m < mods; ++m) {
+        if (m % 4 == 3) {
+            fprintf(f, "mod\tid=%lu,name=\"mod%lu.o\",file=%lu,lib=0\n", m, m, m);
+        } else {
+            fprintf(f, "mod\tid=%lu,name=\"mod%lu.o\",file=%lu\n", m, m, m);
+        }
+    }
+
+    // the main scope of each module is followed by its procedures
+    id = 0;
+    for (m = 0; m < mods; ++m) {
+        unsigned long main = id++;
+        fprintf(f, "scope\tid=%lu,name=\"\",mod=%lu\n", main, m);
+        for (p = 0; p < PROCS; ++p) {
+            unsigned long proc = m * PROCS + p;
+            fprintf(f, "scope\tid=%lu,name=\"_f%lu\",mod=%lu,type=scope,size=%u,"
+                       "parent=%lu,sym=%lu,span=%lu",
+                    id++, proc, m, SPANS * 4, main, proc * 2, proc * SPANS);
+            for (s = 1; s < SPANS; ++s) {
+                fprintf(f, "+%lu", proc * SPANS + s);
+            }
+            putc('\n', f);
+        }
+    }
+
+    // the segments, with the code segment large enough for all spans
+    addr[0] = 0x0800;
+    addr[1] = addr[0] + spans * 4;
+    addr[2] = addr[1] + procs * 2;
+    for (s = 0; s < SEGS; ++s) {
+        fprintf(f, "seg\tid=%lu,name=\"%s\",start=0x%06lX,size=0x%04lX,"
+                   "addrsize=absolute,type=%s\n",
+                s, segname[s], addr[s],
+                s == 0 ? spans * 4 : procs * 2, s == 0 ? "ro" : "rw");
+    }
+
+    // four bytes for each span in the code segment
+    for (id = 0; id < spans; ++id) {
+        fprintf(f, "span\tid=%lu,seg=0,start=%lu,size=4\n", id, id * 4);
+    }
+
+    // a label and a cheap local for each procedure, in random order of the
+    // names, so sorting has something to do
+    for (p = 0; p < procs; ++p) {
+        unsigned long scope = p / PROCS + p + 1;
+        unsigned long val = addr[0] + p * SPANS * 4;
+        unsigned long line = p * SPANS * LINES;
+        fprintf(f, "sym\tid=%lu,name=\"_f%lu\",addrsize=absolute,size=%u,"
+                   "scope=%lu,def=%lu,ref=%lu,val=0x%lX,seg=0,type=lab\n",
+                p * 2, (p * 7919) % procs, SPANS * 4, scope, line, line + 1, val);
+        fprintf(f, "sym\tid=%lu,name=\"@L%lu\",addrsize=absolute,"
+                   "parent=%lu,def=%lu,val=0x%lX,seg=0,type=lab\n",
+                p * 2 + 1, p, p * 2, line + 2, val + 8);
+    }
+    fprintf(f, "type\tid=0,val=\"00\"\n");
+
+    if (fclose(f) != 0) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
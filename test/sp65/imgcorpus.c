@@ -0,0 +1,413 @@
+
+// generate the sample images for the sp65 input format benchmark
+//
+// usage: imgcorpus <directory> <count>
+//
+// Writes <count> 16 color images of the size of the Lynx screen with
+// filled shapes on a plain background. Each image is written as PCX, PNG
+// and GIF file with the same pixels, so the readers can be compared. The
+// PNG files are compressed with fixed Huffman codes and a simple LZ77
+// matcher, the GIF files with plain LZW.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define WIDTH           160
+#define HEIGHT          102
+#define COLORS          16
+
+static unsigned char pix[HEIGHT][WIDTH];
+static unsigned char pal[COLORS][3];
+static unsigned long seed = 1;
+
+static unsigned rnd(unsigned max)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (unsigned) ((seed >> 8) % max);
+}
+
+static void shapes(void)
+{
+    unsigned i, x, y;
+
+    memset(pix, 0, sizeof(pix));
+    for (i = 0; i < 12; ++i) {
+        unsigned c = 1 + rnd(COLORS - 1);
+        long cx = rnd(WIDTH), cy = rnd(HEIGHT), r = 4 + rnd(HEIGHT / 4);
+        int box = rnd(2);
+        for (y = 0; y < HEIGHT; ++y) {
+            for (x = 0; x < WIDTH; ++x) {
+                long dx = (long) x - cx, dy = (long) y - cy;
+                if (box ? (labs(dx) < r && labs(dy) < r / 2)
+                        : (dx * dx + dy * dy < r * r)) {
+                    pix[y][x] = c;
+                }
+            }
+        }
+    }
+}
+
+// output buffer for the compressed formats
+static unsigned char out[WIDTH * HEIGHT * 2 + 1024];
+static unsigned outlen;
+static unsigned long bitbuf;
+static unsigned bitcount;
+
+static void putbits(unsigned v, unsigned n)
+{
+    bitbuf |= (unsigned long) v << bitcount;
+    bitcount += n;
+    while (bitcount >= 8) {
+        out[outlen++] = bitbuf & 0xFF;
+        bitbuf >>= 8;
+        bitcount -= 8;
+    }
+}
+
+static void flushbits(void)
+{
+    if (bitcount > 0) {
+        out[outlen++] = bitbuf & 0xFF;
+    }
+    bitbuf = 0;
+    bitcount = 0;
+}
+
+static void putbe32(FILE *f, unsigned long v)
+{
+    putc((v >> 24) & 0xFF, f);
+    putc((v >> 16) & 0xFF, f);
+    putc((v >> 8) & 0xFF, f);
+    putc(v & 0xFF, f);
+}
+
+static void put16(FILE *f, unsigned v)
+{
+    putc(v & 0xFF, f);
+    putc((v >> 8) & 0xFF, f);
+}
+
+static int writepcx(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    unsigned x, y, i;
+
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    putc(10, f);
+    putc(5, f);
+    putc(1, f);
+    putc(8, f);
+    put16(f, 0);
+    put16(f, 0);
+    put16(f, WIDTH - 1);
+    put16(f, HEIGHT - 1);
+    put16(f, 72);
+    put16(f, 72);
+    for (i = 0; i < 48 + 1; ++i) {
+        putc(0, f);
+    }
+    putc(1, f);
+    put16(f, WIDTH);
+    put16(f, 1);
+    for (i = 0; i < 58; ++i) {
+        putc(0, f);
+    }
+    for (y = 0; y < HEIGHT; ++y) {
+        for (x = 0; x < WIDTH; ) {
+            unsigned v = pix[y][x], n = 1;
+            while (x + n < WIDTH && n < 63 && pix[y][x + n] == v) {
+                ++n;
+            }
+            if (n > 1 || v >= 0xC0) {
+                putc(0xC0 | n, f);
+            }
+            putc(v, f);
+            x += n;
+        }
+    }
+    putc(0x0C, f);
+    for (i = 0; i < 256; ++i) {
+        putc(i < COLORS ? pal[i][0] : 0, f);
+        putc(i < COLORS ? pal[i][1] : 0, f);
+        putc(i < COLORS ? pal[i][2] : 0, f);
+    }
+    return fclose(f) == 0;
+}
+
+// deflate with the fixed Huffman code
+static void putcode(unsigned code, unsigned len)
+{
+    unsigned rev = 0, i;
+    for (i = 0; i < len; ++i) {
+        rev = (rev << 1) | ((code >> i) & 1);
+    }
+    putbits(rev, len);
+}
+
+static void putlit(unsigned sym)
+{
+    if (sym < 144) {
+        putcode(0x30 + sym, 8);
+    } else if (sym < 256) {
+        putcode(0x190 + sym - 144, 9);
+    } else if (sym < 280) {
+        putcode(sym - 256, 7);
+    } else {
+        putcode(0xC0 + sym - 280, 8);
+    }
+}
+
+static const unsigned short lenbase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const unsigned char lenextra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const unsigned short distbase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+static const unsigned char distextra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static void deflate(const unsigned char *data, unsigned len)
+{
+    static long head[4096];
+    unsigned i = 0, k;
+    unsigned long a = 1, b = 0;
+
+    for (k = 0; k < len; ++k) {
+        a = (a + data[k]) % 65521;
+        b = (b + a) % 65521;
+    }
+    for (k = 0; k < 4096; ++k) {
+        head[k] = -1;
+    }
+
+    out[outlen++] = 0x78;
+    out[outlen++] = 0x01;
+    putbits(1, 1);                      // last block
+    putbits(1, 2);                      // fixed Huffman codes
+    while (i < len) {
+        unsigned mlen = 0, dist = 0;
+        if (i + 3 <= len) {
+            unsigned h = ((data[i] << 8) ^ (data[i + 1] << 4) ^ data[i + 2]) & 0xFFF;
+            long p = head[h];
+            if (p >= 0 && i - p <= 32768) {
+                while (i + mlen < len && mlen < 258 && data[p + mlen] == data[i + mlen]) {
+                    ++mlen;
+                }
+                dist = i - p;
+            }
+            head[h] = i;
+        }
+        if (mlen >= 3) {
+            unsigned c = 28;
+            while (lenbase[c] > mlen) {
+                --c;
+            }
+            putlit(257 + c);
+            putbits(mlen - lenbase[c], lenextra[c]);
+            c = 29;
+            while (distbase[c] > dist) {
+                --c;
+            }
+            putcode(c, 5);
+            putbits(dist - distbase[c], distextra[c]);
+            i += mlen;
+        } else {
+            putlit(data[i]);
+            ++i;
+        }
+    }
+    putlit(256);
+    flushbits();
+    out[outlen++] = (b >> 8) & 0xFF;
+    out[outlen++] = b & 0xFF;
+    out[outlen++] = (a >> 8) & 0xFF;
+    out[outlen++] = a & 0xFF;
+}
+
+static unsigned long crc(unsigned long c, const unsigned char *p, unsigned len)
+{
+    static unsigned long table[256];
+    unsigned i, j;
+
+    if (table[1] == 0) {
+        for (i = 0; i < 256; ++i) {
+            unsigned long v = i;
+            for (j = 0; j < 8; ++j) {
+                v = (v & 1) ? 0xEDB88320UL ^ (v >> 1) : v >> 1;
+            }
+            table[i] = v;
+        }
+    }
+    c ^= 0xFFFFFFFFUL;
+    while (len--) {
+        c = table[(c ^ *p++) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFUL;
+}
+
+static void chunk(FILE *f, const char *type, const unsigned char *data, unsigned len)
+{
+    putbe32(f, len);
+    fwrite(type, 1, 4, f);
+    fwrite(data, 1, len, f);
+    putbe32(f, crc(crc(0, (const unsigned char *) type, 4), data, len));
+}
+
+static int writepng(const char *path)
+{
+    static unsigned char raw[HEIGHT * (WIDTH / 2 + 1)];
+    unsigned char hdr[13];
+    FILE *f = fopen(path, "wb");
+    unsigned x, y, n = 0;
+
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    fwrite("\x89PNG\r\n\x1A\n", 1, 8, f);
+    hdr[0] = hdr[1] = hdr[4] = hdr[5] = 0;
+    hdr[2] = WIDTH >> 8;
+    hdr[3] = WIDTH & 0xFF;
+    hdr[6] = HEIGHT >> 8;
+    hdr[7] = HEIGHT & 0xFF;
+    hdr[8] = 4;                         // bit depth
+    hdr[9] = 3;                         // indexed
+    hdr[10] = hdr[11] = hdr[12] = 0;
+    chunk(f, "IHDR", hdr, sizeof(hdr));
+    chunk(f, "PLTE", pal[0], sizeof(pal));
+
+    // 4 bits per pixel, no filter
+    for (y = 0; y < HEIGHT; ++y) {
+        raw[n++] = 0;
+        for (x = 0; x < WIDTH; x += 2) {
+            raw[n++] = (pix[y][x] << 4) | pix[y][x + 1];
+        }
+    }
+    outlen = 0;
+    deflate(raw, n);
+    chunk(f, "IDAT", out, outlen);
+    chunk(f, "IEND", out, 0);
+    return fclose(f) == 0;
+}
+
+static int writegif(const char *path)
+{
+    static long key[8192];
+    static unsigned short val[8192];
+    FILE *f = fopen(path, "wb");
+    unsigned clear = COLORS, next = COLORS + 2, size = 5, prefix, i, k;
+    const unsigned char *p = pix[0];
+
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    fwrite("GIF89a", 1, 6, f);
+    put16(f, WIDTH);
+    put16(f, HEIGHT);
+    putc(0x80 | 3, f);                  // global table with 16 colors
+    putc(0, f);
+    putc(0, f);
+    fwrite(pal, 1, sizeof(pal), f);
+    putc(0x2C, f);
+    put16(f, 0);
+    put16(f, 0);
+    put16(f, WIDTH);
+    put16(f, HEIGHT);
+    putc(0, f);
+    putc(4, f);                         // minimum code size
+
+    // LZW with a hash table for the strings
+    outlen = 0;
+    for (k = 0; k < 8192; ++k) {
+        key[k] = -1;
+    }
+    putbits(clear, size);
+    prefix = p[0];
+    for (i = 1; i < WIDTH * HEIGHT; ++i) {
+        long s = ((long) prefix << 8) | p[i];
+        unsigned h = (unsigned) ((s * 40503UL) >> 4) & 8191;
+        while (key[h] != -1 && key[h] != s) {
+            h = (h + 1) & 8191;
+        }
+        if (key[h] == s) {
+            prefix = val[h];
+            continue;
+        }
+        putbits(prefix, size);
+        if (next < 4096) {
+            key[h] = s;
+            val[h] = next++;
+            if (next > (1U << size) && size < 12) {
+                ++size;
+            }
+        } else {
+            putbits(clear, size);
+            for (k = 0; k < 8192; ++k) {
+                key[k] = -1;
+            }
+            next = COLORS + 2;
+            size = 5;
+        }
+        prefix = p[i];
+    }
+    putbits(prefix, size);
+    putbits(clear + 1, size);
+    flushbits();
+
+    // data sub-blocks
+    for (i = 0; i < outlen; i += 255) {
+        unsigned n = outlen - i < 255 ? outlen - i : 255;
+        putc(n, f);
+        fwrite(out + i, 1, n, f);
+    }
+    putc(0, f);
+    putc(0x3B, f);
+    return fclose(f) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    char path[1024];
+    unsigned long count, n;
+    unsigned i;
+
+    if (argc < 3 || (count = strtoul(argv[2], NULL, 0)) == 0 || count > 9999) {
+        fprintf(stderr, "usage: %s <directory> <count (1-9999)>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    for (n = 0; n < count; ++n) {
+        for (i = 0; i < COLORS; ++i) {
+            pal[i][0] = rnd(256);
+            pal[i][1] = rnd(256);
+            pal[i][2] = rnd(256);
+        }
+        shapes();
+        sprintf(path, "%s/asset%04lu.pcx", argv[1], n);
+        if (!writepcx(path)) {
+            return EXIT_FAILURE;
+        }
+        sprintf(path, "%s/asset%04lu.png", argv[1], n);
+        if (!writepng(path)) {
+            return EXIT_FAILURE;
+        }
+        sprintf(path, "%s/asset%04lu.gif", argv[1], n);
+        if (!writegif(path)) {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
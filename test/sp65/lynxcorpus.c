@@ -0,0 +1,181 @@
+
+// generate the sample images for the sp65 Lynx sprite benchmark
+//
+// usage: lynxcorpus <directory>
+//
+// Writes a few 8 bit PCX images with different kinds of content into the
+// given directory: filled shapes on a transparent background, dithered
+// color bands, two color text, random noise as the worst case, repeating
+// tiles, and a large sheet of frames of the size of the Lynx screen.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAXWIDTH        480
+#define MAXHEIGHT       2040
+
+static unsigned char pix[MAXHEIGHT][MAXWIDTH];
+static unsigned long seed = 1;
+
+static unsigned rnd(unsigned max)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (unsigned) ((seed >> 8) % max);
+}
+
+static void put16(FILE *f, unsigned v)
+{
+    putc(v & 0xFF, f);
+    putc((v >> 8) & 0xFF, f);
+}
+
+// write pix as an RLE compressed PCX file with one 8 bit plane
+static int writepcx(const char *dir, const char *name, unsigned w, unsigned h)
+{
+    char path[1024];
+    FILE *f;
+    unsigned bpl = (w + 1) & ~1U;
+    unsigned x, y, i;
+
+    sprintf(path, "%s/%s.pcx", dir, name);
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return 0;
+    }
+    putc(10, f);                        // manufacturer
+    putc(5, f);                         // version
+    putc(1, f);                         // RLE encoding
+    putc(8, f);                         // bits per pixel
+    put16(f, 0);
+    put16(f, 0);
+    put16(f, w - 1);
+    put16(f, h - 1);
+    put16(f, 72);
+    put16(f, 72);
+    for (i = 0; i < 48 + 1; ++i) {      // EGA palette, reserved
+        putc(0, f);
+    }
+    putc(1, f);                         // planes
+    put16(f, bpl);
+    put16(f, 1);                        // color palette
+    for (i = 0; i < 58; ++i) {
+        putc(0, f);
+    }
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < bpl; ) {
+            unsigned v = x < w ? pix[y][x] : 0;
+            unsigned n = 1;
+            while (x + n < bpl && n < 63 && (x + n < w ? pix[y][x + n] : 0) == v) {
+                ++n;
+            }
+            if (n > 1 || v >= 0xC0) {
+                putc(0xC0 | n, f);
+            }
+            putc(v, f);
+            x += n;
+        }
+    }
+    putc(0x0C, f);
+    for (i = 0; i < 256 * 3; ++i) {
+        putc(i * 37 & 0xFF, f);
+    }
+    return fclose(f) == 0;
+}
+
+// filled circles and boxes in colors 1-15 on a transparent background
+static void shapes(unsigned x0, unsigned y0, unsigned w, unsigned h)
+{
+    unsigned i, x, y;
+
+    for (y = 0; y < h; ++y) {
+        memset(&pix[y0 + y][x0], 0, w);
+    }
+    for (i = 0; i < 12; ++i) {
+        unsigned c = 1 + rnd(15);
+        unsigned cx = rnd(w), cy = rnd(h), r = 4 + rnd(h / 4);
+        int box = rnd(2);
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                long dx = (long) x - cx, dy = (long) y - cy;
+                if (box ? (labs(dx) < (long) r && labs(dy) < (long) r / 2)
+                        : (dx * dx + dy * dy < (long) (r * r))) {
+                    pix[y0 + y][x0 + x] = c;
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned x, y;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    shapes(0, 0, 160, 102);
+    if (!writepcx(argv[1], "shapes", 160, 102)) {
+        return EXIT_FAILURE;
+    }
+
+    // eight color bands with an ordered dither between neighbours
+    for (y = 0; y < 102; ++y) {
+        for (x = 0; x < 160; ++x) {
+            unsigned band = y * 7 / 102, frac = (y * 7 * 4 / 102) & 3;
+            pix[y][x] = band + (((x + y) & 3) < frac);
+        }
+    }
+    if (!writepcx(argv[1], "bands", 160, 102)) {
+        return EXIT_FAILURE;
+    }
+
+    // rows of random 4x6 glyphs, one pixel apart
+    for (y = 0; y < 102; ++y) {
+        for (x = 0; x < 160; ++x) {
+            pix[y][x] = (x % 5 != 4 && y % 8 < 6) ? rnd(3) == 0 : 0;
+        }
+    }
+    if (!writepcx(argv[1], "text", 160, 102)) {
+        return EXIT_FAILURE;
+    }
+
+    for (y = 0; y < 102; ++y) {
+        for (x = 0; x < 160; ++x) {
+            pix[y][x] = rnd(16);
+        }
+    }
+    if (!writepcx(argv[1], "noise", 160, 102)) {
+        return EXIT_FAILURE;
+    }
+
+    // a four color 8x8 tile repeated over the screen
+    for (y = 0; y < 8; ++y) {
+        for (x = 0; x < 8; ++x) {
+            pix[y][x] = rnd(4);
+        }
+    }
+    for (y = 0; y < 102; ++y) {
+        for (x = 0; x < 160; ++x) {
+            pix[y][x] = pix[y % 8][x % 8];
+        }
+    }
+    if (!writepcx(argv[1], "tiles", 160, 102)) {
+        return EXIT_FAILURE;
+    }
+
+    // a sheet of 3x20 frames of shapes
+    for (y = 0; y < MAXHEIGHT; y += 102) {
+        for (x = 0; x < MAXWIDTH; x += 160) {
+            shapes(x, y, 160, 102);
+        }
+    }
+    if (!writepcx(argv[1], "sheet", MAXWIDTH, MAXHEIGHT)) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+// check that a Lynx sprite decodes to the pixels of a raw bitmap
+//
+// usage: lynxdec <sprite> <raw> <width> <bpp> literal|packed
+//
+// Decodes a sprite written by sp65 without an action point, so it has just
+// one quadrant, and compares each line with the raw data that sp65 wrote
+// for the same bitmap. Returns EXIT_FAILURE on the first difference.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static unsigned char spr[65536];
+static unsigned char raw[65536];
+
+static const unsigned char *bits;
+static unsigned bitpos, bitend;
+
+static int getbits(unsigned n, unsigned *v)
+{
+    *v = 0;
+    while (n--) {
+        if (bitpos >= bitend) {
+            return 0;
+        }
+        *v = (*v << 1) | ((bits[bitpos / 8] >> (7 - bitpos % 8)) & 1);
+        ++bitpos;
+    }
+    return 1;
+}
+
+static size_t readfile(const char *name, unsigned char *buf, size_t size)
+{
+    FILE *f = fopen(name, "rb");
+    size_t n;
+    if (f == NULL) {
+        perror(name);
+        exit(EXIT_FAILURE);
+    }
+    n = fread(buf, 1, size, f);
+    fclose(f);
+    return n;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t sprlen, rawlen, pos = 0;
+    unsigned width, bpp, y = 0;
+    int packed;
+
+    if (argc != 6 || (width = atoi(argv[3])) == 0 ||
+        (bpp = atoi(argv[4])) < 1 || bpp > 4) {
+        fprintf(stderr, "usage: %s <sprite> <raw> <width> <bpp> literal|packed\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+    packed = strcmp(argv[5], "packed") == 0;
+    sprlen = readfile(argv[1], spr, sizeof(spr));
+    rawlen = readfile(argv[2], raw, sizeof(raw));
+
+    // each line starts with the number of bytes including the count, a
+    // count of zero ends the sprite
+    while (pos < sprlen && spr[pos] != 0) {
+        const unsigned char *expect = raw + (size_t) y * width;
+        unsigned x = 0, v, n, c;
+
+        if (spr[pos] == 1 || pos + spr[pos] > sprlen ||
+            (size_t) (y + 1) * width > rawlen) {
+            fprintf(stderr, "%s: bad line %u\n", argv[1], y);
+            return EXIT_FAILURE;
+        }
+        bits = spr + pos + 1;
+        bitpos = 0;
+        bitend = (spr[pos] - 1) * 8;
+        pos += spr[pos];
+
+        while (x < width) {
+            if (!packed) {
+                if (!getbits(bpp, &c) || c != expect[x]) {
+                    break;
+                }
+                ++x;
+                continue;
+            }
+            // a literal flag and a count, then the pixels of a literal, or
+            // the pixel of a run, which has at least two pixels
+            if (!getbits(1, &v) || !getbits(4, &n) || x + n + 1 > width ||
+                (!v && n == 0)) {
+                break;
+            }
+            if (!v && !getbits(bpp, &c)) {
+                break;
+            }
+            for (++n; n > 0; --n, ++x) {
+                if ((v && !getbits(bpp, &c)) || c != expect[x]) {
+                    break;
+                }
+            }
+            if (n > 0) {
+                break;
+            }
+        }
+        if (x != width) {
+            fprintf(stderr, "%s: line %u differs at pixel %u\n", argv[1], y, x);
+            return EXIT_FAILURE;
+        }
+        ++y;
+    }
+    if (pos >= sprlen || (size_t) y * width != rawlen) {
+        fprintf(stderr, "%s: %u lines, expected %lu\n", argv[1], y,
+                (unsigned long) (rawlen / width));
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
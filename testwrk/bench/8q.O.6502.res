@@ -0,0 +1 @@
+8q O 6502 3099 11559100
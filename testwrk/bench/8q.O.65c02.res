@@ -0,0 +1 @@
+8q O 65c02 3081 11212769
@@ -0,0 +1 @@
+8q Oi 6502 3230 9899058
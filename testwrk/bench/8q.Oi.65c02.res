@@ -0,0 +1 @@
+8q Oi 65c02 3192 9687993
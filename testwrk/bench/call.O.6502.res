@@ -0,0 +1 @@
+call O 6502 3902 8348869
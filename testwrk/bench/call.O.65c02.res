@@ -0,0 +1 @@
+call O 65c02 3878 8302010
@@ -0,0 +1 @@
+call Oi 6502 3992 7707686
@@ -0,0 +1 @@
+call Oi 65c02 3961 7637654
@@ -0,0 +1 @@
+call Oirs 6502 3925 7055834
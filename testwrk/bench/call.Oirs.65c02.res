@@ -0,0 +1 @@
+call Oirs 65c02 3894 6989800
@@ -0,0 +1 @@
+call Os 6502 3859 7856942
@@ -0,0 +1 @@
+call Os 65c02 3836 7807770
@@ -0,0 +1 @@
+cmp O 6502 3774 23315534
@@ -0,0 +1 @@
+cmp O 65c02 3756 23094882
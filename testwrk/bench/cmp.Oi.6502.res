@@ -0,0 +1 @@
+cmp Oi 6502 3823 22651077
@@ -0,0 +1 @@
+cmp Oi 65c02 3803 22447081
@@ -0,0 +1 @@
+dijkstra O 6502 4337 5528596
@@ -0,0 +1 @@
+dijkstra O 65c02 4303 5517626
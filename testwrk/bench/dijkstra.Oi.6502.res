@@ -0,0 +1 @@
+dijkstra Oi 6502 4741 5435741
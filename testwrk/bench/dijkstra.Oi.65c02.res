@@ -0,0 +1 @@
+dijkstra Oi 65c02 4686 5427167
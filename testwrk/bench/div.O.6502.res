@@ -0,0 +1 @@
+div O 6502 3575 41136316
@@ -0,0 +1 @@
+div O 65c02 3551 41026293
@@ -0,0 +1 @@
+div Oi 6502 3595 40756293
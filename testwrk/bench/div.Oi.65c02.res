@@ -0,0 +1 @@
+div Oi 65c02 3570 40508245
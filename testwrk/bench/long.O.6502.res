@@ -0,0 +1 @@
+long O 6502 3351 14504408
@@ -0,0 +1 @@
+long O 65c02 3326 14406379
@@ -0,0 +1 @@
+long Oi 6502 3332 13408515
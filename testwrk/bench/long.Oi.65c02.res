@@ -0,0 +1 @@
+long Oi 65c02 3304 13280359
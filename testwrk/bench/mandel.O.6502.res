@@ -0,0 +1 @@
+mandel O 6502 3213 126210497
@@ -0,0 +1 @@
+mandel O 65c02 3193 125768037
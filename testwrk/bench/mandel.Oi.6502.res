@@ -0,0 +1 @@
+mandel Oi 6502 3304 124040728
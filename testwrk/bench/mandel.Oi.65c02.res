@@ -0,0 +1 @@
+mandel Oi 65c02 3287 123590075
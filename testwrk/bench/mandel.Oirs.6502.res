@@ -0,0 +1 @@
+mandel Oirs 6502 3292 122693759
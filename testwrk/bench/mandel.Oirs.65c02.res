@@ -0,0 +1 @@
+mandel Oirs 65c02 3275 122254377
@@ -0,0 +1 @@
+mul O 6502 3159 20075755
@@ -0,0 +1 @@
+mul O 65c02 3145 20010802
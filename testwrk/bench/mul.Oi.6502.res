@@ -0,0 +1 @@
+mul Oi 6502 3191 19738807
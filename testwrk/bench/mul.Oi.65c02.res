@@ -0,0 +1 @@
+mul Oi 65c02 3177 19666752
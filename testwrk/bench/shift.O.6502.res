@@ -0,0 +1 @@
+shift O 6502 3402 9245073
@@ -0,0 +1 @@
+shift O 65c02 3378 9183663
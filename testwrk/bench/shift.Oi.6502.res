@@ -0,0 +1 @@
+shift Oi 6502 3432 8301127
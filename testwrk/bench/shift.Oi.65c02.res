@@ -0,0 +1 @@
+shift Oi 65c02 3412 8226495
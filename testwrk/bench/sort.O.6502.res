@@ -0,0 +1 @@
+sort O 6502 3470 200378
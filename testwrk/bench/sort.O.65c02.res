@@ -0,0 +1 @@
+sort O 65c02 3453 199773
@@ -0,0 +1 @@
+sort Oi 6502 3689 200801
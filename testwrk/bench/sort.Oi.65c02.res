@@ -0,0 +1 @@
+sort Oi 65c02 3652 199220
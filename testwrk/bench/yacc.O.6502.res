@@ -0,0 +1 @@
+yacc O 6502 8591 210874
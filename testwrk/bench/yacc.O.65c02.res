@@ -0,0 +1 @@
+yacc O 65c02 8515 208390
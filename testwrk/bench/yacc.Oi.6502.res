@@ -0,0 +1 @@
+yacc Oi 6502 9106 188972
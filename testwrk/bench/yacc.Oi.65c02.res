@@ -0,0 +1 @@
+yacc Oi 65c02 8975 186467
@@ -0,0 +1 @@
+yacc Oirs 6502 8911 187048
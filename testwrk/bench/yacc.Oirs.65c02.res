@@ -0,0 +1 @@
+yacc Oirs 65c02 8780 184564
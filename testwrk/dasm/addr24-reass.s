@@ -0,0 +1,24 @@
+; da65 V2.17 - Git 8bdc099
+; Created:    2026-10-18 22:13:45
+; Input file: ../../testwrk/dasm/addr24.bin
+; Page:       1
+
+
+        .setcpu "6502"
+
+
+        .org    $8000
+
+start:  ldx     #$00
+L018002:lda     L018017,x
+        sta     $0200,x
+        inx
+        cpx     #$04
+        bne     L018002
+        jsr     L018013
+        jmp     start
+
+L018013:lda     L018017
+        rts
+
+L018017:.byte   $01,$02,$04,$08